@@ -26,6 +26,9 @@
 #ifdef HAVE_SYS_STAT_H
 #include <sys/stat.h>
 #endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
 
 #include <math.h>
 #ifdef HAVE_MEMORY_H
@@ -41,6 +44,8 @@
 #include <unistd.h>
 #endif
 
+#include <glib/gstdio.h>
+
 #include <libxfce4util/libxfce4util.h>
 
 #include <engines/balou/balou-theme.h>
@@ -58,6 +63,38 @@ static time_t mtime (const gchar *path);
 static GdkPixbuf *load_cached_preview (const BalouTheme *theme);
 static void store_cached_preview (const BalouTheme *theme,
                                   GdkPixbuf        *pixbuf);
+static gchar *cached_background_file (const BalouTheme *theme,
+                                      GdkImage         *image,
+                                      gint              logo_height,
+                                      gboolean          draw_logo,
+                                      gboolean          create);
+static gboolean load_cached_background (const BalouTheme *theme,
+                                        GdkImage         *image,
+                                        gint              logo_height,
+                                        gboolean          draw_logo);
+static void store_cached_background (const BalouTheme *theme,
+                                     GdkImage         *image,
+                                     gint              logo_height,
+                                     gboolean          draw_logo);
+
+
+/* header of a cached background, followed by the image rows in the
+ * format of the X server */
+typedef struct
+{
+  guint32 magic;
+  guint32 width;
+  guint32 height;
+  guint32 bpl;
+  guint32 depth;
+  guint32 bpp;
+  guint32 byte_order;
+  guint32 red_mask;
+  guint32 green_mask;
+  guint32 blue_mask;
+} BackgroundHeader;
+
+#define BACKGROUND_MAGIC 0x47425842 /* "BXBG" */
 
 
 struct _BalouTheme
@@ -246,6 +283,139 @@ balou_theme_draw_gradient (const BalouTheme *theme,
 }
 
 
+/* renders gradient and logo on the client into @image */
+static void
+render_background (const BalouTheme *theme,
+                   GdkImage         *image,
+                   gint              logo_height,
+                   gboolean          draw_logo)
+{
+  GdkVisual *visual = image->visual;
+  GdkPixbuf *pixbuf;
+  GdkPixbuf *logo;
+  guint32    pixel;
+  guchar    *row;
+  guchar    *p;
+  gint       rowstride;
+  gint       red, green, blue;
+  gint       pw, ph;
+  gint       x, y;
+
+  pixbuf = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, image->width, image->height);
+  rowstride = gdk_pixbuf_get_rowstride (pixbuf);
+
+  for (y = 0; y < image->height; ++y)
+    {
+      if (y < logo_height)
+        {
+          red = theme->bgcolor2.red + (y * (theme->bgcolor1.red - theme->bgcolor2.red) / logo_height);
+          green = theme->bgcolor2.green + (y * (theme->bgcolor1.green - theme->bgcolor2.green) / logo_height);
+          blue = theme->bgcolor2.blue + (y * (theme->bgcolor1.blue - theme->bgcolor2.blue) / logo_height);
+        }
+      else
+        {
+          red = theme->bgcolor1.red;
+          green = theme->bgcolor1.green;
+          blue = theme->bgcolor1.blue;
+        }
+
+      row = gdk_pixbuf_get_pixels (pixbuf) + y * rowstride;
+      for (x = 0, p = row; x < image->width; ++x, p += 3)
+        {
+          p[0] = red >> 8;
+          p[1] = green >> 8;
+          p[2] = blue >> 8;
+        }
+    }
+
+  logo = draw_logo ? balou_theme_get_logo (theme, image->width, logo_height) : NULL;
+  if (logo != NULL)
+    {
+      pw = gdk_pixbuf_get_width (logo);
+      ph = gdk_pixbuf_get_height (logo);
+      x = (image->width - pw) / 2;
+      y = (logo_height - ph) / 2;
+
+      gdk_pixbuf_composite (logo, pixbuf, x, y, pw, ph, x, y,
+                            1.0, 1.0, GDK_INTERP_NEAREST, 255);
+      g_object_unref (logo);
+    }
+
+  /* convert to the pixel format of the true color visual */
+  for (y = 0; y < image->height; ++y)
+    {
+      row = gdk_pixbuf_get_pixels (pixbuf) + y * rowstride;
+      for (x = 0, p = row; x < image->width; ++x, p += 3)
+        {
+          pixel = (((p[0] * 257) >> (16 - visual->red_prec)) << visual->red_shift)
+                | (((p[1] * 257) >> (16 - visual->green_prec)) << visual->green_shift)
+                | (((p[2] * 257) >> (16 - visual->blue_prec)) << visual->blue_shift);
+          gdk_image_put_pixel (image, x, y, pixel);
+        }
+    }
+
+  g_object_unref (pixbuf);
+}
+
+
+/* draws the gradient, the textbox background and optionally the
+ * centered logo. the result is cached per theme and geometry in the
+ * format of the X server, so a login only reads it back and sends it
+ * with one (shared memory) PutImage */
+void
+balou_theme_draw_background (const BalouTheme *theme,
+                             GdkDrawable      *drawable,
+                             GdkGC            *gc,
+                             GdkRectangle      logobox,
+                             GdkRectangle      textbox,
+                             gboolean          draw_logo)
+{
+  GdkColormap *cmap;
+  GdkVisual   *visual;
+  GdkImage    *image = NULL;
+  GdkPixbuf   *pb;
+  gint         width = logobox.width;
+  gint         height = logobox.height + textbox.height;
+  gint         pw, ph;
+
+  cmap = gdk_drawable_get_colormap (drawable);
+  visual = cmap != NULL ? gdk_colormap_get_visual (cmap) : NULL;
+
+  if (visual != NULL && visual->type == GDK_VISUAL_TRUE_COLOR
+      && width > 0 && height > 0)
+    image = gdk_image_new (GDK_IMAGE_FASTEST, visual, width, height);
+
+  if (image != NULL)
+    {
+      if (!load_cached_background (theme, image, logobox.height, draw_logo))
+        {
+          render_background (theme, image, logobox.height, draw_logo);
+          store_cached_background (theme, image, logobox.height, draw_logo);
+        }
+
+      gdk_draw_image (drawable, gc, image, 0, 0, logobox.x, logobox.y, width, height);
+      g_object_unref (image);
+      return;
+    }
+
+  /* no usable visual, draw on the server */
+  balou_theme_draw_gradient (theme, drawable, gc, logobox, textbox);
+
+  pb = draw_logo ? balou_theme_get_logo (theme, logobox.width, logobox.height) : NULL;
+  if (pb != NULL)
+    {
+      pw = gdk_pixbuf_get_width (pb);
+      ph = gdk_pixbuf_get_height (pb);
+
+      gdk_draw_pixbuf (drawable, gc, pb, 0, 0,
+                       logobox.x + (logobox.width - pw) / 2,
+                       logobox.y + (logobox.height - ph) / 2,
+                       pw, ph, GDK_RGB_DITHER_NONE, 0, 0);
+      g_object_unref (pb);
+    }
+}
+
+
 GdkPixbuf*
 balou_theme_generate_preview (const BalouTheme *theme,
                               gint              width,
@@ -516,4 +686,133 @@ store_cached_preview (const BalouTheme *theme,
 }
 
 
+static gchar*
+cached_background_file (const BalouTheme *theme,
+                        GdkImage         *image,
+                        gint              logo_height,
+                        gboolean          draw_logo,
+                        gboolean          create)
+{
+  gchar *resource;
+  gchar *file;
+
+  /* the built-in defaults are cheap to render */
+  if (theme->theme_file == NULL || theme->name == NULL)
+    return NULL;
+
+  resource = g_strdup_printf ("splash-theme-background-%s-%dx%d-%d%s.raw",
+                              theme->name, image->width, image->height,
+                              logo_height, draw_logo ? "-logo" : "");
+  if (create)
+    file = xfce_resource_save_location (XFCE_RESOURCE_CACHE, resource, TRUE);
+  else
+    file = xfce_resource_lookup (XFCE_RESOURCE_CACHE, resource);
+  g_free (resource);
+
+  return file;
+}
+
+
+static gboolean
+load_cached_background (const BalouTheme *theme,
+                        GdkImage         *image,
+                        gint              logo_height,
+                        gboolean          draw_logo)
+{
+  BackgroundHeader header;
+  gboolean         succeed = FALSE;
+  gchar           *file;
+  gchar           *p;
+  gssize           n;
+  gsize            left;
+  gint             fd;
+
+  file = cached_background_file (theme, image, logo_height, draw_logo, FALSE);
+  if (file == NULL)
+    return FALSE;
+
+  if ((mtime (file) < mtime (theme->theme_file))
+      || (draw_logo && theme->logo_file != NULL
+        && (mtime (file) < mtime (theme->logo_file))))
+    {
+      /* background is outdated */
+      unlink (file);
+      g_free (file);
+
+      return FALSE;
+    }
+
+  fd = g_open (file, O_RDONLY, 0);
+  g_free (file);
+
+  if (fd < 0)
+    return FALSE;
+
+  if (read (fd, &header, sizeof (header)) == sizeof (header)
+      && header.magic == BACKGROUND_MAGIC
+      && header.width == (guint32) image->width
+      && header.height == (guint32) image->height
+      && header.bpl == image->bpl
+      && header.depth == (guint32) image->depth
+      && header.bpp == image->bpp
+      && header.byte_order == (guint32) image->byte_order
+      && header.red_mask == image->visual->red_mask
+      && header.green_mask == image->visual->green_mask
+      && header.blue_mask == image->visual->blue_mask)
+    {
+      /* straight into the (shared) image memory */
+      p = image->mem;
+      for (left = (gsize) image->bpl * image->height; left > 0; left -= n, p += n)
+        {
+          n = read (fd, p, left);
+          if (n <= 0)
+            break;
+        }
+
+      succeed = (left == 0);
+    }
+
+  close (fd);
+
+  return succeed;
+}
+
+
+static void
+store_cached_background (const BalouTheme *theme,
+                         GdkImage         *image,
+                         gint              logo_height,
+                         gboolean          draw_logo)
+{
+  BackgroundHeader header;
+  gchar           *contents;
+  gchar           *file;
+  gsize            size;
+
+  file = cached_background_file (theme, image, logo_height, draw_logo, TRUE);
+  if (file == NULL)
+    return;
+
+  header.magic = BACKGROUND_MAGIC;
+  header.width = image->width;
+  header.height = image->height;
+  header.bpl = image->bpl;
+  header.depth = image->depth;
+  header.bpp = image->bpp;
+  header.byte_order = image->byte_order;
+  header.red_mask = image->visual->red_mask;
+  header.green_mask = image->visual->green_mask;
+  header.blue_mask = image->visual->blue_mask;
+
+  size = (gsize) image->bpl * image->height;
+  contents = g_malloc (sizeof (header) + size);
+  memcpy (contents, &header, sizeof (header));
+  memcpy (contents + sizeof (header), image->mem, size);
+
+  g_file_set_contents (file, contents, sizeof (header) + size, NULL);
+
+  g_free (contents);
+  g_free (file);
+}
+
 
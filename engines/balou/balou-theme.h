@@ -46,6 +46,12 @@ void         balou_theme_draw_gradient    (const BalouTheme *theme,
                                            GdkGC            *gc,
                                            GdkRectangle      logobox,
                                            GdkRectangle      textbox);
+void         balou_theme_draw_background  (const BalouTheme *theme,
+                                           GdkDrawable      *drawable,
+                                           GdkGC            *gc,
+                                           GdkRectangle      logobox,
+                                           GdkRectangle      textbox,
+                                           gboolean          draw_logo);
 GdkPixbuf   *balou_theme_generate_preview (const BalouTheme *theme,
                                            gint              width,
                                            gint              height);
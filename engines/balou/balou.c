@@ -30,9 +30,16 @@
 
 #define BALOU_INCREMENT   2
 
+/* duration of a fade and the frame interval, in milliseconds */
+#define BALOU_FADE_TIME   300
+#define BALOU_FRAME_TIME  16
 
 
 
+
+static void            balou_fadein          (Balou        *balou,
+                                              const gchar  *text);
+static void            balou_fadeout         (Balou        *balou);
 static void            balou_window_init     (BalouWindow  *window,
                                               GdkScreen    *screen,
                                               int           monitor,
@@ -82,7 +89,6 @@ balou_init (Balou        *balou,
   GdkCursor            *cursor;
   GdkScreen            *screen;
   GdkWindow            *root;
-  GdkPixbuf            *pb;
   GdkGCValues           gc_values;
   GdkGCValuesMask       gc_mask;
   GdkGC                *gc_copy;
@@ -93,12 +99,10 @@ balou_init (Balou        *balou,
   gint                  i;
   gint                  n;
   gint                  m;
-  gint                  px;
-  gint                  py;
-  gint                  pw;
-  gint                  ph;
 
   balou->theme = theme;
+  balou->phase = BALOU_IDLE;
+  balou->phase_timer = g_timer_new ();
 
   balou_theme_get_bgcolor (theme, &balou->bgcolor);
   balou_theme_get_fgcolor (theme, &balou->fgcolor);
@@ -167,17 +171,19 @@ balou_init (Balou        *balou,
           window->textbox.y      += window->logobox.height;
           window->textbox.height -= window->logobox.height;
 
-          balou_theme_draw_gradient (balou->theme,
-                                     window->backbuf,
-                                     gc_copy,
-                                     window->logobox,
-                                     window->textbox);
-
-          gdk_gc_set_rgb_fg_color (gc_copy, &balou->fgcolor);
-
           if (mainscreen == screen && mainmonitor == m)
             balou->mainwin = window;
 
+          /* the logo is only shown on the main window */
+          balou_theme_draw_background (balou->theme,
+                                       window->backbuf,
+                                       gc_copy,
+                                       window->logobox,
+                                       window->textbox,
+                                       window == balou->mainwin);
+
+          gdk_gc_set_rgb_fg_color (gc_copy, &balou->fgcolor);
+
           ++i;
         }
 
@@ -206,25 +212,8 @@ balou_init (Balou        *balou,
     }
   gdk_flush ();
 
-  /* display logo pixbuf (if any) */
-  window = balou->mainwin;
-  pb = balou_theme_get_logo (balou->theme,
-                             window->logobox.width,
-                             window->logobox.height);
-  if (G_LIKELY (pb != NULL))
-    {
-      pw = gdk_pixbuf_get_width (pb);
-      ph = gdk_pixbuf_get_height (pb);
-      px = (window->logobox.width - pw) / 2;
-      py = (window->logobox.height - ph) / 2;
-
-      gdk_draw_pixbuf (window->backbuf, window->gc_copy, pb, 0, 0,
-                       px, py, pw, ph, GDK_RGB_DITHER_NONE, 0, 0);
-      gdk_window_clear_area (window->window, px, py, pw, ph);
-      g_object_unref (pb);
-    }
-
   /* create fader pixmap */
+  window = balou->mainwin;
   balou->fader_pm = gdk_pixmap_new (window->window,
                                     window->textbox.width,
                                     window->textbox.height,
@@ -237,7 +226,137 @@ balou_init (Balou        *balou,
 }
 
 
-void
+/* moves the text to @x in the back buffer and only copies the part of
+ * the textbox that changed to the window */
+static void
+balou_move_text (Balou *balou,
+                 gint   x)
+{
+  BalouWindow *window = balou->mainwin;
+  GdkRectangle old = balou->fader_area;
+  GdkRectangle area = balou->fader_area;
+  GdkRectangle damage;
+  GdkRectangle clip;
+
+  area.x = x;
+
+  if (gdk_rectangle_intersect (&old, &window->textbox, &clip))
+    {
+      gdk_draw_rectangle (window->backbuf, window->gc_set, TRUE,
+                          clip.x, clip.y, clip.width, clip.height);
+    }
+
+  if (gdk_rectangle_intersect (&area, &window->textbox, &clip))
+    {
+      gdk_draw_drawable (window->backbuf, window->gc_copy, balou->fader_pm,
+                         clip.x - area.x, clip.y - area.y, clip.x, clip.y,
+                         clip.width, clip.height);
+    }
+
+  if (old.width > 0)
+    gdk_rectangle_union (&old, &area, &damage);
+  else
+    damage = area;
+  if (gdk_rectangle_intersect (&damage, &window->textbox, &damage))
+    {
+      gdk_window_clear_area (window->window, damage.x, damage.y,
+                             damage.width, damage.height);
+    }
+
+  balou->fader_area = area;
+}
+
+
+static void
+balou_clear_text (Balou *balou)
+{
+  BalouWindow *window = balou->mainwin;
+
+  gdk_draw_rectangle (window->backbuf,
+                      window->gc_set, TRUE,
+                      window->textbox.x,
+                      window->textbox.y,
+                      window->textbox.width,
+                      window->textbox.height);
+
+  gdk_window_clear_area (window->window,
+                         window->textbox.x,
+                         window->textbox.y,
+                         window->textbox.width,
+                         window->textbox.height);
+
+  balou->fader_area.width = 0;
+}
+
+
+static gboolean
+balou_frame (gpointer data)
+{
+  Balou   *balou = BALOU (data);
+  gchar   *text;
+  gdouble  progress;
+
+  /* the position follows the clock, a late frame skips ahead instead
+   * of slowing the animation down */
+  progress = g_timer_elapsed (balou->phase_timer, NULL) * 1000.0 / BALOU_FADE_TIME;
+  progress = MIN (progress, 1.0);
+
+  balou_move_text (balou, balou->phase_from
+                   + (balou->phase_to - balou->phase_from) * progress);
+  gdk_display_flush (gdk_drawable_get_display (balou->mainwin->window));
+
+  if (progress < 1.0)
+    return TRUE;
+
+  if (balou->phase == BALOU_FADEOUT)
+    {
+      balou_clear_text (balou);
+
+      if (balou->next_text != NULL)
+        {
+          text = balou->next_text;
+          balou->next_text = NULL;
+          balou_fadein (balou, text);
+          g_free (text);
+          return TRUE;
+        }
+    }
+  else if (balou->next_text != NULL)
+    {
+      balou_fadeout (balou);
+      return TRUE;
+    }
+
+  balou->phase = BALOU_IDLE;
+  balou->frame_id = 0;
+
+  return FALSE;
+}
+
+
+static void
+balou_start_phase (Balou     *balou,
+                   BalouPhase phase,
+                   gint       from,
+                   gint       to)
+{
+  balou->phase = phase;
+  balou->phase_from = from;
+  balou->phase_to = to;
+  g_timer_start (balou->phase_timer);
+
+  /* below the priority of the ICE and D-Bus sources, so clients are
+   * always served before the next frame */
+  if (balou->frame_id == 0)
+    {
+      balou->frame_id = g_timeout_add_full (G_PRIORITY_DEFAULT_IDLE,
+                                            BALOU_FRAME_TIME,
+                                            balou_frame, balou, NULL);
+    }
+}
+
+
+static void
 balou_fadein (Balou *balou, const gchar *text)
 {
   BalouWindow *window = balou->mainwin;
@@ -245,7 +364,6 @@ balou_fadein (Balou *balou, const gchar *text)
   gint         median;
   gint         th;
   gint         tw;
-  gint         x;
 
   pango_layout_set_text (window->layout, text, -1);
   pango_layout_get_pixel_size (window->layout, &tw, &th);
@@ -261,67 +379,54 @@ balou_fadein (Balou *balou, const gchar *text)
                    BALOU_INCREMENT, 0, window->layout);
 
   median = (window->area.width - area.width) / 2;
-  for (x = 0; (median - x) > BALOU_INCREMENT; x += BALOU_INCREMENT)
-    {
-      gdk_draw_drawable (window->window, window->gc_copy, balou->fader_pm,
-                         0, 0, area.x + x, area.y, area.width, area.height);
-
-      gdk_flush ();
-
-      g_main_context_iteration (NULL, FALSE);
-    }
-
-  area.x += median;
   balou->fader_area = area;
 
-  gdk_draw_rectangle (window->backbuf,
-                      window->gc_set, TRUE,
-                      window->textbox.x,
-                      window->textbox.y,
-                      window->textbox.width,
-                      window->textbox.height);
+  balou_start_phase (balou, BALOU_FADEIN, area.x, area.x + median);
+}
 
-  gdk_draw_drawable (window->backbuf, window->gc_copy, balou->fader_pm,
-                     0, 0, area.x, area.y, area.width, area.height);
 
-  gdk_window_clear_area (window->window,
-                         window->textbox.x,
-                         window->textbox.y,
-                         window->textbox.width,
-                         window->textbox.height);
+static void
+balou_fadeout (Balou *balou)
+{
+  BalouWindow *window = balou->mainwin;
+
+  balou_start_phase (balou, BALOU_FADEOUT, balou->fader_area.x,
+                     window->textbox.x + window->textbox.width);
 }
 
 
+/* shows @text, the call never waits for the animation, a text that is
+ * replaced before it was shown is skipped */
 void
-balou_fadeout (Balou *balou)
+balou_next (Balou *balou, const gchar *text)
 {
-  BalouWindow *window = balou->mainwin;
-  GdkRectangle area = balou->fader_area;
-  gint         left;
+  g_free (balou->next_text);
+  balou->next_text = g_strdup (text);
 
-  left = (window->textbox.x + window->textbox.width) - BALOU_INCREMENT;
-  for (; area.x < left; area.x += BALOU_INCREMENT)
+  switch (balou->phase)
     {
-      gdk_draw_drawable (window->window, window->gc_copy, balou->fader_pm,
-                         0, 0, area.x, area.y, area.width, area.height);
+    case BALOU_IDLE:
+      if (balou->fader_area.width > 0)
+        {
+          balou_fadeout (balou);
+        }
+      else
+        {
+          balou_fadein (balou, balou->next_text);
+          g_free (balou->next_text);
+          balou->next_text = NULL;
+        }
+      break;
 
-      gdk_flush ();
+    case BALOU_FADEIN:
+      /* turn around where the text currently is */
+      balou_fadeout (balou);
+      break;
 
-      g_main_context_iteration (NULL, FALSE);
+    case BALOU_FADEOUT:
+      /* picked up once the old text is gone */
+      break;
     }
-
-  gdk_draw_rectangle (window->backbuf,
-                      window->gc_set, TRUE,
-                      window->textbox.x,
-                      window->textbox.y,
-                      window->textbox.width,
-                      window->textbox.height);
-
-  gdk_window_clear_area (window->window,
-                         window->textbox.x,
-                         window->textbox.y,
-                         window->textbox.width,
-                         window->textbox.height);
 }
 
 
@@ -354,6 +459,12 @@ balou_destroy (Balou *balou)
 {
   gint i;
 
+  if (balou->frame_id != 0)
+    g_source_remove (balou->frame_id);
+  if (balou->phase_timer != NULL)
+    g_timer_destroy (balou->phase_timer);
+  g_free (balou->next_text);
+
   balou_theme_destroy (balou->theme);
 
   for (i = 0; i < balou->nwindows; ++i)
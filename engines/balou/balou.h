@@ -34,6 +34,13 @@ G_BEGIN_DECLS;
 typedef struct _BalouWindow BalouWindow;
 typedef struct _Balou       Balou;
 
+typedef enum
+{
+  BALOU_IDLE,
+  BALOU_FADEIN,
+  BALOU_FADEOUT,
+} BalouPhase;
+
 
 struct _Balou
 {
@@ -48,6 +55,14 @@ struct _Balou
 
   GdkRectangle   fader_area;
   GdkPixmap     *fader_pm;
+
+  /* text animation, driven by the frame timer */
+  BalouPhase     phase;
+  GTimer        *phase_timer;
+  gint           phase_from;
+  gint           phase_to;
+  guint          frame_id;
+  gchar         *next_text;
 };
 
 
@@ -56,9 +71,8 @@ void  balou_init      (Balou        *balou,
                        GdkScreen    *mainscreen,
                        gint          mainmonitor,
                        BalouTheme   *theme);
-void  balou_fadein    (Balou        *balou,
+void  balou_next      (Balou        *balou,
                        const gchar  *text);
-void  balou_fadeout   (Balou        *balou);
 int   balou_run       (Balou        *balou,
                        GtkWidget    *dialog);
 void  balou_destroy   (Balou *balou);
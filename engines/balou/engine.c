@@ -61,8 +61,7 @@ engine_next (XfsmSplashEngine *engine,
 {
   Balou *balou = BALOU (engine->user_data);
 
-  balou_fadeout (balou);
-  balou_fadein (balou, text);
+  balou_next (balou, text);
 }
 
 
@@ -28,10 +28,15 @@
 #include <stdlib.h>
 #endif
 
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
 #include <limits.h>
 #include <errno.h>
 
 #include <gtk/gtk.h>
+#include <gdk-pixbuf/gdk-pixdata.h>
 
 
 static GdkPixbuf*
@@ -62,13 +67,67 @@ create_slide (GdkPixbuf *base, int steps)
       gdk_pixbuf_copy_area (base, 0, 0, bw, bh,
                             result, i * bw, 0);
 
-      for (x = 0; x < bw; ++x)
+      /* walk rows so the inner loop runs over contiguous memory */
+      for (y = 0; y < bh; ++y)
+        {
+          p = pixels + y * rowstride + i * bw * n_channels;
+          for (x = 0; x < bw; ++x, p += n_channels)
+            p[3] = ((i + 1) * p[3]) / (steps + 1);
+        }
+    }
+
+  return result;
+}
+
+
+/* Composite the slide over the engine background color, so the splash
+ * can upload opaque RGB frames to the X server without doing any alpha
+ * blending at login time. The rows are plain arrays of bytes and the
+ * division by 255 is done with shifts, which lets the compiler
+ * vectorize the inner loop. */
+static GdkPixbuf*
+create_atlas (GdkPixbuf *slide, const GdkColor *color)
+{
+  GdkPixbuf    *result;
+  const guchar *src_pixels, *s;
+  guchar       *dst_pixels, *d;
+  int           src_rowstride;
+  int           dst_rowstride;
+  int           width, height;
+  int           x, y;
+  guint         bg[3];
+  guint         a, t;
+
+  g_return_val_if_fail (gdk_pixbuf_get_has_alpha (slide), NULL);
+
+  width = gdk_pixbuf_get_width (slide);
+  height = gdk_pixbuf_get_height (slide);
+
+  result = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, width, height);
+  src_rowstride = gdk_pixbuf_get_rowstride (slide);
+  dst_rowstride = gdk_pixbuf_get_rowstride (result);
+  src_pixels = gdk_pixbuf_get_pixels (slide);
+  dst_pixels = gdk_pixbuf_get_pixels (result);
+
+  bg[0] = color->red >> 8;
+  bg[1] = color->green >> 8;
+  bg[2] = color->blue >> 8;
+
+  for (y = 0; y < height; ++y)
+    {
+      s = src_pixels + y * src_rowstride;
+      d = dst_pixels + y * dst_rowstride;
+
+      for (x = 0; x < width; ++x, s += 4, d += 3)
         {
-          for (y = 0; y < bh; ++y)
-            {
-              p = pixels + y * rowstride + (i * bw + x) * n_channels;
-              p[3] = ((i + 1) * p[3]) / (steps + 1);
-            }
+          a = s[3];
+
+          t = s[0] * a + bg[0] * (255 - a) + 128;
+          d[0] = (t + (t >> 8)) >> 8;
+          t = s[1] * a + bg[1] * (255 - a) + 128;
+          d[1] = (t + (t >> 8)) >> 8;
+          t = s[2] * a + bg[2] * (255 - a) + 128;
+          d[2] = (t + (t >> 8)) >> 8;
         }
     }
 
@@ -76,6 +135,53 @@ create_slide (GdkPixbuf *base, int steps)
 }
 
 
+static int
+write_atlas (const gchar *filename, int steps, const gchar *color_spec)
+{
+  GdkPixbuf *slide;
+  GdkPixbuf *atlas;
+  GdkPixdata pixdata;
+  GdkColor   color;
+  GString   *csource;
+  gpointer   pixels;
+
+  if (steps <= 0 || !gdk_color_parse (color_spec, &color))
+    {
+      fprintf (stderr, "generate: Invalid atlas parameters\n");
+      return EXIT_FAILURE;
+    }
+
+  slide = gdk_pixbuf_new_from_file (filename, NULL);
+  if (slide == NULL || !gdk_pixbuf_get_has_alpha (slide)
+      || gdk_pixbuf_get_width (slide) % steps != 0)
+    {
+      fprintf (stderr, "generate: Unable to use %s as slide\n", filename);
+      return EXIT_FAILURE;
+    }
+
+  atlas = create_atlas (slide, &color);
+
+  pixels = gdk_pixdata_from_pixbuf (&pixdata, atlas, TRUE);
+  csource = gdk_pixdata_to_csource (&pixdata, "slide",
+                                    GDK_PIXDATA_DUMP_PIXDATA_STREAM
+                                    | GDK_PIXDATA_DUMP_STATIC);
+
+  printf ("/* mice sprite atlas, generated by generate --atlas */\n\n");
+  printf ("#define SLIDE_STEPS  %d\n", steps);
+  printf ("#define SLIDE_WIDTH  %d\n", gdk_pixbuf_get_width (atlas) / steps);
+  printf ("#define SLIDE_HEIGHT %d\n", gdk_pixbuf_get_height (atlas));
+  printf ("#define SLIDE_COLOR  \"%s\"\n\n", color_spec);
+  fputs (csource->str, stdout);
+
+  g_string_free (csource, TRUE);
+  g_free (pixels);
+  g_object_unref (atlas);
+  g_object_unref (slide);
+
+  return EXIT_SUCCESS;
+}
+
+
 int main (int argc, char **argv)
 {
   GdkPixbuf *base;
@@ -84,9 +190,13 @@ int main (int argc, char **argv)
 
   gtk_init (&argc, &argv);
 
+  if (argc == 5 && strcmp (argv[1], "--atlas") == 0)
+    return write_atlas (argv[2], atoi (argv[3]), argv[4]);
+
   if (argc != 3)
     {
-      fprintf (stderr, "Usage: generate <file> <steps>\n");
+      fprintf (stderr, "Usage: generate <file> <steps>\n"
+                       "       generate --atlas <slide> <steps> <color>\n");
       return EXIT_FAILURE;
     }
 
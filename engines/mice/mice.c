@@ -26,8 +26,11 @@
 #include <X11/Xlib.h>
 
 #include <gdk-pixbuf/gdk-pixdata.h>
+#include <gdk/gdkx.h>
 #include <gmodule.h>
 
+#include <libxfce4util/libxfce4util.h>
+
 #include <libxfsm/xfsm-splash-engine.h>
 
 #include <engines/mice/preview.h>
@@ -35,8 +38,6 @@
 
 
 #define BORDER  2
-#define COLOR   "#DAE7FE"
-#define STEPS   8
 
 
 #define MICE_WINDOW(obj)  ((MiceWindow *)(obj))
@@ -61,6 +62,7 @@ struct _MiceWindow
 struct _Mice
 {
   gboolean     dialog_active;
+  GdkDisplay  *display;
   GList       *windows;
   MiceWindow  *mainwin;
   int          base_width;
@@ -68,6 +70,11 @@ struct _Mice
   int          step;
   int          direction;
   guint        timeout_id;
+
+  /* X request accounting, reported on destroy */
+  GTimer      *timer;
+  gulong       requests_start;
+  gulong       requests_anim;
 };
 
 
@@ -146,12 +153,19 @@ mice_step (Mice *mice)
 {
   MiceWindow *mice_window;
   GList      *lp;
+  Display    *dpy;
+  gulong      serial;
   int         sx;
   int         sy;
 
+  dpy = GDK_DISPLAY_XDISPLAY (mice->display);
+  serial = XNextRequest (dpy);
+
   sx = mice->step * mice->base_width;
   sy = 0;
 
+  /* one CopyArea per monitor window from the shared screen pixmap,
+   * sent to the server as a single batch */
   for (lp = mice->windows; lp != NULL; lp = lp->next)
     {
       mice_window = MICE_WINDOW (lp->data);
@@ -165,12 +179,15 @@ mice_step (Mice *mice)
                          mice->base_height);
     }
 
+  gdk_display_flush (mice->display);
+  mice->requests_anim += XNextRequest (dpy) - serial;
+
   if (mice->step == 0 && mice->direction < 0)
     {
       mice->step++;
       mice->direction = 1;
     }
-  else if (mice->step == STEPS - 1 && mice->direction > 0)
+  else if (mice->step == SLIDE_STEPS - 1 && mice->direction > 0)
     {
       mice->step--;
       mice->direction = -1;
@@ -205,6 +222,7 @@ mice_setup (XfsmSplashEngine *engine,
   GdkPixmap    *pixmap;
   GdkPixbuf    *pixbuf;
   GdkColor      color;
+  Display      *dpy;
   GdkCursor    *cursor;
   GdkScreen    *screen;
   GdkGC        *gc;
@@ -215,16 +233,22 @@ mice_setup (XfsmSplashEngine *engine,
   int           nmonitors;
   int           n, m;
 
-  gdk_color_parse (COLOR, &color);
+  mice->display = engine->display;
+  mice->timer = g_timer_new ();
+  dpy = GDK_DISPLAY_XDISPLAY (engine->display);
+  mice->requests_start = XNextRequest (dpy);
+
+  gdk_color_parse (SLIDE_COLOR, &color);
   cursor = gdk_cursor_new (GDK_WATCH);
 
-  /* load slide pixbuf */
+  /* load the sprite atlas, already composited over SLIDE_COLOR at
+   * build time */
   pixbuf = gdk_pixbuf_new_from_inline (-1, slide, FALSE, NULL);
   pw = gdk_pixbuf_get_width (pixbuf);
   ph = gdk_pixbuf_get_height (pixbuf);
 
-  mice->base_width = pw / STEPS;
-  mice->base_height = ph;
+  mice->base_width = SLIDE_WIDTH;
+  mice->base_height = SLIDE_HEIGHT;
   mice->step = 0;
   mice->direction = 1;
 
@@ -246,9 +270,9 @@ mice_setup (XfsmSplashEngine *engine,
       gc = gdk_gc_new_with_values (root, &gc_values, GDK_GC_FUNCTION
                                   | GDK_GC_EXPOSURES | GDK_GC_FOREGROUND);
 
-      /* create pixmap for this screen */
+      /* upload the atlas once per screen, all monitor windows on
+       * this screen copy their frames from the same pixmap */
       pixmap = gdk_pixmap_new (root, pw, ph, -1);
-      gdk_draw_rectangle (pixmap, gc, TRUE, 0, 0, pw, ph);
       gdk_draw_pixbuf (pixmap, gc, pixbuf, 0, 0, 0, 0,
                        pw, ph, GDK_RGB_DITHER_NONE, 0, 0);
 
@@ -327,11 +351,21 @@ mice_destroy (XfsmSplashEngine *engine)
   MiceWindow *mice_window;
   Mice       *mice = MICE (engine->user_data);
   GList      *lp;
+  gdouble     elapsed;
+  gulong      requests;
+
+  elapsed = g_timer_elapsed (mice->timer, NULL);
+  requests = XNextRequest (GDK_DISPLAY_XDISPLAY (mice->display))
+             - mice->requests_start;
+  DBG ("%lu X requests in %.1fs (%.1f/s), %lu for the animation (%.1f/s)",
+       requests, elapsed, requests / MAX (elapsed, 0.001),
+       mice->requests_anim, mice->requests_anim / MAX (elapsed, 0.001));
+  g_timer_destroy (mice->timer);
 
   for (lp = mice->windows; lp != NULL; lp = lp->next)
     {
       mice_window = MICE_WINDOW (lp->data);
-      gdk_window_remove_filter (mice_window->window, mice_filter, mice);
+      gdk_window_remove_filter (mice_window->window, mice_filter, mice_window);
       gdk_window_destroy (mice_window->window);
       g_object_unref (mice_window->pixmap);
       g_object_unref (mice_window->gc);
@@ -1,4 +1,11 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
+/* mice sprite atlas, generated by generate --atlas */
+
+#define SLIDE_STEPS  8
+#define SLIDE_WIDTH  100
+#define SLIDE_HEIGHT 52
+#define SLIDE_COLOR  "#DAE7FE"
+
+/* GdkPixbuf RGB C-Source image dump 1-byte-run-length-encoded */
 
 #ifdef __SUNPRO_C
 #pragma align 4 (slide)
@@ -11,850 +18,943 @@ static const guint8 slide[] =
 { ""
   /* Pixbuf magic (0x47646b50) */
   "GdkP"
-  /* length: header (24) + pixel_data (25824) */
-  "\0\0d\370"
-  /* pixdata_type (0x2010002) */
-  "\2\1\0\2"
-  /* rowstride (3200) */
-  "\0\0\14\200"
+  /* length: header (24) + pixel_data (19347) */
+  "\0\0K\253"
+  /* pixdata_type (0x2010001) */
+  "\2\1\0\1"
+  /* rowstride (2400) */
+  "\0\0\11`"
   /* width (800) */
   "\0\0\3\40"
   /* height (52) */
   "\0\0\0""4"
   /* pixel_data: */
-  "\3\0\0\0\27\0\0\0\17\1\1\1\2\341\0\0\0\0\3\0\0\0/\0\0\0\36\1\1\1\5\341"
-  "\0\0\0\0\3\0\0\0F\0\0\0-\1\1\1\10\341\0\0\0\0\3\0\0\0^\0\0\0<\1\1\1\13"
-  "\341\0\0\0\0\3\0\0\0u\0\0\0K\1\1\1\16\341\0\0\0\0\3\0\0\0\215\0\0\0Z"
-  "\1\1\1\21\341\0\0\0\0\3\0\0\0\244\0\0\0i\1\1\1\24\341\0\0\0\0\3\0\0\0"
-  "\274\0\0\0x\1\1\1\27\341\0\0\0\0\6\1\1\1\6\0\0\0\31\0\0\0\33\0\0\0\21"
-  "\1\1\1\4\77\77@\0\304\0\0\0\0\3QQQ\0\0\0\0\0\2\2\2\0\227\0\0\0\0\6\1"
-  "\1\1\15\0\0\0""2\0\0\0""7\0\0\0\"\1\1\1\11\77\77@\0\304\0\0\0\0\3QQQ"
-  "\0\0\0\0\0\2\2\2\0\227\0\0\0\0\6\1\1\1\24\0\0\0K\0\0\0R\0\0\0""3\1\1"
-  "\1\16\77\77@\0\304\0\0\0\0\3QQQ\0\0\0\0\0\2\2\2\0\227\0\0\0\0\6\1\1\1"
-  "\33\0\0\0d\0\0\0n\0\0\0D\1\1\1\22\77\77@\0\304\0\0\0\0\3QQQ\0\0\0\0\0"
-  "\2\2\2\0\227\0\0\0\0\6\1\1\1!\0\0\0~\0\0\0\211\0\0\0V\1\1\1\27\77\77"
-  "@\0\304\0\0\0\0\3QQQ\0\0\0\0\1\2\2\2\0\227\0\0\0\0\6\1\1\1(\0\0\0\227"
-  "\0\0\0\245\0\0\0g\1\1\1\34\77\77@\0\304\0\0\0\0\3QQQ\0\0\0\0\1\2\2\2"
-  "\0\227\0\0\0\0\6\1\1\1/\0\0\0\260\0\0\0\300\0\0\0x\1\1\1\40\77\77@\0"
-  "\304\0\0\0\0\3QQQ\0\0\0\0\1\2\2\2\0\227\0\0\0\0\6\1\1\1""6\0\0\0\311"
-  "\0\0\0\334\0\0\0\211\1\1\1%\77\77@\0\304\0\0\0\0\3QQQ\0\0\0\0\1\2\2\2"
-  "\0\230\0\0\0\0\7\0\0\0\1\0\0\0\20\0\0\0\33\0\0\0\34\0\0\0\23\1\1\1\7"
-  "\2\2\2\0\301\0\0\0\0\5\1\1\1\5\0\0\0\25\0\0\0\33\0\0\0\31\1\1\1\12\227"
-  "\0\0\0\0\7\0\0\0\3\0\0\0\40\0\0\0""7\0\0\0""8\0\0\0'\1\1\1\16\2\2\2\0"
-  "\301\0\0\0\0\5\1\1\1\12\0\0\0*\0\0\0""6\0\0\0""3\1\1\1\24\227\0\0\0\0"
-  "\7\0\0\0\5\0\0\0""0\0\0\0S\0\0\0T\0\0\0;\1\1\1\25\2\2\2\0\301\0\0\0\0"
-  "\5\1\1\1\17\0\0\0\77\0\0\0R\0\0\0L\1\1\1\36\227\0\0\0\0\7\0\0\0\7\0\0"
-  "\0@\0\0\0o\0\0\0p\0\0\0N\1\1\1\34\2\2\2\0\301\0\0\0\0\5\1\1\1\24\0\0"
-  "\0T\0\0\0m\0\0\0f\1\1\1(\227\0\0\0\0\7\0\0\0\10\0\0\0P\0\0\0\212\0\0"
-  "\0\214\0\0\0b\1\1\1#\2\2\2\0\301\0\0\0\0\5\1\1\1\32\0\0\0i\0\0\0\211"
-  "\0\0\0\177\1\1\1""3\227\0\0\0\0\7\0\0\0\12\0\0\0`\0\0\0\246\0\0\0\250"
-  "\0\0\0v\1\1\1*\2\2\2\0\301\0\0\0\0\5\1\1\1\37\0\0\0~\0\0\0\244\0\0\0"
-  "\231\1\1\1=\227\0\0\0\0\7\0\0\0\14\0\0\0p\0\0\0\302\0\0\0\304\0\0\0\211"
-  "\1\1\1""1\2\2\2\0\301\0\0\0\0\5\1\1\1$\0\0\0\223\0\0\0\300\0\0\0\262"
-  "\1\1\1G\227\0\0\0\0\7\0\0\0\16\0\0\0\200\0\0\0\336\0\0\0\340\0\0\0\235"
-  "\1\1\1""8\2\2\2\0\301\0\0\0\0\5\1\1\1)\0\0\0\250\0\0\0\333\0\0\0\314"
-  "\1\1\1Q\231\0\0\0\0\2\0\0\0\4\0\0\0\23\202\0\0\0\34\3\0\0\0\26\1\1\1"
-  "\13\3\3\3\1\276\0\0\0\0\2\0\0\0\1\0\0\0\31\204\0\0\0\34\1\0\0\0\6\230"
-  "\0\0\0\0\2\0\0\0\11\0\0\0&\202\0\0\0""8\3\0\0\0-\1\1\1\26\3\3\3\2\276"
-  "\0\0\0\0\2\0\0\0\2\0\0\0""3\204\0\0\0""8\1\0\0\0\15\230\0\0\0\0\7\0\0"
-  "\0\16\0\0\0:\0\0\0T\0\0\0U\0\0\0D\1\1\1\"\3\3\3\4\276\0\0\0\0\2\0\0\0"
-  "\4\0\0\0L\203\0\0\0U\2\0\0\0T\0\0\0\24\230\0\0\0\0\7\0\0\0\22\0\0\0M"
-  "\0\0\0p\0\0\0q\0\0\0[\1\1\1-\3\3\3\5\276\0\0\0\0\2\0\0\0\5\0\0\0f\203"
-  "\0\0\0q\2\0\0\0p\0\0\0\32\230\0\0\0\0\7\0\0\0\27\0\0\0`\0\0\0\214\0\0"
-  "\0\215\0\0\0r\1\1\1""9\3\3\3\7\276\0\0\0\0\2\0\0\0\6\0\0\0\177\203\0"
-  "\0\0\215\2\0\0\0\214\0\0\0!\230\0\0\0\0\7\0\0\0\34\0\0\0t\0\0\0\250\0"
-  "\0\0\252\0\0\0\211\1\1\1D\3\3\3\10\276\0\0\0\0\2\0\0\0\10\0\0\0\231\203"
-  "\0\0\0\252\2\0\0\0\250\0\0\0(\230\0\0\0\0\7\0\0\0\40\0\0\0\207\0\0\0"
-  "\304\0\0\0\306\0\0\0\240\1\1\1P\3\3\3\12\276\0\0\0\0\2\0\0\0\11\0\0\0"
-  "\262\203\0\0\0\306\2\0\0\0\304\0\0\0.\230\0\0\0\0\7\0\0\0%\0\0\0\232"
-  "\0\0\0\340\0\0\0\342\0\0\0\267\1\1\1[\3\3\3\13\276\0\0\0\0\2\0\0\0\12"
-  "\0\0\0\314\203\0\0\0\342\2\0\0\0\340\0\0\0""5\232\0\0\0\0\2\2\2\2\5\1"
-  "\1\1\23\202\0\0\0\34\3\0\0\0\32\0\0\0\21\0\0\0\7\266\0\0\0\0\3\0\0\0"
-  "\1\0\0\0\2\16\16\16\0\203\0\0\0\0\1\0\0\0\11\205\0\0\0\34\1\1\1\1\23"
-  "\232\0\0\0\0\2\2\2\2\12\1\1\1'\202\0\0\0""8\3\0\0\0""5\0\0\0\"\0\0\0"
-  "\16\266\0\0\0\0\3\0\0\0\2\0\0\0\4\16\16\16\0\203\0\0\0\0\1\0\0\0\22\205"
-  "\0\0\0""8\1\1\1\1'\232\0\0\0\0\10\2\2\2\20\1\1\1;\0\0\0T\0\0\0U\0\0\0"
-  "P\0\0\0""3\0\0\0\25\0\0\0\1\265\0\0\0\0\3\0\0\0\3\0\0\0\7\16\16\16\0"
-  "\203\0\0\0\0\1\0\0\0\33\205\0\0\0U\1\1\1\1:\232\0\0\0\0\10\2\2\2\25\1"
-  "\1\1N\0\0\0p\0\0\0q\0\0\0k\0\0\0D\0\0\0\34\0\0\0\1\265\0\0\0\0\3\0\0"
-  "\0\4\0\0\0\11\16\16\16\0\203\0\0\0\0\1\0\0\0$\205\0\0\0q\1\1\1\1N\232"
-  "\0\0\0\0\10\2\2\2\32\1\1\1b\0\0\0\214\0\0\0\215\0\0\0\205\0\0\0V\0\0"
-  "\0#\0\0\0\2\265\0\0\0\0\3\0\0\0\5\0\0\0\14\16\16\16\0\203\0\0\0\0\1\0"
-  "\0\0-\205\0\0\0\215\1\1\1\1a\232\0\0\0\0\10\2\2\2\40\1\1\1v\0\0\0\250"
-  "\0\0\0\252\0\0\0\240\0\0\0g\0\0\0*\0\0\0\2\265\0\0\0\0\3\0\0\0\6\0\0"
-  "\0\16\16\16\16\0\203\0\0\0\0\1\0\0\0""6\205\0\0\0\252\1\1\1\1u\232\0"
-  "\0\0\0\10\2\2\2%\1\1\1\211\0\0\0\304\0\0\0\306\0\0\0\273\0\0\0x\0\0\0"
-  "1\0\0\0\3\265\0\0\0\0\3\0\0\0\7\0\0\0\21\16\16\16\0\203\0\0\0\0\1\0\0"
-  "\0\77\205\0\0\0\306\1\1\1\1\210\232\0\0\0\0\10\2\2\2*\1\1\1\235\0\0\0"
-  "\340\0\0\0\342\0\0\0\326\0\0\0\211\0\0\0""8\0\0\0\3\265\0\0\0\0\3\0\0"
-  "\0\10\0\0\0\23\16\16\16\0\203\0\0\0\0\1\0\0\0H\205\0\0\0\342\1\1\1\1"
-  "\234\234\0\0\0\0\3\1\1\1\5\0\0\0\22\0\0\0\33\202\0\0\0\34\4\0\0\0\31"
-  "\0\0\0\21\1\1\1\11\1\1\1\1\261\0\0\0\0\4\0\0\0\10\0\0\0\32\0\0\0\34\1"
-  "\1\1\21\203\0\0\0\0\1\0\0\0\14\205\0\0\0\34\2\0\0\0\33\0\0\0\1\233\0"
-  "\0\0\0\3\1\1\1\13\0\0\0%\0\0\0""7\202\0\0\0""8\4\0\0\0""2\0\0\0\"\1\1"
-  "\1\22\1\1\1\3\261\0\0\0\0\5\0\0\0\20\0\0\0""4\0\0\0""8\1\1\1#\0\0\0\1"
-  "\202\0\0\0\0\1\0\0\0\31\205\0\0\0""8\2\0\0\0""7\0\0\0\2\233\0\0\0\0\3"
-  "\1\1\1\21\0\0\0""8\0\0\0S\202\0\0\0U\4\0\0\0L\0\0\0""3\1\1\1\33\1\1\1"
-  "\5\261\0\0\0\0\5\0\0\0\30\0\0\0N\0\0\0T\1\1\1""5\0\0\0\2\202\0\0\0\0"
-  "\1\0\0\0&\205\0\0\0U\2\0\0\0R\0\0\0\3\233\0\0\0\0\3\1\1\1\27\0\0\0K\0"
-  "\0\0o\202\0\0\0q\4\0\0\0e\0\0\0D\1\1\1$\1\1\1\6\261\0\0\0\0\5\0\0\0\40"
-  "\0\0\0h\0\0\0p\1\1\1G\0\0\0\2\202\0\0\0\0\1\0\0\0""3\205\0\0\0q\2\0\0"
-  "\0n\0\0\0\4\233\0\0\0\0\3\1\1\1\34\0\0\0]\0\0\0\212\202\0\0\0\215\4\0"
-  "\0\0~\0\0\0U\1\1\1.\1\1\1\10\261\0\0\0\0\5\0\0\0(\0\0\0\202\0\0\0\215"
-  "\1\1\1Y\0\0\0\3\202\0\0\0\0\1\0\0\0\77\205\0\0\0\215\2\0\0\0\211\0\0"
-  "\0\5\233\0\0\0\0\3\1\1\1\"\0\0\0p\0\0\0\246\202\0\0\0\252\4\0\0\0\230"
-  "\0\0\0f\1\1\1""7\1\1\1\12\261\0\0\0\0\5\0\0\0""0\0\0\0\234\0\0\0\251"
-  "\1\1\1k\0\0\0\4\202\0\0\0\0\1\0\0\0L\205\0\0\0\252\2\0\0\0\245\0\0\0"
-  "\6\233\0\0\0\0\3\1\1\1(\0\0\0\203\0\0\0\302\202\0\0\0\306\4\0\0\0\261"
-  "\0\0\0w\1\1\1@\1\1\1\13\261\0\0\0\0\5\0\0\0""8\0\0\0\266\0\0\0\305\1"
-  "\1\1}\0\0\0\4\202\0\0\0\0\1\0\0\0Y\205\0\0\0\306\2\0\0\0\300\0\0\0\7"
-  "\233\0\0\0\0\3\1\1\1.\0\0\0\226\0\0\0\336\202\0\0\0\342\4\0\0\0\312\0"
-  "\0\0\210\1\1\1I\1\1\1\15\261\0\0\0\0\5\0\0\0@\0\0\0\320\0\0\0\341\1\1"
-  "\1\217\0\0\0\5\202\0\0\0\0\1\0\0\0f\205\0\0\0\342\2\0\0\0\334\0\0\0\10"
-  "\235\0\0\0\0\3\2\2\2\3\0\0\0\20\0\0\0\32\203\0\0\0\34\3\0\0\0\33\0\0"
-  "\0\23\1\1\1\10\256\0\0\0\0\2\1\1\1\3\0\0\0\33\203\0\0\0\34\1\1\1\1\21"
-  "\202\0\0\0\0\1\0\0\0\14\206\0\0\0\34\1\0\0\0\6\235\0\0\0\0\3\2\2\2\7"
-  "\0\0\0\40\0\0\0""4\203\0\0\0""8\4\0\0\0""6\0\0\0&\1\1\1\21\0\0\0\1\255"
-  "\0\0\0\0\2\1\1\1\6\0\0\0""6\203\0\0\0""8\1\1\1\1\"\202\0\0\0\0\1\0\0"
-  "\0\30\206\0\0\0""8\1\0\0\0\14\235\0\0\0\0\3\2\2\2\13\0\0\0""0\0\0\0O"
-  "\203\0\0\0U\4\0\0\0R\0\0\0""9\1\1\1\32\0\0\0\2\255\0\0\0\0\2\1\1\1\11"
-  "\0\0\0Q\203\0\0\0U\1\1\1\1""4\202\0\0\0\0\1\0\0\0%\206\0\0\0U\1\0\0\0"
-  "\23\235\0\0\0\0\3\2\2\2\17\0\0\0@\0\0\0i\203\0\0\0q\4\0\0\0m\0\0\0L\1"
-  "\1\1#\0\0\0\2\255\0\0\0\0\2\1\1\1\14\0\0\0l\203\0\0\0q\1\1\1\1E\202\0"
-  "\0\0\0\1\0\0\0""1\206\0\0\0q\1\0\0\0\31\235\0\0\0\0\3\2\2\2\23\0\0\0"
-  "P\0\0\0\204\203\0\0\0\215\4\0\0\0\210\0\0\0_\1\1\1+\0\0\0\3\255\0\0\0"
-  "\0\2\1\1\1\17\0\0\0\207\203\0\0\0\215\1\1\1\1V\202\0\0\0\0\1\0\0\0>\206"
-  "\0\0\0\215\1\0\0\0\37\235\0\0\0\0\3\2\2\2\27\0\0\0`\0\0\0\236\203\0\0"
-  "\0\252\4\0\0\0\244\0\0\0r\1\1\1""4\0\0\0\4\255\0\0\0\0\2\1\1\1\22\0\0"
-  "\0\242\203\0\0\0\252\1\1\1\1h\202\0\0\0\0\1\0\0\0J\206\0\0\0\252\1\0"
-  "\0\0&\235\0\0\0\0\3\2\2\2\33\0\0\0p\0\0\0\271\203\0\0\0\306\4\0\0\0\277"
-  "\0\0\0\205\1\1\1=\0\0\0\4\255\0\0\0\0\2\1\1\1\25\0\0\0\275\203\0\0\0"
-  "\306\1\1\1\1y\202\0\0\0\0\1\0\0\0W\206\0\0\0\306\1\0\0\0,\235\0\0\0\0"
-  "\3\2\2\2\37\0\0\0\200\0\0\0\323\203\0\0\0\342\4\0\0\0\332\0\0\0\230\1"
-  "\1\1F\0\0\0\5\255\0\0\0\0\2\1\1\1\30\0\0\0\330\203\0\0\0\342\1\1\1\1"
-  "\212\202\0\0\0\0\1\0\0\0c\206\0\0\0\342\1\0\0\0""2\237\0\0\0\0\3\1\1"
-  "\1\1\1\1\1\13\0\0\0\27\204\0\0\0\34\3\0\0\0\31\0\0\0\15\1\1\1\1\253\0"
-  "\0\0\0\1\0\0\0\15\205\0\0\0\34\3\1\1\1\7\0\0\0\0\1\1\1\12\206\0\0\0\34"
-  "\1\1\1\1\12\216\0\0\0\0\2\2\2\2\1\1\1\1\3\217\0\0\0\0\3\1\1\1\2\1\1\1"
-  "\27\0\0\0/\204\0\0\0""8\3\0\0\0""2\0\0\0\32\1\1\1\3\253\0\0\0\0\1\0\0"
-  "\0\32\205\0\0\0""8\3\1\1\1\17\0\0\0\0\1\1\1\24\206\0\0\0""8\1\1\1\1\24"
-  "\216\0\0\0\0\2\2\2\2\2\1\1\1\6\217\0\0\0\0\3\1\1\1\4\1\1\1#\0\0\0G\204"
-  "\0\0\0U\3\0\0\0K\0\0\0'\1\1\1\5\253\0\0\0\0\1\0\0\0(\204\0\0\0U\4\0\0"
-  "\0T\1\1\1\27\0\0\0\0\1\1\1\36\206\0\0\0U\1\1\1\1\36\216\0\0\0\0\2\2\2"
-  "\2\3\1\1\1\12\217\0\0\0\0\3\1\1\1\5\1\1\1.\0\0\0^\204\0\0\0q\3\0\0\0"
-  "d\0\0\0""4\1\1\1\6\253\0\0\0\0\1\0\0\0""5\204\0\0\0q\4\0\0\0p\1\1\1\37"
-  "\0\0\0\0\1\1\1(\206\0\0\0q\1\1\1\1(\216\0\0\0\0\2\2\2\2\4\1\1\1\15\217"
-  "\0\0\0\0\3\1\1\1\7\1\1\1:\0\0\0v\204\0\0\0\215\3\0\0\0}\0\0\0B\1\1\1"
-  "\10\253\0\0\0\0\1\0\0\0C\205\0\0\0\215\3\1\1\1'\0\0\0\0\1\1\1""2\206"
-  "\0\0\0\215\1\1\1\1""2\216\0\0\0\0\2\2\2\2\6\1\1\1\21\217\0\0\0\0\3\1"
-  "\1\1\10\1\1\1F\0\0\0\216\204\0\0\0\252\3\0\0\0\226\0\0\0O\1\1\1\12\253"
-  "\0\0\0\0\1\0\0\0P\204\0\0\0\252\4\0\0\0\251\1\1\1/\0\0\0\0\1\1\1<\206"
-  "\0\0\0\252\1\1\1\1<\216\0\0\0\0\2\2\2\2\7\1\1\1\24\217\0\0\0\0\3\1\1"
-  "\1\12\1\1\1Q\0\0\0\245\204\0\0\0\306\3\0\0\0\257\0\0\0\\\1\1\1\13\253"
-  "\0\0\0\0\1\0\0\0^\204\0\0\0\306\4\0\0\0\305\1\1\1""7\0\0\0\0\1\1\1F\206"
-  "\0\0\0\306\1\1\1\1F\216\0\0\0\0\2\2\2\2\10\1\1\1\30\217\0\0\0\0\3\1\1"
-  "\1\13\1\1\1]\0\0\0\275\204\0\0\0\342\3\0\0\0\310\0\0\0i\1\1\1\15\253"
-  "\0\0\0\0\1\0\0\0k\204\0\0\0\342\4\0\0\0\341\1\1\1\77\0\0\0\0\1\1\1P\206"
-  "\0\0\0\342\1\1\1\1P\216\0\0\0\0\2\2\2\2\11\1\1\1\33\221\0\0\0\0\3\3\3"
-  "\3\0\1\1\1\10\0\0\0\24\204\0\0\0\34\3\0\0\0\32\0\0\0\15\1\1\1\1\251\0"
-  "\0\0\0\1\0\0\0\21\205\0\0\0\34\3\0\0\0\27\12\12\12\0\0\0\0\5\206\0\0"
-  "\0\34\1\0\0\0\14\216\0\0\0\0\2\1\1\1\12\0\0\0\15\203\0\0\0\0\1\1\1\1"
-  "\11\215\0\0\0\0\3\3\3\3\0\1\1\1\20\0\0\0)\204\0\0\0""8\3\0\0\0""5\0\0"
-  "\0\33\1\1\1\3\251\0\0\0\0\1\0\0\0#\205\0\0\0""8\3\0\0\0.\12\12\12\0\0"
-  "\0\0\13\206\0\0\0""8\1\0\0\0\31\216\0\0\0\0\2\1\1\1\25\0\0\0\33\203\0"
-  "\0\0\0\1\1\1\1\23\215\0\0\0\0\4\3\3\3\0\1\1\1\30\0\0\0>\0\0\0T\203\0"
-  "\0\0U\3\0\0\0O\0\0\0)\1\1\1\5\251\0\0\0\0\1\0\0\0""5\205\0\0\0U\3\0\0"
-  "\0E\12\12\12\0\0\0\0\20\206\0\0\0U\1\0\0\0&\216\0\0\0\0\2\1\1\1\40\0"
-  "\0\0)\203\0\0\0\0\1\1\1\1\34\215\0\0\0\0\4\3\3\3\0\1\1\1\40\0\0\0S\0"
-  "\0\0p\203\0\0\0q\3\0\0\0j\0\0\0""6\1\1\1\6\251\0\0\0\0\1\0\0\0G\205\0"
-  "\0\0q\3\0\0\0\\\12\12\12\0\0\0\0\26\206\0\0\0q\1\0\0\0""3\216\0\0\0\0"
-  "\2\1\1\1+\0\0\0""7\203\0\0\0\0\1\1\1\1&\215\0\0\0\0\3\3\3\3\1\1\1\1("
-  "\0\0\0g\204\0\0\0\215\3\0\0\0\204\0\0\0D\1\1\1\10\251\0\0\0\0\1\0\0\0"
-  "X\205\0\0\0\215\3\0\0\0s\12\12\12\1\0\0\0\33\206\0\0\0\215\1\0\0\0@\216"
-  "\0\0\0\0\2\1\1\1""5\0\0\0D\203\0\0\0\0\1\1\1\1/\215\0\0\0\0\4\3\3\3\1"
-  "\1\1\1""0\0\0\0|\0\0\0\251\203\0\0\0\252\3\0\0\0\237\0\0\0R\1\1\1\12"
-  "\251\0\0\0\0\1\0\0\0j\205\0\0\0\252\3\0\0\0\212\12\12\12\1\0\0\0!\206"
-  "\0\0\0\252\1\0\0\0M\216\0\0\0\0\2\1\1\1@\0\0\0R\203\0\0\0\0\1\1\1\1""9"
-  "\215\0\0\0\0\4\3\3\3\1\1\1\1""8\0\0\0\221\0\0\0\305\203\0\0\0\306\3\0"
-  "\0\0\271\0\0\0_\1\1\1\13\251\0\0\0\0\1\0\0\0|\205\0\0\0\306\3\0\0\0\241"
-  "\12\12\12\1\0\0\0&\206\0\0\0\306\1\0\0\0Z\216\0\0\0\0\2\1\1\1K\0\0\0"
-  "`\203\0\0\0\0\1\1\1\1B\215\0\0\0\0\4\3\3\3\1\1\1\1@\0\0\0\246\0\0\0\341"
-  "\203\0\0\0\342\3\0\0\0\324\0\0\0m\1\1\1\15\251\0\0\0\0\1\0\0\0\216\205"
-  "\0\0\0\342\3\0\0\0\270\12\12\12\1\0\0\0,\206\0\0\0\342\1\0\0\0g\216\0"
-  "\0\0\0\2\1\1\1V\0\0\0n\203\0\0\0\0\1\1\1\1L\220\0\0\0\0\2\1\1\1\6\0\0"
-  "\0\25\204\0\0\0\34\3\0\0\0\31\1\1\1\13\2\2\2\0\247\0\0\0\0\1\0\0\0\21"
-  "\206\0\0\0\34\3\1\1\1\10\2\2\2\0\0\0\0\33\205\0\0\0\34\1\0\0\0\16\216"
-  "\0\0\0\0\2\0\0\0\21\0\0\0\15\202\0\0\0\0\2\0\0\0\14\0\0\0\26\220\0\0"
-  "\0\0\2\1\1\1\15\0\0\0*\204\0\0\0""8\3\0\0\0""3\1\1\1\26\2\2\2\0\247\0"
-  "\0\0\0\1\0\0\0#\206\0\0\0""8\3\1\1\1\21\2\2\2\1\0\0\0""6\205\0\0\0""8"
-  "\1\0\0\0\35\216\0\0\0\0\2\0\0\0#\0\0\0\32\202\0\0\0\0\2\0\0\0\30\0\0"
-  "\0-\220\0\0\0\0\3\1\1\1\23\0\0\0\77\0\0\0T\203\0\0\0U\3\0\0\0M\1\1\1"
-  "!\2\2\2\1\247\0\0\0\0\1\0\0\0""5\206\0\0\0U\3\1\1\1\32\2\2\2\2\0\0\0"
-  "Q\205\0\0\0U\1\0\0\0+\216\0\0\0\0\2\0\0\0""4\0\0\0(\202\0\0\0\0\2\0\0"
-  "\0$\0\0\0D\220\0\0\0\0\3\1\1\1\32\0\0\0T\0\0\0p\203\0\0\0q\3\0\0\0f\1"
-  "\1\1,\2\2\2\1\247\0\0\0\0\1\0\0\0G\206\0\0\0q\3\1\1\1#\2\2\2\2\0\0\0"
-  "l\205\0\0\0q\1\0\0\0:\216\0\0\0\0\2\0\0\0F\0\0\0""5\202\0\0\0\0\2\0\0"
-  "\0""0\0\0\0[\220\0\0\0\0\2\1\1\1\40\0\0\0i\204\0\0\0\215\3\0\0\0\200"
-  "\1\1\1""7\2\2\2\2\247\0\0\0\0\1\0\0\0Y\206\0\0\0\215\3\1\1\1,\2\2\2\3"
-  "\0\0\0\207\205\0\0\0\215\1\0\0\0H\216\0\0\0\0\2\0\0\0W\0\0\0C\202\0\0"
-  "\0\0\2\0\0\0<\0\0\0r\220\0\0\0\0\3\1\1\1'\0\0\0~\0\0\0\251\203\0\0\0"
-  "\252\3\0\0\0\232\1\1\1B\2\2\2\2\247\0\0\0\0\1\0\0\0k\206\0\0\0\252\3"
-  "\1\1\1""5\2\2\2\4\0\0\0\242\205\0\0\0\252\1\0\0\0W\216\0\0\0\0\2\0\0"
-  "\0i\0\0\0P\202\0\0\0\0\2\0\0\0H\0\0\0\211\220\0\0\0\0\3\1\1\1-\0\0\0"
-  "\223\0\0\0\305\203\0\0\0\306\3\0\0\0\263\1\1\1M\2\2\2\3\247\0\0\0\0\1"
-  "\0\0\0}\206\0\0\0\306\3\1\1\1>\2\2\2\4\0\0\0\275\205\0\0\0\306\1\0\0"
-  "\0e\216\0\0\0\0\2\0\0\0z\0\0\0^\202\0\0\0\0\2\0\0\0T\0\0\0\240\220\0"
-  "\0\0\0\3\1\1\1""4\0\0\0\250\0\0\0\341\203\0\0\0\342\3\0\0\0\315\1\1\1"
-  "X\2\2\2\3\247\0\0\0\0\1\0\0\0\217\206\0\0\0\342\3\1\1\1G\2\2\2\5\0\0"
-  "\0\330\205\0\0\0\342\1\0\0\0t\216\0\0\0\0\2\0\0\0\214\0\0\0k\202\0\0"
-  "\0\0\2\0\0\0`\0\0\0\267\221\0\0\0\0\3\21\21\21\0\1\1\1\7\0\0\0\27\204"
-  "\0\0\0\34\2\0\0\0\26\1\1\1\5\246\0\0\0\0\1\0\0\0\16\206\0\0\0\34\3\0"
-  "\0\0\25\0\0\0\0\0\0\0\24\205\0\0\0\34\1\0\0\0\17\216\0\0\0\0\6\0\0\0"
-  "\27\1\1\1\13\0\0\0\0\2\2\2\4\0\0\0\33\0\0\0\12\221\0\0\0\0\3\21\21\21"
-  "\0\1\1\1\17\0\0\0.\204\0\0\0""8\2\0\0\0,\1\1\1\12\246\0\0\0\0\1\0\0\0"
-  "\35\206\0\0\0""8\3\0\0\0+\0\0\0\0\0\0\0(\205\0\0\0""8\1\0\0\0\37\216"
-  "\0\0\0\0\6\0\0\0.\1\1\1\26\0\0\0\0\2\2\2\11\0\0\0""6\0\0\0\25\221\0\0"
-  "\0\0\3\21\21\21\0\1\1\1\27\0\0\0F\204\0\0\0U\2\0\0\0B\1\1\1\20\246\0"
-  "\0\0\0\1\0\0\0,\206\0\0\0U\3\0\0\0A\0\0\0\0\0\0\0=\205\0\0\0U\1\0\0\0"
-  "/\216\0\0\0\0\6\0\0\0E\1\1\1!\0\0\0\0\2\2\2\16\0\0\0R\0\0\0\37\221\0"
-  "\0\0\0\3\21\21\21\0\1\1\1\37\0\0\0]\204\0\0\0q\2\0\0\0X\1\1\1\25\246"
-  "\0\0\0\0\1\0\0\0:\206\0\0\0q\3\0\0\0W\0\0\0\0\0\0\0Q\205\0\0\0q\1\0\0"
-  "\0>\216\0\0\0\0\6\0\0\0\\\1\1\1,\0\0\0\0\2\2\2\23\0\0\0m\0\0\0*\221\0"
-  "\0\0\0\3\21\21\21\0\1\1\1'\0\0\0t\204\0\0\0\215\2\0\0\0n\1\1\1\32\246"
-  "\0\0\0\0\1\0\0\0I\206\0\0\0\215\3\0\0\0m\0\0\0\0\0\0\0e\205\0\0\0\215"
-  "\1\0\0\0N\216\0\0\0\0\6\0\0\0t\1\1\1""8\0\0\0\0\2\2\2\27\0\0\0\211\0"
-  "\0\0""4\221\0\0\0\0\3\21\21\21\0\1\1\1/\0\0\0\214\204\0\0\0\252\2\0\0"
-  "\0\204\1\1\1\40\246\0\0\0\0\1\0\0\0X\206\0\0\0\252\3\0\0\0\203\0\0\0"
-  "\0\0\0\0z\205\0\0\0\252\1\0\0\0^\216\0\0\0\0\6\0\0\0\213\1\1\1C\0\0\0"
-  "\0\2\2\2\34\0\0\0\244\0\0\0\77\221\0\0\0\0\3\21\21\21\0\1\1\1""7\0\0"
-  "\0\243\204\0\0\0\306\2\0\0\0\232\1\1\1%\246\0\0\0\0\1\0\0\0f\206\0\0"
-  "\0\306\3\0\0\0\231\0\0\0\0\0\0\0\216\205\0\0\0\306\1\0\0\0m\216\0\0\0"
-  "\0\6\0\0\0\242\1\1\1N\0\0\0\0\2\2\2!\0\0\0\300\0\0\0I\221\0\0\0\0\3\21"
-  "\21\21\0\1\1\1\77\0\0\0\272\204\0\0\0\342\2\0\0\0\260\1\1\1*\246\0\0"
-  "\0\0\1\0\0\0u\206\0\0\0\342\3\0\0\0\257\0\0\0\0\0\0\0\242\205\0\0\0\342"
-  "\1\0\0\0}\216\0\0\0\0\6\0\0\0\271\1\1\1Y\0\0\0\0\2\2\2&\0\0\0\333\0\0"
-  "\0T\223\0\0\0\0\3\3\3\3\0\0\0\0\13\0\0\0\32\203\0\0\0\34\3\0\0\0\33\1"
-  "\1\1\16\1\1\1\0\244\0\0\0\0\1\0\0\0\11\207\0\0\0\34\2\1\1\1\6\0\0\0\14"
-  "\205\0\0\0\34\1\0\0\0\17\216\0\0\0\0\5\0\0\0\33\1\1\1\7\0\0\0\0\0\0\0"
-  "\25\0\0\0\30\224\0\0\0\0\3\3\3\3\1\0\0\0\27\0\0\0""4\203\0\0\0""8\3\0"
-  "\0\0""7\1\1\1\35\1\1\1\1\244\0\0\0\0\1\0\0\0\22\207\0\0\0""8\2\1\1\1"
-  "\15\0\0\0\30\205\0\0\0""8\1\0\0\0\37\215\0\0\0\0\7\0\0\0\1\0\0\0""7\1"
-  "\1\1\17\0\0\0\0\0\0\0+\0\0\0""1\0\0\0\1\223\0\0\0\0\3\3\3\3\1\0\0\0#"
-  "\0\0\0N\203\0\0\0U\3\0\0\0S\1\1\1,\1\1\1\2\244\0\0\0\0\1\0\0\0\34\207"
-  "\0\0\0U\2\1\1\1\23\0\0\0%\205\0\0\0U\1\0\0\0/\215\0\0\0\0\7\0\0\0\1\0"
-  "\0\0R\1\1\1\26\0\0\0\0\0\0\0A\0\0\0I\0\0\0\1\223\0\0\0\0\3\3\3\3\2\0"
-  "\0\0/\0\0\0h\203\0\0\0q\3\0\0\0n\1\1\1:\1\1\1\3\244\0\0\0\0\1\0\0\0%"
-  "\207\0\0\0q\2\1\1\1\32\0\0\0""1\205\0\0\0q\1\0\0\0\77\215\0\0\0\0\7\0"
-  "\0\0\2\0\0\0n\1\1\1\36\0\0\0\0\0\0\0V\0\0\0b\0\0\0\2\223\0\0\0\0\3\3"
-  "\3\3\2\0\0\0;\0\0\0\203\203\0\0\0\215\3\0\0\0\212\1\1\1I\1\1\1\3\244"
-  "\0\0\0\0\1\0\0\0/\207\0\0\0\215\2\1\1\1\40\0\0\0>\205\0\0\0\215\1\0\0"
-  "\0N\215\0\0\0\0\7\0\0\0\2\0\0\0\211\1\1\1%\0\0\0\1\0\0\0l\0\0\0z\0\0"
-  "\0\2\223\0\0\0\0\3\3\3\3\3\0\0\0G\0\0\0\235\203\0\0\0\252\3\0\0\0\246"
-  "\1\1\1X\1\1\1\4\244\0\0\0\0\1\0\0\0""8\207\0\0\0\252\2\1\1\1'\0\0\0J"
-  "\205\0\0\0\252\1\0\0\0^\215\0\0\0\0\7\0\0\0\3\0\0\0\245\1\1\1-\0\0\0"
-  "\1\0\0\0\202\0\0\0\223\0\0\0\3\223\0\0\0\0\3\3\3\3\3\0\0\0S\0\0\0\267"
-  "\203\0\0\0\306\3\0\0\0\301\1\1\1f\1\1\1\5\244\0\0\0\0\1\0\0\0B\207\0"
-  "\0\0\306\2\1\1\1-\0\0\0W\205\0\0\0\306\1\0\0\0n\215\0\0\0\0\7\0\0\0\3"
-  "\0\0\0\300\1\1\1""4\0\0\0\1\0\0\0\227\0\0\0\253\0\0\0\3\223\0\0\0\0\3"
-  "\3\3\3\4\0\0\0_\0\0\0\321\203\0\0\0\342\3\0\0\0\335\1\1\1u\1\1\1\6\244"
-  "\0\0\0\0\1\0\0\0K\207\0\0\0\342\2\1\1\1""4\0\0\0c\205\0\0\0\342\1\0\0"
-  "\0~\215\0\0\0\0\7\0\0\0\4\0\0\0\334\1\1\1<\0\0\0\1\0\0\0\255\0\0\0\304"
-  "\0\0\0\4\225\0\0\0\0\2\5\5\5\2\0\0\0\21\204\0\0\0\34\2\0\0\0\26\1\1\1"
-  "\4\243\0\0\0\0\1\1\1\1\2\207\0\0\0\34\2\0\0\0\27\1\1\1\22\205\0\0\0\34"
-  "\6\0\0\0\31\0\0\0\22\0\0\0\16\1\1\1\11\2\2\2\4\2\2\2\1\210\0\0\0\0\6"
-  "\1\1\1\3\0\0\0\34\1\1\1\3\1\1\1\11\0\0\0\34\0\0\0\12\226\0\0\0\0\2\5"
-  "\5\5\4\0\0\0#\204\0\0\0""8\2\0\0\0-\1\1\1\10\243\0\0\0\0\1\1\1\1\5\207"
-  "\0\0\0""8\2\0\0\0.\1\1\1$\205\0\0\0""8\6\0\0\0""3\0\0\0%\0\0\0\34\1\1"
-  "\1\23\2\2\2\11\2\2\2\2\210\0\0\0\0\6\1\1\1\7\0\0\0""8\1\1\1\6\1\1\1\23"
-  "\0\0\0""8\0\0\0\25\226\0\0\0\0\3\5\5\5\7\0\0\0""5\0\0\0T\203\0\0\0U\2"
-  "\0\0\0C\1\1\1\15\243\0\0\0\0\2\1\1\1\7\0\0\0T\206\0\0\0U\2\0\0\0E\1\1"
-  "\1""7\205\0\0\0U\6\0\0\0M\0\0\0""8\0\0\0*\1\1\1\35\2\2\2\16\2\2\2\4\210"
-  "\0\0\0\0\6\1\1\1\13\0\0\0U\1\1\1\12\1\1\1\35\0\0\0U\0\0\0\40\226\0\0"
-  "\0\0\3\5\5\5\11\0\0\0G\0\0\0p\203\0\0\0q\2\0\0\0Z\1\1\1\21\243\0\0\0"
-  "\0\2\1\1\1\12\0\0\0p\206\0\0\0q\2\0\0\0\\\1\1\1I\205\0\0\0q\6\0\0\0g"
-  "\0\0\0K\0\0\0""8\1\1\1'\2\2\2\23\2\2\2\5\210\0\0\0\0\6\1\1\1\17\0\0\0"
-  "q\1\1\1\15\1\1\1&\0\0\0q\0\0\0*\226\0\0\0\0\3\5\5\5\14\0\0\0Y\0\0\0\214"
-  "\203\0\0\0\215\2\0\0\0p\1\1\1\26\243\0\0\0\0\2\1\1\1\14\0\0\0\214\206"
-  "\0\0\0\215\2\0\0\0t\1\1\1[\205\0\0\0\215\6\0\0\0\200\0\0\0]\0\0\0F\1"
-  "\1\1""1\2\2\2\30\2\2\2\6\210\0\0\0\0\6\1\1\1\22\0\0\0\215\1\1\1\21\1"
-  "\1\1""0\0\0\0\215\0\0\0""5\226\0\0\0\0\3\5\5\5\16\0\0\0k\0\0\0\250\203"
-  "\0\0\0\252\2\0\0\0\207\1\1\1\32\243\0\0\0\0\2\1\1\1\17\0\0\0\250\206"
-  "\0\0\0\252\2\0\0\0\213\1\1\1n\205\0\0\0\252\6\0\0\0\232\0\0\0p\0\0\0"
-  "T\1\1\1;\2\2\2\35\2\2\2\10\210\0\0\0\0\6\1\1\1\26\0\0\0\252\1\1\1\24"
-  "\1\1\1:\0\0\0\252\0\0\0@\226\0\0\0\0\3\5\5\5\21\0\0\0}\0\0\0\304\203"
-  "\0\0\0\306\2\0\0\0\235\1\1\1\37\243\0\0\0\0\2\1\1\1\21\0\0\0\304\206"
-  "\0\0\0\306\2\0\0\0\242\1\1\1\200\205\0\0\0\306\6\0\0\0\264\0\0\0\203"
-  "\0\0\0b\1\1\1E\2\2\2\"\2\2\2\11\210\0\0\0\0\6\1\1\1\32\0\0\0\306\1\1"
-  "\1\30\1\1\1C\0\0\0\306\0\0\0J\226\0\0\0\0\3\5\5\5\23\0\0\0\217\0\0\0"
-  "\340\203\0\0\0\342\2\0\0\0\264\1\1\1#\243\0\0\0\0\2\1\1\1\24\0\0\0\340"
-  "\206\0\0\0\342\2\0\0\0\271\1\1\1\222\205\0\0\0\342\6\0\0\0\316\0\0\0"
-  "\226\0\0\0p\1\1\1O\2\2\2'\2\2\2\12\210\0\0\0\0\6\1\1\1\36\0\0\0\342\1"
-  "\1\1\33\1\1\1M\0\0\0\342\0\0\0U\227\0\0\0\0\3bbb\0\1\1\1\7\0\0\0\30\203"
-  "\0\0\0\34\2\0\0\0\32\1\1\1\12\243\0\0\0\0\1\0\0\0\27\222\0\0\0\34\5\0"
-  "\0\0\33\0\0\0\27\0\0\0\22\0\0\0\13\2\2\2\5\204\0\0\0\0\5\1\1\1\6\0\0"
-  "\0\32\21\21\21\0\0\0\0\27\0\0\0\26\230\0\0\0\0\3bbb\0\1\1\1\17\0\0\0"
-  "1\203\0\0\0""8\2\0\0\0""5\1\1\1\24\243\0\0\0\0\1\0\0\0/\222\0\0\0""8"
-  "\5\0\0\0""6\0\0\0/\0\0\0$\0\0\0\27\2\2\2\12\204\0\0\0\0\5\1\1\1\14\0"
-  "\0\0""4\21\21\21\0\0\0\0.\0\0\0-\230\0\0\0\0\3bbb\0\1\1\1\27\0\0\0J\203"
-  "\0\0\0U\2\0\0\0P\1\1\1\36\243\0\0\0\0\1\0\0\0G\222\0\0\0U\6\0\0\0R\0"
-  "\0\0G\0\0\0""6\0\0\0\"\2\2\2\17\0\0\0\1\203\0\0\0\0\6\1\1\1\23\0\0\0"
-  "N\21\21\21\0\0\0\0E\0\0\0D\0\0\0\1\227\0\0\0\0\3bbb\0\1\1\1\37\0\0\0"
-  "c\203\0\0\0q\2\0\0\0k\1\1\1(\243\0\0\0\0\1\0\0\0_\222\0\0\0q\6\0\0\0"
-  "m\0\0\0^\0\0\0H\0\0\0.\2\2\2\24\0\0\0\1\203\0\0\0\0\6\1\1\1\31\0\0\0"
-  "h\21\21\21\0\0\0\0\\\0\0\0[\0\0\0\1\227\0\0\0\0\3bbb\0\1\1\1&\0\0\0{"
-  "\203\0\0\0\215\2\0\0\0\206\1\1\1""2\243\0\0\0\0\1\0\0\0v\222\0\0\0\215"
-  "\6\0\0\0\210\0\0\0v\0\0\0Z\0\0\0""9\2\2\2\31\0\0\0\1\203\0\0\0\0\6\1"
-  "\1\1\40\0\0\0\202\21\21\21\1\0\0\0t\0\0\0r\0\0\0\1\227\0\0\0\0\3bbb\0"
-  "\1\1\1.\0\0\0\224\203\0\0\0\252\2\0\0\0\241\1\1\1<\243\0\0\0\0\1\0\0"
-  "\0\216\222\0\0\0\252\6\0\0\0\244\0\0\0\216\0\0\0l\0\0\0E\2\2\2\36\0\0"
-  "\0\2\203\0\0\0\0\6\1\1\1&\0\0\0\234\21\21\21\1\0\0\0\213\0\0\0\211\0"
-  "\0\0\2\227\0\0\0\0\3bbb\0\1\1\1""6\0\0\0\255\203\0\0\0\306\2\0\0\0\274"
-  "\1\1\1F\243\0\0\0\0\1\0\0\0\246\222\0\0\0\306\6\0\0\0\277\0\0\0\245\0"
-  "\0\0~\0\0\0P\2\2\2#\0\0\0\2\203\0\0\0\0\6\1\1\1-\0\0\0\266\21\21\21\1"
-  "\0\0\0\242\0\0\0\240\0\0\0\2\227\0\0\0\0\3bbb\0\1\1\1>\0\0\0\306\203"
-  "\0\0\0\342\2\0\0\0\327\1\1\1P\243\0\0\0\0\1\0\0\0\276\222\0\0\0\342\6"
-  "\0\0\0\332\0\0\0\275\0\0\0\220\0\0\0\\\2\2\2(\0\0\0\2\203\0\0\0\0\6\1"
-  "\1\1""3\0\0\0\320\21\21\21\1\0\0\0\271\0\0\0\267\0\0\0\2\231\0\0\0\0"
-  "\2\1\1\1\1\0\0\0\21\204\0\0\0\34\2\0\0\0\20\3\3\3\0\240\0\0\0\0\2\1\1"
-  "\1\7\0\0\0\32\227\0\0\0\34\11\0\0\0\31\1\1\1\21\3\3\3\10\1\1\1\0\2\2"
-  "\2\5\1\1\1\20\1\1\1\4\0\0\0\34\1\1\1\6\232\0\0\0\0\2\1\1\1\3\0\0\0\""
-  "\204\0\0\0""8\2\0\0\0\40\3\3\3\1\240\0\0\0\0\2\1\1\1\16\0\0\0""5\227"
-  "\0\0\0""8\11\0\0\0""2\1\1\1\"\3\3\3\20\1\1\1\1\2\2\2\12\1\1\1!\1\1\1"
-  "\11\0\0\0""8\1\1\1\14\232\0\0\0\0\3\1\1\1\5\0\0\0""3\0\0\0T\202\0\0\0"
-  "U\3\0\0\0T\0\0\0""1\3\3\3\2\240\0\0\0\0\2\1\1\1\25\0\0\0P\227\0\0\0U"
-  "\11\0\0\0L\1\1\1""4\3\3\3\30\1\1\1\2\2\2\2\17\1\1\1""2\1\1\1\15\0\0\0"
-  "T\1\1\1\23\232\0\0\0\0\3\1\1\1\6\0\0\0D\0\0\0p\202\0\0\0q\3\0\0\0p\0"
-  "\0\0A\3\3\3\2\240\0\0\0\0\2\1\1\1\34\0\0\0k\227\0\0\0q\11\0\0\0e\1\1"
-  "\1E\3\3\3\40\1\1\1\3\2\2\2\24\1\1\1C\1\1\1\22\0\0\0p\1\1\1\31\232\0\0"
-  "\0\0\2\1\1\1\10\0\0\0V\204\0\0\0\215\2\0\0\0Q\3\3\3\3\240\0\0\0\0\2\1"
-  "\1\1$\0\0\0\206\227\0\0\0\215\11\0\0\0~\1\1\1W\3\3\3)\1\1\1\3\2\2\2\31"
-  "\1\1\1S\1\1\1\26\0\0\0\214\1\1\1\37\232\0\0\0\0\3\1\1\1\12\0\0\0g\0\0"
-  "\0\251\202\0\0\0\252\3\0\0\0\251\0\0\0b\3\3\3\4\240\0\0\0\0\2\1\1\1+"
-  "\0\0\0\241\227\0\0\0\252\11\0\0\0\230\1\1\1h\3\3\3""1\1\1\1\4\2\2\2\36"
-  "\1\1\1d\1\1\1\33\0\0\0\250\1\1\1&\232\0\0\0\0\3\1\1\1\13\0\0\0x\0\0\0"
-  "\305\202\0\0\0\306\3\0\0\0\305\0\0\0r\3\3\3\4\240\0\0\0\0\2\1\1\1""2"
-  "\0\0\0\274\227\0\0\0\306\11\0\0\0\261\1\1\1z\3\3\3""9\1\1\1\5\2\2\2#"
-  "\1\1\1u\1\1\1\37\0\0\0\304\1\1\1,\232\0\0\0\0\3\1\1\1\15\0\0\0\211\0"
-  "\0\0\341\202\0\0\0\342\3\0\0\0\341\0\0\0\202\3\3\3\5\240\0\0\0\0\2\1"
-  "\1\1""9\0\0\0\327\227\0\0\0\342\11\0\0\0\312\1\1\1\213\3\3\3A\1\1\1\6"
-  "\2\2\2(\1\1\1\206\1\1\1$\0\0\0\340\1\1\1""2\234\0\0\0\0\2\1\1\1\11\0"
-  "\0\0\32\203\0\0\0\34\2\0\0\0\25\1\1\1\2\236\0\0\0\0\2\4\4\4\0\0\0\0\30"
-  "\233\0\0\0\34\2\0\0\0\31\0\0\0\16\202\1\1\1\2\1\0\0\0\12\235\0\0\0\0"
-  "\2\1\1\1\22\0\0\0""4\203\0\0\0""8\2\0\0\0*\1\1\1\4\236\0\0\0\0\2\4\4"
-  "\4\1\0\0\0""1\233\0\0\0""8\2\0\0\0""3\0\0\0\35\202\1\1\1\5\1\0\0\0\24"
-  "\235\0\0\0\0\2\1\1\1\33\0\0\0N\203\0\0\0U\2\0\0\0\77\1\1\1\6\236\0\0"
-  "\0\0\2\4\4\4\1\0\0\0J\233\0\0\0U\2\0\0\0L\0\0\0,\202\1\1\1\10\1\0\0\0"
-  "\36\235\0\0\0\0\2\1\1\1$\0\0\0h\203\0\0\0q\2\0\0\0T\1\1\1\10\236\0\0"
-  "\0\0\2\4\4\4\2\0\0\0c\233\0\0\0q\2\0\0\0f\0\0\0;\202\1\1\1\13\1\0\0\0"
-  "(\235\0\0\0\0\2\1\1\1-\0\0\0\202\203\0\0\0\215\2\0\0\0i\1\1\1\12\236"
-  "\0\0\0\0\2\4\4\4\2\0\0\0{\233\0\0\0\215\5\0\0\0\177\0\0\0J\1\1\1\15\1"
-  "\1\1\16\0\0\0""2\235\0\0\0\0\2\1\1\1""6\0\0\0\234\203\0\0\0\252\2\0\0"
-  "\0~\1\1\1\14\236\0\0\0\0\2\4\4\4\3\0\0\0\224\233\0\0\0\252\5\0\0\0\231"
-  "\0\0\0Y\1\1\1\20\1\1\1\21\0\0\0<\235\0\0\0\0\2\1\1\1\77\0\0\0\266\203"
-  "\0\0\0\306\2\0\0\0\223\1\1\1\16\236\0\0\0\0\2\4\4\4\3\0\0\0\255\233\0"
-  "\0\0\306\5\0\0\0\262\0\0\0h\1\1\1\23\1\1\1\24\0\0\0F\235\0\0\0\0\2\1"
-  "\1\1H\0\0\0\320\203\0\0\0\342\2\0\0\0\250\1\1\1\20\236\0\0\0\0\2\4\4"
-  "\4\4\0\0\0\306\233\0\0\0\342\5\0\0\0\314\0\0\0w\1\1\1\26\1\1\1\27\0\0"
-  "\0P\236\0\0\0\0\2\0\0\0\3\0\0\0\25\203\0\0\0\34\2\0\0\0\27\2\2\2\3\205"
-  "\0\0\0\0\2\11\11\11\0\3\3\3\1\202\1\1\1\5\2\2\2\2\2\7\7\7\0\222\0\0\0"
-  "\0\1\1\1\1\11\220\0\0\0\34\3\0\0\0\25\0\0\0\7\0\0\0\23\213\0\0\0\34\2"
-  "\0\0\0\33\0\0\0\15\237\0\0\0\0\2\0\0\0\6\0\0\0+\203\0\0\0""8\2\0\0\0"
-  "/\2\2\2\7\205\0\0\0\0\2\11\11\11\0\3\3\3\3\202\1\1\1\13\2\2\2\2\5\7\7"
-  "\7\0\222\0\0\0\0\1\1\1\1\22\220\0\0\0""8\3\0\0\0*\0\0\0\17\0\0\0'\213"
-  "\0\0\0""8\3\0\0\0""6\0\0\0\33\0\0\0\1\236\0\0\0\0\2\0\0\0\12\0\0\0@\203"
-  "\0\0\0U\2\0\0\0G\2\2\2\13\205\0\0\0\0\2\11\11\11\0\3\3\3\5\202\1\1\1"
-  "\21\2\2\2\2\10\7\7\7\1\222\0\0\0\0\1\1\1\1\33\220\0\0\0U\3\0\0\0\77\0"
-  "\0\0\26\0\0\0:\213\0\0\0U\3\0\0\0Q\0\0\0)\0\0\0\2\236\0\0\0\0\2\0\0\0"
-  "\15\0\0\0V\203\0\0\0q\2\0\0\0_\2\2\2\17\205\0\0\0\0\6\11\11\11\0\3\3"
-  "\3\7\1\1\1\26\1\1\1\27\2\2\2\13\7\7\7\1\222\0\0\0\0\1\1\1\1$\220\0\0"
-  "\0q\3\0\0\0T\0\0\0\36\0\0\0N\213\0\0\0q\3\0\0\0l\0\0\0""7\0\0\0\3\236"
-  "\0\0\0\0\2\0\0\0\20\0\0\0k\203\0\0\0\215\2\0\0\0w\2\2\2\22\205\0\0\0"
-  "\0\2\11\11\11\0\3\3\3\11\202\1\1\1\34\2\2\2\2\16\7\7\7\2\222\0\0\0\0"
-  "\1\1\1\1-\220\0\0\0\215\3\0\0\0i\0\0\0%\0\0\0a\213\0\0\0\215\3\0\0\0"
-  "\207\0\0\0E\0\0\0\3\236\0\0\0\0\2\0\0\0\24\0\0\0\201\203\0\0\0\252\2"
-  "\0\0\0\217\2\2\2\26\205\0\0\0\0\2\11\11\11\0\3\3\3\13\202\1\1\1\"\2\2"
-  "\2\2\21\7\7\7\2\222\0\0\0\0\1\1\1\1""6\220\0\0\0\252\3\0\0\0~\0\0\0-"
-  "\0\0\0u\213\0\0\0\252\3\0\0\0\242\0\0\0S\0\0\0\4\236\0\0\0\0\2\0\0\0"
-  "\27\0\0\0\226\203\0\0\0\306\2\0\0\0\247\2\2\2\32\205\0\0\0\0\6\11\11"
-  "\11\0\3\3\3\15\1\1\1'\1\1\1(\2\2\2\24\7\7\7\3\222\0\0\0\0\1\1\1\1\77"
-  "\220\0\0\0\306\3\0\0\0\223\0\0\0""4\0\0\0\210\213\0\0\0\306\3\0\0\0\275"
-  "\0\0\0a\0\0\0\5\236\0\0\0\0\2\0\0\0\32\0\0\0\254\203\0\0\0\342\2\0\0"
-  "\0\277\2\2\2\36\205\0\0\0\0\6\11\11\11\0\3\3\3\17\1\1\1-\1\1\1.\2\2\2"
-  "\27\7\7\7\3\222\0\0\0\0\1\1\1\1H\220\0\0\0\342\3\0\0\0\250\0\0\0<\0\0"
-  "\0\234\213\0\0\0\342\3\0\0\0\330\0\0\0o\0\0\0\6\237\0\0\0\0\2\2\2\2\0"
-  "\1\1\1\17\203\0\0\0\34\2\0\0\0\31\0\0\0\5\202\0\0\0\0\4\2\2\2\1\0\0\0"
-  "\13\0\0\0\26\0\0\0\33\203\0\0\0\34\6\0\0\0\32\0\0\0\26\0\0\0\21\0\0\0"
-  "\14\1\1\1\7\1\1\1\2\215\0\0\0\0\1\0\0\0\24\215\0\0\0\34\1\0\0\0\33\202"
-  "\0\0\0\34\3\1\1\1\6\0\0\0\0\0\0\0\3\215\0\0\0\34\2\0\0\0\26\3\3\3\3\236"
-  "\0\0\0\0\2\2\2\2\1\1\1\1\37\203\0\0\0""8\2\0\0\0""3\0\0\0\12\202\0\0"
-  "\0\0\4\2\2\2\2\0\0\0\27\0\0\0,\0\0\0""7\203\0\0\0""8\6\0\0\0""5\0\0\0"
-  ",\0\0\0#\0\0\0\30\1\1\1\16\1\1\1\4\215\0\0\0\0\1\0\0\0)\215\0\0\0""8"
-  "\1\0\0\0""6\202\0\0\0""8\3\1\1\1\14\0\0\0\0\0\0\0\7\215\0\0\0""8\2\0"
-  "\0\0,\3\3\3\6\236\0\0\0\0\3\2\2\2\2\1\1\1/\0\0\0T\202\0\0\0U\2\0\0\0"
-  "L\0\0\0\20\202\0\0\0\0\4\2\2\2\4\0\0\0#\0\0\0C\0\0\0S\202\0\0\0U\7\0"
-  "\0\0T\0\0\0O\0\0\0C\0\0\0""4\0\0\0%\1\1\1\25\1\1\1\7\215\0\0\0\0\1\0"
-  "\0\0=\215\0\0\0U\1\0\0\0Q\202\0\0\0U\3\1\1\1\22\0\0\0\0\0\0\0\13\215"
-  "\0\0\0U\2\0\0\0C\3\3\3\11\236\0\0\0\0\3\2\2\2\2\1\1\1\77\0\0\0p\202\0"
-  "\0\0q\2\0\0\0f\0\0\0\25\202\0\0\0\0\4\2\2\2\5\0\0\0/\0\0\0Y\0\0\0o\202"
-  "\0\0\0q\7\0\0\0p\0\0\0j\0\0\0Y\0\0\0F\0\0\0""1\1\1\1\34\1\1\1\11\215"
-  "\0\0\0\0\1\0\0\0R\215\0\0\0q\1\0\0\0l\202\0\0\0q\3\1\1\1\30\0\0\0\0\0"
-  "\0\0\16\215\0\0\0q\2\0\0\0Y\3\3\3\14\236\0\0\0\0\2\2\2\2\3\1\1\1O\203"
-  "\0\0\0\215\2\0\0\0\177\0\0\0\32\202\0\0\0\0\4\2\2\2\6\0\0\0;\0\0\0o\0"
-  "\0\0\212\203\0\0\0\215\6\0\0\0\204\0\0\0p\0\0\0W\0\0\0=\1\1\1$\1\1\1"
-  "\14\215\0\0\0\0\1\0\0\0f\215\0\0\0\215\1\0\0\0\207\202\0\0\0\215\3\1"
-  "\1\1\36\0\0\0\0\0\0\0\22\215\0\0\0\215\2\0\0\0o\3\3\3\17\236\0\0\0\0"
-  "\3\2\2\2\4\1\1\1_\0\0\0\251\202\0\0\0\252\2\0\0\0\231\0\0\0\40\202\0"
-  "\0\0\0\4\2\2\2\10\0\0\0G\0\0\0\206\0\0\0\246\202\0\0\0\252\7\0\0\0\251"
-  "\0\0\0\237\0\0\0\206\0\0\0i\0\0\0J\1\1\1+\1\1\1\16\215\0\0\0\0\1\0\0"
-  "\0{\215\0\0\0\252\1\0\0\0\242\202\0\0\0\252\3\1\1\1$\0\0\0\0\0\0\0\26"
-  "\215\0\0\0\252\2\0\0\0\206\3\3\3\22\236\0\0\0\0\3\2\2\2\4\1\1\1o\0\0"
-  "\0\305\202\0\0\0\306\2\0\0\0\262\0\0\0%\202\0\0\0\0\4\2\2\2\11\0\0\0"
-  "S\0\0\0\234\0\0\0\302\202\0\0\0\306\7\0\0\0\305\0\0\0\271\0\0\0\235\0"
-  "\0\0z\0\0\0V\1\1\1""2\1\1\1\21\215\0\0\0\0\1\0\0\0\217\215\0\0\0\306"
-  "\1\0\0\0\275\202\0\0\0\306\3\1\1\1*\0\0\0\0\0\0\0\31\215\0\0\0\306\2"
-  "\0\0\0\234\3\3\3\25\236\0\0\0\0\3\2\2\2\5\1\1\1\177\0\0\0\341\202\0\0"
-  "\0\342\2\0\0\0\314\0\0\0*\202\0\0\0\0\4\2\2\2\12\0\0\0_\0\0\0\262\0\0"
-  "\0\336\202\0\0\0\342\7\0\0\0\341\0\0\0\324\0\0\0\263\0\0\0\214\0\0\0"
-  "b\1\1\1""9\1\1\1\23\215\0\0\0\0\1\0\0\0\244\215\0\0\0\342\1\0\0\0\330"
-  "\202\0\0\0\342\3\1\1\1""0\0\0\0\0\0\0\0\35\215\0\0\0\342\2\0\0\0\262"
-  "\3\3\3\30\240\0\0\0\0\2\1\1\1\13\0\0\0\33\202\0\0\0\34\4\0\0\0\32\1\1"
-  "\1\7\1\1\1\14\0\0\0\32\214\0\0\0\34\7\0\0\0\30\1\1\1\24\0\0\0\17\1\1"
-  "\1\12\1\1\1\6\4\4\4\2\7\7\7\0\204\0\0\0\0\2\23\23\24\0\0\0\0\12\216\0"
-  "\0\0\34\6\0\0\0\23\0\0\0\31\0\0\0\34\1\1\1\11\0\0\0\0\1\1\1\6\216\0\0"
-  "\0\34\2\0\0\0\30\3\3\3\2\237\0\0\0\0\2\1\1\1\26\0\0\0""7\202\0\0\0""8"
-  "\4\0\0\0""4\1\1\1\17\1\1\1\31\0\0\0""4\214\0\0\0""8\7\0\0\0""1\1\1\1"
-  "(\0\0\0\36\1\1\1\24\1\1\1\14\4\4\4\4\7\7\7\0\204\0\0\0\0\2\23\23\24\0"
-  "\0\0\0\24\216\0\0\0""8\6\0\0\0'\0\0\0""2\0\0\0""8\1\1\1\22\0\0\0\0\1"
-  "\1\1\15\216\0\0\0""8\2\0\0\0""1\3\3\3\4\237\0\0\0\0\2\1\1\1!\0\0\0S\202"
-  "\0\0\0U\4\0\0\0N\1\1\1\27\1\1\1&\0\0\0N\213\0\0\0U\10\0\0\0T\0\0\0J\1"
-  "\1\1<\0\0\0.\1\1\1\37\1\1\1\22\4\4\4\7\7\7\7\0\204\0\0\0\0\3\23\23\24"
-  "\0\0\0\0\37\0\0\0T\215\0\0\0U\6\0\0\0;\0\0\0K\0\0\0U\1\1\1\33\0\0\0\0"
-  "\1\1\1\24\216\0\0\0U\2\0\0\0J\3\3\3\7\237\0\0\0\0\2\1\1\1,\0\0\0o\202"
-  "\0\0\0q\4\0\0\0h\1\1\1\37\1\1\1""2\0\0\0h\213\0\0\0q\10\0\0\0p\0\0\0"
-  "c\1\1\1P\0\0\0=\1\1\1)\1\1\1\30\4\4\4\11\7\7\7\0\204\0\0\0\0\3\23\23"
-  "\24\0\0\0\0)\0\0\0p\215\0\0\0q\6\0\0\0O\0\0\0d\0\0\0q\1\1\1$\0\0\0\0"
-  "\1\1\1\33\216\0\0\0q\2\0\0\0b\3\3\3\11\237\0\0\0\0\2\1\1\1""7\0\0\0\212"
-  "\202\0\0\0\215\4\0\0\0\203\1\1\1&\1\1\1\77\0\0\0\202\213\0\0\0\215\10"
-  "\0\0\0\214\0\0\0|\1\1\1d\0\0\0M\1\1\1""3\1\1\1\36\4\4\4\13\7\7\7\1\204"
-  "\0\0\0\0\2\23\23\24\1\0\0\0""3\216\0\0\0\215\6\0\0\0c\0\0\0}\0\0\0\215"
-  "\1\1\1-\0\0\0\0\1\1\1\"\216\0\0\0\215\2\0\0\0{\3\3\3\14\237\0\0\0\0\2"
-  "\1\1\1B\0\0\0\246\202\0\0\0\252\4\0\0\0\235\1\1\1.\1\1\1L\0\0\0\234\213"
-  "\0\0\0\252\10\0\0\0\250\0\0\0\225\1\1\1x\0\0\0\\\1\1\1>\1\1\1$\4\4\4"
-  "\16\7\7\7\1\204\0\0\0\0\3\23\23\24\1\0\0\0>\0\0\0\251\215\0\0\0\252\6"
-  "\0\0\0w\0\0\0\226\0\0\0\252\1\1\1""6\0\0\0\0\1\1\1)\216\0\0\0\252\2\0"
-  "\0\0\224\3\3\3\16\237\0\0\0\0\2\1\1\1M\0\0\0\302\202\0\0\0\306\4\0\0"
-  "\0\267\1\1\1""6\1\1\1X\0\0\0\266\213\0\0\0\306\10\0\0\0\304\0\0\0\256"
-  "\1\1\1\214\0\0\0l\1\1\1H\1\1\1*\4\4\4\20\7\7\7\1\204\0\0\0\0\3\23\23"
-  "\24\1\0\0\0H\0\0\0\305\215\0\0\0\306\6\0\0\0\213\0\0\0\257\0\0\0\306"
-  "\1\1\1\77\0\0\0\0\1\1\1""0\216\0\0\0\306\2\0\0\0\254\3\3\3\21\237\0\0"
-  "\0\0\2\1\1\1X\0\0\0\336\202\0\0\0\342\4\0\0\0\321\1\1\1>\1\1\1e\0\0\0"
-  "\320\213\0\0\0\342\10\0\0\0\340\0\0\0\307\1\1\1\240\0\0\0{\1\1\1R\1\1"
-  "\1""0\4\4\4\22\7\7\7\1\204\0\0\0\0\3\23\23\24\1\0\0\0R\0\0\0\341\215"
-  "\0\0\0\342\6\0\0\0\237\0\0\0\310\0\0\0\342\1\1\1H\0\0\0\0\1\1\1""7\216"
-  "\0\0\0\342\2\0\0\0\305\3\3\3\23\240\0\0\0\0\2\1\1\1\10\0\0\0\33\227\0"
-  "\0\0\34\2\0\0\0\32\0\0\0\30\203\0\0\0\25\1\0\0\0\31\217\0\0\0\34\6\0"
-  "\0\0\31\1\1\1\13\0\0\0\34\0\0\0\32\0\0\0\21\0\0\0\31\217\0\0\0\34\1\0"
-  "\0\0\24\240\0\0\0\0\2\1\1\1\21\0\0\0""6\227\0\0\0""8\6\0\0\0""5\0\0\0"
-  "0\0\0\0+\0\0\0*\0\0\0+\0\0\0""2\217\0\0\0""8\6\0\0\0""2\1\1\1\26\0\0"
-  "\0""8\0\0\0""5\0\0\0#\0\0\0""3\217\0\0\0""8\1\0\0\0(\240\0\0\0\0\2\1"
-  "\1\1\31\0\0\0R\202\0\0\0U\1\0\0\0T\223\0\0\0U\10\0\0\0T\0\0\0O\0\0\0"
-  "H\0\0\0A\0\0\0\77\0\0\0A\0\0\0K\0\0\0T\216\0\0\0U\6\0\0\0L\1\1\1\"\0"
-  "\0\0U\0\0\0O\0\0\0""5\0\0\0M\217\0\0\0U\1\0\0\0<\240\0\0\0\0\2\1\1\1"
-  "\"\0\0\0m\202\0\0\0q\1\0\0\0p\223\0\0\0q\10\0\0\0p\0\0\0j\0\0\0`\0\0"
-  "\0W\0\0\0T\0\0\0V\0\0\0d\0\0\0p\216\0\0\0q\6\0\0\0e\1\1\1-\0\0\0q\0\0"
-  "\0j\0\0\0G\0\0\0f\217\0\0\0q\1\0\0\0P\240\0\0\0\0\2\1\1\1*\0\0\0\210"
-  "\226\0\0\0\215\7\0\0\0\214\0\0\0\204\0\0\0x\0\0\0m\0\0\0i\0\0\0l\0\0"
-  "\0~\217\0\0\0\215\6\0\0\0\177\1\1\1""8\0\0\0\215\0\0\0\204\0\0\0X\0\0"
-  "\0\200\217\0\0\0\215\1\0\0\0d\240\0\0\0\0\2\1\1\1""3\0\0\0\244\202\0"
-  "\0\0\252\1\0\0\0\251\223\0\0\0\252\10\0\0\0\250\0\0\0\237\0\0\0\220\0"
-  "\0\0\203\0\0\0~\0\0\0\202\0\0\0\227\0\0\0\251\216\0\0\0\252\6\0\0\0\230"
-  "\1\1\1D\0\0\0\252\0\0\0\237\0\0\0j\0\0\0\232\217\0\0\0\252\1\0\0\0x\240"
-  "\0\0\0\0\2\1\1\1;\0\0\0\277\202\0\0\0\306\1\0\0\0\305\223\0\0\0\306\10"
-  "\0\0\0\304\0\0\0\271\0\0\0\250\0\0\0\231\0\0\0\223\0\0\0\227\0\0\0\260"
-  "\0\0\0\305\216\0\0\0\306\6\0\0\0\262\1\1\1O\0\0\0\306\0\0\0\271\0\0\0"
-  "|\0\0\0\263\217\0\0\0\306\1\0\0\0\214\240\0\0\0\0\2\1\1\1D\0\0\0\332"
-  "\202\0\0\0\342\1\0\0\0\341\223\0\0\0\342\10\0\0\0\340\0\0\0\324\0\0\0"
-  "\300\0\0\0\257\0\0\0\250\0\0\0\255\0\0\0\311\0\0\0\341\216\0\0\0\342"
-  "\6\0\0\0\313\1\1\1Z\0\0\0\342\0\0\0\324\0\0\0\216\0\0\0\315\217\0\0\0"
-  "\342\1\0\0\0\240\241\0\0\0\0\1\2\2\2\11\255\0\0\0\34\3\1\1\1\12\0\0\0"
-  "\13\0\0\0\30\222\0\0\0\34\1\1\1\1\6\240\0\0\0\0\1\2\2\2\22\255\0\0\0"
-  "8\3\1\1\1\25\0\0\0\27\0\0\0""0\222\0\0\0""8\1\1\1\1\14\240\0\0\0\0\2"
-  "\2\2\2\33\0\0\0T\254\0\0\0U\4\1\1\1\40\0\0\0\"\0\0\0I\0\0\0T\221\0\0"
-  "\0U\1\1\1\1\22\240\0\0\0\0\2\2\2\2$\0\0\0p\254\0\0\0q\4\1\1\1+\0\0\0"
-  ".\0\0\0a\0\0\0p\221\0\0\0q\1\1\1\1\30\240\0\0\0\0\2\2\2\2-\0\0\0\214"
-  "\254\0\0\0\215\3\1\1\1""6\0\0\0""9\0\0\0z\222\0\0\0\215\1\1\1\1\36\240"
-  "\0\0\0\0\2\2\2\2""6\0\0\0\250\254\0\0\0\252\4\1\1\1A\0\0\0E\0\0\0\222"
-  "\0\0\0\251\221\0\0\0\252\1\1\1\1$\240\0\0\0\0\2\2\2\2\77\0\0\0\304\254"
-  "\0\0\0\306\4\1\1\1L\0\0\0P\0\0\0\253\0\0\0\305\221\0\0\0\306\1\1\1\1"
-  "*\240\0\0\0\0\2\2\2\2H\0\0\0\340\254\0\0\0\342\4\1\1\1W\0\0\0\\\0\0\0"
-  "\303\0\0\0\341\221\0\0\0\342\1\1\1\1""0\241\0\0\0\0\1\0\0\0\26\254\0"
-  "\0\0\34\5\0\0\0\33\1\1\1\15\1\1\1\6\1\1\1\17\0\0\0\33\220\0\0\0\34\1"
-  "\0\0\0\16\241\0\0\0\0\1\0\0\0,\254\0\0\0""8\5\0\0\0""7\1\1\1\32\1\1\1"
-  "\15\1\1\1\37\0\0\0""7\220\0\0\0""8\1\0\0\0\34\241\0\0\0\0\1\0\0\0B\254"
-  "\0\0\0U\5\0\0\0S\1\1\1'\1\1\1\24\1\1\1.\0\0\0S\220\0\0\0U\1\0\0\0+\241"
-  "\0\0\0\0\1\0\0\0X\254\0\0\0q\5\0\0\0n\1\1\1""4\1\1\1\33\1\1\1>\0\0\0"
-  "o\220\0\0\0q\1\0\0\0""9\241\0\0\0\0\1\0\0\0n\254\0\0\0\215\5\0\0\0\212"
-  "\1\1\1A\1\1\1!\1\1\1M\0\0\0\213\220\0\0\0\215\1\0\0\0H\241\0\0\0\0\1"
-  "\0\0\0\204\254\0\0\0\252\5\0\0\0\246\1\1\1N\1\1\1(\1\1\1]\0\0\0\247\220"
-  "\0\0\0\252\1\0\0\0V\241\0\0\0\0\1\0\0\0\232\254\0\0\0\306\5\0\0\0\301"
-  "\1\1\1[\1\1\1/\1\1\1l\0\0\0\303\220\0\0\0\306\1\0\0\0e\241\0\0\0\0\1"
-  "\0\0\0\260\254\0\0\0\342\5\0\0\0\335\1\1\1h\1\1\1""6\1\1\1|\0\0\0\337"
-  "\220\0\0\0\342\1\0\0\0s\240\0\0\0\0\1\2\2\2\10\302\0\0\0\34\1\0\0\0\20"
-  "\240\0\0\0\0\1\2\2\2\20\302\0\0\0""8\1\0\0\0\40\240\0\0\0\0\2\2\2\2\30"
-  "\0\0\0T\301\0\0\0U\1\0\0\0""0\240\0\0\0\0\2\2\2\2\40\0\0\0p\301\0\0\0"
-  "q\1\0\0\0@\240\0\0\0\0\1\2\2\2(\302\0\0\0\215\1\0\0\0Q\240\0\0\0\0\2"
-  "\2\2\2""0\0\0\0\251\301\0\0\0\252\1\0\0\0a\240\0\0\0\0\2\2\2\2""8\0\0"
-  "\0\305\301\0\0\0\306\1\0\0\0q\240\0\0\0\0\2\2\2\2@\0\0\0\341\301\0\0"
-  "\0\342\1\0\0\0\201\240\0\0\0\0\1\0\0\0\30\302\0\0\0\34\1\1\1\1\10\237"
-  "\0\0\0\0\2\0\0\0\1\0\0\0""0\302\0\0\0""8\1\1\1\1\20\237\0\0\0\0\2\0\0"
-  "\0\2\0\0\0I\302\0\0\0U\1\1\1\1\30\237\0\0\0\0\2\0\0\0\3\0\0\0a\302\0"
-  "\0\0q\1\1\1\1\40\237\0\0\0\0\2\0\0\0\3\0\0\0z\302\0\0\0\215\1\1\1\1("
-  "\237\0\0\0\0\2\0\0\0\4\0\0\0\222\302\0\0\0\252\1\1\1\1""0\237\0\0\0\0"
-  "\2\0\0\0\5\0\0\0\253\302\0\0\0\306\1\1\1\1""8\237\0\0\0\0\2\0\0\0\6\0"
-  "\0\0\303\302\0\0\0\342\1\1\1\1@\237\0\0\0\0\1\1\1\1\13\302\0\0\0\34\2"
-  "\0\0\0\22\6\6\6\0\237\0\0\0\0\1\1\1\1\27\302\0\0\0""8\2\0\0\0%\6\6\6"
-  "\0\237\0\0\0\0\1\1\1\1#\266\0\0\0U\1\0\0\0T\213\0\0\0U\2\0\0\0""7\6\6"
-  "\6\0\237\0\0\0\0\1\1\1\1.\266\0\0\0q\1\0\0\0p\213\0\0\0q\2\0\0\0J\6\6"
-  "\6\0\237\0\0\0\0\1\1\1\1:\302\0\0\0\215\2\0\0\0\\\6\6\6\0\237\0\0\0\0"
-  "\1\1\1\1F\266\0\0\0\252\1\0\0\0\251\213\0\0\0\252\2\0\0\0o\6\6\6\0\237"
-  "\0\0\0\0\1\1\1\1Q\266\0\0\0\306\1\0\0\0\305\213\0\0\0\306\2\0\0\0\201"
-  "\6\6\6\0\237\0\0\0\0\1\1\1\1]\266\0\0\0\342\1\0\0\0\341\213\0\0\0\342"
-  "\2\0\0\0\224\6\6\6\0\236\0\0\0\0\2\20\20\20\0\0\0\0\30\264\0\0\0\34\3"
-  "\1\1\1\23\1\1\1\11\0\0\0\16\212\0\0\0\34\2\0\0\0\23\5\5\5\0\237\0\0\0"
-  "\0\2\20\20\20\0\0\0\0""1\264\0\0\0""8\3\1\1\1'\1\1\1\22\0\0\0\35\212"
-  "\0\0\0""8\2\0\0\0'\5\5\5\1\237\0\0\0\0\2\20\20\20\0\0\0\0J\263\0\0\0"
-  "U\5\0\0\0T\1\1\1;\1\1\1\34\0\0\0,\0\0\0T\211\0\0\0U\2\0\0\0;\5\5\5\2"
-  "\237\0\0\0\0\2\20\20\20\0\0\0\0c\263\0\0\0q\5\0\0\0p\1\1\1O\1\1\1%\0"
-  "\0\0:\0\0\0p\211\0\0\0q\2\0\0\0N\5\5\5\2\237\0\0\0\0\2\20\20\20\1\0\0"
-  "\0{\264\0\0\0\215\3\1\1\1c\1\1\1.\0\0\0I\212\0\0\0\215\2\0\0\0b\5\5\5"
-  "\3\237\0\0\0\0\2\20\20\20\1\0\0\0\224\263\0\0\0\252\5\0\0\0\251\1\1\1"
-  "w\1\1\1""8\0\0\0X\0\0\0\251\211\0\0\0\252\2\0\0\0v\5\5\5\4\237\0\0\0"
-  "\0\2\20\20\20\1\0\0\0\255\263\0\0\0\306\5\0\0\0\305\1\1\1\213\1\1\1A"
-  "\0\0\0f\0\0\0\305\211\0\0\0\306\2\0\0\0\211\5\5\5\4\237\0\0\0\0\2\20"
-  "\20\20\1\0\0\0\306\263\0\0\0\342\5\0\0\0\341\1\1\1\237\1\1\1J\0\0\0u"
-  "\0\0\0\341\211\0\0\0\342\2\0\0\0\235\5\5\5\5\237\0\0\0\0\1\1\1\1\7\263"
-  "\0\0\0\34\6\0\0\0\24\2\2\2\10\1\1\1\16\0\0\0\31\0\0\0\34\0\0\0\33\210"
-  "\0\0\0\34\2\1\1\1\17\2\2\2\0\240\0\0\0\0\1\1\1\1\17\263\0\0\0""8\6\0"
-  "\0\0)\2\2\2\21\1\1\1\34\0\0\0""3\0\0\0""8\0\0\0""7\210\0\0\0""8\2\1\1"
-  "\1\36\2\2\2\0\240\0\0\0\0\1\1\1\1\27\263\0\0\0U\6\0\0\0>\2\2\2\32\1\1"
-  "\1*\0\0\0M\0\0\0U\0\0\0S\207\0\0\0U\3\0\0\0T\1\1\1-\2\2\2\0\240\0\0\0"
-  "\0\1\1\1\1\37\263\0\0\0q\6\0\0\0S\2\2\2#\1\1\1""8\0\0\0g\0\0\0q\0\0\0"
-  "o\207\0\0\0q\3\0\0\0p\1\1\1<\2\2\2\0\240\0\0\0\0\1\1\1\1'\263\0\0\0\215"
-  "\6\0\0\0g\2\2\2,\1\1\1F\0\0\0\200\0\0\0\215\0\0\0\212\207\0\0\0\215\3"
-  "\0\0\0\214\1\1\1K\2\2\2\1\240\0\0\0\0\1\1\1\1/\263\0\0\0\252\6\0\0\0"
-  "|\2\2\2""5\1\1\1T\0\0\0\232\0\0\0\252\0\0\0\246\207\0\0\0\252\3\0\0\0"
-  "\250\1\1\1Z\2\2\2\1\240\0\0\0\0\1\1\1\1""7\263\0\0\0\306\6\0\0\0\221"
-  "\2\2\2>\1\1\1b\0\0\0\264\0\0\0\306\0\0\0\302\207\0\0\0\306\3\0\0\0\304"
-  "\1\1\1i\2\2\2\1\240\0\0\0\0\1\1\1\1\77\263\0\0\0\342\6\0\0\0\246\2\2"
-  "\2G\1\1\1p\0\0\0\316\0\0\0\342\0\0\0\336\207\0\0\0\342\3\0\0\0\340\1"
-  "\1\1x\2\2\2\1\240\0\0\0\0\1\0\0\0\21\262\0\0\0\34\2\0\0\0\25\0\0\0\24"
-  "\203\0\0\0\34\2\0\0\0\20\0\0\0\10\206\0\0\0\34\2\0\0\0\30\1\1\1\7\242"
-  "\0\0\0\0\1\0\0\0\"\262\0\0\0""8\2\0\0\0*\0\0\0)\203\0\0\0""8\2\0\0\0"
-  "\40\0\0\0\21\206\0\0\0""8\2\0\0\0""1\1\1\1\16\242\0\0\0\0\1\0\0\0""3"
-  "\261\0\0\0U\4\0\0\0T\0\0\0@\0\0\0>\0\0\0T\202\0\0\0U\2\0\0\0""1\0\0\0"
-  "\32\206\0\0\0U\2\0\0\0J\1\1\1\25\242\0\0\0\0\1\0\0\0D\261\0\0\0q\4\0"
-  "\0\0p\0\0\0U\0\0\0S\0\0\0p\202\0\0\0q\2\0\0\0A\0\0\0#\206\0\0\0q\2\0"
-  "\0\0b\1\1\1\34\242\0\0\0\0\1\0\0\0V\261\0\0\0\215\4\0\0\0\214\0\0\0k"
-  "\0\0\0h\0\0\0\214\202\0\0\0\215\2\0\0\0R\0\0\0+\206\0\0\0\215\2\0\0\0"
-  "{\1\1\1$\242\0\0\0\0\1\0\0\0g\261\0\0\0\252\4\0\0\0\250\0\0\0\200\0\0"
-  "\0}\0\0\0\250\202\0\0\0\252\2\0\0\0b\0\0\0""4\206\0\0\0\252\2\0\0\0\224"
-  "\1\1\1+\242\0\0\0\0\1\0\0\0x\261\0\0\0\306\4\0\0\0\304\0\0\0\226\0\0"
-  "\0\222\0\0\0\304\202\0\0\0\306\2\0\0\0s\0\0\0=\206\0\0\0\306\2\0\0\0"
-  "\254\1\1\1""2\242\0\0\0\0\1\0\0\0\211\261\0\0\0\342\4\0\0\0\340\0\0\0"
-  "\253\0\0\0\247\0\0\0\340\202\0\0\0\342\2\0\0\0\203\0\0\0F\206\0\0\0\342"
-  "\2\0\0\0\305\1\1\1""9\241\0\0\0\0\2\34\34\34\0\0\0\0\30\266\0\0\0\34"
-  "\3\0\0\0\15\4\4\4\3\0\0\0\27\204\0\0\0\34\3\0\0\0\33\1\1\1\16\2\2\2\1"
-  "\242\0\0\0\0\2\34\34\34\0\0\0\0""1\266\0\0\0""8\3\0\0\0\33\4\4\4\6\0"
-  "\0\0/\204\0\0\0""8\3\0\0\0""6\1\1\1\35\2\2\2\2\242\0\0\0\0\2\34\34\34"
-  "\0\0\0\0I\266\0\0\0U\3\0\0\0(\4\4\4\11\0\0\0G\204\0\0\0U\3\0\0\0Q\1\1"
-  "\1,\2\2\2\3\242\0\0\0\0\2\34\34\34\0\0\0\0b\266\0\0\0q\3\0\0\0""6\4\4"
-  "\4\14\0\0\0_\204\0\0\0q\3\0\0\0l\1\1\1:\2\2\2\4\242\0\0\0\0\2\34\34\34"
-  "\0\0\0\0z\266\0\0\0\215\3\0\0\0C\4\4\4\17\0\0\0w\204\0\0\0\215\3\0\0"
-  "\0\210\1\1\1I\2\2\2\5\242\0\0\0\0\2\34\34\34\0\0\0\0\223\266\0\0\0\252"
-  "\3\0\0\0Q\4\4\4\22\0\0\0\217\204\0\0\0\252\3\0\0\0\243\1\1\1X\2\2\2\6"
-  "\242\0\0\0\0\2\34\34\34\0\0\0\0\253\266\0\0\0\306\3\0\0\0^\4\4\4\25\0"
-  "\0\0\247\204\0\0\0\306\3\0\0\0\276\1\1\1f\2\2\2\7\242\0\0\0\0\2\34\34"
-  "\34\0\0\0\0\304\266\0\0\0\342\3\0\0\0l\4\4\4\30\0\0\0\277\204\0\0\0\342"
-  "\3\0\0\0\331\1\1\1u\2\2\2\10\242\0\0\0\0\1\3\3\3\2\266\0\0\0\34\3\1\1"
-  "\1\17\1\1\1\7\0\0\0\31\204\0\0\0\34\2\0\0\0\22\3\3\3\3\244\0\0\0\0\1"
-  "\3\3\3\5\266\0\0\0""8\3\1\1\1\37\1\1\1\16\0\0\0""2\204\0\0\0""8\2\0\0"
-  "\0$\3\3\3\6\244\0\0\0\0\1\3\3\3\7\266\0\0\0U\3\1\1\1/\1\1\1\25\0\0\0"
-  "L\203\0\0\0U\3\0\0\0T\0\0\0""6\3\3\3\12\244\0\0\0\0\1\3\3\3\12\266\0"
-  "\0\0q\3\1\1\1>\1\1\1\34\0\0\0e\203\0\0\0q\3\0\0\0p\0\0\0H\3\3\3\15\244"
-  "\0\0\0\0\1\3\3\3\14\266\0\0\0\215\3\1\1\1N\1\1\1$\0\0\0~\203\0\0\0\215"
-  "\3\0\0\0\214\0\0\0Z\3\3\3\21\244\0\0\0\0\1\3\3\3\17\266\0\0\0\252\3\1"
-  "\1\1^\1\1\1+\0\0\0\230\203\0\0\0\252\3\0\0\0\250\0\0\0l\3\3\3\24\244"
-  "\0\0\0\0\1\3\3\3\21\266\0\0\0\306\3\1\1\1m\1\1\1""2\0\0\0\261\203\0\0"
-  "\0\306\3\0\0\0\304\0\0\0~\3\3\3\30\244\0\0\0\0\1\3\3\3\24\266\0\0\0\342"
-  "\3\1\1\1}\1\1\1""9\0\0\0\312\203\0\0\0\342\3\0\0\0\340\0\0\0\220\3\3"
-  "\3\33\244\0\0\0\0\1\1\1\1\7\265\0\0\0\34\2\1\1\1\27\0\0\0\21\204\0\0"
-  "\0\34\2\0\0\0\23\1\1\1\5\246\0\0\0\0\1\1\1\1\16\265\0\0\0""8\2\1\1\1"
-  "/\0\0\0\"\204\0\0\0""8\2\0\0\0&\1\1\1\12\246\0\0\0\0\1\1\1\1\25\265\0"
-  "\0\0U\3\1\1\1G\0\0\0""4\0\0\0T\202\0\0\0U\3\0\0\0T\0\0\0:\1\1\1\17\246"
-  "\0\0\0\0\1\1\1\1\34\265\0\0\0q\3\1\1\1^\0\0\0E\0\0\0p\202\0\0\0q\3\0"
-  "\0\0p\0\0\0M\1\1\1\24\246\0\0\0\0\1\1\1\1#\265\0\0\0\215\3\1\1\1v\0\0"
-  "\0W\0\0\0\214\202\0\0\0\215\3\0\0\0\214\0\0\0`\1\1\1\32\246\0\0\0\0\1"
-  "\1\1\1*\265\0\0\0\252\3\1\1\1\216\0\0\0h\0\0\0\250\202\0\0\0\252\3\0"
-  "\0\0\250\0\0\0t\1\1\1\37\246\0\0\0\0\1\1\1\1""1\265\0\0\0\306\3\1\1\1"
-  "\245\0\0\0z\0\0\0\304\202\0\0\0\306\3\0\0\0\304\0\0\0\207\1\1\1$\246"
-  "\0\0\0\0\1\1\1\1""8\265\0\0\0\342\3\1\1\1\275\0\0\0\213\0\0\0\340\202"
-  "\0\0\0\342\3\0\0\0\340\0\0\0\232\1\1\1)\246\0\0\0\0\1\1\1\1\12\270\0"
-  "\0\0\34\3\0\0\0\33\0\0\0\22\1\1\1\4\250\0\0\0\0\1\1\1\1\24\270\0\0\0"
-  "8\3\0\0\0""7\0\0\0$\1\1\1\11\250\0\0\0\0\1\1\1\1\37\265\0\0\0U\1\0\0"
-  "\0T\202\0\0\0U\3\0\0\0S\0\0\0""6\1\1\1\16\250\0\0\0\0\1\1\1\1)\265\0"
-  "\0\0q\1\0\0\0p\202\0\0\0q\3\0\0\0o\0\0\0H\1\1\1\23\250\0\0\0\0\1\1\1"
-  "\1""4\270\0\0\0\215\3\0\0\0\212\0\0\0Z\1\1\1\30\250\0\0\0\0\1\1\1\1>"
-  "\265\0\0\0\252\1\0\0\0\251\202\0\0\0\252\3\0\0\0\246\0\0\0l\1\1\1\35"
-  "\250\0\0\0\0\1\1\1\1I\265\0\0\0\306\1\0\0\0\305\202\0\0\0\306\3\0\0\0"
-  "\302\0\0\0~\1\1\1\"\250\0\0\0\0\1\1\1\1S\265\0\0\0\342\1\0\0\0\341\202"
-  "\0\0\0\342\3\0\0\0\336\0\0\0\220\1\1\1'\250\0\0\0\0\1\0\0\0\14\266\0"
-  "\0\0\34\3\0\0\0\33\1\1\1\20\1\1\1\3\252\0\0\0\0\1\0\0\0\30\266\0\0\0"
-  "8\3\0\0\0""6\1\1\1\40\1\1\1\7\252\0\0\0\0\1\0\0\0%\266\0\0\0U\3\0\0\0"
-  "Q\1\1\1""1\1\1\1\13\252\0\0\0\0\1\0\0\0""1\266\0\0\0q\3\0\0\0l\1\1\1"
-  "A\1\1\1\16\252\0\0\0\0\1\0\0\0=\266\0\0\0\215\3\0\0\0\210\1\1\1R\1\1"
-  "\1\22\252\0\0\0\0\1\0\0\0J\266\0\0\0\252\3\0\0\0\243\1\1\1b\1\1\1\26"
-  "\252\0\0\0\0\1\0\0\0V\266\0\0\0\306\3\0\0\0\276\1\1\1s\1\1\1\31\252\0"
-  "\0\0\0\1\0\0\0b\266\0\0\0\342\3\0\0\0\331\1\1\1\203\1\1\1\35\252\0\0"
-  "\0\0\1\1\1\1\15\264\0\0\0\34\3\0\0\0\33\1\1\1\17\2\2\2\2\254\0\0\0\0"
-  "\1\1\1\1\32\264\0\0\0""8\3\0\0\0""7\1\1\1\36\2\2\2\4\254\0\0\0\0\1\1"
-  "\1\1(\264\0\0\0U\3\0\0\0R\1\1\1-\2\2\2\7\254\0\0\0\0\1\1\1\1""5\264\0"
-  "\0\0q\3\0\0\0n\1\1\1<\2\2\2\11\254\0\0\0\0\1\1\1\1C\264\0\0\0\215\3\0"
-  "\0\0\211\1\1\1K\2\2\2\14\254\0\0\0\0\1\1\1\1P\264\0\0\0\252\3\0\0\0\245"
-  "\1\1\1Z\2\2\2\16\254\0\0\0\0\1\1\1\1^\264\0\0\0\306\3\0\0\0\300\1\1\1"
-  "i\2\2\2\21\254\0\0\0\0\1\1\1\1k\264\0\0\0\342\3\0\0\0\334\1\1\1x\2\2"
-  "\2\23\254\0\0\0\0\1\1\1\1\15\264\0\0\0\34\1\1\1\1\12\256\0\0\0\0\1\1"
-  "\1\1\32\264\0\0\0""8\1\1\1\1\24\256\0\0\0\0\1\1\1\1(\264\0\0\0U\1\1\1"
-  "\1\36\256\0\0\0\0\1\1\1\1""5\264\0\0\0q\1\1\1\1(\256\0\0\0\0\1\1\1\1"
-  "B\264\0\0\0\215\1\1\1\1""2\256\0\0\0\0\1\1\1\1P\264\0\0\0\252\1\1\1\1"
-  "<\256\0\0\0\0\1\1\1\1]\264\0\0\0\306\1\1\1\1F\256\0\0\0\0\1\1\1\1j\264"
-  "\0\0\0\342\1\1\1\1P\256\0\0\0\0\1\0\0\0\14\263\0\0\0\34\2\0\0\0\33\7"
-  "\7\7\0\256\0\0\0\0\1\0\0\0\30\263\0\0\0""8\2\0\0\0""7\7\7\7\0\256\0\0"
-  "\0\0\1\0\0\0$\263\0\0\0U\2\0\0\0S\7\7\7\0\256\0\0\0\0\1\0\0\0""0\263"
-  "\0\0\0q\2\0\0\0n\7\7\7\0\256\0\0\0\0\1\0\0\0=\263\0\0\0\215\2\0\0\0\212"
-  "\7\7\7\1\256\0\0\0\0\1\0\0\0I\263\0\0\0\252\2\0\0\0\246\7\7\7\1\256\0"
-  "\0\0\0\1\0\0\0U\263\0\0\0\306\2\0\0\0\301\7\7\7\1\256\0\0\0\0\1\0\0\0"
-  "a\263\0\0\0\342\2\0\0\0\335\7\7\7\1\256\0\0\0\0\1\1\1\1\12\264\0\0\0"
-  "\34\1\3\3\3\2\256\0\0\0\0\1\1\1\1\24\264\0\0\0""8\1\3\3\3\4\256\0\0\0"
-  "\0\1\1\1\1\37\263\0\0\0U\2\0\0\0T\3\3\3\7\256\0\0\0\0\1\1\1\1)\263\0"
-  "\0\0q\2\0\0\0p\3\3\3\11\256\0\0\0\0\1\1\1\1""4\263\0\0\0\215\2\0\0\0"
-  "\214\3\3\3\13\256\0\0\0\0\1\1\1\1>\263\0\0\0\252\2\0\0\0\250\3\3\3\16"
-  "\256\0\0\0\0\1\1\1\1I\263\0\0\0\306\2\0\0\0\304\3\3\3\20\256\0\0\0\0"
-  "\1\1\1\1S\263\0\0\0\342\2\0\0\0\340\3\3\3\22\256\0\0\0\0\1\0\0\0\7\264"
-  "\0\0\0\34\1\0\0\0\22\256\0\0\0\0\1\0\0\0\17\264\0\0\0""8\1\0\0\0$\256"
-  "\0\0\0\0\1\0\0\0\27\264\0\0\0U\1\0\0\0""6\256\0\0\0\0\1\0\0\0\37\264"
-  "\0\0\0q\1\0\0\0H\256\0\0\0\0\1\0\0\0'\264\0\0\0\215\1\0\0\0Z\256\0\0"
-  "\0\0\1\0\0\0/\264\0\0\0\252\1\0\0\0l\256\0\0\0\0\1\0\0\0""7\264\0\0\0"
-  "\306\1\0\0\0~\256\0\0\0\0\1\0\0\0\77\264\0\0\0\342\1\0\0\0\220\256\0"
-  "\0\0\0\1\2\2\2\4\265\0\0\0\34\2\0\0\0\17\6\6\6\0\254\0\0\0\0\1\2\2\2"
-  "\10\265\0\0\0""8\2\0\0\0\36\6\6\6\0\254\0\0\0\0\1\2\2\2\15\265\0\0\0"
-  "U\2\0\0\0-\6\6\6\0\254\0\0\0\0\1\2\2\2\21\265\0\0\0q\2\0\0\0<\6\6\6\0"
-  "\254\0\0\0\0\1\2\2\2\26\265\0\0\0\215\2\0\0\0K\6\6\6\0\254\0\0\0\0\1"
-  "\2\2\2\32\265\0\0\0\252\2\0\0\0Z\6\6\6\0\254\0\0\0\0\1\2\2\2\37\265\0"
-  "\0\0\306\2\0\0\0i\6\6\6\0\254\0\0\0\0\1\2\2\2#\265\0\0\0\342\2\0\0\0"
-  "x\6\6\6\0\254\0\0\0\0\1\1\1\1\11\266\0\0\0\34\1\0\0\0\15\254\0\0\0\0"
-  "\1\1\1\1\22\266\0\0\0""8\1\0\0\0\32\254\0\0\0\0\1\1\1\1\34\266\0\0\0"
-  "U\1\0\0\0'\254\0\0\0\0\1\1\1\1%\266\0\0\0q\1\0\0\0""4\254\0\0\0\0\1\1"
-  "\1\1/\266\0\0\0\215\1\0\0\0A\254\0\0\0\0\1\1\1\1""8\266\0\0\0\252\1\0"
-  "\0\0N\254\0\0\0\0\1\1\1\1B\266\0\0\0\306\1\0\0\0[\254\0\0\0\0\1\1\1\1"
-  "K\266\0\0\0\342\1\0\0\0h\253\0\0\0\0\2\0\0\0\5\0\0\0\32\267\0\0\0\34"
-  "\1\1\1\1\11\252\0\0\0\0\2\0\0\0\13\0\0\0""5\267\0\0\0""8\1\1\1\1\22\252"
-  "\0\0\0\0\2\0\0\0\21\0\0\0P\266\0\0\0U\2\0\0\0T\1\1\1\34\252\0\0\0\0\2"
-  "\0\0\0\27\0\0\0k\266\0\0\0q\2\0\0\0p\1\1\1%\252\0\0\0\0\2\0\0\0\34\0"
-  "\0\0\205\267\0\0\0\215\1\1\1\1/\252\0\0\0\0\2\0\0\0\"\0\0\0\240\266\0"
-  "\0\0\252\2\0\0\0\251\1\1\1""8\252\0\0\0\0\2\0\0\0(\0\0\0\273\266\0\0"
-  "\0\306\2\0\0\0\305\1\1\1B\252\0\0\0\0\2\0\0\0.\0\0\0\326\266\0\0\0\342"
-  "\2\0\0\0\341\1\1\1K\251\0\0\0\0\2\1\1\1\5\0\0\0\32\270\0\0\0\34\2\0\0"
-  "\0\33\2\2\2\4\250\0\0\0\0\2\1\1\1\12\0\0\0""4\270\0\0\0""8\2\0\0\0""6"
-  "\2\2\2\10\250\0\0\0\0\2\1\1\1\20\0\0\0N\270\0\0\0U\2\0\0\0Q\2\2\2\14"
-  "\250\0\0\0\0\2\1\1\1\25\0\0\0h\270\0\0\0q\2\0\0\0l\2\2\2\20\250\0\0\0"
-  "\0\2\1\1\1\32\0\0\0\203\270\0\0\0\215\2\0\0\0\207\2\2\2\24\250\0\0\0"
-  "\0\2\1\1\1\40\0\0\0\235\270\0\0\0\252\2\0\0\0\242\2\2\2\30\250\0\0\0"
-  "\0\2\1\1\1%\0\0\0\267\270\0\0\0\306\2\0\0\0\275\2\2\2\34\250\0\0\0\0"
-  "\2\1\1\1*\0\0\0\321\270\0\0\0\342\2\0\0\0\330\2\2\2\40\247\0\0\0\0\2"
-  "\1\1\1\3\0\0\0\31\261\0\0\0\34\3\0\0\0\23\0\0\0\16\0\0\0\26\206\0\0\0"
-  "\34\1\0\0\0\23\247\0\0\0\0\2\1\1\1\7\0\0\0""3\261\0\0\0""8\3\0\0\0&\0"
-  "\0\0\34\0\0\0,\206\0\0\0""8\1\0\0\0'\247\0\0\0\0\2\1\1\1\12\0\0\0M\261"
-  "\0\0\0U\4\0\0\0""9\0\0\0*\0\0\0B\0\0\0T\205\0\0\0U\1\0\0\0;\247\0\0\0"
-  "\0\2\1\1\1\16\0\0\0f\261\0\0\0q\4\0\0\0L\0\0\0""8\0\0\0X\0\0\0p\205\0"
-  "\0\0q\1\0\0\0O\247\0\0\0\0\2\1\1\1\21\0\0\0\200\261\0\0\0\215\4\0\0\0"
-  "_\0\0\0G\0\0\0n\0\0\0\214\205\0\0\0\215\1\0\0\0b\247\0\0\0\0\2\1\1\1"
-  "\25\0\0\0\232\261\0\0\0\252\4\0\0\0r\0\0\0U\0\0\0\204\0\0\0\250\205\0"
-  "\0\0\252\1\0\0\0v\247\0\0\0\0\2\1\1\1\30\0\0\0\263\261\0\0\0\306\4\0"
-  "\0\0\205\0\0\0c\0\0\0\232\0\0\0\304\205\0\0\0\306\1\0\0\0\212\247\0\0"
-  "\0\0\2\1\1\1\34\0\0\0\315\261\0\0\0\342\4\0\0\0\230\0\0\0q\0\0\0\260"
-  "\0\0\0\340\205\0\0\0\342\1\0\0\0\236\247\0\0\0\0\1\0\0\0\24\262\0\0\0"
-  "\34\7\0\0\0\31\2\2\2\2\0\0\0\0\4\4\4\2\0\0\0\13\0\0\0\24\0\0\0\33\202"
-  "\0\0\0\34\2\0\0\0\33\10\10\10\0\246\0\0\0\0\1\0\0\0)\262\0\0\0""8\7\0"
-  "\0\0""2\2\2\2\5\0\0\0\0\4\4\4\5\0\0\0\27\0\0\0)\0\0\0""7\202\0\0\0""8"
-  "\2\0\0\0""7\10\10\10\0\246\0\0\0\0\1\0\0\0=\262\0\0\0U\7\0\0\0K\2\2\2"
-  "\10\0\0\0\0\4\4\4\10\0\0\0\"\0\0\0>\0\0\0R\202\0\0\0U\2\0\0\0S\10\10"
-  "\10\1\246\0\0\0\0\1\0\0\0R\262\0\0\0q\7\0\0\0d\2\2\2\13\0\0\0\0\4\4\4"
-  "\13\0\0\0.\0\0\0S\0\0\0n\202\0\0\0q\2\0\0\0o\10\10\10\1\246\0\0\0\0\1"
-  "\0\0\0f\262\0\0\0\215\7\0\0\0~\2\2\2\15\0\0\0\0\4\4\4\16\0\0\0""9\0\0"
-  "\0h\0\0\0\211\202\0\0\0\215\2\0\0\0\212\10\10\10\1\246\0\0\0\0\1\0\0"
-  "\0{\262\0\0\0\252\7\0\0\0\227\2\2\2\20\0\0\0\0\4\4\4\21\0\0\0E\0\0\0"
-  "}\0\0\0\245\202\0\0\0\252\2\0\0\0\246\10\10\10\2\246\0\0\0\0\1\0\0\0"
-  "\217\262\0\0\0\306\7\0\0\0\260\2\2\2\23\0\0\0\0\4\4\4\24\0\0\0P\0\0\0"
-  "\222\0\0\0\300\202\0\0\0\306\2\0\0\0\302\10\10\10\2\246\0\0\0\0\1\0\0"
-  "\0\244\262\0\0\0\342\7\0\0\0\311\2\2\2\26\0\0\0\0\4\4\4\27\0\0\0\\\0"
-  "\0\0\247\0\0\0\334\202\0\0\0\342\2\0\0\0\336\10\10\10\2\245\0\0\0\0\1"
-  "\3\3\3\2\203\0\0\0\34\3\0\0\0\33\0\0\0\24\1\1\1\24\256\0\0\0\34\2\0\0"
-  "\0\27\0\0\0\1\202\0\0\0\0\6\34\34\35\0\4\4\4\2\1\1\1\11\0\0\0\17\1\1"
-  "\1\16\16\16\16\0\245\0\0\0\0\1\3\3\3\4\203\0\0\0""8\3\0\0\0""7\0\0\0"
-  "(\1\1\1)\256\0\0\0""8\2\0\0\0.\0\0\0\3\202\0\0\0\0\6\34\34\35\0\4\4\4"
-  "\4\1\1\1\22\0\0\0\37\1\1\1\34\16\16\16\0\245\0\0\0\0\2\3\3\3\6\0\0\0"
-  "T\202\0\0\0U\3\0\0\0S\0\0\0<\1\1\1>\256\0\0\0U\2\0\0\0E\0\0\0\5\202\0"
-  "\0\0\0\6\34\34\35\0\4\4\4\6\1\1\1\34\0\0\0.\1\1\1*\16\16\16\0\245\0\0"
-  "\0\0\2\3\3\3\10\0\0\0p\202\0\0\0q\3\0\0\0o\0\0\0P\1\1\1S\256\0\0\0q\2"
-  "\0\0\0\\\0\0\0\6\202\0\0\0\0\6\34\34\35\0\4\4\4\10\1\1\1%\0\0\0>\1\1"
-  "\1""8\16\16\16\0\245\0\0\0\0\1\3\3\3\13\203\0\0\0\215\3\0\0\0\213\0\0"
-  "\0d\1\1\1g\256\0\0\0\215\2\0\0\0s\0\0\0\10\202\0\0\0\0\6\34\34\35\0\4"
-  "\4\4\12\1\1\1/\0\0\0M\1\1\1G\16\16\16\0\245\0\0\0\0\2\3\3\3\15\0\0\0"
-  "\251\202\0\0\0\252\3\0\0\0\247\0\0\0x\1\1\1|\256\0\0\0\252\2\0\0\0\212"
-  "\0\0\0\12\202\0\0\0\0\6\34\34\35\0\4\4\4\14\1\1\1""8\0\0\0]\1\1\1U\16"
-  "\16\16\0\245\0\0\0\0\2\3\3\3\17\0\0\0\305\202\0\0\0\306\3\0\0\0\303\0"
-  "\0\0\214\1\1\1\221\256\0\0\0\306\2\0\0\0\241\0\0\0\13\202\0\0\0\0\6\34"
-  "\34\35\0\4\4\4\16\1\1\1B\0\0\0l\1\1\1c\16\16\16\0\245\0\0\0\0\2\3\3\3"
-  "\21\0\0\0\341\202\0\0\0\342\3\0\0\0\337\0\0\0\240\1\1\1\246\256\0\0\0"
-  "\342\2\0\0\0\270\0\0\0\15\202\0\0\0\0\6\34\34\35\0\4\4\4\20\1\1\1K\0"
-  "\0\0|\1\1\1q\16\16\16\0\245\0\0\0\0\7\10\10\10\0\1\1\1\26\0\0\0\27\0"
-  "\0\0\16\2\2\2\3***\0\1\1\1\24\206\0\0\0\34\6\1\1\1\23\1\1\1\4\0\0\0\12"
-  "\0\0\0\21\0\0\0\27\0\0\0\33\227\0\0\0\34\202\0\0\0\32\212\0\0\0\34\2"
-  "\0\0\0\25\0\0\0\1\254\0\0\0\0\7\10\10\10\1\1\1\1,\0\0\0.\0\0\0\35\2\2"
-  "\2\7***\0\1\1\1)\206\0\0\0""8\6\1\1\1&\1\1\1\10\0\0\0\25\0\0\0#\0\0\0"
-  "/\0\0\0""7\227\0\0\0""8\202\0\0\0""5\212\0\0\0""8\2\0\0\0+\0\0\0\2\254"
-  "\0\0\0\0\7\10\10\10\2\1\1\1B\0\0\0E\0\0\0,\2\2\2\13***\0\1\1\1=\206\0"
-  "\0\0U\6\1\1\1""9\1\1\1\15\0\0\0\37\0\0\0""5\0\0\0G\0\0\0S\227\0\0\0U"
-  "\2\0\0\0O\0\0\0P\212\0\0\0U\2\0\0\0@\0\0\0\3\254\0\0\0\0\7\10\10\10\3"
-  "\1\1\1X\0\0\0\\\0\0\0;\2\2\2\17***\0\1\1\1R\206\0\0\0q\6\1\1\1L\1\1\1"
-  "\21\0\0\0*\0\0\0F\0\0\0_\0\0\0o\227\0\0\0q\2\0\0\0j\0\0\0k\212\0\0\0"
-  "q\2\0\0\0V\0\0\0\4\254\0\0\0\0\7\10\10\10\4\1\1\1n\0\0\0s\0\0\0J\2\2"
-  "\2\23***\0\1\1\1f\206\0\0\0\215\6\1\1\1`\1\1\1\26\0\0\0""4\0\0\0X\0\0"
-  "\0w\0\0\0\213\227\0\0\0\215\2\0\0\0\204\0\0\0\206\212\0\0\0\215\2\0\0"
-  "\0k\0\0\0\5\254\0\0\0\0\7\10\10\10\5\1\1\1\204\0\0\0\212\0\0\0Y\2\2\2"
-  "\27***\0\1\1\1{\206\0\0\0\252\6\1\1\1s\1\1\1\32\0\0\0\77\0\0\0j\0\0\0"
-  "\217\0\0\0\247\227\0\0\0\252\2\0\0\0\237\0\0\0\241\212\0\0\0\252\2\0"
-  "\0\0\201\0\0\0\6\254\0\0\0\0\7\10\10\10\6\1\1\1\232\0\0\0\241\0\0\0h"
-  "\2\2\2\33***\0\1\1\1\217\206\0\0\0\306\6\1\1\1\206\1\1\1\37\0\0\0I\0"
-  "\0\0{\0\0\0\247\0\0\0\303\227\0\0\0\306\2\0\0\0\271\0\0\0\274\212\0\0"
-  "\0\306\2\0\0\0\226\0\0\0\7\254\0\0\0\0\7\10\10\10\7\1\1\1\260\0\0\0\270"
-  "\0\0\0w\2\2\2\37***\0\1\1\1\244\206\0\0\0\342\6\1\1\1\231\1\1\1#\0\0"
-  "\0T\0\0\0\215\0\0\0\277\0\0\0\337\227\0\0\0\342\2\0\0\0\324\0\0\0\327"
-  "\212\0\0\0\342\2\0\0\0\254\0\0\0\10\255\0\0\0\0\2\32\32\32\0\13\13\13"
-  "\0\202\0\0\0\0\2\3\3\3\1\0\0\0\33\205\0\0\0\34\2\1\1\1\17\4\4\4\0\203"
-  "\0\0\0\0\11\6\6\6\0\1\1\1\1\0\0\0\6\1\1\1\12\0\0\0\16\0\0\0\21\0\0\0"
-  "\23\0\0\0\26\0\0\0\27\202\0\0\0\31\2\0\0\0\32\1\1\1\32\203\0\0\0\31\15"
-  "\0\0\0\30\0\0\0\26\0\0\0\25\0\0\0\22\0\0\1\20\1\1\1\15\0\0\0\12\0\0\0"
-  "\6\0\0\0\3\2\2\2\0\1\1\1\2\0\0\0\15\0\0\0\31\211\0\0\0\34\1\1\1\1\22"
-  "\255\0\0\0\0\2\32\32\32\0\13\13\13\0\202\0\0\0\0\2\3\3\3\2\0\0\0""7\205"
-  "\0\0\0""8\2\1\1\1\36\4\4\4\0\203\0\0\0\0\15\6\6\6\0\1\1\1\3\0\0\0\14"
-  "\1\1\1\24\0\0\0\34\0\0\0\"\0\0\0'\0\0\0,\0\0\0/\0\0\0""2\0\0\0""3\0\0"
-  "\0""4\1\1\1""5\203\0\0\0""3\15\0\0\0""0\0\0\0-\0\0\0*\0\0\0%\0\0\1\40"
-  "\1\1\1\32\0\0\0\24\0\0\0\15\0\0\0\6\2\2\2\1\1\1\1\4\0\0\0\32\0\0\0""2"
-  "\211\0\0\0""8\1\1\1\1$\255\0\0\0\0\2\32\32\32\0\13\13\13\0\202\0\0\0"
-  "\0\2\3\3\3\4\0\0\0R\205\0\0\0U\2\1\1\1-\4\4\4\0\203\0\0\0\0\15\6\6\6"
-  "\0\1\1\1\5\0\0\0\22\1\1\1\36\0\0\0*\0\0\0""4\0\0\0;\0\0\0B\0\0\0G\0\0"
-  "\0K\0\0\0M\0\0\0O\1\1\1O\202\0\0\0M\16\0\0\0L\0\0\0H\0\0\0D\0\0\0\77"
-  "\0\0\0""8\0\0\1""1\1\1\1(\0\0\0\37\0\0\0\24\0\0\0\11\2\2\2\1\1\1\1\6"
-  "\0\0\0(\0\0\0K\211\0\0\0U\1\1\1\1""6\255\0\0\0\0\2\32\32\32\0\13\13\13"
-  "\0\202\0\0\0\0\2\3\3\3\5\0\0\0n\205\0\0\0q\2\1\1\1<\4\4\4\0\203\0\0\0"
-  "\0\15\6\6\6\0\1\1\1\6\0\0\0\30\1\1\1(\0\0\0""8\0\0\0E\0\0\0N\0\0\0X\0"
-  "\0\0^\0\0\0d\0\0\0g\0\0\0i\1\1\1j\202\0\0\0g\16\0\0\0f\0\0\0`\0\0\0Z"
-  "\0\0\0T\0\0\0K\0\0\1A\1\1\1""5\0\0\0)\0\0\0\33\0\0\0\14\2\2\2\2\1\1\1"
-  "\10\0\0\0""5\0\0\0d\211\0\0\0q\1\1\1\1H\255\0\0\0\0\2\32\32\32\0\13\13"
-  "\13\0\202\0\0\0\0\2\3\3\3\7\0\0\0\211\205\0\0\0\215\2\1\1\1L\4\4\4\1"
-  "\203\0\0\0\0\15\6\6\6\0\1\1\1\10\0\0\0\36\1\1\1""3\0\0\0F\0\0\0V\0\0"
-  "\0b\0\0\0o\0\0\0v\0\0\0~\0\0\0\201\0\0\0\204\1\1\1\204\202\0\0\0\201"
-  "\16\0\0\0\177\0\0\0x\0\0\0q\0\0\0i\0\0\0]\0\0\1Q\1\1\1C\0\0\0""4\0\0"
-  "\0\"\0\0\0\17\2\2\2\2\1\1\1\12\0\0\0B\0\0\0}\211\0\0\0\215\1\1\1\1Z\255"
-  "\0\0\0\0\2\32\32\32\0\13\13\13\0\202\0\0\0\0\2\3\3\3\10\0\0\0\245\205"
-  "\0\0\0\252\2\1\1\1[\4\4\4\1\203\0\0\0\0\15\6\6\6\0\1\1\1\12\0\0\0$\1"
-  "\1\1=\0\0\0T\0\0\0h\0\0\0v\0\0\0\205\0\0\0\216\0\0\0\227\0\0\0\233\0"
-  "\0\0\236\1\1\1\237\202\0\0\0\233\16\0\0\0\231\0\0\0\220\0\0\0\210\0\0"
-  "\0~\0\0\0p\0\0\1b\1\1\1P\0\0\0>\0\0\0)\0\0\0\22\2\2\2\3\1\1\1\14\0\0"
-  "\0P\0\0\0\226\211\0\0\0\252\1\1\1\1l\255\0\0\0\0\2\32\32\32\0\13\13\13"
-  "\0\202\0\0\0\0\2\3\3\3\12\0\0\0\300\205\0\0\0\306\2\1\1\1j\4\4\4\1\203"
-  "\0\0\0\0\15\6\6\6\0\1\1\1\13\0\0\0*\1\1\1G\0\0\0b\0\0\0y\0\0\0\211\0"
-  "\0\0\233\0\0\0\245\0\0\0\260\0\0\0\265\0\0\0\271\1\1\1\271\202\0\0\0"
-  "\265\16\0\0\0\262\0\0\0\250\0\0\0\236\0\0\0\223\0\0\0\203\0\0\1r\1\1"
-  "\1^\0\0\0I\0\0\0""0\0\0\0\25\2\2\2\3\1\1\1\16\0\0\0]\0\0\0\257\211\0"
-  "\0\0\306\1\1\1\1~\255\0\0\0\0\2\32\32\32\0\13\13\13\0\202\0\0\0\0\2\3"
-  "\3\3\13\0\0\0\334\205\0\0\0\342\2\1\1\1y\4\4\4\1\203\0\0\0\0\15\6\6\6"
-  "\0\1\1\1\15\0\0\0""0\1\1\1Q\0\0\0p\0\0\0\212\0\0\0\235\0\0\0\261\0\0"
-  "\0\275\0\0\0\311\0\0\0\317\0\0\0\323\1\1\1\324\202\0\0\0\317\16\0\0\0"
-  "\314\0\0\0\300\0\0\0\265\0\0\0\250\0\0\0\226\0\0\1\202\1\1\1k\0\0\0S"
-  "\0\0\0""7\0\0\0\30\2\2\2\4\1\1\1\20\0\0\0j\0\0\0\310\211\0\0\0\342\1"
-  "\1\1\1\220\261\0\0\0\0\1\1\1\1\11\204\0\0\0\34\3\0\0\0\33\0\0\0\13\11"
-  "\11\11\0\215\0\0\0\0\4\6\6\6\0\0\0\0\0\1\1\1\0\13\13\13\0\202\0\0\0\0"
-  "\1\10\10\10\0\214\0\0\0\0\3\1\1\1\0\1\1\1\12\0\0\0\26\210\0\0\0\34\1"
-  "\1\1\1\10\260\0\0\0\0\1\1\1\1\23\204\0\0\0""8\3\0\0\0""7\0\0\0\27\11"
-  "\11\11\0\215\0\0\0\0\4\6\6\6\0\0\0\0\0\1\1\1\0\13\13\13\0\202\0\0\0\0"
-  "\1\10\10\10\0\214\0\0\0\0\3\1\1\1\1\1\1\1\24\0\0\0-\210\0\0\0""8\1\1"
-  "\1\1\20\260\0\0\0\0\1\1\1\1\34\204\0\0\0U\3\0\0\0S\0\0\0#\11\11\11\0"
-  "\215\0\0\0\0\4\6\6\6\0\0\0\0\0\1\1\1\1\13\13\13\1\202\0\0\0\0\1\10\10"
-  "\10\0\214\0\0\0\0\3\1\1\1\2\1\1\1\36\0\0\0C\210\0\0\0U\1\1\1\1\30\260"
-  "\0\0\0\0\1\1\1\1&\204\0\0\0q\3\0\0\0o\0\0\0/\11\11\11\0\215\0\0\0\0\4"
-  "\6\6\6\0\0\0\0\0\1\1\1\1\13\13\13\1\202\0\0\0\0\1\10\10\10\0\214\0\0"
-  "\0\0\3\1\1\1\3\1\1\1(\0\0\0Z\210\0\0\0q\1\1\1\1\40\260\0\0\0\0\1\1\1"
-  "\1/\204\0\0\0\215\3\0\0\0\213\0\0\0:\11\11\11\0\215\0\0\0\0\4\6\6\6\0"
-  "\0\0\0\1\1\1\1\1\13\13\13\1\202\0\0\0\1\1\10\10\10\0\214\0\0\0\0\3\1"
-  "\1\1\3\1\1\1""3\0\0\0p\210\0\0\0\215\1\1\1\1(\260\0\0\0\0\1\1\1\1""9"
-  "\204\0\0\0\252\3\0\0\0\247\0\0\0F\11\11\11\0\215\0\0\0\0\4\6\6\6\0\0"
-  "\0\0\1\1\1\1\2\13\13\13\2\202\0\0\0\1\1\10\10\10\0\214\0\0\0\0\3\1\1"
-  "\1\4\1\1\1=\0\0\0\207\210\0\0\0\252\1\1\1\1""0\260\0\0\0\0\1\1\1\1B\204"
-  "\0\0\0\306\3\0\0\0\303\0\0\0R\11\11\11\0\215\0\0\0\0\4\6\6\6\0\0\0\0"
-  "\1\1\1\1\2\13\13\13\2\202\0\0\0\1\1\10\10\10\0\214\0\0\0\0\3\1\1\1\5"
-  "\1\1\1G\0\0\0\235\210\0\0\0\306\1\1\1\1""8\260\0\0\0\0\1\1\1\1L\204\0"
-  "\0\0\342\3\0\0\0\337\0\0\0^\11\11\11\0\215\0\0\0\0\4\6\6\6\0\0\0\0\1"
-  "\1\1\1\2\13\13\13\2\202\0\0\0\1\1\10\10\10\0\214\0\0\0\0\3\1\1\1\6\1"
-  "\1\1Q\0\0\0\264\210\0\0\0\342\1\1\1\1@\260\0\0\0\0\1\0\0\0\22\203\0\0"
-  "\0\34\2\0\0\0\33\0\0\0\10\244\0\0\0\0\4\6\6\6\0\1\1\1\6\1\1\1\22\0\0"
-  "\0\33\205\0\0\0\34\1\1\1\1\22\260\0\0\0\0\1\0\0\0$\203\0\0\0""8\2\0\0"
-  "\0""6\0\0\0\21\244\0\0\0\0\4\6\6\6\0\1\1\1\14\1\1\1$\0\0\0""7\205\0\0"
-  "\0""8\1\1\1\1$\260\0\0\0\0\1\0\0\0""7\203\0\0\0U\2\0\0\0Q\0\0\0\32\244"
-  "\0\0\0\0\4\6\6\6\0\1\1\1\23\1\1\1""7\0\0\0R\205\0\0\0U\1\1\1\1""6\260"
-  "\0\0\0\0\1\0\0\0I\203\0\0\0q\2\0\0\0l\0\0\0\"\244\0\0\0\0\4\6\6\6\0\1"
-  "\1\1\31\1\1\1I\0\0\0n\205\0\0\0q\1\1\1\1H\260\0\0\0\0\1\0\0\0\\\203\0"
-  "\0\0\215\2\0\0\0\210\0\0\0+\244\0\0\0\0\4\6\6\6\0\1\1\1\37\1\1\1[\0\0"
-  "\0\211\205\0\0\0\215\1\1\1\1Z\260\0\0\0\0\1\0\0\0n\203\0\0\0\252\2\0"
-  "\0\0\243\0\0\0""4\244\0\0\0\0\4\6\6\6\0\1\1\1&\1\1\1n\0\0\0\245\205\0"
-  "\0\0\252\1\1\1\1l\260\0\0\0\0\1\0\0\0\201\203\0\0\0\306\2\0\0\0\276\0"
-  "\0\0<\244\0\0\0\0\4\6\6\6\0\1\1\1,\1\1\1\200\0\0\0\300\205\0\0\0\306"
-  "\1\1\1\1~\260\0\0\0\0\1\0\0\0\223\203\0\0\0\342\2\0\0\0\331\0\0\0E\244"
-  "\0\0\0\0\4\6\6\6\0\1\1\1""2\1\1\1\222\0\0\0\334\205\0\0\0\342\1\1\1\1"
-  "\220\257\0\0\0\0\2\16\16\16\0\0\0\0\32\202\0\0\0\34\2\0\0\0\31\1\1\1"
-  "\5\250\0\0\0\0\3\1\1\1\2\1\1\1\14\0\0\0\27\203\0\0\0\34\1\0\0\0\21\257"
-  "\0\0\0\0\2\16\16\16\0\0\0\0""4\202\0\0\0""8\2\0\0\0""3\1\1\1\13\250\0"
-  "\0\0\0\3\1\1\1\4\1\1\1\31\0\0\0/\203\0\0\0""8\1\0\0\0\"\257\0\0\0\0\2"
-  "\16\16\16\1\0\0\0O\202\0\0\0U\2\0\0\0L\1\1\1\21\250\0\0\0\0\3\1\1\1\7"
-  "\1\1\1&\0\0\0G\203\0\0\0U\1\0\0\0""3\257\0\0\0\0\2\16\16\16\1\0\0\0i"
-  "\202\0\0\0q\2\0\0\0f\1\1\1\26\250\0\0\0\0\3\1\1\1\11\1\1\1""3\0\0\0_"
-  "\203\0\0\0q\1\0\0\0D\257\0\0\0\0\2\16\16\16\1\0\0\0\204\202\0\0\0\215"
-  "\2\0\0\0\177\1\1\1\34\250\0\0\0\0\3\1\1\1\14\1\1\1@\0\0\0v\203\0\0\0"
-  "\215\1\0\0\0V\257\0\0\0\0\2\16\16\16\2\0\0\0\236\202\0\0\0\252\2\0\0"
-  "\0\231\1\1\1\"\250\0\0\0\0\3\1\1\1\16\1\1\1M\0\0\0\216\203\0\0\0\252"
-  "\1\0\0\0g\257\0\0\0\0\2\16\16\16\2\0\0\0\271\202\0\0\0\306\2\0\0\0\262"
-  "\1\1\1'\250\0\0\0\0\3\1\1\1\21\1\1\1Z\0\0\0\246\203\0\0\0\306\1\0\0\0"
-  "x\257\0\0\0\0\2\16\16\16\2\0\0\0\323\202\0\0\0\342\2\0\0\0\314\1\1\1"
-  "-\250\0\0\0\0\3\1\1\1\23\1\1\1g\0\0\0\276\203\0\0\0\342\1\0\0\0\211\257"
-  "\0\0\0\0\1\3\3\3\3\202\0\0\0\34\2\0\0\0\26\2\2\2\3\253\0\0\0\0\5\7\7"
-  "\10\0\1\1\1\5\0\0\0\15\1\1\1\21\1\1\1\3\257\0\0\0\0\1\3\3\3\7\202\0\0"
-  "\0""8\2\0\0\0,\2\2\2\6\253\0\0\0\0\5\7\7\10\0\1\1\1\12\0\0\0\33\1\1\1"
-  "#\1\1\1\6\257\0\0\0\0\1\3\3\3\13\202\0\0\0U\2\0\0\0C\2\2\2\11\253\0\0"
-  "\0\0\5\7\7\10\0\1\1\1\17\0\0\0)\1\1\1""5\1\1\1\12\257\0\0\0\0\1\3\3\3"
-  "\17\202\0\0\0q\2\0\0\0Y\2\2\2\14\253\0\0\0\0\5\7\7\10\0\1\1\1\24\0\0"
-  "\0""7\1\1\1G\1\1\1\15\257\0\0\0\0\1\3\3\3\22\202\0\0\0\215\2\0\0\0o\2"
-  "\2\2\20\253\0\0\0\0\5\7\7\10\0\1\1\1\32\0\0\0E\1\1\1Y\1\1\1\21\257\0"
-  "\0\0\0\1\3\3\3\26\202\0\0\0\252\2\0\0\0\206\2\2\2\23\253\0\0\0\0\5\7"
-  "\7\10\0\1\1\1\37\0\0\0S\1\1\1k\1\1\1\24\257\0\0\0\0\1\3\3\3\32\202\0"
-  "\0\0\306\2\0\0\0\234\2\2\2\26\253\0\0\0\0\5\7\7\10\0\1\1\1$\0\0\0a\1"
-  "\1\1}\1\1\1\30\257\0\0\0\0\1\3\3\3\36\202\0\0\0\342\2\0\0\0\262\2\2\2"
-  "\31\253\0\0\0\0\5\7\7\10\0\1\1\1)\0\0\0o\1\1\1\217\1\1\1\33\257\0\0\0"
-  "\0\4\3\3\3\2\0\0\0\32\1\1\1\17\1\1\1\1\340\0\0\0\0\4\3\3\3\5\0\0\0""4"
-  "\1\1\1\37\1\1\1\2\340\0\0\0\0\4\3\3\3\10\0\0\0O\1\1\1/\1\1\1\3\340\0"
-  "\0\0\0\4\3\3\3\12\0\0\0i\1\1\1\77\1\1\1\4\340\0\0\0\0\4\3\3\3\15\0\0"
-  "\0\203\1\1\1O\1\1\1\5\340\0\0\0\0\4\3\3\3\20\0\0\0\236\1\1\1_\1\1\1\6"
-  "\340\0\0\0\0\4\3\3\3\22\0\0\0\270\1\1\1o\1\1\1\7\340\0\0\0\0\4\3\3\3"
-  "\25\0\0\0\322\1\1\1\177\1\1\1\10\303\0\0\0\0"};
-
+  "\3\306\322\347\315\331\357\330\345\374\341\332\347\376\3\262\274\317"
+  "\300\314\340\326\342\371\341\332\347\376\3\236\250\270\264\276\321\323"
+  "\340\366\341\332\347\376\3\212\222\240\247\261\302\321\335\363\341\332"
+  "\347\376\3v}\211\232\243\263\316\332\360\341\332\347\376\3agr\215\225"
+  "\244\314\330\355\341\332\347\376\3NR[\200\210\225\311\325\352\341\332"
+  "\347\376\3""9=Csz\206\306\322\347\341\332\347\376\5\325\342\370\305\320"
+  "\345\303\317\343\313\330\355\327\343\372\337\332\347\376\5\317\333\361"
+  "\257\272\314\253\265\307\275\310\334\322\337\365\337\332\347\376\5\311"
+  "\325\352\232\243\263\224\235\254\256\271\313\316\332\360\337\332\347"
+  "\376\5\303\317\343\205\214\232|\203\220\240\251\272\313\327\354\337\332"
+  "\347\376\5\276\311\335nu\200ekv\220\231\250\306\322\347\306\332\347\376"
+  "\1\331\346\375\230\332\347\376\5\270\303\326Y^hMRZ\202\212\227\302\316"
+  "\342\306\332\347\376\1\331\346\375\230\332\347\376\5\262\275\317DHO6"
+  "9\77sz\206\277\312\336\306\332\347\376\1\331\346\375\230\332\347\376"
+  "\5\254\266\310.16\36\40#ekv\273\306\331\306\332\347\376\1\331\346\375"
+  "\231\332\347\376\6\331\346\375\314\331\356\303\317\343\302\316\342\312"
+  "\326\353\324\341\367\302\332\347\376\5\326\342\371\310\324\351\303\317"
+  "\343\305\320\345\321\336\364\227\332\347\376\6\327\344\373\277\312\336"
+  "\253\265\307\252\264\306\271\304\327\316\332\360\302\332\347\376\5\321"
+  "\336\364\266\301\324\254\266\310\256\271\313\311\325\352\227\332\347"
+  "\376\6\326\342\371\261\274\316\223\234\253\222\233\252\250\262\303\310"
+  "\324\351\302\332\347\376\5\315\331\357\244\256\277\224\235\254\231\242"
+  "\262\300\314\340\227\332\347\376\6\324\341\367\243\255\276{\202\217z"
+  "\202\216\227\240\260\302\316\342\302\332\347\376\5\311\325\352\222\233"
+  "\252}\204\221\203\213\230\270\303\326\227\332\347\376\6\323\340\366\226"
+  "\237\256djubhs\206\216\234\274\307\333\302\332\347\376\5\304\320\344"
+  "\200\210\225ekvmt\177\257\271\313\227\332\347\376\6\321\336\364\210\220"
+  "\236LQYJOWu|\210\266\301\324\302\332\347\376\5\300\313\337nu\200NR[W"
+  "\\f\246\260\301\227\332\347\376\6\320\334\362z\202\21647=25;ekv\260\273"
+  "\315\302\332\347\376\5\273\307\332\\bl69\77BFM\236\247\270\227\332\347"
+  "\376\6\316\332\360ms\177\34\36!\33\34\37TYb\252\264\306\302\332\347\376"
+  "\5\267\302\325JOW\37!$,.3\225\236\256\231\332\347\376\2\327\343\372\312"
+  "\326\353\202\302\316\342\3\307\323\350\321\335\363\331\346\375\276\332"
+  "\347\376\2\331\346\375\305\320\345\204\302\316\342\1\325\342\370\230"
+  "\332\347\376\2\322\337\365\272\305\330\202\252\264\306\3\264\276\321"
+  "\307\323\350\330\345\374\276\332\347\376\2\330\345\374\256\271\313\204"
+  "\252\264\306\1\317\333\361\230\332\347\376\7\316\332\360\250\262\304"
+  "\222\233\252\221\232\251\240\251\272\275\310\334\327\343\372\276\332"
+  "\347\376\2\327\343\372\231\242\262\203\221\232\251\2\222\233\252\311"
+  "\325\352\230\332\347\376\7\313\327\354\230\241\261z\202\216y\201\215"
+  "\214\225\243\264\276\321\326\343\371\276\332\347\376\2\326\342\371\203"
+  "\213\230\203y\201\215\2z\202\216\304\317\344\230\332\347\376\7\306\322"
+  "\347\210\220\236bhsagry\200\214\251\264\305\324\341\367\276\332\347\376"
+  "\2\325\342\370mt\177\203agr\2bhs\276\311\335\230\332\347\376\7\302\316"
+  "\342w~\212JOWIMUekv\240\252\273\323\340\366\276\332\347\376\2\323\340"
+  "\366W\\f\203IMU\2JOW\270\303\326\230\332\347\376\7\277\312\336gmx25;"
+  "149QV_\226\237\257\322\336\364\276\332\347\376\2\322\337\365BFM\2031"
+  "49\2""25;\263\275\320\230\332\347\376\7\272\305\331V[e\33\34\37\31\32"
+  "\35>AH\215\225\244\321\335\363\276\332\347\376\2\321\336\364,.3\203\31"
+  "\32\35\2\33\34\37\255\267\311\232\332\347\376\2\326\343\371\312\326\353"
+  "\202\302\316\342\3\304\317\344\313\330\355\324\341\367\266\332\347\376"
+  "\2\331\346\375\330\345\374\204\332\347\376\1\322\337\365\205\302\316"
+  "\342\1\312\326\353\232\332\347\376\2\322\336\364\271\304\327\202\252"
+  "\264\306\3\255\267\311\275\310\334\316\332\360\266\332\347\376\2\330"
+  "\345\374\327\343\372\204\332\347\376\1\313\327\354\205\252\264\306\1"
+  "\271\304\327\232\332\347\376\10\314\331\356\250\262\303\222\233\252\221"
+  "\232\251\226\237\256\256\271\313\310\324\351\331\346\375\265\332\347"
+  "\376\2\327\344\373\324\341\367\204\332\347\376\1\303\317\343\205\221"
+  "\232\251\1\251\263\304\232\332\347\376\10\310\324\351\230\241\261z\202"
+  "\216y\201\215\177\206\223\240\251\272\302\316\342\331\346\375\265\332"
+  "\347\376\2\327\343\372\322\337\365\204\332\347\376\1\273\306\332\205"
+  "y\201\215\1\230\241\261\232\332\347\376\10\304\320\344\207\217\235bh"
+  "sagrhoz\220\231\250\274\307\333\330\345\374\265\332\347\376\2\326\342"
+  "\371\320\334\362\204\332\347\376\1\264\276\321\205agr\1\207\220\236\232"
+  "\332\347\376\10\277\312\336v}\211JOWIMUQV_\202\212\227\266\301\324\330"
+  "\345\374\265\332\347\376\2\325\342\370\316\332\360\204\332\347\376\1"
+  "\254\266\310\205IMU\1v}\212\232\332\347\376\10\273\306\331ekv25;149:"
+  ">Dsz\206\260\273\315\327\344\373\265\332\347\376\2\324\341\367\313\330"
+  "\355\204\332\347\376\1\244\256\277\205149\1flw\232\332\347\376\10\266"
+  "\301\324TYb\33\34\37\31\32\35#%)ekv\252\264\306\327\344\373\265\332\347"
+  "\376\2\323\340\366\312\326\353\204\332\347\376\1\234\246\266\205\31\32"
+  "\35\1UZc\234\332\347\376\3\326\342\371\313\327\354\303\317\343\202\302"
+  "\316\342\4\305\320\345\313\330\355\322\337\365\331\346\375\261\332\347"
+  "\376\4\323\340\366\304\317\344\302\316\342\314\330\355\203\332\347\376"
+  "\1\320\334\362\205\302\316\342\2\303\317\343\331\346\375\233\332\347"
+  "\376\3\321\335\363\272\305\331\253\265\307\202\252\264\306\4\257\272"
+  "\314\275\310\334\313\327\354\327\344\373\261\332\347\376\5\314\331\356"
+  "\256\270\312\252\264\306\274\307\333\331\346\375\202\332\347\376\1\305"
+  "\320\345\205\252\264\306\2\253\265\307\330\345\374\233\332\347\376\3"
+  "\314\330\355\252\264\306\223\234\253\202\221\232\251\4\231\242\262\256"
+  "\271\313\303\317\343\326\342\371\261\332\347\376\5\305\321\346\227\240"
+  "\260\222\233\252\255\267\311\330\345\374\202\332\347\376\1\272\305\330"
+  "\205\221\232\251\2\224\235\254\327\344\373\233\332\347\376\3\306\322"
+  "\347\232\243\263{\202\217\202y\201\215\4\204\214\231\240\251\272\273"
+  "\307\332\325\342\370\261\332\347\376\5\277\312\336\201\211\226z\202\216"
+  "\236\247\270\330\345\374\202\332\347\376\1\256\271\313\205y\201\215\2"
+  "|\203\220\327\343\372\233\332\347\376\3\302\316\342\212\223\241dju\202"
+  "agr\4nu\200\221\232\251\263\276\320\323\340\366\261\332\347\376\5\270"
+  "\303\326kq}agr\216\227\246\327\344\373\202\332\347\376\1\244\256\277"
+  "\205agr\2ekv\326\342\371\233\332\347\376\3\275\310\334z\202\216LQY\202"
+  "IMU\4X]g\203\213\230\253\265\307\321\336\364\261\332\347\376\5\261\274"
+  "\316UZcJNV\177\206\224\327\343\372\202\332\347\376\1\231\242\262\205"
+  "IMU\2MRZ\325\342\370\233\332\347\376\3\270\303\326jp|47=\202149\4CGN"
+  "t{\207\244\255\277\321\335\363\261\332\347\376\5\252\264\306>BI25:pv"
+  "\202\327\343\372\202\332\347\376\1\216\226\245\205149\2""69\77\324\341"
+  "\367\233\332\347\376\3\263\276\320Z_i\34\36!\202\31\32\35\4-05flw\234"
+  "\245\266\317\333\361\261\332\347\376\5\243\255\276(+/\32\33\36`fp\326"
+  "\342\371\202\332\347\376\1\203\213\230\205\31\32\35\2\36\40#\323\340"
+  "\366\235\332\347\376\3\327\344\373\314\331\356\304\317\344\203\302\316"
+  "\342\3\303\317\343\312\326\353\323\340\366\256\332\347\376\2\327\344"
+  "\373\303\317\343\203\302\316\342\1\314\330\355\202\332\347\376\1\320"
+  "\334\362\206\302\316\342\1\325\342\370\235\332\347\376\3\324\341\367"
+  "\277\312\336\256\270\312\203\252\264\306\4\254\266\310\272\305\330\314"
+  "\330\355\331\346\375\255\332\347\376\2\325\342\370\254\266\310\203\252"
+  "\264\306\1\275\310\334\202\332\347\376\1\305\321\346\206\252\264\306"
+  "\1\320\334\362\235\332\347\376\3\321\335\363\261\274\316\226\237\257"
+  "\203\221\232\251\4\224\235\254\251\263\305\304\320\344\330\345\374\255"
+  "\332\347\376\2\322\337\365\225\236\255\203\221\232\251\1\256\270\312"
+  "\202\332\347\376\1\272\305\331\206\221\232\251\1\312\326\353\235\332"
+  "\347\376\3\315\332\357\243\255\276\200\210\225\203y\201\215\4}\204\221"
+  "\231\242\262\274\307\333\330\345\374\255\332\347\376\2\320\334\362~\205"
+  "\222\203y\201\215\1\237\251\272\202\332\347\376\1\260\273\315\206y\201"
+  "\215\1\305\320\345\235\332\347\376\3\312\326\353\226\237\256io{\203a"
+  "gr\4flw\211\221\237\265\300\323\327\344\373\255\332\347\376\2\315\331"
+  "\357gmx\203agr\1\221\231\251\202\332\347\376\1\245\257\300\206agr\1\277"
+  "\313\337\235\332\347\376\3\307\322\347\210\220\236SXa\203IMU\4NR[y\200"
+  "\214\256\270\312\327\343\372\255\332\347\376\2\313\327\354PT]\203IMU"
+  "\1\201\211\227\202\332\347\376\1\233\244\264\206IMU\1\272\305\330\235"
+  "\332\347\376\3\303\317\343z\202\216<\77F\203149\4""7:@hoz\246\260\301"
+  "\327\343\372\255\332\347\376\2\310\324\3518<B\203149\1sz\206\202\332"
+  "\347\376\1\220\230\247\206149\1\264\277\322\235\332\347\376\3\300\313"
+  "\337ms\177&(,\203\31\32\35\4\40\"%X]g\236\250\271\326\342\371\255\332"
+  "\347\376\2\306\321\346!#'\203\31\32\35\1eku\202\332\347\376\1\205\215"
+  "\233\206\31\32\35\1\257\272\314\237\332\347\376\3\331\346\375\321\335"
+  "\363\306\322\347\204\302\316\342\3\305\320\345\317\333\361\331\346\375"
+  "\253\332\347\376\1\317\333\361\205\302\316\342\3\324\341\367\332\347"
+  "\376\321\336\364\206\302\316\342\1\321\336\364\216\332\347\376\2\331"
+  "\346\375\327\344\373\217\332\347\376\3\330\345\374\306\322\347\262\274"
+  "\317\204\252\264\306\3\257\272\314\304\317\344\327\344\373\253\332\347"
+  "\376\1\304\317\344\205\252\264\306\3\315\331\357\332\347\376\311\325"
+  "\352\206\252\264\306\1\311\325\352\216\332\347\376\2\330\345\374\325"
+  "\342\370\217\332\347\376\3\327\343\372\274\307\333\235\247\267\204\221"
+  "\232\251\3\232\243\263\271\304\327\326\342\371\253\332\347\376\1\270"
+  "\303\326\204\221\232\251\4\222\233\252\306\322\347\332\347\376\300\314"
+  "\340\206\221\232\251\1\300\314\340\216\332\347\376\2\327\344\373\321"
+  "\336\364\217\332\347\376\3\326\342\371\263\276\320\212\222\240\204y\201"
+  "\215\3\205\214\232\256\270\312\325\342\370\253\332\347\376\1\255\267"
+  "\311\204y\201\215\4z\202\216\300\313\337\332\347\376\270\303\326\206"
+  "y\201\215\1\270\303\326\216\332\347\376\2\327\343\372\317\333\361\217"
+  "\332\347\376\3\324\341\367\251\263\304u|\210\204agr\3ov\201\242\253\274"
+  "\323\340\366\253\332\347\376\1\241\252\273\205agr\3\271\304\327\332\347"
+  "\376\257\272\314\206agr\1\257\272\314\216\332\347\376\2\325\342\370\314"
+  "\330\355\217\332\347\376\3\323\340\366\236\250\271afq\204IMU\3Z_i\226"
+  "\237\257\321\336\364\253\332\347\376\1\226\237\256\204IMU\4JNV\262\275"
+  "\317\332\347\376\247\261\302\206IMU\1\247\261\302\216\332\347\376\2\324"
+  "\341\367\311\325\352\217\332\347\376\3\321\336\364\225\236\256MRZ\204"
+  "149\3DHP\213\224\242\321\335\363\253\332\347\376\1\212\222\240\20414"
+  "9\4""25:\253\265\307\332\347\376\236\250\271\206149\1\236\250\271\216"
+  "\332\347\376\2\323\340\366\306\321\346\217\332\347\376\3\321\335\363"
+  "\213\223\2428<B\204\31\32\35\3/27\200\210\225\317\333\361\253\332\347"
+  "\376\1\177\206\223\204\31\32\35\4\32\33\36\244\256\277\332\347\376\226"
+  "\237\257\206\31\32\35\1\226\237\257\216\332\347\376\2\322\337\365\303"
+  "\317\343\222\332\347\376\2\323\340\366\311\325\352\204\302\316\342\3"
+  "\304\317\344\317\333\361\331\346\375\251\332\347\376\1\313\330\355\205"
+  "\302\316\342\3\306\322\347\332\347\376\326\342\371\206\302\316\342\1"
+  "\320\334\362\216\332\347\376\2\321\336\364\317\333\361\203\332\347\376"
+  "\1\322\337\365\216\332\347\376\2\314\331\356\267\302\325\204\252\264"
+  "\306\3\255\267\311\303\317\343\327\344\373\251\332\347\376\1\274\307"
+  "\333\205\252\264\306\3\263\275\320\332\347\376\321\335\363\206\252\264"
+  "\306\1\305\320\345\216\332\347\376\2\310\324\351\303\317\343\203\332"
+  "\347\376\1\312\326\353\216\332\347\376\3\306\321\346\245\257\300\222"
+  "\233\252\203\221\232\251\3\226\237\257\267\302\325\326\342\371\251\332"
+  "\347\376\1\255\267\311\205\221\232\251\3\237\250\271\332\347\376\314"
+  "\331\356\206\221\232\251\1\272\305\330\216\332\347\376\2\277\312\336"
+  "\267\302\325\203\332\347\376\1\302\316\342\216\332\347\376\3\277\312"
+  "\336\223\234\253z\202\216\203y\201\215\3\177\207\224\254\266\310\325"
+  "\342\370\251\332\347\376\1\235\247\267\205y\201\215\3\213\224\242\332"
+  "\347\376\307\323\350\206y\201\215\1\256\271\313\216\332\347\376\2\265"
+  "\300\323\253\265\307\203\332\347\376\1\272\305\330\215\332\347\376\3"
+  "\331\346\375\270\303\326\202\212\227\204agr\3io{\240\251\272\323\340"
+  "\366\251\332\347\376\1\217\227\246\205agr\3x\177\213\331\346\375\303"
+  "\317\343\206agr\1\243\255\276\216\332\347\376\2\255\267\311\240\251\272"
+  "\203\332\347\376\1\262\275\317\215\332\347\376\4\331\346\375\261\274"
+  "\316pw\202JNV\203IMU\3RW`\224\235\254\321\336\364\251\332\347\376\1\177"
+  "\207\224\205IMU\3dju\331\346\375\276\311\335\206IMU\1\230\241\261\216"
+  "\332\347\376\2\244\255\277\224\235\254\203\332\347\376\1\251\264\305"
+  "\215\332\347\376\4\331\346\375\252\264\306^dn25:\203149\3<\77F\211\221"
+  "\237\321\335\363\251\332\347\376\1pw\202\205149\3PU^\331\346\375\272"
+  "\305\330\206149\1\215\225\244\216\332\347\376\2\232\243\264\210\220\236"
+  "\203\332\347\376\1\242\253\275\215\332\347\376\4\331\346\375\244\255"
+  "\277LQY\32\33\36\203\31\32\35\3%'+}\204\221\317\333\361\251\332\347\376"
+  "\1afq\205\31\32\35\3=@G\331\346\375\264\277\322\206\31\32\35\1\202\212"
+  "\227\216\332\347\376\2\221\231\251|\203\220\203\332\347\376\1\231\242"
+  "\263\220\332\347\376\2\325\342\370\310\324\351\204\302\316\342\2\305"
+  "\320\345\321\335\363\250\332\347\376\1\313\330\355\206\302\316\342\3"
+  "\323\340\366\332\347\376\303\317\343\205\302\316\342\1\316\332\360\216"
+  "\332\347\376\2\313\330\355\317\333\361\202\332\347\376\2\320\334\362"
+  "\307\323\350\220\332\347\376\2\317\333\361\266\301\324\204\252\264\306"
+  "\2\256\271\313\307\323\350\250\332\347\376\1\274\307\333\206\252\264"
+  "\306\3\314\330\355\331\346\375\254\266\310\205\252\264\306\1\301\315"
+  "\341\216\332\347\376\2\274\307\333\304\317\344\202\332\347\376\2\305"
+  "\321\346\264\276\321\220\332\347\376\3\312\326\353\244\256\277\222\233"
+  "\252\203\221\232\251\3\230\241\261\276\311\335\331\346\375\247\332\347"
+  "\376\1\255\267\311\206\221\232\251\3\304\320\344\330\345\374\225\236"
+  "\255\205\221\232\251\1\265\300\323\216\332\347\376\2\256\270\312\270"
+  "\303\326\202\332\347\376\2\273\306\332\240\251\272\220\332\347\376\3"
+  "\304\320\344\222\233\252z\202\216\203y\201\215\3\203\213\230\265\277"
+  "\322\331\346\375\247\332\347\376\1\235\247\267\206y\201\215\3\274\307"
+  "\333\330\345\374~\205\222\205y\201\215\1\250\262\304\216\332\347\376"
+  "\2\236\250\270\255\267\311\202\332\347\376\2\261\274\316\214\225\243"
+  "\220\332\347\376\2\277\312\336\200\210\225\204agr\3ms\177\253\265\307"
+  "\330\345\374\247\332\347\376\1\216\226\245\206agr\3\265\277\322\327\344"
+  "\373gmx\205agr\1\234\246\266\216\332\347\376\2\220\230\247\241\252\273"
+  "\202\332\347\376\2\247\261\302y\200\214\220\332\347\376\3\271\304\327"
+  "nu\200JNV\203IMU\3V[e\242\253\275\330\345\374\247\332\347\376\1\177\206"
+  "\223\206IMU\3\255\267\311\327\343\372PT]\205IMU\1\220\230\247\216\332"
+  "\347\376\2\200\210\225\226\237\256\202\332\347\376\2\234\246\266ekv\220"
+  "\332\347\376\3\264\276\321\\bl25:\203149\3AEL\230\242\262\327\344\373"
+  "\247\332\347\376\1ov\201\206149\3\245\257\300\327\343\3728<B\205149\1"
+  "\204\214\231\216\332\347\376\2rx\204\212\222\240\202\332\347\376\2\222"
+  "\233\252QV_\220\332\347\376\3\256\270\312JOW\32\33\36\203\31\32\35\3"
+  "+-2\217\230\247\327\344\373\247\332\347\376\1`ep\206\31\32\35\3\236\247"
+  "\270\326\343\371!#'\205\31\32\35\1w~\212\216\332\347\376\2bhs\177\206"
+  "\223\202\332\347\376\2\210\220\236>AH\222\332\347\376\2\324\341\367\306"
+  "\322\347\204\302\316\342\2\307\323\350\326\342\371\246\332\347\376\1"
+  "\316\332\360\206\302\316\342\3\310\324\351\332\347\376\311\325\352\205"
+  "\302\316\342\1\315\331\357\216\332\347\376\6\306\322\347\321\335\363"
+  "\332\347\376\327\343\372\303\317\343\321\336\364\222\332\347\376\2\315"
+  "\331\357\263\275\320\204\252\264\306\2\264\277\322\321\336\364\246\332"
+  "\347\376\1\301\315\341\206\252\264\306\3\265\300\323\332\347\376\270"
+  "\303\326\205\252\264\306\1\277\313\337\216\332\347\376\6\263\275\320"
+  "\307\323\350\332\347\376\322\337\365\254\266\310\310\324\351\222\332"
+  "\347\376\2\306\322\347\236\250\270\204\221\232\251\2\242\253\274\314"
+  "\331\356\246\332\347\376\1\264\277\322\206\221\232\251\3\242\254\275"
+  "\332\347\376\246\260\301\205\221\232\251\1\262\274\317\216\332\347\376"
+  "\6\237\250\271\276\311\335\332\347\376\316\332\360\224\235\254\277\313"
+  "\337\222\332\347\376\2\300\313\337\212\223\241\204y\201\215\2\217\227"
+  "\246\310\324\351\246\332\347\376\1\250\262\304\206y\201\215\3\220\230"
+  "\247\332\347\376\225\236\255\205y\201\215\1\245\257\300\216\332\347\376"
+  "\6\213\224\242\265\277\322\332\347\376\312\326\353}\204\221\266\301\324"
+  "\222\332\347\376\2\271\304\327w~\212\204agr\2|\203\220\304\320\344\246"
+  "\332\347\376\1\234\245\265\206agr\3}\204\221\332\347\376\204\214\231"
+  "\205agr\1\227\240\260\216\332\347\376\6w~\212\252\264\306\332\347\376"
+  "\307\322\347ekv\256\270\312\222\332\347\376\2\262\275\317bhs\204IMU\2"
+  "io{\277\312\336\246\332\347\376\1\217\227\246\206IMU\3jp|\332\347\376"
+  "rx\204\205IMU\1\212\222\240\216\332\347\376\6cit\241\253\274\332\347"
+  "\376\302\316\342NR[\244\256\277\222\332\347\376\2\253\265\307OS\\\204"
+  "149\2V[e\273\306\331\246\332\347\376\1\203\213\230\206149\3W\\f\332\347"
+  "\376afq\205149\1}\204\221\216\332\347\376\6PT]\230\241\261\332\347\376"
+  "\276\311\33569\77\234\245\265\222\332\347\376\2\244\256\277;\77E\204"
+  "\31\32\35\2DHO\266\301\324\246\332\347\376\1v}\211\206\31\32\35\3DHP"
+  "\332\347\376PT]\205\31\32\35\1ov\201\216\332\347\376\6<\77F\216\227\246"
+  "\332\347\376\272\305\330\37!$\222\233\252\224\332\347\376\2\321\335\363"
+  "\304\317\344\203\302\316\342\2\303\317\343\316\332\360\245\332\347\376"
+  "\1\322\337\365\207\302\316\342\2\325\342\370\320\334\362\205\302\316"
+  "\342\1\315\331\357\216\332\347\376\5\303\317\343\324\341\367\332\347"
+  "\376\310\324\351\305\321\346\224\332\347\376\3\331\346\375\306\322\347"
+  "\256\270\312\203\252\264\306\3\253\265\307\301\315\341\331\346\375\244"
+  "\332\347\376\1\313\327\354\207\252\264\306\2\317\333\361\305\321\346"
+  "\205\252\264\306\1\277\313\337\215\332\347\376\7\331\346\375\253\265"
+  "\307\315\331\357\332\347\376\265\300\323\260\273\315\331\346\375\223"
+  "\332\347\376\3\331\346\375\274\307\333\227\240\260\203\221\232\251\3"
+  "\223\234\253\265\277\322\330\345\374\244\332\347\376\1\302\316\342\207"
+  "\221\232\251\2\312\326\353\272\305\331\205\221\232\251\1\262\274\317"
+  "\215\332\347\376\7\331\346\375\224\235\254\307\323\350\332\347\376\242"
+  "\254\275\234\245\265\331\346\375\223\332\347\376\3\330\345\374\262\274"
+  "\317\201\211\226\203y\201\215\3|\203\220\251\263\304\327\344\373\244"
+  "\332\347\376\1\272\305\331\207y\201\215\2\304\320\344\260\273\315\205"
+  "y\201\215\1\244\256\277\215\332\347\376\7\330\345\374|\203\220\300\314"
+  "\340\332\347\376\220\231\250\206\216\234\330\345\374\223\332\347\376"
+  "\3\330\345\374\250\262\303jp|\203agr\3dju\234\245\266\327\344\373\244"
+  "\332\347\376\1\262\274\317\207agr\2\277\312\336\245\257\300\205agr\1"
+  "\227\240\260\215\332\347\376\7\330\345\374ekv\273\306\331\331\346\375"
+  "~\205\222rx\204\330\345\374\223\332\347\376\3\327\344\373\235\247\267"
+  "TYb\203IMU\3LQY\217\230\247\327\343\372\244\332\347\376\1\252\264\306"
+  "\207IMU\2\271\304\327\233\244\264\205IMU\1\212\222\240\215\332\347\376"
+  "\7\327\344\373MRZ\264\276\321\331\346\375kq}\\bl\327\344\373\223\332"
+  "\347\376\3\327\344\373\223\234\253>AH\203149\3""58>\203\213\231\326\342"
+  "\371\244\332\347\376\1\242\253\274\207149\2\264\276\321\220\230\247\205"
+  "149\1|\203\220\215\332\347\376\7\327\344\37369\77\256\270\312\331\346"
+  "\375Y^hHLT\327\344\373\223\332\347\376\3\327\343\372\211\221\237'*.\203"
+  "\31\32\35\3\35\37\"v}\212\325\342\370\244\332\347\376\1\232\243\263\207"
+  "\31\32\35\2\256\270\312\205\215\233\205\31\32\35\1nu\200\215\332\347"
+  "\376\7\327\343\372\36\40#\247\261\302\331\346\375FJR25;\327\343\372\225"
+  "\332\347\376\2\330\345\374\313\330\355\204\302\316\342\2\307\323\350"
+  "\327\343\372\243\332\347\376\1\330\345\374\207\302\316\342\2\306\322"
+  "\347\313\327\354\205\302\316\342\6\305\320\345\313\327\354\316\332\360"
+  "\322\337\365\327\343\372\331\346\375\210\332\347\376\6\327\344\373\302"
+  "\316\342\327\344\373\322\337\365\302\316\342\321\336\364\226\332\347"
+  "\376\2\327\343\372\274\307\333\204\252\264\306\2\264\276\321\323\340"
+  "\366\243\332\347\376\1\326\342\371\207\252\264\306\2\263\275\320\273"
+  "\307\332\205\252\264\306\6\256\271\313\272\305\331\302\316\342\312\326"
+  "\353\322\337\365\330\345\374\210\332\347\376\6\324\341\367\252\264\306"
+  "\325\342\370\312\326\353\252\264\306\310\324\351\226\332\347\376\3\324"
+  "\341\367\255\267\311\222\233\252\203\221\232\251\2\241\252\273\317\333"
+  "\361\243\332\347\376\2\324\341\367\222\233\252\206\221\232\251\2\237"
+  "\250\271\253\265\307\205\221\232\251\6\230\241\261\252\264\306\266\301"
+  "\324\301\315\341\316\332\360\327\343\372\210\332\347\376\6\321\335\363"
+  "\221\232\251\321\336\364\301\315\341\221\232\251\277\312\336\226\332"
+  "\347\376\3\322\337\365\235\247\267z\202\216\203y\201\215\2\215\225\244"
+  "\314\330\355\243\332\347\376\2\321\336\364z\202\216\206y\201\215\2\213"
+  "\224\242\234\245\266\205y\201\215\6\202\212\227\232\243\263\252\264\306"
+  "\271\304\327\312\326\353\326\343\371\210\332\347\376\6\315\331\357y\201"
+  "\215\317\333\361\272\305\330y\201\215\266\301\324\226\332\347\376\3\320"
+  "\334\362\216\226\245bhs\203agr\2z\202\216\307\323\350\243\332\347\376"
+  "\2\320\334\362bhs\206agr\2w~\212\215\225\244\205agr\6ms\177\212\223\241"
+  "\236\250\270\260\273\315\306\321\346\325\342\370\210\332\347\376\6\313"
+  "\327\354agr\314\330\355\261\274\316agr\255\267\311\226\332\347\376\3"
+  "\316\333\360\177\206\223JOW\203IMU\2gmx\304\320\344\243\332\347\376\2"
+  "\315\331\357JOW\206IMU\2cit|\204\221\205IMU\6V[ez\202\216\222\233\252"
+  "\250\262\303\301\315\341\323\340\366\210\332\347\376\6\307\323\350IM"
+  "U\311\325\352\251\263\304IMU\243\255\276\226\332\347\376\3\314\330\355"
+  "ov\20125;\203149\2TYb\300\313\337\243\332\347\376\2\314\330\35525;\206"
+  "149\2PT]mt\177\205149\6@DKjp|\206\216\234\237\251\272\275\310\334\322"
+  "\337\365\210\332\347\376\6\304\320\344149\306\321\346\241\253\274149"
+  "\233\244\264\226\332\347\376\3\312\326\353`ep\33\34\37\203\31\32\35\2"
+  "@DK\274\307\333\243\332\347\376\2\311\325\352\33\34\37\206\31\32\35\2"
+  "<\77F^cm\205\31\32\35\6*,1Z_iz\202\216\227\240\260\271\304\327\322\336"
+  "\364\210\332\347\376\6\300\314\340\31\32\35\303\317\343\230\242\262\31"
+  "\32\35\221\232\251\230\332\347\376\2\324\341\367\305\321\346\203\302"
+  "\316\342\2\304\317\344\321\336\364\243\332\347\376\1\306\322\347\222"
+  "\302\316\342\5\303\317\343\306\322\347\313\327\354\321\335\363\326\343"
+  "\371\204\332\347\376\5\325\342\370\304\317\344\332\347\376\306\322\347"
+  "\307\323\350\231\332\347\376\2\315\331\357\260\273\315\203\252\264\306"
+  "\2\255\267\311\311\325\352\243\332\347\376\1\262\274\317\222\252\264"
+  "\306\5\254\266\310\262\274\317\273\306\332\306\322\347\322\336\364\204"
+  "\332\347\376\5\320\334\362\256\270\312\332\347\376\263\275\320\264\276"
+  "\321\231\332\347\376\2\306\322\347\233\244\264\203\221\232\251\2\226"
+  "\237\256\300\314\340\243\332\347\376\1\235\247\267\222\221\232\251\6"
+  "\224\235\254\235\247\267\254\266\310\275\310\334\315\332\357\331\346"
+  "\375\203\332\347\376\6\312\326\353\227\240\260\332\347\376\237\250\271"
+  "\240\251\272\331\346\375\230\332\347\376\2\300\313\337\205\215\233\203"
+  "y\201\215\2\177\206\223\270\303\326\243\332\347\376\1\211\221\237\222"
+  "y\201\215\6}\204\221\212\222\240\234\246\266\263\275\320\311\325\352"
+  "\331\346\375\203\332\347\376\6\305\320\345\201\211\226\332\347\376\213"
+  "\224\242\214\225\243\331\346\375\230\332\347\376\2\272\305\330qx\203"
+  "\203agr\2gny\257\272\314\243\332\347\376\1u|\210\222agr\6flwu|\210\215"
+  "\225\244\251\263\305\305\321\345\331\346\375\203\332\347\376\6\277\312"
+  "\336kq}\331\346\375w~\212y\200\214\331\346\375\230\332\347\376\2\263"
+  "\276\320[ak\203IMU\2PU^\247\261\302\243\332\347\376\1afq\222IMU\6NR["
+  "afq~\205\222\237\250\271\301\314\340\330\345\374\203\332\347\376\6\272"
+  "\305\330UZc\331\346\375citekv\330\345\374\230\332\347\376\2\254\266\310"
+  "FJR\203149\2""9=C\236\250\271\243\332\347\376\1LQY\222149\6""7:@MRZn"
+  "u\200\226\237\256\274\310\333\330\345\374\203\332\347\376\6\264\276\321"
+  ">BI\331\346\375PT]QV_\330\345\374\230\332\347\376\2\245\257\300149\203"
+  "\31\32\35\2\"$(\226\237\257\243\332\347\376\1""8;A\222\31\32\35\6\40"
+  "\"%8<B_eo\213\224\242\270\303\326\330\345\374\203\332\347\376\6\257\271"
+  "\313(+/\331\346\375<\77F>AH\330\345\374\231\332\347\376\2\331\346\375"
+  "\313\330\355\204\302\316\342\1\314\331\356\241\332\347\376\2\324\341"
+  "\367\304\317\344\227\302\316\342\11\305\320\345\314\330\355\323\340\366"
+  "\332\347\376\326\343\371\314\331\356\327\343\372\302\316\342\325\342"
+  "\370\232\332\347\376\2\327\344\373\275\310\334\204\252\264\306\2\277"
+  "\312\336\331\346\375\240\332\347\376\2\316\332\360\255\267\311\227\252"
+  "\264\306\11\257\272\314\275\310\334\315\331\356\331\346\375\322\336\364"
+  "\276\311\335\322\337\365\252\264\306\320\334\362\232\332\347\376\3\326"
+  "\342\371\256\271\313\222\233\252\202\221\232\251\3\222\233\252\260\273"
+  "\315\330\345\374\240\332\347\376\2\310\324\351\226\237\256\227\221\232"
+  "\251\11\231\242\262\256\270\312\306\322\346\330\345\374\315\332\357\257"
+  "\272\314\317\333\361\222\233\252\312\326\353\232\332\347\376\3\325\342"
+  "\370\240\251\272z\202\216\202y\201\215\3z\202\216\242\254\275\330\345"
+  "\374\240\332\347\376\2\302\316\342\177\206\223\227y\201\215\11\204\214"
+  "\231\237\251\272\277\312\337\327\344\373\311\325\352\241\253\274\313"
+  "\327\354z\202\216\305\320\345\232\332\347\376\2\323\340\366\220\231\250"
+  "\204agr\2\225\236\255\327\344\373\240\332\347\376\2\273\307\332gny\227"
+  "agr\11nu\200\220\231\250\267\302\326\327\344\373\305\321\345\223\234"
+  "\254\307\323\350bhs\300\313\337\232\332\347\376\3\321\336\364\202\212"
+  "\227JNV\202IMU\3JNV\206\216\234\327\343\372\240\332\347\376\2\265\300"
+  "\323PU^\227IMU\11X]g\201\211\227\261\273\316\327\343\372\301\314\340"
+  "\205\215\233\303\317\343JOW\272\305\330\232\332\347\376\3\321\335\363"
+  "sz\20625:\202149\3""25:y\200\214\327\343\372\240\332\347\376\2\257\272"
+  "\3149=C\227149\11CGNry\205\252\264\306\326\342\371\274\310\333v}\212"
+  "\300\313\33725;\265\277\322\232\332\347\376\3\317\333\361ekv\32\33\36"
+  "\202\31\32\35\3\32\33\36kq}\326\343\371\240\332\347\376\2\251\264\305"
+  "\"$(\227\31\32\35\11-05djt\243\255\276\325\342\370\270\303\326hny\273"
+  "\307\332\33\34\37\257\272\314\234\332\347\376\2\322\337\365\304\317\344"
+  "\203\302\316\342\2\310\324\351\330\345\374\237\332\347\376\1\305\321"
+  "\346\233\302\316\342\2\305\320\345\316\332\360\202\330\345\374\1\321"
+  "\336\364\235\332\347\376\2\313\327\354\256\270\312\203\252\264\306\2"
+  "\266\301\324\327\343\372\236\332\347\376\2\331\346\375\260\273\315\233"
+  "\252\264\306\2\256\271\313\301\315\341\202\326\342\371\1\311\325\352"
+  "\235\332\347\376\2\303\317\343\227\240\260\203\221\232\251\2\244\256"
+  "\277\325\342\370\236\332\347\376\2\331\346\375\233\244\264\233\221\232"
+  "\251\2\231\242\262\264\277\322\202\323\340\366\1\300\314\340\235\332"
+  "\347\376\2\273\307\332\201\211\226\203y\201\215\2\222\233\252\323\340"
+  "\366\236\332\347\376\2\330\345\374\205\215\233\233y\201\215\2\203\213"
+  "\230\250\262\303\202\321\335\363\1\270\303\326\235\332\347\376\2\264"
+  "\276\321kq}\203agr\2\200\210\225\321\336\364\236\332\347\376\2\330\345"
+  "\374qx\203\233agr\5mt\177\233\244\264\317\333\361\316\332\360\257\272"
+  "\314\235\332\347\376\2\254\266\310UZc\203IMU\2nu\200\320\334\362\236"
+  "\332\347\376\2\327\344\373[ak\233IMU\5W\\f\216\226\245\314\331\356\314"
+  "\330\355\247\261\302\235\332\347\376\2\244\256\277>BI\203149\2\\bl\316"
+  "\332\360\236\332\347\376\2\327\344\373FJR\233149\5BFM\201\211\226\312"
+  "\326\353\311\325\352\236\250\270\235\332\347\376\2\235\246\267(+/\203"
+  "\31\32\35\2JOW\314\331\356\236\332\347\376\2\327\343\372149\233\31\32"
+  "\35\5,.3t{\207\307\323\350\306\322\347\226\237\256\236\332\347\376\2"
+  "\327\344\373\310\324\351\203\302\316\342\2\306\322\347\327\344\373\206"
+  "\332\347\376\1\331\346\375\202\326\342\371\1\330\345\374\223\332\347"
+  "\376\1\322\337\365\220\302\316\342\3\310\324\351\324\341\367\312\326"
+  "\353\213\302\316\342\2\303\317\343\317\333\361\237\332\347\376\2\325"
+  "\342\370\265\300\323\203\252\264\306\2\262\274\317\324\341\367\206\332"
+  "\347\376\1\327\344\373\202\321\335\363\1\326\343\371\223\332\347\376"
+  "\1\313\327\354\220\252\264\306\3\266\301\324\315\331\357\271\304\327"
+  "\213\252\264\306\3\254\266\310\303\317\343\331\346\375\236\332\347\376"
+  "\2\321\336\364\243\255\276\203\221\232\251\2\235\247\267\321\335\363"
+  "\206\332\347\376\1\326\343\371\202\314\330\355\2\323\340\366\331\346"
+  "\375\222\332\347\376\1\303\317\343\220\221\232\251\3\244\256\277\307"
+  "\323\350\250\262\304\213\221\232\251\3\225\236\255\267\302\325\330\345"
+  "\374\236\332\347\376\2\317\333\361\220\231\250\203y\201\215\2\211\221"
+  "\237\315\332\357\206\332\347\376\5\324\341\367\307\323\350\306\322\347"
+  "\321\335\363\331\346\375\222\332\347\376\1\273\307\332\220y\201\215\3"
+  "\222\233\252\300\314\340\227\240\260\213y\201\215\3~\205\222\253\265"
+  "\307\327\344\373\236\332\347\376\2\314\331\356\177\206\223\203agr\2t"
+  "{\207\313\327\354\206\332\347\376\1\322\337\365\202\302\316\342\2\316"
+  "\332\360\330\345\374\222\332\347\376\1\264\276\321\220agr\3\200\210\225"
+  "\272\305\331\207\217\235\213agr\3gmx\237\250\271\327\344\373\236\332"
+  "\347\376\2\311\325\352lr~\203IMU\2`ep\307\323\350\206\332\347\376\1\321"
+  "\335\363\202\275\310\334\2\314\330\355\330\345\374\222\332\347\376\1"
+  "\254\266\310\220IMU\3nu\200\264\276\321v}\211\213IMU\3PT]\223\234\253"
+  "\327\343\372\236\332\347\376\2\306\322\347Z_i\203149\2KPX\304\320\344"
+  "\206\332\347\376\5\317\333\361\271\304\327\270\303\326\311\325\352\330"
+  "\344\373\222\332\347\376\1\244\256\277\220149\3\\bl\256\270\312flw\213"
+  "149\3""8<B\207\217\235\326\342\371\236\332\347\376\2\304\317\344GKS\203"
+  "\31\32\35\2""7:@\301\314\340\206\332\347\376\5\315\332\357\264\276\321"
+  "\263\276\320\307\322\347\330\344\373\222\332\347\376\1\235\246\267\220"
+  "\31\32\35\3JOW\247\261\302UZc\213\31\32\35\3!#'{\202\217\325\342\370"
+  "\240\332\347\376\1\315\331\357\203\302\316\342\2\305\320\345\326\342"
+  "\371\202\332\347\376\4\331\346\375\321\335\363\307\323\350\303\317\343"
+  "\203\302\316\342\6\304\317\344\307\323\350\313\330\355\320\334\362\324"
+  "\341\367\330\345\374\215\332\347\376\1\311\325\352\215\302\316\342\1"
+  "\303\317\343\202\302\316\342\3\325\342\370\332\347\376\327\344\373\215"
+  "\302\316\342\2\307\323\350\327\344\373\236\332\347\376\2\331\346\375"
+  "\300\313\337\203\252\264\306\2\256\271\313\321\336\364\202\332\347\376"
+  "\4\330\345\374\306\322\347\264\277\322\253\265\307\203\252\264\306\6"
+  "\255\267\311\264\277\322\274\307\333\305\321\346\316\332\360\327\343"
+  "\372\215\332\347\376\1\267\302\325\215\252\264\306\1\254\266\310\202"
+  "\252\264\306\3\320\334\362\332\347\376\324\341\367\215\252\264\306\2"
+  "\264\277\322\325\342\370\236\332\347\376\3\330\345\374\262\275\317\222"
+  "\233\252\202\221\232\251\2\231\242\262\314\331\356\202\332\347\376\4"
+  "\327\343\372\274\307\333\241\252\273\223\234\253\202\221\232\251\7\222"
+  "\233\252\226\237\257\241\252\273\256\270\312\272\305\331\310\324\351"
+  "\324\341\367\215\332\347\376\1\246\260\301\215\221\232\251\1\225\236"
+  "\255\202\221\232\251\3\313\327\354\332\347\376\321\335\363\215\221\232"
+  "\251\2\241\252\273\322\337\365\236\332\347\376\3\330\345\374\244\256"
+  "\277z\202\216\202y\201\215\2\203\213\230\310\324\351\202\332\347\376"
+  "\4\326\343\371\262\274\317\216\226\245{\202\217\202y\201\215\7z\202\216"
+  "\177\207\224\216\226\245\236\250\270\260\273\315\302\316\342\322\337"
+  "\365\215\332\347\376\1\224\235\254\215y\201\215\1~\205\222\202y\201\215"
+  "\3\306\321\346\332\347\376\316\332\360\215y\201\215\2\216\226\245\320"
+  "\334\362\236\332\347\376\2\327\344\373\227\240\260\203agr\2mt\177\304"
+  "\317\344\202\332\347\376\4\325\342\370\250\262\303{\202\217dju\203ag"
+  "r\6io{z\202\216\220\230\247\246\260\301\273\307\332\320\334\362\215\332"
+  "\347\376\1\203\213\230\215agr\1gmx\202agr\3\300\314\340\332\347\376\313"
+  "\327\354\215agr\2{\202\217\315\332\357\236\332\347\376\3\327\343\372"
+  "\211\221\240JNV\202IMU\2W\\f\277\312\336\202\332\347\376\4\323\340\366"
+  "\235\247\267gnyLQY\202IMU\7JNVRW`gny\200\210\225\233\244\264\265\300"
+  "\323\316\332\360\215\332\347\376\1qx\203\215IMU\1PT]\202IMU\3\273\307"
+  "\332\332\347\376\307\323\350\215IMU\2gny\313\327\354\236\332\347\376"
+  "\3\327\343\372|\203\22025:\202149\2BFM\272\305\331\202\332\347\376\4"
+  "\322\337\365\223\234\253UZc47=\202149\7""25:<\77FTYbrx\204\220\231\250"
+  "\257\272\314\314\330\355\215\332\347\376\1`ep\215149\1""8<B\202149\3"
+  "\266\301\324\332\347\376\305\320\345\215149\2UZc\310\324\351\236\332"
+  "\347\376\3\326\343\371nt\200\32\33\36\202\31\32\35\2,.3\266\301\324\202"
+  "\332\347\376\4\322\336\364\211\221\237BFM\34\36!\202\31\32\35\7\32\33"
+  "\36%'+AELbhs\206\216\234\251\264\305\312\326\353\215\332\347\376\1NR"
+  "[\215\31\32\35\1!#'\202\31\32\35\3\261\274\316\332\347\376\301\315\341"
+  "\215\31\32\35\2BFM\306\322\346\240\332\347\376\2\321\335\363\303\317"
+  "\343\202\302\316\342\4\304\317\344\324\341\367\320\334\362\304\317\344"
+  "\214\302\316\342\6\305\321\346\311\325\352\315\331\357\321\336\364\325"
+  "\342\370\330\345\374\206\332\347\376\1\321\336\364\216\302\316\342\6"
+  "\312\326\353\305\320\345\302\316\342\322\337\365\332\347\376\325\342"
+  "\370\216\302\316\342\2\305\321\346\330\345\374\237\332\347\376\2\307"
+  "\323\350\253\265\307\202\252\264\306\4\256\270\312\315\331\357\305\320"
+  "\345\256\270\312\214\252\264\306\6\260\273\315\270\303\326\300\314\340"
+  "\311\325\352\320\334\362\327\343\372\206\332\347\376\1\311\325\352\216"
+  "\252\264\306\6\271\304\327\257\272\314\252\264\306\313\327\354\332\347"
+  "\376\317\333\361\216\252\264\306\2\260\273\315\327\343\372\237\332\347"
+  "\376\2\276\311\335\223\234\253\202\221\232\251\4\227\240\260\306\322"
+  "\347\272\305\330\227\240\260\213\221\232\251\7\222\233\252\233\244\264"
+  "\247\261\302\263\275\320\300\313\337\313\327\354\324\341\367\206\332"
+  "\347\376\2\277\313\337\222\233\252\215\221\232\251\6\250\262\303\232"
+  "\243\263\221\232\251\303\317\343\332\347\376\311\325\352\216\221\232"
+  "\251\2\233\244\264\324\341\367\237\332\347\376\2\265\277\322{\202\217"
+  "\202y\201\215\4\201\211\226\300\313\337\257\272\314\201\211\226\213y"
+  "\201\215\7z\202\216\205\215\233\226\237\257\246\260\301\267\302\325\306"
+  "\321\346\322\337\365\206\332\347\376\2\267\302\325z\202\216\215y\201"
+  "\215\6\226\237\257\205\214\232y\201\215\273\307\332\332\347\376\303\317"
+  "\343\216y\201\215\2\206\216\234\322\337\365\237\332\347\376\2\253\265"
+  "\307dju\202agr\4jp|\272\305\330\244\256\277kq}\213agr\10bhspw\202\205"
+  "\215\233\230\241\261\257\271\313\300\314\340\321\335\363\331\346\375"
+  "\204\332\347\376\2\331\346\375\256\271\313\216agr\6\205\215\233ov\201"
+  "agr\264\276\321\332\347\376\275\310\334\216agr\2qx\203\320\334\362\237"
+  "\332\347\376\2\242\253\275LQY\202IMU\4TYb\263\276\320\231\242\263UZc"
+  "\213IMU\10JOW[`jt{\207\213\224\242\245\257\300\273\307\332\316\333\360"
+  "\331\346\375\204\332\347\376\3\331\346\375\245\257\300JNV\215IMU\6t{"
+  "\207Z_iIMU\254\266\310\332\347\376\267\302\325\216IMU\2[ak\316\332\360"
+  "\237\332\347\376\2\230\242\26247=\202149\4>AH\254\266\310\217\230\247"
+  ">BI\213149\10""25;EIQcis~\205\222\235\246\267\266\301\324\315\331\356"
+  "\331\346\375\204\332\347\376\3\331\346\375\234\246\26625:\215149\6ci"
+  "tDHP149\244\256\277\332\347\376\261\274\316\216149\2GKS\314\330\355\237"
+  "\332\347\376\2\217\230\247\34\36!\202\31\32\35\4'*.\245\257\300\204\214"
+  "\232(+/\213\31\32\35\10\33\34\37""038RW_qx\203\224\235\255\261\274\316"
+  "\313\327\354\331\346\375\204\332\347\376\3\331\346\375\224\235\254\32"
+  "\33\36\215\31\32\35\6RW`/27\31\32\35\235\246\267\332\347\376\253\265"
+  "\307\216\31\32\35\2""25:\312\326\353\240\332\347\376\2\323\340\366\303"
+  "\317\343\227\302\316\342\2\304\317\344\305\321\346\203\310\324\351\1"
+  "\305\320\345\217\302\316\342\6\305\320\345\321\335\363\302\316\342\304"
+  "\317\344\313\330\355\305\320\345\217\302\316\342\1\311\325\352\240\332"
+  "\347\376\2\314\330\355\254\266\310\227\252\264\306\6\255\267\311\261"
+  "\274\316\265\300\323\266\301\324\265\300\323\257\272\314\217\252\264"
+  "\306\6\257\272\314\307\323\350\252\264\306\255\267\311\274\307\333\256"
+  "\271\313\217\252\264\306\1\270\303\326\240\332\347\376\2\305\320\345"
+  "\224\235\254\202\221\232\251\1\222\233\252\223\221\232\251\10\222\233"
+  "\252\226\237\257\234\246\266\242\254\275\244\256\277\242\254\275\232"
+  "\243\263\222\233\252\216\221\232\251\6\231\242\262\275\310\334\221\232"
+  "\251\226\237\257\255\267\311\230\241\261\217\221\232\251\1\247\261\302"
+  "\240\332\347\376\2\275\310\334}\204\221\202y\201\215\1z\202\216\223y"
+  "\201\215\10z\202\216\177\207\224\210\220\236\220\230\247\222\233\252"
+  "\220\231\250\205\214\232z\202\216\216y\201\215\6\204\214\231\264\276"
+  "\321y\201\215\177\207\224\235\247\267\203\213\230\217y\201\215\1\226"
+  "\237\256\240\332\347\376\2\266\301\324flw\226agr\7bhsio{sz\206}\204\221"
+  "\200\210\225~\205\222nu\200\217agr\6mt\177\252\264\306agrio{\217\227"
+  "\246ms\177\217agr\1\205\214\232\240\332\347\376\2\257\271\313NR[\202"
+  "IMU\1JNV\223IMU\10JOWRW`_eojp|nu\200kq}Y^hJNV\216IMU\6X]g\240\252\273"
+  "IMURW`\177\207\224V[e\217IMU\1sz\206\240\332\347\376\2\250\262\3037:"
+  "@\202149\1""25:\223149\10""25;<\77FJOWW\\f\\blY^hDHO25:\216149\6BFM\227"
+  "\240\260149<\77Fpw\202AEL\217149\1bhs\240\332\347\376\2\240\252\273\40"
+  "\"%\202\31\32\35\1\32\33\36\223\31\32\35\10\33\34\37%'+69\77DHPJOWFJ"
+  "R.16\32\33\36\216\31\32\35\6,/4\215\226\245\31\32\35%'+afq+-2\217\31"
+  "\32\35\1QV_\241\332\347\376\1\322\337\365\255\302\316\342\3\321\336\364"
+  "\321\335\363\305\321\346\222\302\316\342\1\325\342\370\240\332\347\376"
+  "\1\313\327\354\255\252\264\306\3\310\324\351\306\322\347\261\274\316"
+  "\222\252\264\306\1\320\334\362\240\332\347\376\2\303\317\343\222\233"
+  "\252\254\221\232\251\4\277\312\336\275\310\334\234\245\265\222\233\252"
+  "\221\221\232\251\1\313\327\354\240\332\347\376\2\274\307\332z\202\216"
+  "\254y\201\215\4\265\300\323\263\275\320\207\217\235z\202\216\221y\201"
+  "\215\1\306\321\346\240\332\347\376\2\264\277\322bhs\254agr\3\254\266"
+  "\310\251\263\305rx\204\222agr\1\300\314\340\240\332\347\376\2\254\267"
+  "\311JOW\254IMU\4\243\254\276\237\250\271]cmJNV\221IMU\1\273\307\332\240"
+  "\332\347\376\2\245\256\30025;\254149\4\231\242\263\226\237\256HLT25:"
+  "\221149\1\266\301\324\240\332\347\376\2\235\246\267\33\34\37\254\31\32"
+  "\35\4\220\231\250\213\224\24236<\32\33\36\221\31\32\35\1\261\274\316"
+  "\241\332\347\376\1\307\323\350\254\302\316\342\5\303\317\343\317\333"
+  "\361\325\342\370\315\331\357\303\317\343\220\302\316\342\1\316\332\360"
+  "\241\332\347\376\1\264\277\322\254\252\264\306\5\253\265\307\304\320"
+  "\344\317\333\361\300\313\337\253\265\307\220\252\264\306\1\302\316\342"
+  "\241\332\347\376\1\242\253\274\254\221\232\251\5\223\234\253\271\304"
+  "\327\311\325\352\263\276\320\223\234\253\220\221\232\251\1\265\300\323"
+  "\241\332\347\376\1\217\227\246\254y\201\215\5|\203\220\256\270\312\303"
+  "\317\343\245\257\300{\202\217\220y\201\215\1\251\263\305\241\332\347"
+  "\376\1|\203\220\254agr\5dju\243\254\276\276\311\335\230\242\262cit\220"
+  "agr\1\234\246\266\241\332\347\376\1io{\254IMU\5LQY\230\241\261\270\303"
+  "\326\213\223\242KPX\220IMU\1\220\231\250\241\332\347\376\1V[e\254149"
+  "\5""58>\215\225\244\262\275\317~\206\22336<\220149\1\204\214\231\241"
+  "\332\347\376\1DHO\254\31\32\35\5\35\37\"\201\211\227\254\266\310pw\203"
+  "\33\35\40\220\31\32\35\1x\177\213\240\332\347\376\1\323\340\366\302\302"
+  "\316\342\1\314\331\356\240\332\347\376\1\314\331\356\302\252\264\306"
+  "\1\277\312\336\240\332\347\376\2\306\321\346\222\233\252\301\221\232"
+  "\251\1\261\274\316\240\332\347\376\2\277\312\336z\202\216\301y\201\215"
+  "\1\243\255\276\240\332\347\376\1\270\303\326\302agr\1\225\236\255\240"
+  "\332\347\376\2\261\274\317JNV\301IMU\1\207\217\235\240\332\347\376\2"
+  "\253\265\30725:\301149\1y\201\215\240\332\347\376\2\244\256\277\32\33"
+  "\36\301\31\32\35\1lr~\240\332\347\376\1\305\321\346\302\302\316\342\1"
+  "\323\340\366\237\332\347\376\2\331\346\375\261\274\316\302\252\264\306"
+  "\1\314\331\356\237\332\347\376\2\330\345\374\234\245\265\302\221\232"
+  "\251\1\306\321\346\237\332\347\376\2\327\344\373\207\217\235\302y\201"
+  "\215\1\277\312\336\237\332\347\376\2\327\344\373rx\204\302agr\1\270\303"
+  "\326\237\332\347\376\2\327\343\372]cm\302IMU\1\261\274\316\237\332\347"
+  "\376\2\326\342\371HLT\302149\1\252\264\306\237\332\347\376\2\325\342"
+  "\37036<\302\31\32\35\1\244\255\277\237\332\347\376\1\321\335\363\302"
+  "\302\316\342\1\313\327\354\240\332\347\376\1\306\322\347\302\252\264"
+  "\306\1\272\305\331\240\332\347\376\1\274\307\333\266\221\232\251\1\222"
+  "\233\252\213\221\232\251\1\253\265\307\240\332\347\376\1\263\276\320"
+  "\266y\201\215\1z\202\216\213y\201\215\1\233\244\264\240\332\347\376\1"
+  "\251\263\304\302agr\1\213\224\242\240\332\347\376\1\236\250\271\266I"
+  "MU\1JNV\213IMU\1{\202\217\240\332\347\376\1\225\236\256\266149\1""25"
+  ":\213149\1lr~\240\332\347\376\1\213\223\242\266\31\32\35\1\32\33\36\213"
+  "\31\32\35\1[ak\240\332\347\376\1\305\321\346\264\302\316\342\3\312\326"
+  "\353\322\337\365\316\332\360\212\302\316\342\1\312\326\353\241\332\347"
+  "\376\1\260\273\315\264\252\264\306\3\271\304\327\313\327\354\301\315"
+  "\341\212\252\264\306\2\271\304\327\331\346\375\240\332\347\376\1\233"
+  "\244\264\263\221\232\251\5\222\233\252\250\262\303\302\316\342\264\277"
+  "\322\222\233\252\211\221\232\251\2\250\262\303\330\345\374\240\332\347"
+  "\376\1\205\215\233\263y\201\215\5z\202\216\227\240\260\273\306\331\250"
+  "\262\304z\202\216\211y\201\215\2\227\240\260\330\345\374\237\332\347"
+  "\376\2\331\346\375qx\203\264agr\3\206\216\234\263\276\320\234\245\265"
+  "\212agr\2\206\216\234\327\344\373\237\332\347\376\2\331\346\375[ak\263"
+  "IMU\5JNVu|\210\252\264\306\217\227\246JNV\211IMU\2u|\210\327\343\372"
+  "\237\332\347\376\2\331\346\375FJR\263149\5""25:djt\243\254\276\203\213"
+  "\23025:\211149\2ekv\327\343\372\237\332\347\376\2\331\346\375149\263"
+  "\31\32\35\5\32\33\36SX`\233\244\265v}\211\32\33\36\211\31\32\35\2TYb"
+  "\326\343\371\237\332\347\376\1\324\341\367\263\302\316\342\6\311\325"
+  "\352\323\340\366\316\332\360\305\320\345\302\316\342\303\317\343\210"
+  "\302\316\342\1\315\331\357\241\332\347\376\1\315\331\357\263\252\264"
+  "\306\6\267\302\325\314\330\355\302\316\342\256\271\313\252\264\306\253"
+  "\265\307\210\252\264\306\1\300\314\340\241\332\347\376\1\306\322\347"
+  "\263\221\232\251\6\245\257\300\304\320\344\266\301\324\230\241\261\221"
+  "\232\251\223\234\253\207\221\232\251\2\222\233\252\264\276\321\241\332"
+  "\347\376\1\300\313\337\263y\201\215\6\223\234\253\274\310\333\252\264"
+  "\306\202\212\227y\201\215{\202\217\207y\201\215\2z\202\216\247\261\302"
+  "\241\332\347\376\1\271\304\327\263agr\6\202\212\227\265\277\323\236\250"
+  "\271ms\177agrdju\207agr\3bhs\232\243\264\331\346\375\240\332\347\376"
+  "\1\262\275\317\263IMU\6pw\202\255\267\312\223\233\253V[eIMULQY\207IM"
+  "U\3JOW\215\226\245\331\346\375\240\332\347\376\1\253\265\307\263149\6"
+  "^dn\245\257\301\207\217\235@DK14947=\207149\3""25;\201\210\226\331\346"
+  "\375\240\332\347\376\1\244\256\277\263\31\32\35\6LQY\236\247\270{\202"
+  "\217*,1\31\32\35\34\36!\207\31\32\35\3\33\34\37t{\207\331\346\375\240"
+  "\332\347\376\1\313\330\355\262\302\316\342\2\310\324\351\311\325\352"
+  "\203\302\316\342\2\314\331\356\323\340\366\206\302\316\342\2\305\321"
+  "\346\324\341\367\242\332\347\376\1\275\310\334\262\252\264\306\2\266"
+  "\301\324\267\302\325\203\252\264\306\2\277\312\336\313\330\355\206\252"
+  "\264\306\2\260\273\315\316\332\360\242\332\347\376\1\256\271\313\261"
+  "\221\232\251\4\222\233\252\243\255\276\245\257\300\222\233\252\202\221"
+  "\232\251\2\260\273\315\304\317\344\206\221\232\251\2\233\244\264\310"
+  "\324\351\242\332\347\376\1\240\251\272\261y\201\215\4z\202\216\221\232"
+  "\251\223\234\253z\202\216\202y\201\215\2\242\254\275\274\307\333\206"
+  "y\201\215\2\206\216\234\302\316\342\242\332\347\376\1\220\231\250\261"
+  "agr\4bhs\177\206\223\201\211\226bhs\202agr\2\224\235\254\265\300\323"
+  "\206agr\2qx\203\273\307\332\242\332\347\376\1\202\212\227\261IMU\4JO"
+  "Wms\177ov\201JOW\202IMU\2\206\216\234\256\270\312\206IMU\2[ak\265\300"
+  "\323\242\332\347\376\1sz\206\261149\4""25;Z_i]cm25;\202149\2x\177\213"
+  "\246\260\301\206149\2GKS\257\272\314\242\332\347\376\1ekv\261\31\32\35"
+  "\4\33\34\37HLTKPX\33\34\37\202\31\32\35\2jp|\236\250\270\206\31\32\35"
+  "\2""25:\251\264\305\242\332\347\376\1\305\321\346\266\302\316\342\3\317"
+  "\333\361\327\344\373\306\322\347\204\302\316\342\3\303\317\343\316\332"
+  "\360\331\346\375\243\332\347\376\1\260\273\315\266\252\264\306\3\303"
+  "\317\343\325\342\370\262\274\317\204\252\264\306\3\254\266\310\301\315"
+  "\341\330\345\374\243\332\347\376\1\234\245\265\266\221\232\251\3\270"
+  "\303\326\322\337\365\235\247\267\204\221\232\251\3\225\236\255\265\277"
+  "\322\327\344\373\243\332\347\376\1\206\216\234\266y\201\215\3\254\266"
+  "\310\320\334\362\211\221\237\204y\201\215\3~\205\222\251\263\304\327"
+  "\343\372\243\332\347\376\1rx\204\266agr\3\241\252\273\315\332\357t{\207"
+  "\204agr\3flw\234\245\266\326\343\371\243\332\347\376\1\\bl\266IMU\3\225"
+  "\236\255\313\327\354`ep\204IMU\3OS\\\217\230\247\325\342\370\243\332"
+  "\347\376\1HLT\266149\3\212\222\240\310\324\351KPX\204149\3""8;A\203\213"
+  "\231\324\341\367\243\332\347\376\1""25;\266\31\32\35\3~\205\222\306\322"
+  "\3467:@\204\31\32\35\3\40\"&v}\212\323\340\366\242\332\347\376\1\330"
+  "\345\374\266\302\316\342\3\315\331\357\324\341\367\305\320\345\204\302"
+  "\316\342\2\313\327\354\327\344\373\244\332\347\376\1\326\343\371\266"
+  "\252\264\306\3\300\313\337\316\332\360\257\272\314\204\252\264\306\2"
+  "\273\306\332\325\342\370\244\332\347\376\1\324\341\367\266\221\232\251"
+  "\3\262\275\317\310\324\351\231\242\262\203\221\232\251\3\222\233\252"
+  "\254\266\310\322\336\364\244\332\347\376\1\322\336\364\266y\201\215\3"
+  "\245\257\300\302\316\342\204\214\231\203y\201\215\3z\202\216\234\246"
+  "\266\317\333\361\244\332\347\376\1\320\334\362\266agr\3\230\241\261\273"
+  "\307\332nu\200\203agr\3bhs\215\225\244\314\330\355\244\332\347\376\1"
+  "\315\332\357\266IMU\3\212\222\241\265\300\323X]g\203IMU\3JOW~\205\222"
+  "\311\325\352\244\332\347\376\1\314\330\355\266149\3}\205\222\257\272"
+  "\314CGN\203149\3""25;nu\200\306\322\346\244\332\347\376\1\311\325\352"
+  "\266\31\32\35\3pv\202\251\264\305-05\203\31\32\35\3\33\34\37_eo\303\317"
+  "\343\244\332\347\376\1\324\341\367\265\302\316\342\2\306\322\347\313"
+  "\330\355\204\302\316\342\2\312\326\353\326\342\371\246\332\347\376\1"
+  "\316\332\360\265\252\264\306\2\262\275\317\275\310\334\204\252\264\306"
+  "\2\272\305\330\321\336\364\246\332\347\376\1\310\324\351\265\221\232"
+  "\251\3\236\247\270\256\270\312\222\233\252\202\221\232\251\3\222\233"
+  "\252\250\262\304\315\331\357\246\332\347\376\1\302\316\342\265y\201\215"
+  "\3\212\222\241\237\250\271z\202\216\202y\201\215\3z\202\216\230\241\261"
+  "\311\325\352\246\332\347\376\1\274\307\333\265agr\3v}\211\220\230\247"
+  "bhs\202agr\3bhs\210\220\236\304\320\344\246\332\347\376\1\266\301\324"
+  "\265IMU\3agq\201\211\226JOW\202IMU\3JOWw~\212\300\313\337\246\332\347"
+  "\376\1\260\273\315\265149\3NRZrx\20425;\202149\3""25;gmx\273\307\332"
+  "\246\332\347\376\1\252\264\306\265\31\32\35\3""9=Bcit\33\34\37\202\31"
+  "\32\35\3\33\34\37V[e\267\302\325\246\332\347\376\1\321\336\364\270\302"
+  "\316\342\3\303\317\343\313\327\354\327\343\372\250\332\347\376\1\311"
+  "\325\352\270\252\264\306\3\253\265\307\273\306\332\322\337\365\250\332"
+  "\347\376\1\300\313\337\265\221\232\251\1\222\233\252\202\221\232\251"
+  "\3\223\234\253\254\266\310\316\332\360\250\332\347\376\1\267\302\325"
+  "\265y\201\215\1z\202\216\202y\201\215\3{\202\217\234\246\266\312\326"
+  "\353\250\332\347\376\1\256\270\312\270agr\3dju\215\225\244\306\321\346"
+  "\250\332\347\376\1\245\257\300\265IMU\1JNV\202IMU\3LQY~\205\222\301\315"
+  "\341\250\332\347\376\1\234\245\266\265149\1""25:\202149\3""47=nu\200"
+  "\275\310\334\250\332\347\376\1\223\234\254\265\31\32\35\1\32\33\36\202"
+  "\31\32\35\3\34\36!_eo\271\304\327\250\332\347\376\1\320\334\362\266\302"
+  "\316\342\3\303\317\343\314\331\356\327\344\373\252\332\347\376\1\305"
+  "\321\346\266\252\264\306\3\254\266\310\277\312\336\324\341\367\252\332"
+  "\347\376\1\272\305\331\266\221\232\251\3\225\236\255\260\273\315\321"
+  "\335\363\252\332\347\376\1\260\273\315\266y\201\215\3~\205\222\243\254"
+  "\276\316\332\360\252\332\347\376\1\246\260\301\266agr\3flw\224\235\255"
+  "\313\327\354\252\332\347\376\1\233\244\264\266IMU\3OS\\\207\217\235\307"
+  "\323\350\252\332\347\376\1\220\231\250\266149\3""8;Ax\177\214\305\320"
+  "\345\252\332\347\376\1\206\216\234\266\31\32\35\3\40\"&kq|\301\315\341"
+  "\252\332\347\376\1\317\333\361\264\302\316\342\3\303\317\343\315\331"
+  "\357\330\345\374\254\332\347\376\1\304\320\344\264\252\264\306\3\253"
+  "\265\307\300\314\340\327\343\372\254\332\347\376\1\270\303\326\264\221"
+  "\232\251\3\224\235\254\264\276\321\324\341\367\254\332\347\376\1\255"
+  "\267\311\264y\201\215\3|\203\220\247\261\302\322\337\365\254\332\347"
+  "\376\1\241\253\274\264agr\3ekv\232\243\264\320\334\362\254\332\347\376"
+  "\1\226\237\257\264IMU\3MRZ\215\226\245\316\332\360\254\332\347\376\1"
+  "\212\222\241\264149\3""69\77\201\210\226\314\330\355\254\332\347\376"
+  "\1\177\206\224\264\31\32\35\3\36\40#t{\207\312\326\353\254\332\347\376"
+  "\1\317\333\361\264\302\316\342\1\321\336\364\256\332\347\376\1\304\320"
+  "\344\264\252\264\306\1\311\325\352\256\332\347\376\1\270\303\326\264"
+  "\221\232\251\1\300\314\340\256\332\347\376\1\255\267\311\264y\201\215"
+  "\1\270\303\326\256\332\347\376\1\242\253\275\264agr\1\257\272\314\256"
+  "\332\347\376\1\226\237\257\264IMU\1\247\261\302\256\332\347\376\1\213"
+  "\223\242\264149\1\236\250\271\256\332\347\376\1\200\207\225\264\31\32"
+  "\35\1\226\237\257\256\332\347\376\1\320\334\362\263\302\316\342\1\303"
+  "\317\343\257\332\347\376\1\305\321\346\263\252\264\306\1\253\265\307"
+  "\257\332\347\376\1\273\306\332\263\221\232\251\1\223\234\253\257\332"
+  "\347\376\1\261\274\316\263y\201\215\1|\203\220\257\332\347\376\1\246"
+  "\260\301\263agr\2dju\331\346\375\256\332\347\376\1\234\245\265\263IM"
+  "U\2LQY\331\346\375\256\332\347\376\1\221\232\251\263149\2""58>\331\346"
+  "\375\256\332\347\376\1\207\217\235\263\31\32\35\2\35\37\"\331\346\375"
+  "\256\332\347\376\1\321\336\364\264\302\316\342\1\330\345\374\256\332"
+  "\347\376\1\311\325\352\264\252\264\306\1\327\343\372\256\332\347\376"
+  "\1\300\313\337\263\221\232\251\2\222\233\252\324\341\367\256\332\347"
+  "\376\1\267\302\325\263y\201\215\2z\202\216\322\337\365\256\332\347\376"
+  "\1\256\270\312\263agr\2bhs\321\335\363\256\332\347\376\1\245\257\300"
+  "\263IMU\2JOW\316\332\360\256\332\347\376\1\234\245\266\263149\2""25;"
+  "\315\331\356\256\332\347\376\1\223\234\254\263\31\32\35\2\33\34\37\313"
+  "\327\354\256\332\347\376\1\324\341\367\264\302\316\342\1\313\327\354"
+  "\256\332\347\376\1\315\331\357\264\252\264\306\1\273\306\332\256\332"
+  "\347\376\1\306\322\347\264\221\232\251\1\254\266\310\256\332\347\376"
+  "\1\277\313\337\264y\201\215\1\234\246\266\256\332\347\376\1\271\304\327"
+  "\264agr\1\215\225\244\256\332\347\376\1\262\274\317\264IMU\1~\205\222"
+  "\256\332\347\376\1\253\265\307\264149\1nu\200\256\332\347\376\1\244\256"
+  "\277\264\31\32\35\1_eo\256\332\347\376\1\327\343\372\265\302\316\342"
+  "\1\315\331\357\255\332\347\376\1\323\340\366\265\252\264\306\1\300\314"
+  "\340\255\332\347\376\1\317\333\361\265\221\232\251\1\264\276\321\255"
+  "\332\347\376\1\314\330\355\265y\201\215\1\247\261\302\255\332\347\376"
+  "\1\307\323\350\265agr\1\232\243\263\255\332\347\376\1\304\320\344\265"
+  "IMU\1\215\225\244\255\332\347\376\1\300\313\337\265149\1\200\210\225"
+  "\255\332\347\376\1\274\310\333\265\31\32\35\1sz\206\255\332\347\376\1"
+  "\322\337\365\266\302\316\342\1\317\333\361\254\332\347\376\1\313\327"
+  "\354\266\252\264\306\1\304\317\344\254\332\347\376\1\302\316\342\266"
+  "\221\232\251\1\271\304\327\254\332\347\376\1\273\306\331\266y\201\215"
+  "\1\256\270\312\254\332\347\376\1\262\275\317\266agr\1\242\254\275\254"
+  "\332\347\376\1\252\264\306\266IMU\1\227\240\260\254\332\347\376\1\242"
+  "\253\275\266149\1\214\225\243\254\332\347\376\1\232\243\264\266\31\32"
+  "\35\1\201\211\226\253\332\347\376\2\326\342\371\304\317\344\267\302\316"
+  "\342\1\322\337\365\252\332\347\376\2\321\335\363\255\267\311\267\252"
+  "\264\306\1\313\327\354\252\332\347\376\2\313\330\355\226\237\256\266"
+  "\221\232\251\2\222\233\252\302\316\342\252\332\347\376\2\306\322\347"
+  "\177\206\223\266y\201\215\2z\202\216\273\306\331\252\332\347\376\2\302"
+  "\316\342hoz\267agr\1\262\275\317\252\332\347\376\2\275\310\334QV_\266"
+  "IMU\2JNV\252\264\306\252\332\347\376\2\270\303\326:>D\266149\2""25:\242"
+  "\253\275\252\332\347\376\2\263\275\320#%)\266\31\32\35\2\32\33\36\232"
+  "\243\264\251\332\347\376\2\326\342\371\304\317\344\270\302\316\342\2"
+  "\303\317\343\327\343\372\250\332\347\376\2\321\336\364\256\270\312\270"
+  "\252\264\306\2\254\266\310\323\340\366\250\332\347\376\2\314\331\356"
+  "\227\240\260\270\221\232\251\2\225\236\255\320\334\362\250\332\347\376"
+  "\2\310\324\351\201\211\226\270y\201\215\2~\205\222\314\331\356\250\332"
+  "\347\376\2\304\320\344jp|\270agr\2gmx\311\325\352\250\332\347\376\2\277"
+  "\312\336TYb\270IMU\2PT]\306\321\346\250\332\347\376\2\273\306\331>AH"
+  "\270149\2""8<B\302\316\342\250\332\347\376\2\266\301\324'*.\270\31\32"
+  "\35\2!#'\277\312\336\247\332\347\376\2\327\344\373\305\320\345\261\302"
+  "\316\342\3\312\326\353\316\332\360\307\323\350\206\302\316\342\1\312"
+  "\326\353\247\332\347\376\2\324\341\367\256\271\313\261\252\264\306\3"
+  "\272\305\330\302\316\342\264\277\322\206\252\264\306\1\271\304\327\247"
+  "\332\347\376\2\321\336\364\230\241\261\261\221\232\251\4\251\263\305"
+  "\266\301\324\242\253\274\222\233\252\205\221\232\251\1\250\262\303\247"
+  "\332\347\376\2\316\332\360\203\213\230\261y\201\215\4\231\242\262\252"
+  "\264\306\217\227\246z\202\216\205y\201\215\1\226\237\257\247\332\347"
+  "\376\2\314\330\355ms\177\261agr\4\211\221\237\235\247\267|\203\220bh"
+  "s\205agr\1\206\216\234\247\332\347\376\2\310\324\351V[e\261IMU\4y\200"
+  "\214\221\232\251io{JOW\205IMU\1u|\210\247\332\347\376\2\306\321\346A"
+  "EL\261149\4hoz\205\215\233V[e25;\205149\1dju\247\332\347\376\2\302\316"
+  "\342+-2\261\31\32\35\4X]gy\201\215DHO\33\34\37\205\31\32\35\1SXa\247"
+  "\332\347\376\1\311\325\352\262\302\316\342\7\305\320\345\330\345\374"
+  "\332\347\376\330\345\374\321\335\363\311\325\352\303\317\343\202\302"
+  "\316\342\1\303\317\343\247\332\347\376\1\267\302\325\262\252\264\306"
+  "\7\257\272\314\326\343\371\332\347\376\326\343\371\306\322\347\267\302"
+  "\325\253\265\307\202\252\264\306\1\253\265\307\247\332\347\376\1\246"
+  "\260\301\262\221\232\251\7\232\243\263\323\340\366\332\347\376\323\340"
+  "\366\275\310\334\245\257\300\224\235\254\202\221\232\251\2\223\234\253"
+  "\331\346\375\246\332\347\376\1\224\235\254\262y\201\215\7\205\214\232"
+  "\321\335\363\332\347\376\321\335\363\263\275\320\223\234\253|\203\220"
+  "\202y\201\215\2{\202\217\331\346\375\246\332\347\376\1\203\213\230\262"
+  "agr\7nu\200\317\333\361\332\347\376\316\333\360\251\263\305\201\211\226"
+  "ekv\202agr\2dju\331\346\375\246\332\347\376\1qx\203\262IMU\7Y^h\314\331"
+  "\356\332\347\376\314\330\355\237\250\271ov\201MRZ\202IMU\2LQY\330\345"
+  "\374\246\332\347\376\1`ep\262149\7DHO\312\326\353\332\347\376\311\325"
+  "\352\226\237\256]cm69\77\202149\2""47=\330\345\374\246\332\347\376\1"
+  "NR[\262\31\32\35\7.16\307\323\350\332\347\376\307\323\347\213\224\242"
+  "KPX\36\40#\202\31\32\35\2\34\36!\330\345\374\245\332\347\376\1\330\345"
+  "\374\203\302\316\342\1\303\317\343\202\311\325\352\256\302\316\342\2"
+  "\306\322\347\331\346\375\203\332\347\376\4\330\345\374\322\337\365\315"
+  "\331\357\316\332\360\246\332\347\376\1\327\343\372\203\252\264\306\3"
+  "\253\265\307\270\303\326\267\302\325\256\252\264\306\2\263\275\320\327"
+  "\344\373\203\332\347\376\4\327\343\372\313\327\354\277\313\337\302\316"
+  "\342\246\332\347\376\2\325\342\370\222\233\252\202\221\232\251\3\223"
+  "\234\253\247\261\302\245\257\300\256\221\232\251\2\237\250\271\326\342"
+  "\371\203\332\347\376\4\325\342\370\302\316\342\263\275\320\266\301\324"
+  "\246\332\347\376\2\323\340\366z\202\216\202y\201\215\3{\202\217\226\237"
+  "\256\223\234\254\256y\201\215\2\213\224\242\325\342\370\203\332\347\376"
+  "\4\323\340\366\273\306\331\245\257\300\252\264\306\246\332\347\376\1"
+  "\321\335\363\203agr\3cit\205\214\232\202\212\230\256agr\2x\177\213\323"
+  "\340\366\203\332\347\376\4\322\336\364\262\275\317\230\241\261\236\247"
+  "\270\246\332\347\376\2\317\333\361JNV\202IMU\3KPXsz\206pw\203\256IMU"
+  "\2dju\321\336\364\203\332\347\376\4\320\334\362\252\264\306\212\223\241"
+  "\222\232\252\246\332\347\376\2\315\332\35725:\202149\3""36<bhs_dn\256"
+  "149\2PU^\321\335\363\203\332\347\376\4\316\333\360\242\253\275~\205\222"
+  "\206\216\234\246\332\347\376\2\314\330\355\32\33\36\202\31\32\35\3\33"
+  "\35\40QV_MQY\256\31\32\35\2=@G\317\333\361\203\332\347\376\4\315\331"
+  "\356\232\243\264pw\202z\201\216\247\332\347\376\6\307\323\350\306\322"
+  "\347\316\332\360\327\344\373\332\347\376\311\325\352\206\302\316\342"
+  "\6\312\326\353\327\343\372\321\336\364\313\330\355\306\322\347\303\317"
+  "\343\227\302\316\342\202\304\317\344\212\302\316\342\2\310\324\351\331"
+  "\346\375\254\332\347\376\7\331\346\375\265\277\322\263\275\320\301\315"
+  "\341\324\341\367\332\347\376\267\302\325\206\252\264\306\6\272\305\330"
+  "\323\340\366\310\324\351\274\307\333\262\274\317\253\265\307\227\252"
+  "\264\306\202\255\267\311\212\252\264\306\2\265\300\323\330\345\374\254"
+  "\332\347\376\7\330\345\374\242\253\275\237\250\271\264\277\322\321\335"
+  "\363\332\347\376\246\260\301\206\221\232\251\6\251\264\305\317\333\361"
+  "\277\313\337\255\267\311\235\247\267\223\234\253\227\221\232\251\2\226"
+  "\237\257\226\237\256\212\221\232\251\2\243\255\276\327\344\373\254\332"
+  "\347\376\7\330\344\373\217\230\247\213\224\242\250\262\303\315\332\357"
+  "\332\347\376\224\235\255\206y\201\215\6\231\242\263\314\330\355\266\301"
+  "\324\236\250\270\211\221\237{\202\217\227y\201\215\2\177\207\224\177"
+  "\206\223\212y\201\215\2\220\231\250\327\343\372\254\332\347\376\7\327"
+  "\344\372|\204\221x\177\213\233\244\264\312\326\353\332\347\376\203\213"
+  "\231\206agr\6\210\220\237\307\323\350\256\270\312\217\227\246t{\207c"
+  "it\227agr\2io{gny\212agr\2\177\206\223\326\342\371\254\332\347\376\7"
+  "\326\343\371jp{dju\216\226\245\307\322\347\332\347\376qx\204\206IMU\6"
+  "x\177\214\304\320\344\244\256\277\177\207\224`epKPX\227IMU\2RW`PU^\212"
+  "IMU\2lr~\325\342\370\254\332\347\376\7\325\342\370W\\ePU^\201\211\226"
+  "\303\317\343\332\347\376`fp\206149\6hny\300\313\337\234\245\265qx\203"
+  "KPX36<\227149\2<\77F9=C\212149\2Z_i\324\341\367\254\332\347\376\7\324"
+  "\341\367DHO=@Gt{\207\300\313\337\332\347\376NS[\206\31\32\35\6X]f\274"
+  "\307\333\222\233\252agr7:@\33\35\40\227\31\32\35\2%'+\"$(\212\31\32\35"
+  "\2GKS\323\340\366\261\332\347\376\2\331\346\375\303\317\343\205\302\316"
+  "\342\1\315\331\357\205\332\347\376\10\331\346\375\325\342\370\321\336"
+  "\364\316\332\360\313\330\355\312\326\353\307\323\350\306\322\347\202"
+  "\305\320\345\2\304\317\344\304\320\344\203\305\320\345\15\305\321\346"
+  "\307\323\350\310\324\351\313\327\354\314\331\356\317\333\361\321\336"
+  "\364\325\342\370\327\344\373\332\347\376\330\345\374\317\333\361\305"
+  "\320\345\211\302\316\342\1\313\327\354\261\332\347\376\2\330\345\374"
+  "\253\265\307\205\252\264\306\1\300\314\340\205\332\347\376\14\327\344"
+  "\373\320\334\362\311\325\352\302\316\342\275\310\334\271\304\327\264"
+  "\277\322\262\274\317\257\272\314\256\271\313\256\270\312\255\267\311"
+  "\203\256\271\313\15\261\274\316\264\276\321\266\301\324\272\305\331\277"
+  "\312\336\304\320\344\311\325\352\317\333\361\325\342\370\331\346\375"
+  "\327\343\372\304\317\344\257\272\314\211\252\264\306\1\273\307\332\261"
+  "\332\347\376\2\327\343\372\224\235\254\205\221\232\251\1\264\276\321"
+  "\205\332\347\376\14\326\342\371\313\327\354\300\314\340\266\301\324\256"
+  "\270\312\250\262\303\242\253\274\235\247\267\232\243\263\230\241\261"
+  "\226\237\257\227\240\260\202\230\241\261\16\231\242\262\234\246\266\240"
+  "\251\272\244\256\277\252\264\306\260\273\315\270\303\326\277\313\337"
+  "\311\325\352\322\337\365\331\346\375\325\342\370\270\303\326\232\243"
+  "\263\211\221\232\251\1\254\266\310\261\332\347\376\2\326\343\371|\203"
+  "\220\205y\201\215\1\247\261\302\205\332\347\376\14\325\342\370\305\321"
+  "\346\270\303\326\252\264\306\237\250\271\227\240\260\217\227\246\212"
+  "\222\240\205\214\232\202\212\227\200\210\225\200\207\225\202\202\212"
+  "\227\16\203\213\230\210\220\236\215\225\244\222\233\252\232\243\263\242"
+  "\254\276\255\267\311\267\302\325\303\317\343\320\334\362\330\345\374"
+  "\323\340\366\255\267\311\205\214\232\211y\201\215\1\235\246\267\261\332"
+  "\347\376\2\324\341\367ekv\205agr\2\231\242\263\331\346\375\204\332\347"
+  "\376\14\323\340\366\300\314\340\257\271\313\236\250\270\220\231\250\206"
+  "\216\234{\202\217u|\210nu\200lr~io{jp{\202lr~\16mt\177sz\206y\201\215"
+  "\200\210\225\212\223\241\225\236\256\241\253\274\256\270\312\275\310"
+  "\334\315\331\357\330\345\374\321\336\364\242\253\274ov\201\211agr\1\215"
+  "\226\245\261\332\347\376\2\323\340\366MRZ\205IMU\2\215\225\244\331\346"
+  "\375\204\332\347\376\14\321\336\364\273\306\332\246\260\301\222\233\252"
+  "\201\211\226u|\210hozafqY^hU[dSXaSX`\202U[d\16W\\f_eoflwnu\200z\202\216"
+  "\206\216\235\226\237\257\245\257\300\267\302\325\313\327\354\327\344"
+  "\373\320\334\362\226\237\256Z_i\211IMU\1~\206\223\261\332\347\376\2\322"
+  "\336\36469\77\205149\2\200\207\225\331\346\375\204\332\347\376\14\321"
+  "\335\363\266\301\324\236\247\270\206\216\234sy\205ekvU[dMRZDHO\77CJ<"
+  "\77F=@F\202\77CJ\16BFMJOWSXa\\bljp|y\200\215\212\222\241\234\245\265"
+  "\261\274\316\310\324\351\327\344\373\316\332\360\212\223\241DHP\2111"
+  "49\1ou\201\261\332\347\376\2\321\335\363\36\40#\205\31\32\35\2sz\206"
+  "\331\346\375\204\332\347\376\12\317\333\361\261\274\316\225\236\256z"
+  "\202\216djuTYbCGN8<B.16)+0\202&(,\202)+0\16,.369\77\77CJJOWZ_ikq}\177"
+  "\206\224\223\234\253\253\265\307\305\321\346\327\343\372\314\331\356"
+  "\177\207\224/27\211\31\32\35\1_eo\261\332\347\376\1\322\337\365\204\302"
+  "\316\342\2\303\317\343\321\335\363\242\332\347\376\2\321\336\364\307"
+  "\323\350\210\302\316\342\1\323\340\366\260\332\347\376\1\312\326\353"
+  "\204\252\264\306\2\253\265\307\306\322\347\241\332\347\376\3\331\346"
+  "\375\311\325\352\264\276\321\210\252\264\306\1\314\331\356\260\332\347"
+  "\376\1\302\316\342\204\221\232\251\2\223\234\253\274\307\333\220\332"
+  "\347\376\202\331\346\375\217\332\347\376\3\330\345\374\300\314\340\241"
+  "\252\273\210\221\232\251\1\306\321\346\260\332\347\376\1\272\305\330"
+  "\204y\201\215\2{\202\217\262\274\317\220\332\347\376\202\331\346\375"
+  "\217\332\347\376\3\327\344\373\270\303\326\215\225\244\210y\201\215\1"
+  "\277\312\336\260\332\347\376\1\262\275\317\204agr\2cit\250\262\304\217"
+  "\332\347\376\205\331\346\375\215\332\347\376\3\327\344\373\257\271\313"
+  "z\202\216\210agr\1\270\303\326\260\332\347\376\1\251\264\305\204IMU\2"
+  "KPX\236\250\270\217\332\347\376\1\331\346\375\202\330\345\374\202\331"
+  "\346\375\215\332\347\376\3\327\343\372\246\260\301gmx\210IMU\1\261\274"
+  "\316\260\332\347\376\1\242\253\275\204149\2""36<\224\235\254\217\332"
+  "\347\376\1\331\346\375\202\330\345\374\202\331\346\375\215\332\347\376"
+  "\3\326\342\371\236\247\270TYb\210149\1\252\264\306\260\332\347\376\1"
+  "\231\242\263\204\31\32\35\2\33\35\40\212\222\240\217\332\347\376\1\331"
+  "\346\375\202\330\345\374\202\331\346\375\215\332\347\376\3\325\342\370"
+  "\225\236\256@DK\210\31\32\35\1\244\255\277\260\332\347\376\1\313\327"
+  "\354\203\302\316\342\2\303\317\343\323\340\366\245\332\347\376\3\325"
+  "\342\370\313\327\354\303\317\343\205\302\316\342\1\313\327\354\260\332"
+  "\347\376\1\273\306\332\203\252\264\306\2\254\266\310\313\330\355\245"
+  "\332\347\376\3\320\334\362\273\307\332\253\265\307\205\252\264\306\1"
+  "\273\307\332\260\332\347\376\1\253\265\307\203\221\232\251\2\225\236"
+  "\255\304\317\344\245\332\347\376\3\312\326\353\253\265\307\224\235\254"
+  "\205\221\232\251\1\254\266\310\260\332\347\376\1\234\245\265\203y\201"
+  "\215\2~\205\222\275\310\334\245\332\347\376\3\305\320\345\234\245\266"
+  "|\203\220\205y\201\215\1\235\246\267\260\332\347\376\1\213\224\242\203"
+  "agr\2flw\265\300\323\245\332\347\376\3\300\313\337\215\225\244ekv\205"
+  "agr\1\215\226\245\260\332\347\376\1|\203\220\203IMU\2OS\\\256\270\312"
+  "\245\332\347\376\3\272\305\330|\204\221MRZ\205IMU\1~\206\223\260\332"
+  "\347\376\1lr~\203149\2""8;A\247\261\302\245\332\347\376\3\265\277\322"
+  "mt\17769\77\205149\1ou\201\260\332\347\376\1\\bl\203\31\32\35\2\40\""
+  "&\237\250\271\245\332\347\376\3\257\272\314^cm\36\40#\205\31\32\35\1"
+  "_eo\260\332\347\376\1\304\317\344\202\302\316\342\2\305\320\345\326\342"
+  "\371\250\332\347\376\3\330\345\374\320\334\362\306\322\347\203\302\316"
+  "\342\1\313\330\355\260\332\347\376\1\256\270\312\202\252\264\306\2\256"
+  "\271\313\321\335\363\250\332\347\376\3\327\343\372\305\320\345\262\274"
+  "\317\203\252\264\306\1\275\310\334\257\332\347\376\2\331\346\375\226"
+  "\237\257\202\221\232\251\2\231\242\262\314\330\355\250\332\347\376\3"
+  "\324\341\367\272\305\330\235\247\267\203\221\232\251\1\256\271\313\257"
+  "\332\347\376\2\331\346\375\200\210\225\202y\201\215\2\203\213\230\307"
+  "\323\350\250\332\347\376\3\322\337\365\257\271\313\211\221\237\203y\201"
+  "\215\1\240\251\272\257\332\347\376\2\331\346\375io{\202agr\2mt\177\302"
+  "\316\342\250\332\347\376\3\320\334\362\244\255\277u|\210\203agr\1\220"
+  "\231\250\257\332\347\376\2\330\345\374SXa\202IMU\2W\\f\275\310\334\250"
+  "\332\347\376\3\316\332\360\230\242\262afq\203IMU\1\202\212\227\257\332"
+  "\347\376\2\330\345\374<\77F\202149\2BFM\271\304\327\250\332\347\376\3"
+  "\314\330\355\215\226\245LQY\203149\1sz\206\257\332\347\376\2\330\345"
+  "\374&(,\202\31\32\35\2,.3\264\276\321\250\332\347\376\3\312\326\353\202"
+  "\212\2308;A\203\31\32\35\1ekv\257\332\347\376\1\327\344\373\202\302\316"
+  "\342\2\307\323\350\327\344\373\254\332\347\376\4\326\342\371\317\333"
+  "\361\314\330\355\327\344\373\257\332\347\376\1\324\341\367\202\252\264"
+  "\306\2\264\277\322\325\342\370\254\332\347\376\4\321\336\364\303\317"
+  "\343\274\307\333\325\342\370\257\332\347\376\1\321\335\363\202\221\232"
+  "\251\2\241\252\273\322\337\365\254\332\347\376\4\315\331\357\267\302"
+  "\325\255\267\311\321\336\364\257\332\347\376\1\315\332\357\202y\201\215"
+  "\2\216\226\245\320\334\362\254\332\347\376\4\311\325\352\253\265\307"
+  "\236\247\270\317\333\361\257\332\347\376\1\313\327\354\202agr\2{\202"
+  "\217\314\331\356\254\332\347\376\4\304\320\344\237\250\271\216\227\246"
+  "\314\330\355\257\332\347\376\1\307\323\350\202IMU\2gny\312\326\353\254"
+  "\332\347\376\4\300\313\337\223\234\253\177\206\224\311\325\352\257\332"
+  "\347\376\1\304\320\344\202149\2UZc\307\323\350\254\332\347\376\4\273"
+  "\307\332\207\217\235pv\202\306\321\346\257\332\347\376\1\301\314\340"
+  "\202\31\32\35\2BFM\305\321\345\254\332\347\376\4\267\302\325{\202\217"
+  "`fp\303\317\343\257\332\347\376\4\330\345\374\304\317\344\315\331\357"
+  "\331\346\375\340\332\347\376\4\326\343\371\256\270\312\300\313\337\330"
+  "\345\374\340\332\347\376\4\323\340\366\226\237\257\262\275\317\327\344"
+  "\373\340\332\347\376\4\322\336\364\200\210\225\244\256\277\327\343\372"
+  "\340\332\347\376\4\317\333\361jp|\227\240\260\326\342\371\340\332\347"
+  "\376\4\315\331\356SXa\211\221\240\325\342\370\340\332\347\376\4\313\327"
+  "\354=@G|\203\220\324\341\367\340\332\347\376\4\310\324\351&)-nt\200\323"
+  "\340\366\303\332\347\376"};
 
@@ -194,7 +194,9 @@ session_editor_clear_sessions(GtkWidget *btn,
             /* only clean Xfce related items */
             if(!g_str_has_prefix(item_name, "xfce4-session-") &&
                !g_str_has_prefix(item_name, "Thunar-") &&
-               !g_str_has_prefix(item_name, "xfwm4-")) {
+               !g_str_has_prefix(item_name, "xfwm4-") &&
+               !(g_str_has_prefix(item_name, "thumbs-") &&
+                 g_str_has_suffix(item_name, ".atlas"))) {
                 continue;
             }
 
@@ -329,10 +331,10 @@ session_editor_set_from_desktop_file(GtkTreeModel *model,
 }
 
 static void
-client_sm_property_changed(DBusGProxy *proxy,
-                           const gchar *name,
-                           const GValue *value,
-                           gpointer user_data)
+client_sm_properties_changed(DBusGProxy *proxy,
+                             GHashTable *properties,
+                             gchar **deleted,
+                             gpointer user_data)
 {
     GtkTreeView *treeview = user_data;
     GtkTreeModel *model = gtk_tree_view_get_model(treeview);
@@ -341,6 +343,10 @@ client_sm_property_changed(DBusGProxy *proxy,
     GtkTreePath *path = gtk_tree_row_reference_get_path(rref);
     GtkTreeIter iter;
     gboolean has_desktop_file = FALSE;
+    gint columns[5];
+    GValue values[5] = { { 0, }, };
+    gint n_values = 0, i;
+    GValue *val;
 
     if(!gtk_tree_model_get_iter(model, &iter, path)) {
         gtk_tree_path_free(path);
@@ -352,33 +358,55 @@ client_sm_property_changed(DBusGProxy *proxy,
                        COL_HAS_DESKTOP_FILE, &has_desktop_file,
                        -1);
 
-    if(!strcmp(name, SmProgram) && G_VALUE_HOLDS_STRING(value)) {
-        if(!has_desktop_file) {
-            gtk_list_store_set(GTK_LIST_STORE(model), &iter,
-                               COL_NAME, g_value_get_string(value),
-                               -1);
-        }
-    } else if(!strcmp(name, SmRestartStyleHint) && G_VALUE_HOLDS_UCHAR(value)) {
-        guchar hint = g_value_get_uchar(value);
+    /* collect everything the batch touches and update the row once */
+    val = g_hash_table_lookup(properties, SmProgram);
+    if(val && G_VALUE_HOLDS_STRING(val) && !has_desktop_file) {
+        columns[n_values] = COL_NAME;
+        g_value_init(&values[n_values], G_TYPE_STRING);
+        g_value_set_string(&values[n_values++], g_value_get_string(val));
+    }
+
+    val = g_hash_table_lookup(properties, SmRestartStyleHint);
+    if(val && G_VALUE_HOLDS_UCHAR(val)) {
+        guchar hint = g_value_get_uchar(val);
 
         if(hint > SmRestartNever)
             hint = SmRestartIfRunning;
 
-        gtk_list_store_set(GTK_LIST_STORE(model), &iter,
-                           COL_RESTART_STYLE, hint,
-                           COL_RESTART_STYLE_STR, _(restart_styles[hint]),
-                           -1);
-    } else if(!strcmp(name, GsmPriority) && G_VALUE_HOLDS_UCHAR(value)) {
-        gtk_list_store_set(GTK_LIST_STORE(model), &iter,
-                           COL_PRIORITY, g_value_get_uchar(value),
-                           -1);
-    } else if(!strcmp(name, SmProcessID) && G_VALUE_HOLDS_STRING(value)) {
-        gtk_list_store_set(GTK_LIST_STORE(model), &iter,
-                           COL_PID, g_value_get_string(value),
-                           -1);
-    } else if(!strcmp(name, GsmDesktopFile) && G_VALUE_HOLDS_STRING(value)) {
+        columns[n_values] = COL_RESTART_STYLE;
+        g_value_init(&values[n_values], G_TYPE_UCHAR);
+        g_value_set_uchar(&values[n_values++], hint);
+        columns[n_values] = COL_RESTART_STYLE_STR;
+        g_value_init(&values[n_values], G_TYPE_STRING);
+        g_value_set_static_string(&values[n_values++],
+                                  _(restart_styles[hint]));
+    }
+
+    val = g_hash_table_lookup(properties, GsmPriority);
+    if(val && G_VALUE_HOLDS_UCHAR(val)) {
+        columns[n_values] = COL_PRIORITY;
+        g_value_init(&values[n_values], G_TYPE_UCHAR);
+        g_value_set_uchar(&values[n_values++], g_value_get_uchar(val));
+    }
+
+    val = g_hash_table_lookup(properties, SmProcessID);
+    if(val && G_VALUE_HOLDS_STRING(val)) {
+        columns[n_values] = COL_PID;
+        g_value_init(&values[n_values], G_TYPE_STRING);
+        g_value_set_string(&values[n_values++], g_value_get_string(val));
+    }
+
+    if(n_values > 0) {
+        gtk_list_store_set_valuesv(GTK_LIST_STORE(model), &iter,
+                                   columns, values, n_values);
+        for(i = 0; i < n_values; ++i)
+            g_value_unset(&values[i]);
+    }
+
+    val = g_hash_table_lookup(properties, GsmDesktopFile);
+    if(val && G_VALUE_HOLDS_STRING(val)) {
         session_editor_set_from_desktop_file(model, &iter,
-                                             g_value_get_string(value));
+                                             g_value_get_string(val));
     }
 }
 
@@ -406,42 +434,19 @@ client_state_changed(DBusGProxy *proxy,
     }
 }
 
+/* takes ownership of client_proxy */
 static void
-manager_client_registered(DBusGProxy *proxy,
+session_editor_add_client(GtkTreeView *treeview,
+                          DBusGProxy *client_proxy,
                           const gchar *object_path,
-                          gpointer user_data)
+                          GHashTable *properties)
 {
-    GtkTreeView *treeview = user_data;
     GtkTreeModel *model = gtk_tree_view_get_model(treeview);
     GtkTreePath *path;
     GtkTreeIter iter;
-    DBusGProxy *client_proxy;
-    GHashTable *properties = NULL;
-    const gchar *propnames[] = {
-        SmProgram, SmRestartStyleHint,SmProcessID, GsmPriority,
-        GsmDesktopFile, NULL
-    };
     GValue *val;
     const gchar *name = NULL, *pid = NULL;
     guchar hint = SmRestartIfRunning, priority = 50;
-    GError *error = NULL;
-
-    DBG("new client at %s", object_path);
-
-    client_proxy = dbus_g_proxy_new_for_name(dbus_conn,
-                                             "org.xfce.SessionManager",
-                                             object_path,
-                                             "org.xfce.Session.Client");
-
-    if(!xfsm_client_dbus_client_get_sm_properties(client_proxy, propnames,
-                                                  &properties, &error))
-    {
-        g_warning("Unable to get properties for client at %s: %s",
-                  object_path, error->message);
-        g_clear_error(&error);
-        g_object_unref(client_proxy);
-        return;
-    }
 
     if((val = g_hash_table_lookup(properties, SmProgram)))
         name = g_value_get_string(val);
@@ -483,11 +488,13 @@ manager_client_registered(DBusGProxy *proxy,
                            (GDestroyNotify)gtk_tree_row_reference_free);
     gtk_tree_path_free(path);
 
-    dbus_g_proxy_add_signal(client_proxy, "SmPropertyChanged",
-                            G_TYPE_STRING, G_TYPE_VALUE,
-                            G_TYPE_INVALID);
-    dbus_g_proxy_connect_signal(client_proxy, "SmPropertyChanged",
-                                G_CALLBACK(client_sm_property_changed),
+    dbus_g_proxy_add_signal(client_proxy, "SmPropertiesChanged",
+                            dbus_g_type_get_map("GHashTable",
+                                                G_TYPE_STRING,
+                                                G_TYPE_VALUE),
+                            G_TYPE_STRV, G_TYPE_INVALID);
+    dbus_g_proxy_connect_signal(client_proxy, "SmPropertiesChanged",
+                                G_CALLBACK(client_sm_properties_changed),
                                 treeview, NULL);
 
     /* proxy will live as long as the client does */
@@ -496,6 +503,41 @@ manager_client_registered(DBusGProxy *proxy,
     dbus_g_proxy_connect_signal(client_proxy, "StateChanged",
                                 G_CALLBACK(client_state_changed), treeview,
                                 NULL);
+}
+
+static void
+manager_client_registered(DBusGProxy *proxy,
+                          const gchar *object_path,
+                          gpointer user_data)
+{
+    GtkTreeView *treeview = user_data;
+    DBusGProxy *client_proxy;
+    GHashTable *properties = NULL;
+    const gchar *propnames[] = {
+        SmProgram, SmRestartStyleHint,SmProcessID, GsmPriority,
+        GsmDesktopFile, NULL
+    };
+    GError *error = NULL;
+
+    DBG("new client at %s", object_path);
+
+    client_proxy = dbus_g_proxy_new_for_name(dbus_conn,
+                                             "org.xfce.SessionManager",
+                                             object_path,
+                                             "org.xfce.Session.Client");
+
+    if(!xfsm_client_dbus_client_get_sm_properties(client_proxy, propnames,
+                                                  &properties, &error))
+    {
+        g_warning("Unable to get properties for client at %s: %s",
+                  object_path, error->message);
+        g_clear_error(&error);
+        g_object_unref(client_proxy);
+        return;
+    }
+
+    session_editor_add_client(treeview, client_proxy, object_path,
+                              properties);
 
     g_hash_table_destroy(properties);
 }
@@ -668,6 +710,7 @@ session_editor_populate_treeview(GtkTreeView *treeview)
     GtkTreeModel *combo_model;
     GPtrArray *clients = NULL;
     GtkListStore *ls;
+    guint64 generation;
     guint i;
     GError *error = NULL;
 
@@ -743,8 +786,10 @@ session_editor_populate_treeview(GtkTreeView *treeview)
                                 G_CALLBACK(manager_client_registered),
                                 treeview, NULL);
 
-    if(!xfsm_manager_dbus_client_list_clients(manager_dbus_proxy,
-                                              &clients, &error))
+    /* one round trip for the whole table */
+    if(!xfsm_manager_dbus_client_get_all_clients(manager_dbus_proxy,
+                                                 &generation, &clients,
+                                                 &error))
     {
         g_critical("Unable to query session manager for client list: %s",
                    error->message);
@@ -753,9 +798,22 @@ session_editor_populate_treeview(GtkTreeView *treeview)
     }
 
     for(i = 0; i < clients->len; ++i) {
-        gchar *client_op = g_ptr_array_index(clients, i);
-        manager_client_registered(manager_dbus_proxy, client_op, treeview);
-        g_free(client_op);
+        GHashTable *client = g_ptr_array_index(clients, i);
+        GValue *object_path = g_hash_table_lookup(client, "object-path");
+        GValue *properties = g_hash_table_lookup(client, "properties");
+
+        if(object_path && properties) {
+            DBusGProxy *client_proxy;
+
+            client_proxy = dbus_g_proxy_new_for_name(dbus_conn,
+                                                     "org.xfce.SessionManager",
+                                                     g_value_get_boxed(object_path),
+                                                     "org.xfce.Session.Client");
+            session_editor_add_client(treeview, client_proxy,
+                                      g_value_get_boxed(object_path),
+                                      g_value_get_boxed(properties));
+        }
+        g_hash_table_destroy(client);
     }
 
     g_ptr_array_free(clients, TRUE);
@@ -771,9 +829,12 @@ session_editor_init(GtkBuilder *builder)
     dbus_g_object_register_marshaller(g_cclosure_marshal_VOID__STRING,
                                       G_TYPE_NONE, G_TYPE_STRING,
                                       G_TYPE_INVALID);
-    dbus_g_object_register_marshaller(xfce4_session_marshal_VOID__STRING_BOXED,
-                                      G_TYPE_NONE, G_TYPE_STRING,
-                                      G_TYPE_VALUE, G_TYPE_INVALID);
+    dbus_g_object_register_marshaller(xfce4_session_marshal_VOID__BOXED_BOXED,
+                                      G_TYPE_NONE,
+                                      dbus_g_type_get_map("GHashTable",
+                                                          G_TYPE_STRING,
+                                                          G_TYPE_VALUE),
+                                      G_TYPE_STRV, G_TYPE_INVALID);
     dbus_g_object_register_marshaller(xfce4_session_marshal_VOID__UINT_UINT,
                                       G_TYPE_NONE, G_TYPE_UINT, G_TYPE_UINT,
                                       G_TYPE_INVALID);
@@ -22,6 +22,14 @@ extern void xfce4_session_marshal_VOID__STRING_BOXED (GClosure     *closure,
                                                       gpointer      invocation_hint,
                                                       gpointer      marshal_data);
 
+/* VOID:BOXED,BOXED (xfce4-session-marshal.list:3) */
+extern void xfce4_session_marshal_VOID__BOXED_BOXED (GClosure     *closure,
+                                                     GValue       *return_value,
+                                                     guint         n_param_values,
+                                                     const GValue *param_values,
+                                                     gpointer      invocation_hint,
+                                                     gpointer      marshal_data);
+
 G_END_DECLS
 
 #endif /* __xfce4_session_marshal_MARSHAL_H__ */
@@ -104,6 +104,86 @@ static
 inline
 #endif
 gboolean
+xfsm_manager_dbus_client_get_all_clients (DBusGProxy *proxy, guint64* OUT_generation, GPtrArray** OUT_clients, GError **error)
+
+{
+  return dbus_g_proxy_call (proxy, "GetAllClients", error, G_TYPE_INVALID, G_TYPE_UINT64, OUT_generation, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), OUT_clients, G_TYPE_INVALID);
+}
+
+typedef void (*xfsm_manager_dbus_client_get_all_clients_reply) (DBusGProxy *proxy, guint64 OUT_generation, GPtrArray *OUT_clients, GError *error, gpointer userdata);
+
+static void
+xfsm_manager_dbus_client_get_all_clients_async_callback (DBusGProxy *proxy, DBusGProxyCall *call, void *user_data)
+{
+  DBusGAsyncData *data = (DBusGAsyncData*) user_data;
+  GError *error = NULL;
+  guint64 OUT_generation;
+  GPtrArray* OUT_clients;
+  dbus_g_proxy_end_call (proxy, call, &error, G_TYPE_UINT64, &OUT_generation, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &OUT_clients, G_TYPE_INVALID);
+  (*(xfsm_manager_dbus_client_get_all_clients_reply)data->cb) (proxy, OUT_generation, OUT_clients, error, data->userdata);
+  return;
+}
+
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+DBusGProxyCall*
+xfsm_manager_dbus_client_get_all_clients_async (DBusGProxy *proxy, xfsm_manager_dbus_client_get_all_clients_reply callback, gpointer userdata)
+
+{
+  DBusGAsyncData *stuff;
+  stuff = g_slice_new (DBusGAsyncData);
+  stuff->cb = G_CALLBACK (callback);
+  stuff->userdata = userdata;
+  return dbus_g_proxy_begin_call (proxy, "GetAllClients", xfsm_manager_dbus_client_get_all_clients_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_INVALID);
+}
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+gboolean
+xfsm_manager_dbus_client_get_clients_since (DBusGProxy *proxy, const guint64 IN_generation, guint64* OUT_current_generation, gboolean* OUT_full, GPtrArray** OUT_clients, GPtrArray** OUT_removed, GError **error)
+
+{
+  return dbus_g_proxy_call (proxy, "GetClientsSince", error, G_TYPE_UINT64, IN_generation, G_TYPE_INVALID, G_TYPE_UINT64, OUT_current_generation, G_TYPE_BOOLEAN, OUT_full, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), OUT_clients, dbus_g_type_get_collection ("GPtrArray", DBUS_TYPE_G_OBJECT_PATH), OUT_removed, G_TYPE_INVALID);
+}
+
+typedef void (*xfsm_manager_dbus_client_get_clients_since_reply) (DBusGProxy *proxy, guint64 OUT_current_generation, gboolean OUT_full, GPtrArray *OUT_clients, GPtrArray *OUT_removed, GError *error, gpointer userdata);
+
+static void
+xfsm_manager_dbus_client_get_clients_since_async_callback (DBusGProxy *proxy, DBusGProxyCall *call, void *user_data)
+{
+  DBusGAsyncData *data = (DBusGAsyncData*) user_data;
+  GError *error = NULL;
+  guint64 OUT_current_generation;
+  gboolean OUT_full;
+  GPtrArray* OUT_clients;
+  GPtrArray* OUT_removed;
+  dbus_g_proxy_end_call (proxy, call, &error, G_TYPE_UINT64, &OUT_current_generation, G_TYPE_BOOLEAN, &OUT_full, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &OUT_clients, dbus_g_type_get_collection ("GPtrArray", DBUS_TYPE_G_OBJECT_PATH), &OUT_removed, G_TYPE_INVALID);
+  (*(xfsm_manager_dbus_client_get_clients_since_reply)data->cb) (proxy, OUT_current_generation, OUT_full, OUT_clients, OUT_removed, error, data->userdata);
+  return;
+}
+
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+DBusGProxyCall*
+xfsm_manager_dbus_client_get_clients_since_async (DBusGProxy *proxy, const guint64 IN_generation, xfsm_manager_dbus_client_get_clients_since_reply callback, gpointer userdata)
+
+{
+  DBusGAsyncData *stuff;
+  stuff = g_slice_new (DBusGAsyncData);
+  stuff->cb = G_CALLBACK (callback);
+  stuff->userdata = userdata;
+  return dbus_g_proxy_begin_call (proxy, "GetClientsSince", xfsm_manager_dbus_client_get_clients_since_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_UINT64, IN_generation, G_TYPE_INVALID);
+}
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+gboolean
 xfsm_manager_dbus_client_get_state (DBusGProxy *proxy, guint* OUT_state, GError **error)
 
 {
@@ -511,6 +591,159 @@ xfsm_manager_dbus_client_can_hibernate_async (DBusGProxy *proxy, xfsm_manager_db
   stuff->userdata = userdata;
   return dbus_g_proxy_begin_call (proxy, "CanHibernate", xfsm_manager_dbus_client_can_hibernate_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_INVALID);
 }
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+gboolean
+xfsm_manager_dbus_client_get_startup_trace (DBusGProxy *proxy, char ** OUT_trace, GError **error)
+
+{
+  return dbus_g_proxy_call (proxy, "GetStartupTrace", error, G_TYPE_INVALID, G_TYPE_STRING, OUT_trace, G_TYPE_INVALID);
+}
+
+typedef void (*xfsm_manager_dbus_client_get_startup_trace_reply) (DBusGProxy *proxy, char * OUT_trace, GError *error, gpointer userdata);
+
+static void
+xfsm_manager_dbus_client_get_startup_trace_async_callback (DBusGProxy *proxy, DBusGProxyCall *call, void *user_data)
+{
+  DBusGAsyncData *data = (DBusGAsyncData*) user_data;
+  GError *error = NULL;
+  char * OUT_trace;
+  dbus_g_proxy_end_call (proxy, call, &error, G_TYPE_STRING, &OUT_trace, G_TYPE_INVALID);
+  (*(xfsm_manager_dbus_client_get_startup_trace_reply)data->cb) (proxy, OUT_trace, error, data->userdata);
+  return;
+}
+
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+DBusGProxyCall*
+xfsm_manager_dbus_client_get_startup_trace_async (DBusGProxy *proxy, xfsm_manager_dbus_client_get_startup_trace_reply callback, gpointer userdata)
+
+{
+  DBusGAsyncData *stuff;
+  stuff = g_slice_new (DBusGAsyncData);
+  stuff->cb = G_CALLBACK (callback);
+  stuff->userdata = userdata;
+  return dbus_g_proxy_begin_call (proxy, "GetStartupTrace", xfsm_manager_dbus_client_get_startup_trace_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_INVALID);
+}
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+gboolean
+xfsm_manager_dbus_client_get_save_latencies (DBusGProxy *proxy, GArray** OUT_bounds, GPtrArray** OUT_latencies, GError **error)
+
+{
+  return dbus_g_proxy_call (proxy, "GetSaveLatencies", error, G_TYPE_INVALID, dbus_g_type_get_collection ("GArray", G_TYPE_UINT), OUT_bounds, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), OUT_latencies, G_TYPE_INVALID);
+}
+
+typedef void (*xfsm_manager_dbus_client_get_save_latencies_reply) (DBusGProxy *proxy, GArray *OUT_bounds, GPtrArray *OUT_latencies, GError *error, gpointer userdata);
+
+static void
+xfsm_manager_dbus_client_get_save_latencies_async_callback (DBusGProxy *proxy, DBusGProxyCall *call, void *user_data)
+{
+  DBusGAsyncData *data = (DBusGAsyncData*) user_data;
+  GError *error = NULL;
+  GArray* OUT_bounds;
+  GPtrArray* OUT_latencies;
+  dbus_g_proxy_end_call (proxy, call, &error, dbus_g_type_get_collection ("GArray", G_TYPE_UINT), &OUT_bounds, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &OUT_latencies, G_TYPE_INVALID);
+  (*(xfsm_manager_dbus_client_get_save_latencies_reply)data->cb) (proxy, OUT_bounds, OUT_latencies, error, data->userdata);
+  return;
+}
+
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+DBusGProxyCall*
+xfsm_manager_dbus_client_get_save_latencies_async (DBusGProxy *proxy, xfsm_manager_dbus_client_get_save_latencies_reply callback, gpointer userdata)
+
+{
+  DBusGAsyncData *stuff;
+  stuff = g_slice_new (DBusGAsyncData);
+  stuff->cb = G_CALLBACK (callback);
+  stuff->userdata = userdata;
+  return dbus_g_proxy_begin_call (proxy, "GetSaveLatencies", xfsm_manager_dbus_client_get_save_latencies_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_INVALID);
+}
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+gboolean
+xfsm_manager_dbus_client_get_client_timeouts (DBusGProxy *proxy, GPtrArray** OUT_timeouts, GError **error)
+
+{
+  return dbus_g_proxy_call (proxy, "GetClientTimeouts", error, G_TYPE_INVALID, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), OUT_timeouts, G_TYPE_INVALID);
+}
+
+typedef void (*xfsm_manager_dbus_client_get_client_timeouts_reply) (DBusGProxy *proxy, GPtrArray *OUT_timeouts, GError *error, gpointer userdata);
+
+static void
+xfsm_manager_dbus_client_get_client_timeouts_async_callback (DBusGProxy *proxy, DBusGProxyCall *call, void *user_data)
+{
+  DBusGAsyncData *data = (DBusGAsyncData*) user_data;
+  GError *error = NULL;
+  GPtrArray* OUT_timeouts;
+  dbus_g_proxy_end_call (proxy, call, &error, dbus_g_type_get_collection ("GPtrArray", dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE)), &OUT_timeouts, G_TYPE_INVALID);
+  (*(xfsm_manager_dbus_client_get_client_timeouts_reply)data->cb) (proxy, OUT_timeouts, error, data->userdata);
+  return;
+}
+
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+DBusGProxyCall*
+xfsm_manager_dbus_client_get_client_timeouts_async (DBusGProxy *proxy, xfsm_manager_dbus_client_get_client_timeouts_reply callback, gpointer userdata)
+
+{
+  DBusGAsyncData *stuff;
+  stuff = g_slice_new (DBusGAsyncData);
+  stuff->cb = G_CALLBACK (callback);
+  stuff->userdata = userdata;
+  return dbus_g_proxy_begin_call (proxy, "GetClientTimeouts", xfsm_manager_dbus_client_get_client_timeouts_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_INVALID);
+}
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+gboolean
+xfsm_manager_dbus_client_get_protocol_stats (DBusGProxy *proxy, GHashTable** OUT_stats, GError **error)
+
+{
+  return dbus_g_proxy_call (proxy, "GetProtocolStats", error, G_TYPE_INVALID, dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE), OUT_stats, G_TYPE_INVALID);
+}
+
+typedef void (*xfsm_manager_dbus_client_get_protocol_stats_reply) (DBusGProxy *proxy, GHashTable *OUT_stats, GError *error, gpointer userdata);
+
+static void
+xfsm_manager_dbus_client_get_protocol_stats_async_callback (DBusGProxy *proxy, DBusGProxyCall *call, void *user_data)
+{
+  DBusGAsyncData *data = (DBusGAsyncData*) user_data;
+  GError *error = NULL;
+  GHashTable* OUT_stats;
+  dbus_g_proxy_end_call (proxy, call, &error, dbus_g_type_get_map ("GHashTable", G_TYPE_STRING, G_TYPE_VALUE), &OUT_stats, G_TYPE_INVALID);
+  (*(xfsm_manager_dbus_client_get_protocol_stats_reply)data->cb) (proxy, OUT_stats, error, data->userdata);
+  return;
+}
+
+static
+#ifdef G_HAVE_INLINE
+inline
+#endif
+DBusGProxyCall*
+xfsm_manager_dbus_client_get_protocol_stats_async (DBusGProxy *proxy, xfsm_manager_dbus_client_get_protocol_stats_reply callback, gpointer userdata)
+
+{
+  DBusGAsyncData *stuff;
+  stuff = g_slice_new (DBusGAsyncData);
+  stuff->cb = G_CALLBACK (callback);
+  stuff->userdata = userdata;
+  return dbus_g_proxy_begin_call (proxy, "GetProtocolStats", xfsm_manager_dbus_client_get_protocol_stats_async_callback, stuff, _dbus_glib_async_data_free, G_TYPE_INVALID);
+}
 #endif /* defined DBUS_GLIB_CLIENT_WRAPPERS_org_xfce_Session_Manager */
 
 G_END_DECLS
@@ -0,0 +1,231 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Measures what answering GetProperties costs for a client with 10, 50
+ * and 500 properties: polling without changes, polling after one
+ * property changed, and copying every value the way the properties
+ * used to be extracted for each request. Samples are batches of
+ * --calls requests, allocations are counted through the glibc malloc.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#include <xfce4-session/xfsm-properties.c>
+
+#include <tests/xfsm-test.h>
+
+
+static gint n_calls = 1000;
+static gint n_iterations = 50;
+
+static GOptionEntry option_entries[] =
+{
+  { "calls", 'c', 0, G_OPTION_ARG_INT, &n_calls, "GetProperties requests per sample", "N" },
+  { "iterations", 'i', 0, G_OPTION_ARG_INT, &n_iterations, "Samples per measurement", "N" },
+  { NULL }
+};
+
+static const gint prop_counts[] = { 10, 50, 500 };
+
+static guint64 n_allocations = 0;
+
+
+#ifdef __GLIBC__
+extern void *__libc_malloc  (size_t size);
+extern void *__libc_calloc  (size_t n_members, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+
+/* counts every allocation of the process, GLib included */
+void *
+malloc (size_t size)
+{
+  n_allocations++;
+  return __libc_malloc (size);
+}
+
+
+void *
+calloc (size_t n_members,
+        size_t size)
+{
+  n_allocations++;
+  return __libc_calloc (n_members, size);
+}
+
+
+void *
+realloc (void  *ptr,
+         size_t size)
+{
+  n_allocations++;
+  return __libc_realloc (ptr, size);
+}
+#endif
+
+
+/* a client with the usual properties plus its own, @n_props in total */
+static XfsmProperties *
+create_client (gint n_props)
+{
+  XfsmProperties *properties;
+  gchar          *restart_command[] = { "/usr/bin/bench", "--sm-client-id", "2a9f5c3e1b", NULL };
+  gchar          *strv[] = { "one", "two", "three", "four", NULL };
+  gchar           name[64];
+  gchar           value[64];
+  gint            n;
+
+  properties = xfsm_properties_new ("2a9f5c3e1b", "local/bench");
+  xfsm_properties_set_string (properties, SmProgram, "/usr/bin/bench");
+  xfsm_properties_set_strv (properties, SmRestartCommand, restart_command);
+  xfsm_properties_set_strv (properties, SmCloneCommand, restart_command);
+  xfsm_properties_set_string (properties, SmCurrentDirectory, "/home/bench");
+  xfsm_properties_set_string (properties, SmUserID, "bench");
+  xfsm_properties_set_uchar (properties, SmRestartStyleHint, SmRestartIfRunning);
+
+  for (n = 6; n < n_props; ++n)
+    {
+      g_snprintf (name, sizeof (name), "_XFSM_Bench%d", n);
+      if (n % 5 == 0)
+        {
+          xfsm_properties_set_strv (properties, name, strv);
+        }
+      else
+        {
+          g_snprintf (value, sizeof (value), "value of property %d", n);
+          xfsm_properties_set_string (properties, name, value);
+        }
+    }
+
+  return properties;
+}
+
+
+/* what every GetProperties request used to allocate and free */
+static void
+copy_sm_props (SmProp **props,
+               gint     num_props)
+{
+  SmProp *copy;
+  gint    n, m;
+
+  for (n = 0; n < num_props; ++n)
+    {
+      copy = malloc (sizeof (SmProp));
+      copy->name = strdup (props[n]->name);
+      copy->type = strdup (props[n]->type);
+      copy->num_vals = props[n]->num_vals;
+      copy->vals = malloc (copy->num_vals * sizeof (SmPropValue));
+
+      for (m = 0; m < copy->num_vals; ++m)
+        {
+          copy->vals[m].length = props[n]->vals[m].length;
+          copy->vals[m].value = malloc (copy->vals[m].length + 1);
+          memcpy (copy->vals[m].value, props[n]->vals[m].value, copy->vals[m].length);
+        }
+
+      SmFreeProperty (copy);
+    }
+}
+
+
+typedef enum
+{
+  MODE_CACHED,
+  MODE_CHANGED,
+  MODE_COPIED
+} Mode;
+
+
+static void
+measure (const gchar *name,
+         gint         n_props,
+         Mode         mode)
+{
+  XfsmProperties *properties;
+  XfsmBench      *bench;
+  SmProp        **props;
+  guint64         allocations = 0;
+  guint64         start;
+  gchar          *label;
+  gint            num_props;
+  gint            i, n;
+
+  properties = create_client (n_props);
+  xfsm_properties_get_sm_props (properties, &num_props);
+  g_assert (num_props == n_props);
+
+  label = g_strdup_printf ("%s, %d props", name, n_props);
+  bench = xfsm_bench_new (label);
+
+  for (i = 0; i < n_iterations; ++i)
+    {
+      start = n_allocations;
+      xfsm_bench_start (bench);
+
+      for (n = 0; n < n_calls; ++n)
+        {
+          if (mode == MODE_CHANGED)
+            xfsm_properties_set_string (properties, SmCurrentDirectory, (n & 1) ? "/home/bench" : "/tmp");
+
+          props = xfsm_properties_get_sm_props (properties, &num_props);
+
+          if (mode == MODE_COPIED)
+            copy_sm_props (props, num_props);
+        }
+
+      xfsm_bench_stop (bench);
+      allocations += n_allocations - start;
+    }
+
+  xfsm_bench_report (bench);
+#ifdef __GLIBC__
+  g_print ("%-40s %13.1f allocations per request\n", label,
+           (gdouble) allocations / ((gdouble) n_iterations * n_calls));
+#endif
+
+  xfsm_bench_free (bench);
+  xfsm_properties_free (properties);
+  g_free (label);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  guint n;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  for (n = 0; n < G_N_ELEMENTS (prop_counts); ++n)
+    {
+      measure ("GetProperties", prop_counts[n], MODE_CACHED);
+      measure ("GetProperties after a change", prop_counts[n], MODE_CHANGED);
+      measure ("GetProperties copying values", prop_counts[n], MODE_COPIED);
+    }
+
+  return EXIT_SUCCESS;
+}
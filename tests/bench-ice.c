@@ -0,0 +1,221 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * ICE load generator. --clients synthetic clients register with a
+ * headless xfce4-session, then each round every client floods it with
+ * --messages SetProperties followed by a GetProperties, and the time
+ * until all replies are back gives the message throughput of the ICE
+ * layer. Global checkpoints, answered by every client with
+ * SaveYourselfDone, are timed as well.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <tests/xfsm-test.h>
+#include <tests/xfsm-test-session.h>
+
+
+#define REPLY_TIMEOUT  (30 * 1000)
+
+
+static gint n_clients = 50;
+static gint n_messages = 100;
+static gint n_rounds = 20;
+
+static GOptionEntry option_entries[] =
+{
+  { "clients", 'n', 0, G_OPTION_ARG_INT, &n_clients, "Number of clients", "N" },
+  { "messages", 'm', 0, G_OPTION_ARG_INT, &n_messages, "SetProperties per client and round", "N" },
+  { "rounds", 'r', 0, G_OPTION_ARG_INT, &n_rounds, "Number of rounds", "N" },
+  { NULL }
+};
+
+static XfsmBench *reply_bench;
+static gint64     round_start;
+static guint      n_replies;
+static guint      n_saved;
+
+
+static void
+get_properties_reply (SmcConn   conn,
+                      SmPointer client_data,
+                      gint      num_props,
+                      SmProp  **props)
+{
+  gint n;
+
+  xfsm_bench_add (reply_bench, g_get_monotonic_time () - round_start);
+  n_replies++;
+
+  for (n = 0; n < num_props; ++n)
+    SmFreeProperty (props[n]);
+  free (props);
+}
+
+
+static void
+save_complete (XfsmTestClient *client,
+               gpointer        user_data)
+{
+  n_saved++;
+}
+
+
+static const XfsmTestClientFuncs client_funcs =
+{
+  NULL,
+  NULL,
+  NULL,
+  save_complete,
+  NULL
+};
+
+
+static void
+flood (XfsmTestClient *client,
+       gint            round)
+{
+  SmPropValue value;
+  SmProp      prop;
+  SmProp     *props[1] = { &prop };
+  gchar       buffer[64];
+  gint        n;
+
+  prop.name = "_XFSM_Load";
+  prop.type = SmARRAY8;
+  prop.num_vals = 1;
+  prop.vals = &value;
+
+  /* a new value every time, so the manager has real work to do */
+  for (n = 0; n < n_messages; ++n)
+    {
+      g_snprintf (buffer, sizeof (buffer), "round %d, message %d", round, n);
+      value.value = buffer;
+      value.length = strlen (buffer);
+      SmcSetProperties (xfsm_test_client_get_conn (client), 1, props);
+    }
+
+  SmcGetProperties (xfsm_test_client_get_conn (client), get_properties_reply, NULL);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  XfsmTestSession  *session;
+  XfsmTestClient  **clients;
+  XfsmBench        *register_bench;
+  XfsmBench        *round_bench;
+  XfsmBench        *checkpoint_bench;
+  gint64            usec;
+  gint64            total_usec = 0;
+  gint              round, n;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  session = xfsm_test_session_start (NULL);
+  if (session == NULL)
+    {
+      g_print ("skipped, the session manager can't be run here\n");
+      return EXIT_SUCCESS;
+    }
+
+  register_bench = xfsm_bench_new ("register");
+  round_bench = xfsm_bench_new ("flood round, all replies");
+  reply_bench = xfsm_bench_new ("flood round, GetProperties reply");
+  checkpoint_bench = xfsm_bench_new ("global checkpoint");
+
+  clients = g_new0 (XfsmTestClient *, n_clients);
+  for (n = 0; n < n_clients; ++n)
+    {
+      xfsm_bench_start (register_bench);
+      clients[n] = xfsm_test_client_new (session, NULL, &client_funcs, NULL);
+      xfsm_bench_stop (register_bench);
+
+      if (clients[n] == NULL)
+        g_error ("Client %d failed to register", n);
+
+      xfsm_test_client_set_properties (clients[n], "/usr/bin/bench-ice");
+    }
+
+  for (round = 0; round < n_rounds; ++round)
+    {
+      n_replies = 0;
+      round_start = g_get_monotonic_time ();
+
+      for (n = 0; n < n_clients; ++n)
+        flood (clients[n], round);
+
+      if (!xfsm_test_session_wait_count (&n_replies, n_clients, REPLY_TIMEOUT))
+        g_error ("Only %u of %d clients got a reply", n_replies, n_clients);
+
+      usec = g_get_monotonic_time () - round_start;
+      xfsm_bench_add (round_bench, usec);
+      total_usec += usec;
+    }
+
+  for (round = 0; round < n_rounds; ++round)
+    {
+      n_saved = 0;
+      xfsm_bench_start (checkpoint_bench);
+
+      SmcRequestSaveYourself (xfsm_test_client_get_conn (clients[0]), SmSaveLocal,
+                              False, SmInteractStyleNone, False, True);
+
+      if (!xfsm_test_session_wait_count (&n_saved, n_clients, REPLY_TIMEOUT))
+        g_error ("Only %u of %d clients completed the checkpoint", n_saved, n_clients);
+
+      xfsm_bench_stop (checkpoint_bench);
+    }
+
+  xfsm_bench_report (register_bench);
+  xfsm_bench_report (round_bench);
+  xfsm_bench_report (reply_bench);
+  xfsm_bench_report (checkpoint_bench);
+
+  if (total_usec > 0)
+    {
+      g_print ("%-40s %10.0f messages per second\n", "throughput",
+               (gdouble) n_rounds * n_clients * (n_messages + 1) * G_USEC_PER_SEC / total_usec);
+    }
+
+  for (n = 0; n < n_clients; ++n)
+    xfsm_test_client_free (clients[n]);
+  g_free (clients);
+
+  xfsm_bench_free (register_bench);
+  xfsm_bench_free (round_bench);
+  xfsm_bench_free (reply_bench);
+  xfsm_bench_free (checkpoint_bench);
+
+  xfsm_test_session_free (session);
+
+  return EXIT_SUCCESS;
+}
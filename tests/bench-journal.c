@@ -0,0 +1,281 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Measures a checkpoint of a 200 client session against the number of
+ * clients that changed since the last one. A full store serialises
+ * every client and replaces the session file, a journal record holds
+ * the changed clients only and is appended to the journal. Both are
+ * synced to the disk, the way xfsm_manager_store_session() does it.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <glib/gstdio.h>
+
+#include <xfce4-session/xfsm-properties.c>
+#include <xfce4-session/xfsm-journal.c>
+
+#include <tests/xfsm-test.h>
+
+
+#define GROUP "Session: " DEFAULT_SESSION_NAME
+
+
+static gint n_clients = 200;
+static gint n_iterations = 50;
+
+static GOptionEntry option_entries[] =
+{
+  { "clients", 'c', 0, G_OPTION_ARG_INT, &n_clients, "Number of clients in the session", "N" },
+  { "iterations", 'i', 0, G_OPTION_ARG_INT, &n_iterations, "Stores per measurement", "N" },
+  { NULL }
+};
+
+static const gint dirty_counts[] = { 1, 5, 20, 50, 100, 200 };
+
+
+/* the benchmark does not load the journal */
+void
+xfsm_legacy_load_session (XfceRc *rc,
+                          GQueue *properties)
+{
+}
+
+
+static XfsmProperties **
+create_clients (void)
+{
+  XfsmProperties **clients;
+  gchar            client_id[64];
+  gchar            program[64];
+  gchar           *restart_command[5];
+  gint             n;
+
+  clients = g_new0 (XfsmProperties *, n_clients);
+
+  for (n = 0; n < n_clients; ++n)
+    {
+      g_snprintf (client_id, sizeof (client_id), "2a9f5c3e1b%08d00000000000000", n);
+      g_snprintf (program, sizeof (program), "/usr/bin/client-%d", n);
+
+      restart_command[0] = program;
+      restart_command[1] = "--sm-client-id";
+      restart_command[2] = client_id;
+      restart_command[3] = "--display=:0.0";
+      restart_command[4] = NULL;
+
+      clients[n] = xfsm_properties_new (client_id, "local/bench");
+      xfsm_properties_set_string (clients[n], SmProgram, program);
+      xfsm_properties_set_strv (clients[n], SmRestartCommand, restart_command);
+      xfsm_properties_set_strv (clients[n], SmCloneCommand, restart_command);
+      xfsm_properties_set_string (clients[n], SmCurrentDirectory, "/home/bench");
+      xfsm_properties_set_string (clients[n], SmUserID, "bench");
+      xfsm_properties_set_uchar (clients[n], SmRestartStyleHint, SmRestartIfRunning);
+    }
+
+  return clients;
+}
+
+
+/* replaces @filename the way the manager replaces the session file */
+static void
+write_file (const gchar *filename,
+            const gchar *contents,
+            gsize        length)
+{
+  gchar  *scratch_file;
+  gssize  written;
+  gsize   offset;
+  gint    fd;
+
+  scratch_file = g_strconcat (filename, ".XXXXXX", NULL);
+  fd = g_mkstemp (scratch_file);
+  if (fd < 0)
+    g_error ("Unable to create %s: %s", scratch_file, g_strerror (errno));
+
+  for (offset = 0; offset < length; offset += written)
+    {
+      written = write (fd, contents + offset, length - offset);
+      if (written < 0 && errno == EINTR)
+        written = 0;
+      else if (written < 0)
+        break;
+    }
+
+  if (offset != length || fsync (fd) != 0)
+    g_error ("Unable to write %s: %s", scratch_file, g_strerror (errno));
+  close (fd);
+
+  if (g_rename (scratch_file, filename) != 0)
+    g_error ("Unable to replace %s: %s", filename, g_strerror (errno));
+
+  g_free (scratch_file);
+}
+
+
+static void
+store_full (XfsmProperties **clients,
+            const gchar     *session_file)
+{
+  GKeyFile *file;
+  gchar    *contents;
+  gchar     prefix[64];
+  gsize     length;
+  gint      n;
+
+  file = g_key_file_new ();
+
+  for (n = 0; n < n_clients; ++n)
+    {
+      g_snprintf (prefix, sizeof (prefix), "Client%d_", n);
+      xfsm_properties_store (clients[n], file, GROUP, prefix);
+    }
+
+  g_key_file_set_integer (file, GROUP, "Count", n_clients);
+  g_key_file_set_string (file, GROUP, "JournalBase", "bench");
+  g_key_file_set_integer (file, GROUP, "LastAccess", time (NULL));
+
+  contents = g_key_file_to_data (file, &length, NULL);
+  write_file (session_file, contents, length);
+
+  g_key_file_free (file);
+  g_free (contents);
+}
+
+
+/* a record with the first @n_dirty clients changed */
+static void
+store_journal (XfsmProperties **clients,
+               gint             n_dirty,
+               guint            record,
+               const gchar     *session_file)
+{
+  GKeyFile *file;
+  gchar   **keys;
+  gchar    *joined;
+  gchar    *contents;
+  gsize     length;
+  gint      n;
+
+  file = g_key_file_new ();
+
+  g_key_file_set_string (file, GROUP, "Base", "bench");
+  g_key_file_set_integer (file, GROUP, "Count", n_clients);
+
+  keys = g_new0 (gchar *, n_clients + 1);
+  for (n = 0; n < n_clients; ++n)
+    {
+      if (n < n_dirty)
+        {
+          keys[n] = g_strdup_printf ("J%uC%d_", record, n);
+          xfsm_properties_store (clients[n], file, GROUP, keys[n]);
+        }
+      else
+        {
+          keys[n] = g_strdup_printf ("Client%d_", n);
+        }
+    }
+
+  joined = g_strjoinv (",", keys);
+  g_key_file_set_string (file, GROUP, "Clients", joined);
+  g_key_file_set_integer (file, GROUP, "LastAccess", time (NULL));
+
+  contents = g_key_file_to_data (file, &length, NULL);
+  if (!xfsm_journal_append (session_file, contents, length))
+    g_error ("Unable to append to the journal of %s", session_file);
+
+  g_key_file_free (file);
+  g_strfreev (keys);
+  g_free (joined);
+  g_free (contents);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  XfsmProperties **clients;
+  XfsmBench       *bench;
+  gchar           *session_file;
+  gchar           *dir;
+  gchar           *name;
+  guint            i;
+  gint             n;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  dir = xfsm_test_mkdtemp ();
+  session_file = g_build_filename (dir, "xfce4-session-bench:0", NULL);
+  clients = create_clients ();
+
+  name = g_strdup_printf ("full store, %d clients", n_clients);
+  bench = xfsm_bench_new (name);
+  for (n = 0; n < n_iterations; ++n)
+    {
+      xfsm_bench_start (bench);
+      store_full (clients, session_file);
+      xfsm_bench_stop (bench);
+    }
+  xfsm_bench_report (bench);
+  xfsm_bench_free (bench);
+  g_free (name);
+
+  for (i = 0; i < G_N_ELEMENTS (dirty_counts) && dirty_counts[i] <= n_clients; ++i)
+    {
+      name = g_strdup_printf ("journal record, %d dirty", dirty_counts[i]);
+      bench = xfsm_bench_new (name);
+      for (n = 0; n < n_iterations; ++n)
+        {
+          /* the manager compacts the journal after this many records */
+          if (n % XFSM_JOURNAL_MAX_RECORDS == 0)
+            xfsm_journal_remove (session_file);
+
+          xfsm_bench_start (bench);
+          store_journal (clients, dirty_counts[i], n % XFSM_JOURNAL_MAX_RECORDS + 1, session_file);
+          xfsm_bench_stop (bench);
+        }
+      xfsm_bench_report (bench);
+      xfsm_bench_free (bench);
+      g_free (name);
+    }
+
+  for (n = 0; n < n_clients; ++n)
+    xfsm_properties_free (clients[n]);
+  g_free (clients);
+
+  xfsm_test_rmtree (dir);
+  g_free (session_file);
+  g_free (dir);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,204 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Memory and lookup cost of the properties of --clients clients (1000
+ * by default), each with the usual properties plus a few of its own.
+ * The heap in use is reported after loading the clients and again after
+ * every property was replaced --rounds times, so leftovers of replaced
+ * values show up as growth. Lookups are timed for a slot property, an
+ * array property and a name no client has, over all clients.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <xfce4-session/xfsm-properties.c>
+
+#include <tests/xfsm-test.h>
+
+
+#define N_OWN_PROPS 8
+
+
+static gint n_clients = 1000;
+static gint n_rounds = 10;
+static gint n_iterations = 50;
+
+static GOptionEntry option_entries[] =
+{
+  { "clients", 'n', 0, G_OPTION_ARG_INT, &n_clients, "Number of clients", "N" },
+  { "rounds", 'r', 0, G_OPTION_ARG_INT, &n_rounds, "Times every property is replaced", "N" },
+  { "iterations", 'i', 0, G_OPTION_ARG_INT, &n_iterations, "Samples per lookup", "N" },
+  { NULL }
+};
+
+
+/* bytes of heap in use, 0 if the C library can't tell */
+static gsize
+heap_in_use (void)
+{
+#if defined (__GLIBC__) && __GLIBC_PREREQ (2, 33)
+  return mallinfo2 ().uordblks;
+#elif defined (__GLIBC__)
+  return (guint) mallinfo ().uordblks;
+#else
+  return 0;
+#endif
+}
+
+
+static void
+set_client (XfsmProperties *properties,
+            gint            client,
+            gint            round)
+{
+  gchar *restart_command[] = { "/usr/bin/bench", "--sm-client-id", NULL, NULL };
+  gchar *environment[] = { "LANG=C", "DISPLAY=:0", NULL, NULL };
+  gchar  name[64];
+  gchar  value[64];
+  gint   n;
+
+  restart_command[2] = properties->client_id;
+  environment[2] = value;
+
+  g_snprintf (value, sizeof (value), "BENCH_ROUND=%d", round);
+  xfsm_properties_set_string (properties, SmProgram, "/usr/bin/bench");
+  xfsm_properties_set_strv (properties, SmRestartCommand, restart_command);
+  xfsm_properties_set_strv (properties, SmCloneCommand, restart_command);
+  xfsm_properties_set_strv (properties, SmEnvironment, environment);
+  xfsm_properties_set_string (properties, SmUserID, "bench");
+  xfsm_properties_set_uchar (properties, SmRestartStyleHint, SmRestartIfRunning);
+  xfsm_properties_set_uchar (properties, GsmPriority, 50 + round % 2);
+
+  g_snprintf (value, sizeof (value), "/home/bench/%d/%d", client, round);
+  xfsm_properties_set_string (properties, SmCurrentDirectory, value);
+
+  for (n = 0; n < N_OWN_PROPS; ++n)
+    {
+      g_snprintf (name, sizeof (name), "_XFSM_Bench%d", n);
+      g_snprintf (value, sizeof (value), "value %d of client %d, round %d", n, client, round);
+      xfsm_properties_set_string (properties, name, value);
+    }
+}
+
+
+static void
+measure_lookup (XfsmProperties **clients,
+                const gchar     *label,
+                const gchar     *property_name)
+{
+  XfsmBench *bench;
+  gint       i, n;
+  gint       found = 0;
+
+  bench = xfsm_bench_new (label);
+
+  for (i = 0; i < n_iterations; ++i)
+    {
+      xfsm_bench_start (bench);
+      for (n = 0; n < n_clients; ++n)
+        if (xfsm_properties_get (clients[n], property_name) != NULL)
+          found++;
+      xfsm_bench_stop (bench);
+    }
+
+  xfsm_bench_report (bench);
+  xfsm_bench_free (bench);
+
+  g_assert (found == 0 || found == n_iterations * n_clients);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  XfsmProperties **clients;
+  gsize            heap_before;
+  gsize            heap_loaded;
+  gsize            heap_replaced;
+  gchar            client_id[64];
+  gchar           *label;
+  gint             n, round;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  clients = g_new (XfsmProperties *, n_clients);
+
+  /* intern the names before the heap is measured */
+  clients[0] = xfsm_properties_new ("2a9f5c3e1b", "local/bench");
+  set_client (clients[0], 0, 0);
+  xfsm_properties_free (clients[0]);
+
+  heap_before = heap_in_use ();
+
+  for (n = 0; n < n_clients; ++n)
+    {
+      g_snprintf (client_id, sizeof (client_id), "2a9f5c3e1b%06d", n);
+      clients[n] = xfsm_properties_new (client_id, "local/bench");
+      set_client (clients[n], n, 0);
+    }
+
+  heap_loaded = heap_in_use ();
+
+  for (round = 1; round <= n_rounds; ++round)
+    for (n = 0; n < n_clients; ++n)
+      set_client (clients[n], n, round);
+
+  heap_replaced = heap_in_use ();
+
+  if (heap_before > 0)
+    {
+      g_print ("%-40s %10" G_GSIZE_FORMAT " bytes per client\n", "heap after loading",
+               (heap_loaded - heap_before) / n_clients);
+      g_print ("%-40s %10" G_GSIZE_FORMAT " bytes per client\n", "heap after replacing",
+               (heap_replaced - heap_before) / n_clients);
+    }
+
+  label = g_strdup_printf ("lookup slot, %d clients", n_clients);
+  measure_lookup (clients, label, SmProgram);
+  g_free (label);
+
+  label = g_strdup_printf ("lookup array, %d clients", n_clients);
+  measure_lookup (clients, label, SmRestartCommand);
+  g_free (label);
+
+  label = g_strdup_printf ("lookup own property, %d clients", n_clients);
+  measure_lookup (clients, label, "_XFSM_Bench5");
+  g_free (label);
+
+  label = g_strdup_printf ("lookup unknown name, %d clients", n_clients);
+  measure_lookup (clients, label, "_XFSM_NotSetAnywhere");
+  g_free (label);
+
+  for (n = 0; n < n_clients; ++n)
+    xfsm_properties_free (clients[n]);
+  g_free (clients);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,274 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Client scaling benchmark for the lookups of the register and
+ * disconnect paths. For 250, 500, 1000 and 2000 clients (up to
+ * --max-clients) a headless xfce4-session restores a saved session
+ * of that many clients in a few priority groups and gets:
+ *
+ *   a registration storm, every client registers with its previous
+ *     id while the manager is still starting the session, each
+ *     registration waits for the reply
+ *   half of the clients dropping their connection without a word,
+ *     which the manager maps back to the client by its IceConn,
+ *     followed by a checkpoint of the others
+ *   a logout, until every client got SmDie and the manager exited
+ *
+ * With constant time lookups the cost per client stays flat as the
+ * number of clients grows.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#include <X11/ICE/ICElib.h>
+
+#include <tests/xfsm-test.h>
+#include <tests/xfsm-test-session.h>
+
+
+#define PHASE_TIMEOUT  (120 * 1000)
+
+/* the saved clients are spread over this many priority groups */
+#define N_PRIORITIES   4
+
+
+static gint max_clients = 2000;
+
+static GOptionEntry option_entries[] =
+{
+  { "max-clients", 'n', 0, G_OPTION_ARG_INT, &max_clients, "Largest number of clients", "N" },
+  { NULL }
+};
+
+static guint n_saved;
+static guint n_died;
+
+
+static void
+client_die (XfsmTestClient *client,
+            gpointer        user_data)
+{
+  n_died++;
+}
+
+
+static void
+client_save_complete (XfsmTestClient *client,
+                      gpointer        user_data)
+{
+  n_saved++;
+}
+
+
+static const XfsmTestClientFuncs client_funcs =
+{
+  NULL,
+  NULL,
+  client_die,
+  client_save_complete,
+  NULL
+};
+
+
+/* every client is a connection in both processes */
+static void
+raise_fd_limit (void)
+{
+#ifdef HAVE_SYS_RESOURCE_H
+  struct rlimit rlim;
+
+  if (getrlimit (RLIMIT_NOFILE, &rlim) == 0 && rlim.rlim_cur < rlim.rlim_max)
+    {
+      rlim.rlim_cur = rlim.rlim_max;
+      setrlimit (RLIMIT_NOFILE, &rlim);
+    }
+#endif
+}
+
+
+static void
+report (const gchar *phase,
+        gint         n_clients,
+        gint64       usec)
+{
+  gchar *label;
+
+  label = g_strdup_printf ("%s, %d clients", phase, n_clients);
+  g_print ("%-40s %10" G_GINT64_FORMAT " usec  %8.1f usec per client\n",
+           label, usec, (gdouble) usec / n_clients);
+  g_free (label);
+}
+
+
+/* the entries of the saved session, the restart commands keep
+ * running until the manager's process group is taken down */
+static gchar *
+saved_session (gint n_clients)
+{
+  GString *contents;
+  gint     n;
+
+  contents = g_string_new (NULL);
+
+  for (n = 1; n <= n_clients; ++n)
+    {
+      g_string_append_printf (contents,
+                              "Client%d_ClientId=1bench-scaling-%d\n"
+                              "Client%d_Hostname=local/localhost\n"
+                              "Client%d_Program=bench-scaling\n"
+                              "Client%d_Priority=%d\n"
+                              "Client%d_RestartCommand=sleep,600\n",
+                              n, n, n, n, n, 10 + (n % N_PRIORITIES) * 10, n);
+    }
+
+  return g_string_free (contents, FALSE);
+}
+
+
+static void
+measure (gint n_clients)
+{
+  XfsmTestSession  *session;
+  XfsmTestClient  **clients;
+  XfsmBench        *register_bench;
+  XfsmTestClient   *probe;
+  gint64            start;
+  gchar            *contents;
+  gchar            *label;
+  gchar            *previous_id;
+  gint              n;
+
+  /* clients are asked to save on logout */
+  contents = saved_session (n_clients);
+  session = xfsm_test_session_restore ("[/general]\nAutoSave=true\n",
+                                       contents, n_clients);
+  g_free (contents);
+  if (session == NULL)
+    {
+      g_print ("skipped, the session manager can't be run here\n");
+      exit (EXIT_SUCCESS);
+    }
+
+  label = g_strdup_printf ("register, %d clients", n_clients);
+  register_bench = xfsm_bench_new (label);
+  g_free (label);
+
+  clients = g_new0 (XfsmTestClient *, n_clients);
+
+  start = g_get_monotonic_time ();
+  for (n = 0; n < n_clients; ++n)
+    {
+      previous_id = g_strdup_printf ("1bench-scaling-%d", n + 1);
+
+      xfsm_bench_start (register_bench);
+      clients[n] = xfsm_test_client_new (session, previous_id, &client_funcs, NULL);
+      xfsm_bench_stop (register_bench);
+
+      if (clients[n] == NULL)
+        g_error ("Client %d of %d failed to register", n, n_clients);
+      if (g_strcmp0 (xfsm_test_client_get_id (clients[n]), previous_id) != 0)
+        g_error ("Client %d of %d was not restored as %s", n, n_clients, previous_id);
+
+      g_free (previous_id);
+
+      xfsm_test_client_set_properties (clients[n], "/usr/bin/bench-scaling");
+    }
+  report ("registration storm", n_clients, g_get_monotonic_time () - start);
+
+  /* the odd clients drop their connection, the checkpoint can only
+   * complete once the manager dropped them as well */
+  start = g_get_monotonic_time ();
+  for (n = 1; n < n_clients; n += 2)
+    {
+      shutdown (IceConnectionNumber (SmcGetIceConnection (xfsm_test_client_get_conn (clients[n]))),
+                SHUT_RDWR);
+      xfsm_test_client_free (clients[n]);
+      clients[n] = NULL;
+    }
+
+  n_saved = 0;
+  probe = clients[0];
+  SmcRequestSaveYourself (xfsm_test_client_get_conn (probe), SmSaveLocal,
+                          False, SmInteractStyleNone, False, True);
+  if (!xfsm_test_session_wait_count (&n_saved, (n_clients + 1) / 2, PHASE_TIMEOUT))
+    g_error ("Only %u of %d clients completed the checkpoint", n_saved, (n_clients + 1) / 2);
+  report ("disconnect half, checkpoint", n_clients, g_get_monotonic_time () - start);
+
+  start = g_get_monotonic_time ();
+  n_died = 0;
+  SmcRequestSaveYourself (xfsm_test_client_get_conn (probe), SmSaveBoth,
+                          True, SmInteractStyleNone, False, True);
+  if (!xfsm_test_session_wait_count (&n_died, (n_clients + 1) / 2, PHASE_TIMEOUT))
+    g_error ("Only %u of %d clients were told to die", n_died, (n_clients + 1) / 2);
+  report ("logout to SmDie", n_clients, g_get_monotonic_time () - start);
+
+  if (!xfsm_test_session_wait (session, PHASE_TIMEOUT))
+    g_error ("The session manager did not exit after the logout");
+  report ("logout to manager exit", n_clients, g_get_monotonic_time () - start);
+
+  xfsm_bench_report (register_bench);
+  xfsm_bench_free (register_bench);
+
+  for (n = 0; n < n_clients; ++n)
+    if (clients[n] != NULL)
+      xfsm_test_client_free (clients[n]);
+  g_free (clients);
+
+  xfsm_test_session_free (session);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  gint n_clients;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  raise_fd_limit ();
+
+  /* closing a dropped connection writes to a dead socket */
+  signal (SIGPIPE, SIG_IGN);
+
+  for (n_clients = 250; n_clients <= max_clients; n_clients *= 2)
+    measure (n_clients);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,257 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Loads a session of 200 clients the way xfsm_manager_load_session()
+ * does, once by parsing the session file and once from the compiled
+ * session cache. Both are timed warm, with the files in the page cache,
+ * and cold, with the pages of both files dropped before every load.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <xfce4-session/xfsm-properties.c>
+#include <xfce4-session/xfsm-session-cache.c>
+
+#include <tests/xfsm-test.h>
+
+
+static gint n_clients = 200;
+static gint n_iterations = 50;
+
+static GOptionEntry option_entries[] =
+{
+  { "clients", 'c', 0, G_OPTION_ARG_INT, &n_clients, "Number of clients in the session", "N" },
+  { "iterations", 'i', 0, G_OPTION_ARG_INT, &n_iterations, "Loads per measurement", "N" },
+  { NULL }
+};
+
+
+/* the session cache has no legacy clients to add */
+void
+xfsm_legacy_add_restart_app (gint     screen_num,
+                             gchar  **command,
+                             gchar  **wm_class,
+                             GQueue  *properties)
+{
+}
+
+
+static void
+write_session (const gchar *session_file)
+{
+  XfsmProperties *properties;
+  GKeyFile       *file;
+  GError         *error = NULL;
+  const gchar    *group = "Session: " DEFAULT_SESSION_NAME;
+  gchar          *contents;
+  gsize           length;
+  gchar           prefix[64];
+  gchar           client_id[64];
+  gchar           program[64];
+  gchar          *restart_command[5];
+  gint            n;
+
+  file = g_key_file_new ();
+  g_key_file_set_integer (file, group, "Count", n_clients);
+  g_key_file_set_integer (file, group, "LastAccess", 0);
+
+  for (n = 0; n < n_clients; ++n)
+    {
+      g_snprintf (client_id, sizeof (client_id), "2a9f5c3e1b%08d00000000000000", n);
+      g_snprintf (program, sizeof (program), "/usr/bin/client-%d", n);
+
+      restart_command[0] = program;
+      restart_command[1] = "--sm-client-id";
+      restart_command[2] = client_id;
+      restart_command[3] = "--display=:0.0";
+      restart_command[4] = NULL;
+
+      properties = xfsm_properties_new (client_id, "local/bench");
+      xfsm_properties_set_string (properties, SmProgram, program);
+      xfsm_properties_set_strv (properties, SmRestartCommand, restart_command);
+      xfsm_properties_set_strv (properties, SmCloneCommand, restart_command);
+      xfsm_properties_set_string (properties, SmCurrentDirectory, "/home/bench");
+      xfsm_properties_set_string (properties, SmUserID, "bench");
+      xfsm_properties_set_uchar (properties, SmRestartStyleHint, SmRestartIfRunning);
+      xfsm_properties_set_uchar (properties, GsmPriority, 50 + n % 3 * 5);
+
+      g_snprintf (prefix, sizeof (prefix), "Client%d_", n);
+      xfsm_properties_store (properties, file, group, prefix);
+      xfsm_properties_free (properties);
+    }
+
+  contents = g_key_file_to_data (file, &length, NULL);
+  if (!g_file_set_contents (session_file, contents, length, &error))
+    g_error ("Unable to write %s: %s", session_file, error->message);
+
+  g_key_file_free (file);
+  g_free (contents);
+}
+
+
+/* evicts @path from the page cache, it has to be clean */
+static void
+drop_pages (const gchar *path)
+{
+#ifdef POSIX_FADV_DONTNEED
+  gint fd;
+
+  fd = open (path, O_RDONLY);
+  if (fd < 0)
+    return;
+
+  fdatasync (fd);
+  posix_fadvise (fd, 0, 0, POSIX_FADV_DONTNEED);
+  close (fd);
+#endif
+}
+
+
+static guint
+load_rc (const gchar *session_file)
+{
+  XfsmProperties *properties;
+  GQueue          queue = G_QUEUE_INIT;
+  XfceRc         *rc;
+  gchar           prefix[64];
+  gint            count;
+  guint           n;
+
+  rc = xfce_rc_simple_open (session_file, TRUE);
+  xfce_rc_set_group (rc, "Session: " DEFAULT_SESSION_NAME);
+
+  for (count = xfce_rc_read_int_entry (rc, "Count", 0); count-- > 0; )
+    {
+      g_snprintf (prefix, sizeof (prefix), "Client%d_", count);
+      properties = xfsm_properties_load (rc, prefix);
+      if (properties != NULL)
+        g_queue_push_tail (&queue, properties);
+    }
+
+  xfce_rc_close (rc);
+
+  n = g_queue_get_length (&queue);
+  g_queue_foreach (&queue, (GFunc) xfsm_properties_free, NULL);
+  g_queue_clear (&queue);
+
+  return n;
+}
+
+
+static guint
+load_cache (const gchar *session_file)
+{
+  XfsmSessionCache *cache;
+  GQueue            queue = G_QUEUE_INIT;
+  guint             n;
+
+  cache = xfsm_session_cache_open (session_file);
+  if (cache == NULL)
+    g_error ("The session cache of %s was not used", session_file);
+
+  xfsm_session_cache_load (cache, DEFAULT_SESSION_NAME, &queue);
+  xfsm_session_cache_close (cache);
+
+  n = g_queue_get_length (&queue);
+  g_queue_foreach (&queue, (GFunc) xfsm_properties_free, NULL);
+  g_queue_clear (&queue);
+
+  return n;
+}
+
+
+static void
+measure (const gchar *name,
+         guint      (*load) (const gchar *session_file),
+         const gchar *session_file,
+         gboolean     cold)
+{
+  XfsmBench *bench;
+  gchar     *cache_file;
+  gint       n;
+
+  bench = xfsm_bench_new (name);
+  cache_file = xfsm_session_cache_filename (session_file);
+
+  for (n = 0; n < n_iterations; ++n)
+    {
+      if (cold)
+        {
+          drop_pages (session_file);
+          drop_pages (cache_file);
+        }
+
+      xfsm_bench_start (bench);
+      if (load (session_file) != (guint) n_clients)
+        g_error ("%s did not load %d clients", name, n_clients);
+      xfsm_bench_stop (bench);
+    }
+
+  xfsm_bench_report (bench);
+  xfsm_bench_free (bench);
+  g_free (cache_file);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  XfsmBench *bench;
+  gchar     *session_file;
+  gchar     *dir;
+  gint       n;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  dir = xfsm_test_mkdtemp ();
+  session_file = g_build_filename (dir, "xfce4-session-bench:0", NULL);
+  write_session (session_file);
+
+  bench = xfsm_bench_new ("compile cache");
+  for (n = 0; n < n_iterations; ++n)
+    {
+      xfsm_bench_start (bench);
+      xfsm_session_cache_compile (session_file);
+      xfsm_bench_stop (bench);
+    }
+  xfsm_bench_report (bench);
+  xfsm_bench_free (bench);
+
+  measure ("load session file, warm", load_rc, session_file, FALSE);
+  measure ("load session cache, warm", load_cache, session_file, FALSE);
+  measure ("load session file, cold", load_rc, session_file, TRUE);
+  measure ("load session cache, cold", load_cache, session_file, TRUE);
+
+  xfsm_test_rmtree (dir);
+  g_free (session_file);
+  g_free (dir);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Compares xfsm_spawn_async() with g_spawn_async() and with the
+ * synchronous spawn the agents used to get. Reports the time a single
+ * spawn takes and how long the main loop stalls while a burst of
+ * children is started from it, the way the autostart items are started
+ * during login. A 1 ms timeout runs next to the burst and the longest
+ * gap between two of its dispatches is the stall. --ballast grows the
+ * process first, fork() gets slower with the size of the parent.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#include <xfce4-session/xfsm-spawn.c>
+
+#include <tests/xfsm-test.h>
+
+
+static gint n_children = 50;
+static gint n_iterations = 20;
+static gint ballast_mb = 0;
+
+static GOptionEntry option_entries[] =
+{
+  { "children", 'c', 0, G_OPTION_ARG_INT, &n_children, "Children spawned per burst", "N" },
+  { "iterations", 'i', 0, G_OPTION_ARG_INT, &n_iterations, "Bursts per measurement", "N" },
+  { "ballast", 'b', 0, G_OPTION_ARG_INT, &ballast_mb, "Megabytes of memory to touch first", "MB" },
+  { NULL }
+};
+
+typedef gboolean (*SpawnFunc) (gchar **argv, GError **error);
+
+typedef struct
+{
+  SpawnFunc  spawn;
+  XfsmBench *bench;
+  GMainLoop *loop;
+  gint64     last_tick;
+  gint64     stall;
+} StallData;
+
+
+static gboolean
+spawn_xfsm (gchar  **argv,
+            GError **error)
+{
+  return xfsm_spawn_async (NULL, argv, NULL, G_SPAWN_SEARCH_PATH, NULL, NULL, error);
+}
+
+
+static gboolean
+spawn_glib (gchar  **argv,
+            GError **error)
+{
+  return g_spawn_async (NULL, argv, NULL, G_SPAWN_SEARCH_PATH, NULL, NULL, NULL, error);
+}
+
+
+/* waits for the child, like the agents were started before */
+static gboolean
+spawn_sync (gchar  **argv,
+            GError **error)
+{
+  return g_spawn_sync (NULL, argv, NULL, G_SPAWN_SEARCH_PATH, NULL, NULL,
+                       NULL, NULL, NULL, error);
+}
+
+
+static void
+spawn_one (SpawnFunc spawn)
+{
+  gchar  *argv[] = { "true", NULL };
+  GError *error = NULL;
+
+  if (!spawn (argv, &error))
+    g_error ("Failed to spawn true: %s", error->message);
+}
+
+
+/* lets the child watches reap what was spawned */
+static void
+reap_children (void)
+{
+  gint64 end_time = g_get_monotonic_time () + 50 * G_TIME_SPAN_MILLISECOND;
+
+  while (g_get_monotonic_time () < end_time)
+    g_main_context_iteration (NULL, FALSE);
+}
+
+
+static void
+measure_latency (const gchar *name,
+                 SpawnFunc    spawn)
+{
+  XfsmBench *bench;
+  gint       i, n;
+
+  bench = xfsm_bench_new (name);
+
+  for (i = 0; i < n_iterations; ++i)
+    {
+      for (n = 0; n < n_children; ++n)
+        {
+          xfsm_bench_start (bench);
+          spawn_one (spawn);
+          xfsm_bench_stop (bench);
+        }
+
+      reap_children ();
+    }
+
+  xfsm_bench_report (bench);
+  xfsm_bench_free (bench);
+}
+
+
+static gboolean
+stall_tick (gpointer user_data)
+{
+  StallData *data = user_data;
+  gint64     now = g_get_monotonic_time ();
+
+  data->stall = MAX (data->stall, now - data->last_tick);
+  data->last_tick = now;
+
+  return TRUE;
+}
+
+
+static gboolean
+stall_burst (gpointer user_data)
+{
+  StallData *data = user_data;
+  gint       n;
+
+  for (n = 0; n < n_children; ++n)
+    spawn_one (data->spawn);
+
+  return FALSE;
+}
+
+
+static gboolean
+stall_done (gpointer user_data)
+{
+  StallData *data = user_data;
+
+  g_main_loop_quit (data->loop);
+
+  return FALSE;
+}
+
+
+static void
+measure_stall (const gchar *name,
+               SpawnFunc    spawn)
+{
+  StallData data;
+  guint     tick_id;
+  gint      i;
+
+  data.spawn = spawn;
+  data.bench = xfsm_bench_new (name);
+  data.loop = g_main_loop_new (NULL, FALSE);
+
+  for (i = 0; i < n_iterations; ++i)
+    {
+      data.last_tick = g_get_monotonic_time ();
+      data.stall = 0;
+
+      tick_id = g_timeout_add (1, stall_tick, &data);
+      g_idle_add (stall_burst, &data);
+      g_timeout_add (200, stall_done, &data);
+
+      g_main_loop_run (data.loop);
+      g_source_remove (tick_id);
+
+      xfsm_bench_add (data.bench, data.stall);
+      reap_children ();
+    }
+
+  xfsm_bench_report (data.bench);
+  xfsm_bench_free (data.bench);
+  g_main_loop_unref (data.loop);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  gchar *ballast = NULL;
+  gchar *name;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  if (ballast_mb > 0)
+    {
+      /* touched, so the pages are really mapped */
+      ballast = g_malloc (ballast_mb * 1024 * 1024);
+      memset (ballast, 1, ballast_mb * 1024 * 1024);
+    }
+
+  measure_latency ("xfsm_spawn_async", spawn_xfsm);
+  measure_latency ("g_spawn_async", spawn_glib);
+  measure_latency ("g_spawn_sync", spawn_sync);
+
+  name = g_strdup_printf ("main loop stall, %d x xfsm_spawn_async", n_children);
+  measure_stall (name, spawn_xfsm);
+  g_free (name);
+
+  name = g_strdup_printf ("main loop stall, %d x g_spawn_async", n_children);
+  measure_stall (name, spawn_glib);
+  g_free (name);
+
+  name = g_strdup_printf ("main loop stall, %d x g_spawn_sync", n_children);
+  measure_stall (name, spawn_sync);
+  g_free (name);
+
+  g_free (ballast);
+
+  return EXIT_SUCCESS;
+}
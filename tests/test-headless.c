@@ -0,0 +1,191 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Runs xfce4-session --headless like the protocol benchmarks do and
+ * checks it is usable there: a client registers, its properties come
+ * back with GetProperties, and a logout requested by the client saves,
+ * sends SmDie and ends the manager together with its private bus.
+ * Exits with 77 (skipped) if the manager can't be run, e.g. without
+ * dbus-daemon.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <tests/xfsm-test.h>
+#include <tests/xfsm-test-session.h>
+
+
+#define TIMEOUT      (10 * 1000)
+#define EXIT_SKIPPED 77
+
+
+static XfsmTestSession *session;
+static XfsmTestClient  *client;
+
+static gchar *program;
+static guint  n_replies;
+static guint  n_saves;
+static guint  n_dies;
+
+
+static void
+client_save_yourself (XfsmTestClient *client,
+                      gint            save_type,
+                      gboolean        shutdown,
+                      gint            interact_style,
+                      gboolean        fast,
+                      gpointer        user_data)
+{
+  g_assert (shutdown);
+
+  n_saves++;
+  SmcSaveYourselfDone (xfsm_test_client_get_conn (client), True);
+}
+
+
+static void
+client_die (XfsmTestClient *client,
+            gpointer        user_data)
+{
+  n_dies++;
+}
+
+
+static const XfsmTestClientFuncs client_funcs =
+{
+  client_save_yourself,
+  NULL,
+  client_die,
+  NULL,
+  NULL
+};
+
+
+static void
+get_properties_reply (SmcConn   conn,
+                      SmPointer client_data,
+                      gint      num_props,
+                      SmProp  **props)
+{
+  gint n;
+
+  for (n = 0; n < num_props; ++n)
+    {
+      if (strcmp (props[n]->name, SmProgram) == 0 && props[n]->num_vals == 1)
+        program = g_strndup (props[n]->vals[0].value, props[n]->vals[0].length);
+      SmFreeProperty (props[n]);
+    }
+  free (props);
+
+  n_replies++;
+}
+
+
+static void
+test_register (void)
+{
+  client = xfsm_test_client_new (session, NULL, &client_funcs, NULL);
+
+  g_assert (client != NULL);
+  g_assert (xfsm_test_client_get_id (client) != NULL);
+  g_assert (xfsm_test_client_is_connected (client));
+}
+
+
+static void
+test_properties (void)
+{
+  xfsm_test_client_set_properties (client, "/usr/bin/test-headless");
+  SmcGetProperties (xfsm_test_client_get_conn (client), get_properties_reply, NULL);
+
+  g_assert (xfsm_test_session_wait_count (&n_replies, 1, TIMEOUT));
+  g_assert_cmpstr (program, ==, "/usr/bin/test-headless");
+}
+
+
+static void
+test_logout (void)
+{
+  GPid pid = xfsm_test_session_get_pid (session);
+
+  SmcRequestSaveYourself (xfsm_test_client_get_conn (client),
+                          SmSaveBoth, True, SmInteractStyleNone, False, True);
+
+  g_assert (xfsm_test_session_wait_count (&n_dies, 1, TIMEOUT));
+  g_assert_cmpuint (n_saves, ==, 1);
+
+  g_assert (xfsm_test_session_wait (session, TIMEOUT));
+  g_assert (WIFEXITED (xfsm_test_session_get_status (session)));
+  g_assert_cmpint (WEXITSTATUS (xfsm_test_session_get_status (session)), ==, 0);
+
+  /* the private bus went away with the manager */
+  g_assert (kill (-pid, 0) < 0 && errno == ESRCH);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  gint result;
+
+  g_test_init (&argc, &argv, NULL);
+  xfsm_test_init (&argc, &argv, NULL);
+
+  /* the client is asked to save on logout */
+  session = xfsm_test_session_start ("[/general]\nAutoSave=true\n");
+  if (session == NULL)
+    return EXIT_SKIPPED;
+
+  g_test_add_func ("/headless/register", test_register);
+  g_test_add_func ("/headless/properties", test_properties);
+  g_test_add_func ("/headless/logout", test_logout);
+
+  result = g_test_run ();
+
+  if (client != NULL)
+    xfsm_test_client_free (client);
+  xfsm_test_session_free (session);
+  g_free (program);
+
+  return result;
+}
@@ -0,0 +1,263 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Connects to the lazy ssh-agent socket and checks that the agent is
+ * spawned on the first connection, that this connection is relayed to
+ * the agent and that later connections reach the agent directly. The
+ * agent is this program run with --fake-agent, it prints its
+ * environment like ssh-agent -s does and echoes what it reads.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#include <xfce4-session/xfsm-lazy-agent.c>
+
+#include <tests/xfsm-test.h>
+
+
+#define TIMEOUT (5 * G_USEC_PER_SEC)
+
+
+static const gchar *self = NULL;
+static GPid         agent_pid = 0;
+static gboolean     agent_ready = FALSE;
+
+
+/* the agent, listens on @path and echoes every connection */
+static gint
+fake_agent (const gchar *path)
+{
+  struct sockaddr_un addr;
+  gchar              buffer[256];
+  gssize             n;
+  gint               client_fd;
+  gint               fd;
+
+  fd = xfsm_lazy_agent_socket_new (path, &addr);
+  if (fd < 0
+      || bind (fd, (struct sockaddr *) &addr, sizeof (addr)) < 0
+      || listen (fd, SOMAXCONN) < 0)
+    return EXIT_FAILURE;
+
+  /* closing stdout tells xfce4-session the environment is complete */
+  g_print ("SSH_AUTH_SOCK=%s; export SSH_AUTH_SOCK;\n"
+           "SSH_AGENT_PID=%d; export SSH_AGENT_PID;\n",
+           path, (gint) getpid ());
+  fflush (stdout);
+  close (STDOUT_FILENO);
+
+  for (;;)
+    {
+      client_fd = accept (fd, NULL, NULL);
+      if (client_fd < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          break;
+        }
+
+      while ((n = read (client_fd, buffer, sizeof (buffer))) > 0)
+        if (write (client_fd, buffer, n) != n)
+          break;
+
+      close (client_fd);
+    }
+
+  return EXIT_SUCCESS;
+}
+
+
+static gboolean
+agent_ready_idle (gpointer user_data)
+{
+  xfsm_lazy_agent_ready (TRUE);
+  agent_ready = TRUE;
+
+  return FALSE;
+}
+
+
+/* what xfsm_startup_lazy_agent_start() does with ssh-agent */
+static void
+start_agent (const gchar *agent_socket,
+             gpointer     user_data)
+{
+  GString *output;
+  GError  *error = NULL;
+  gchar    buffer[256];
+  gchar   *expected;
+  gchar   *argv[] = { (gchar *) self, "--fake-agent", (gchar *) agent_socket, NULL };
+  gssize   n;
+  gint     fd;
+
+  g_assert (agent_pid == 0);
+
+  g_spawn_async_with_pipes (NULL, argv, NULL, G_SPAWN_DO_NOT_REAP_CHILD, NULL, NULL,
+                            &agent_pid, NULL, &fd, NULL, &error);
+  g_assert_no_error (error);
+
+  output = g_string_new (NULL);
+  while ((n = read (fd, buffer, sizeof (buffer))) != 0)
+    {
+      if (n < 0 && errno == EINTR)
+        continue;
+      g_assert (n > 0);
+      g_string_append_len (output, buffer, n);
+    }
+  close (fd);
+
+  expected = g_strdup_printf ("SSH_AGENT_PID=%d;", (gint) agent_pid);
+  g_assert (strstr (output->str, expected) != NULL);
+  g_free (expected);
+  g_string_free (output, TRUE);
+
+  /* the agent reports from the main loop in xfce4-session */
+  g_idle_add (agent_ready_idle, NULL);
+}
+
+
+static gint
+connect_agent (const gchar *path)
+{
+  struct sockaddr_un addr;
+  gint               fd;
+
+  fd = xfsm_lazy_agent_socket_new (path, &addr);
+  g_assert_cmpint (fd, >=, 0);
+  g_assert_cmpint (connect (fd, (struct sockaddr *) &addr, sizeof (addr)), ==, 0);
+  fcntl (fd, F_SETFL, fcntl (fd, F_GETFL) | O_NONBLOCK);
+
+  return fd;
+}
+
+
+/* sends @message and reads it back, while the main loop relays */
+static void
+echo (gint         fd,
+      const gchar *message)
+{
+  GString *reply;
+  gchar    buffer[256];
+  gssize   n;
+  gsize    length = strlen (message);
+  gint64   end_time;
+
+  g_assert_cmpint (write (fd, message, length), ==, length);
+
+  reply = g_string_new (NULL);
+  end_time = g_get_monotonic_time () + TIMEOUT;
+
+  while (reply->len < length && g_get_monotonic_time () < end_time)
+    {
+      n = read (fd, buffer, sizeof (buffer));
+      if (n > 0)
+        g_string_append_len (reply, buffer, n);
+      else if (n == 0 || (errno != EAGAIN && errno != EINTR))
+        break;
+      else if (!g_main_context_iteration (NULL, FALSE))
+        g_usleep (1000);
+    }
+
+  g_assert_cmpstr (reply->str, ==, message);
+  g_string_free (reply, TRUE);
+}
+
+
+static void
+test_lazy_agent (void)
+{
+  gchar  *path;
+  gint64  end_time;
+  gint    status;
+  gint    fd;
+
+  g_unsetenv ("SSH_AUTH_SOCK");
+
+  g_assert (xfsm_lazy_agent_init (start_agent, NULL));
+  path = g_strdup (xfsm_lazy_agent_get_socket ());
+  g_assert_cmpstr (g_getenv ("SSH_AUTH_SOCK"), ==, path);
+
+  /* nothing is started before someone connects */
+  g_main_context_iteration (NULL, FALSE);
+  g_assert (agent_pid == 0);
+
+  /* the first connection waits in the backlog until the agent runs */
+  fd = connect_agent (path);
+  end_time = g_get_monotonic_time () + TIMEOUT;
+  while (!agent_ready && g_get_monotonic_time () < end_time)
+    if (!g_main_context_iteration (NULL, FALSE))
+      g_usleep (1000);
+
+  g_assert (agent_ready);
+  g_assert (agent_pid > 0);
+  g_assert_cmpint (kill (agent_pid, 0), ==, 0);
+  g_assert_cmpstr (g_getenv ("SSH_AUTH_SOCK"), ==, path);
+
+  /* relayed by xfce4-session */
+  echo (fd, "relayed");
+  close (fd);
+
+  /* the agent owns the socket path now */
+  fd = connect_agent (path);
+  echo (fd, "direct");
+  close (fd);
+
+  kill (agent_pid, SIGTERM);
+  waitpid (agent_pid, &status, 0);
+
+  xfsm_lazy_agent_shutdown ();
+  g_assert (xfsm_lazy_agent_get_socket () == NULL);
+  g_assert (!g_file_test (path, G_FILE_TEST_EXISTS));
+
+  g_free (path);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  if (argc == 3 && strcmp (argv[1], "--fake-agent") == 0)
+    return fake_agent (argv[2]);
+
+  self = argv[0];
+
+  /* the relay writes to sockets the test closes */
+  signal (SIGPIPE, SIG_IGN);
+
+  g_test_init (&argc, &argv, NULL);
+  xfsm_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/lazy-agent/relay", test_lazy_agent);
+
+  return g_test_run ();
+}
@@ -0,0 +1,386 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * The legacy session management state kept per window: how the replies
+ * to WM_SAVE_YOURSELF move a window between the states, and which
+ * windows end up in the session file. And how the saved applications
+ * are handed to the startup scheduler: their priority among the other
+ * clients and how their windows are recognized again.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#include <xfce4-session/xfsm-properties.c>
+#include <xfce4-session/xfsm-settings.c>
+#include <xfce4-session/xfsm-legacy.c>
+
+#include <tests/xfsm-test.h>
+
+
+#define EXIT_SKIPPED 77
+
+
+#ifdef LEGACY_SESSION_MANAGEMENT
+
+static SmWindow *
+add_window (Window       wid,
+            gint         type,
+            const gchar *res_name,
+            const gchar *res_class)
+{
+  SmWindow *sm_window;
+
+  sm_window = sm_window_new (wid, 0, type, g_strdup (res_name), g_strdup (res_class));
+  window_list = g_list_append (window_list, sm_window);
+
+  return sm_window;
+}
+
+
+static void
+test_legacy_replied (void)
+{
+  SmSave    save = { NULL, };
+  SmWindow *asked1, *asked2, *asked3, *command;
+
+  asked1 = add_window (0x100, SM_WMSAVEYOURSELF, NULL, NULL);
+  asked2 = add_window (0x200, SM_WMSAVEYOURSELF, NULL, NULL);
+  asked3 = add_window (0x300, SM_WMSAVEYOURSELF, NULL, NULL);
+  command = add_window (0x400, SM_WMCOMMAND, NULL, NULL);
+  save.awaiting_replies = 3;
+
+  /* a window that saved is asked for its WM_COMMAND */
+  sm_save_window_replied (&save, 0x100, FALSE);
+  g_assert_cmpint (asked1->type, ==, SM_WMCOMMAND);
+  g_assert_cmpint (save.awaiting_replies, ==, 2);
+
+  /* the PropertyNotify after the UnmapNotify is no second reply */
+  sm_save_window_replied (&save, 0x100, FALSE);
+  g_assert_cmpint (asked1->type, ==, SM_WMCOMMAND);
+  g_assert_cmpint (save.awaiting_replies, ==, 2);
+
+  /* a destroyed window is dropped, and stays dropped */
+  sm_save_window_replied (&save, 0x200, TRUE);
+  g_assert_cmpint (asked2->type, ==, SM_ERROR);
+  g_assert_cmpint (save.awaiting_replies, ==, 1);
+  sm_save_window_replied (&save, 0x200, FALSE);
+  g_assert_cmpint (asked2->type, ==, SM_ERROR);
+  g_assert_cmpint (save.awaiting_replies, ==, 1);
+
+  /* windows that were never asked don't count */
+  sm_save_window_replied (&save, 0x400, FALSE);
+  g_assert_cmpint (command->type, ==, SM_WMCOMMAND);
+  sm_save_window_replied (&save, 0x999, FALSE);
+  g_assert_cmpint (save.awaiting_replies, ==, 1);
+
+  sm_save_window_replied (&save, 0x300, FALSE);
+  g_assert_cmpint (asked3->type, ==, SM_WMCOMMAND);
+  g_assert_cmpint (save.awaiting_replies, ==, 0);
+
+  sm_window_list_clear ();
+}
+
+
+static void
+test_legacy_store (void)
+{
+  GKeyFile *file;
+  SmWindow *sm_window;
+  gchar    *value;
+
+  sm_window = add_window (0x100, SM_WMCOMMAND, "xterm", "XTerm");
+  sm_window->wm_command = g_strsplit ("xterm -geometry 80x24", " ", -1);
+  sm_window->wm_client_machine = g_strdup ("localhost");
+  sm_window->screen_num = 1;
+
+  /* failed to save */
+  sm_window = add_window (0x200, SM_ERROR, "xclock", "XClock");
+  sm_window->wm_command = g_strsplit ("xclock", " ", -1);
+  sm_window->wm_client_machine = g_strdup ("localhost");
+
+  /* known to restore badly */
+  sm_window = add_window (0x300, SM_WMCOMMAND, "xmms", "Xmms");
+  sm_window->wm_command = g_strsplit ("xmms", " ", -1);
+  sm_window->wm_client_machine = g_strdup ("localhost");
+
+  /* saved, but WM_COMMAND went away */
+  sm_window = add_window (0x400, SM_WMCOMMAND, "xeyes", "XEyes");
+  sm_window->wm_client_machine = g_strdup ("localhost");
+
+  sm_window = add_window (0x500, SM_WMCOMMAND, NULL, NULL);
+  sm_window->wm_command = g_strsplit ("xload", " ", -1);
+  sm_window->wm_client_machine = g_strdup ("otherhost");
+
+  file = g_key_file_new ();
+  xfsm_legacy_store_session (file, "Session: Test");
+
+  g_assert_cmpint (g_key_file_get_integer (file, "Session: Test", "LegacyCount", NULL), ==, 2);
+
+  value = g_key_file_get_string (file, "Session: Test", "Legacy0_Command", NULL);
+  g_assert_cmpstr (value, ==, "xterm,-geometry,80x24");
+  g_free (value);
+  g_assert_cmpint (g_key_file_get_integer (file, "Session: Test", "Legacy0_Screen", NULL), ==, 1);
+  value = g_key_file_get_string (file, "Session: Test", "Legacy0_Class", NULL);
+  g_assert_cmpstr (value, ==, "xterm,XTerm");
+  g_free (value);
+
+  value = g_key_file_get_string (file, "Session: Test", "Legacy1_Command", NULL);
+  g_assert_cmpstr (value, ==, "xload");
+  g_free (value);
+  value = g_key_file_get_string (file, "Session: Test", "Legacy1_ClientMachine", NULL);
+  g_assert_cmpstr (value, ==, "otherhost");
+  g_free (value);
+  g_assert (!g_key_file_has_key (file, "Session: Test", "Legacy1_Class", NULL));
+
+  g_key_file_free (file);
+  sm_window_list_clear ();
+}
+
+
+static XfsmProperties *
+restart_app (const gchar *command,
+             const gchar *wm_class)
+{
+  XfsmProperties *app;
+  GQueue          queue = G_QUEUE_INIT;
+
+  /* nothing is restarted in headless mode */
+  xfsm_headless = FALSE;
+  xfsm_legacy_add_restart_app (0, g_strsplit (command, " ", -1),
+                               wm_class != NULL ? g_strsplit (wm_class, ",", -1) : NULL,
+                               &queue);
+  xfsm_headless = TRUE;
+
+  g_assert_cmpuint (g_queue_get_length (&queue), ==, 1);
+  app = g_queue_pop_head (&queue);
+  g_assert (app->legacy);
+
+  return app;
+}
+
+
+static XfsmProperties *
+client (const gchar *client_id,
+        guchar       priority)
+{
+  XfsmProperties *properties;
+
+  properties = xfsm_properties_new (client_id, NULL);
+  xfsm_properties_set_uchar (properties, GsmPriority, priority);
+
+  return properties;
+}
+
+
+static void
+test_legacy_priority (void)
+{
+  XfsmProperties *app;
+  GQueue          queue = G_QUEUE_INIT;
+  gchar         **restart_command;
+
+  app = restart_app ("xterm -e top", NULL);
+  g_assert_cmpuint (xfsm_properties_get_uchar (app, GsmPriority, 0), ==, LEGACY_PRIORITY);
+  g_assert_cmpstr (xfsm_properties_get_string (app, SmProgram), ==, "xterm");
+  restart_command = xfsm_properties_get_strv (app, SmRestartCommand);
+  g_assert_cmpuint (g_strv_length (restart_command), ==, 3);
+  g_assert_cmpstr (restart_command[2], ==, "top");
+  g_assert (xfsm_properties_check (app));
+
+  /* started with the clients of the same priority, after the window
+   * manager and the panel, before the applications */
+  g_queue_push_tail (&queue, client ("terminal", 50));
+  g_queue_push_tail (&queue, client ("browser", 60));
+  g_queue_push_tail (&queue, app);
+  g_queue_push_tail (&queue, client ("panel", 25));
+  g_queue_push_tail (&queue, client ("wm", 15));
+  g_queue_sort (&queue, (GCompareDataFunc) xfsm_properties_compare, NULL);
+
+  g_assert_cmpstr (XFSM_PROPERTIES (g_queue_peek_nth (&queue, 0))->client_id, ==, "wm");
+  g_assert_cmpstr (XFSM_PROPERTIES (g_queue_peek_nth (&queue, 1))->client_id, ==, "panel");
+  g_assert_cmpint (xfsm_properties_compare (g_queue_peek_nth (&queue, 2), app), ==, 0);
+  g_assert_cmpint (xfsm_properties_compare (g_queue_peek_nth (&queue, 3), app), ==, 0);
+  g_assert_cmpstr (XFSM_PROPERTIES (g_queue_peek_nth (&queue, 4))->client_id, ==, "browser");
+
+  g_queue_foreach (&queue, (GFunc) xfsm_properties_free, NULL);
+  g_queue_clear (&queue);
+
+  xfsm_settings_set_string (xfsm_settings_get (), "/general/LegacyPriority", "10");
+  app = restart_app ("xclock", NULL);
+  g_assert_cmpuint (xfsm_properties_get_uchar (app, GsmPriority, 0), ==, 10);
+  xfsm_properties_free (app);
+
+  xfsm_settings_set_string (xfsm_settings_get (), "/general/LegacyPriority", "400");
+  app = restart_app ("xclock", NULL);
+  g_assert_cmpuint (xfsm_properties_get_uchar (app, GsmPriority, 0), ==, 255);
+  xfsm_properties_free (app);
+
+  xfsm_settings_set_string (xfsm_settings_get (), "/general/LegacyPriority", "-5");
+  app = restart_app ("xclock", NULL);
+  g_assert_cmpuint (xfsm_properties_get_uchar (app, GsmPriority, 0), ==, 0);
+  xfsm_properties_free (app);
+
+  xfsm_settings_set_string (xfsm_settings_get (), "/general/LegacyPriority",
+                            G_STRINGIFY (LEGACY_PRIORITY));
+}
+
+
+static void
+test_legacy_load (void)
+{
+  XfsmProperties *app;
+  GKeyFile       *file;
+  XfceRc         *rc;
+  GQueue          queue = G_QUEUE_INIT;
+  gchar          *directory;
+  gchar          *filename;
+  gchar          *data;
+  gchar         **strv;
+  gsize           length;
+  SmWindow       *sm_window;
+
+  sm_window = add_window (0x100, SM_WMCOMMAND, "xterm", "XTerm");
+  sm_window->wm_command = g_strsplit ("xterm -geometry 80x24", " ", -1);
+  sm_window->wm_client_machine = g_strdup ("localhost");
+
+  sm_window = add_window (0x200, SM_WMCOMMAND, NULL, NULL);
+  sm_window->wm_command = g_strsplit ("xload", " ", -1);
+  sm_window->wm_client_machine = g_strdup ("localhost");
+
+  file = g_key_file_new ();
+  xfsm_legacy_store_session (file, "Session: Test");
+  sm_window_list_clear ();
+
+  directory = xfsm_test_mkdtemp ();
+  filename = g_build_filename (directory, "session.rc", NULL);
+  data = g_key_file_to_data (file, &length, NULL);
+  g_assert (g_file_set_contents (filename, data, length, NULL));
+  g_key_file_free (file);
+  g_free (data);
+
+  rc = xfce_rc_simple_open (filename, TRUE);
+  g_assert (rc != NULL);
+  xfce_rc_set_group (rc, "Session: Test");
+
+  /* nothing is restarted in headless mode */
+  xfsm_legacy_load_session (rc, &queue);
+  g_assert_cmpuint (g_queue_get_length (&queue), ==, 0);
+
+  xfsm_headless = FALSE;
+  xfsm_legacy_load_session (rc, &queue);
+  xfsm_headless = TRUE;
+  xfce_rc_close (rc);
+
+  g_assert_cmpuint (g_queue_get_length (&queue), ==, 2);
+
+  app = g_queue_pop_head (&queue);
+  strv = xfsm_properties_get_strv (app, LegacyCommand);
+  g_assert_cmpuint (g_strv_length (strv), ==, 3);
+  g_assert_cmpstr (strv[2], ==, "80x24");
+  strv = xfsm_properties_get_strv (app, LegacyClass);
+  g_assert_cmpstr (strv[0], ==, "xterm");
+  g_assert_cmpstr (strv[1], ==, "XTerm");
+  xfsm_properties_free (app);
+
+  app = g_queue_pop_head (&queue);
+  g_assert_cmpstr (xfsm_properties_get_string (app, SmProgram), ==, "xload");
+  g_assert (xfsm_properties_get_strv (app, LegacyClass) == NULL);
+  xfsm_properties_free (app);
+
+  xfsm_test_rmtree (directory);
+  g_free (directory);
+  g_free (filename);
+}
+
+
+static void
+test_legacy_matches (void)
+{
+  XfsmWnckWindowInfo  info = { NULL, };
+  XfsmProperties     *app;
+  XfsmProperties     *properties;
+  gchar              *top[] = { "xterm", "-e", "top", NULL };
+  gchar              *xterm[] = { "xterm", NULL };
+
+  app = restart_app ("xterm -e top", "xterm,XTerm");
+  app->pid = 4242;
+
+  /* nothing known about the window */
+  g_assert (!xfsm_legacy_window_matches (app, &info));
+
+  info.pid = 4242;
+  g_assert (xfsm_legacy_window_matches (app, &info));
+  info.pid = 4243;
+  g_assert (!xfsm_legacy_window_matches (app, &info));
+
+  /* the whole command has to match */
+  info.command = xterm;
+  g_assert (!xfsm_legacy_window_matches (app, &info));
+  info.command = top;
+  g_assert (xfsm_legacy_window_matches (app, &info));
+  info.command = NULL;
+
+  info.res_name = "xterm";
+  info.res_class = "UXTerm";
+  g_assert (!xfsm_legacy_window_matches (app, &info));
+  info.res_class = "XTerm";
+  g_assert (xfsm_legacy_window_matches (app, &info));
+
+  /* only legacy applications are waited for */
+  properties = xfsm_properties_new ("client", NULL);
+  xfsm_properties_set_strv (properties, LegacyCommand, top);
+  properties->pid = 4243;
+  info.pid = 4243;
+  g_assert (!xfsm_legacy_window_matches (properties, &info));
+
+  xfsm_properties_free (properties);
+  xfsm_properties_free (app);
+}
+
+#endif
+
+
+int
+main (int argc, char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+  xfsm_test_init (&argc, &argv, NULL);
+
+#ifdef LEGACY_SESSION_MANAGEMENT
+  xfsm_settings_use_keyfile (NULL, NULL);
+
+  g_test_add_func ("/legacy/replied", test_legacy_replied);
+  g_test_add_func ("/legacy/store", test_legacy_store);
+  g_test_add_func ("/legacy/priority", test_legacy_priority);
+  g_test_add_func ("/legacy/load", test_legacy_load);
+  g_test_add_func ("/legacy/matches", test_legacy_matches);
+
+  return g_test_run ();
+#else
+  return EXIT_SKIPPED;
+#endif
+}
@@ -0,0 +1,197 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * The mice splash engine draws its frames from the sprite atlas in
+ * engines/mice/slide.h, composited ahead of time by generate --atlas.
+ * These tests check the compositing against an exact blend, and that
+ * the checked in atlas still matches slide.png and its background
+ * color, since it is only regenerated by hand (make update-slide).
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+/* the generator is a program of its own */
+#define main generate_main
+#include <engines/mice/generate.c>
+#undef main
+
+#include <engines/mice/slide.h>
+
+#include <tests/xfsm-test.h>
+
+
+#define SLIDE_PNG XFSM_TEST_SRCDIR "/engines/mice/slide.png"
+
+
+/* source over a background, rounded to the nearest value */
+static guint
+blend (guint src,
+       guint bg,
+       guint alpha)
+{
+  return (2 * (src * alpha + bg * (255 - alpha)) + 255) / 510;
+}
+
+
+static void
+test_mice_atlas_blend (void)
+{
+  static const gchar *colors[] = { "#DAE7FE", "#000000", "#FFFFFF", "#7F8081" };
+  GdkPixbuf          *slide;
+  GdkPixbuf          *atlas;
+  GdkColor            color;
+  const guchar       *d;
+  guchar             *s;
+  guint               bg[3];
+  guint               n;
+  gint                x, y, c;
+
+  /* every source value against every alpha */
+  slide = gdk_pixbuf_new (GDK_COLORSPACE_RGB, TRUE, 8, 256, 256);
+  for (y = 0; y < 256; y++)
+    {
+      s = gdk_pixbuf_get_pixels (slide) + y * gdk_pixbuf_get_rowstride (slide);
+      for (x = 0; x < 256; x++, s += 4)
+        {
+          s[0] = y;
+          s[1] = 255 - y;
+          s[2] = y ^ x;
+          s[3] = x;
+        }
+    }
+
+  for (n = 0; n < G_N_ELEMENTS (colors); n++)
+    {
+      g_assert (gdk_color_parse (colors[n], &color));
+      bg[0] = color.red >> 8;
+      bg[1] = color.green >> 8;
+      bg[2] = color.blue >> 8;
+
+      atlas = create_atlas (slide, &color);
+      g_assert (atlas != NULL);
+      g_assert (!gdk_pixbuf_get_has_alpha (atlas));
+      g_assert_cmpint (gdk_pixbuf_get_width (atlas), ==, 256);
+      g_assert_cmpint (gdk_pixbuf_get_height (atlas), ==, 256);
+
+      for (y = 0; y < 256; y++)
+        {
+          s = gdk_pixbuf_get_pixels (slide) + y * gdk_pixbuf_get_rowstride (slide);
+          d = gdk_pixbuf_get_pixels (atlas) + y * gdk_pixbuf_get_rowstride (atlas);
+          for (x = 0; x < 256; x++, s += 4, d += 3)
+            for (c = 0; c < 3; c++)
+              g_assert_cmpuint (d[c], ==, blend (s[c], bg[c], s[3]));
+        }
+
+      g_object_unref (G_OBJECT (atlas));
+    }
+
+  g_object_unref (G_OBJECT (slide));
+}
+
+
+static void
+test_mice_slide_steps (void)
+{
+  GdkPixbuf    *base;
+  GdkPixbuf    *result;
+  const guchar *p;
+  guchar       *b;
+  gint          i;
+
+  base = gdk_pixbuf_new (GDK_COLORSPACE_RGB, TRUE, 8, 2, 1);
+  b = gdk_pixbuf_get_pixels (base);
+  b[0] = 10; b[1] = 20; b[2] = 30; b[3] = 255;
+  b[4] = 40; b[5] = 50; b[6] = 60; b[7] = 100;
+
+  /* each step fades in a bit more, the last one is never opaque */
+  result = create_slide (base, 4);
+  g_assert_cmpint (gdk_pixbuf_get_width (result), ==, 8);
+  g_assert_cmpint (gdk_pixbuf_get_height (result), ==, 1);
+
+  p = gdk_pixbuf_get_pixels (result);
+  for (i = 0; i < 4; i++, p += 8)
+    {
+      g_assert (memcmp (p, b, 3) == 0);
+      g_assert_cmpuint (p[3], ==, (i + 1) * 255 / 5);
+      g_assert (memcmp (p + 4, b + 4, 3) == 0);
+      g_assert_cmpuint (p[7], ==, (i + 1) * 100 / 5);
+    }
+
+  g_object_unref (G_OBJECT (result));
+  g_object_unref (G_OBJECT (base));
+}
+
+
+static void
+test_mice_slide_current (void)
+{
+  GdkPixbuf    *png;
+  GdkPixbuf    *atlas;
+  GdkPixbuf    *shipped;
+  GdkColor      color;
+  GError       *error = NULL;
+  const guchar *a, *b;
+  gint          width;
+  gint          y;
+
+  png = gdk_pixbuf_new_from_file (SLIDE_PNG, &error);
+  g_assert_no_error (error);
+  g_assert (gdk_pixbuf_get_has_alpha (png));
+  g_assert_cmpint (gdk_pixbuf_get_width (png), ==, SLIDE_WIDTH * SLIDE_STEPS);
+  g_assert_cmpint (gdk_pixbuf_get_height (png), ==, SLIDE_HEIGHT);
+
+  shipped = gdk_pixbuf_new_from_inline (-1, slide, FALSE, &error);
+  g_assert_no_error (error);
+  g_assert (!gdk_pixbuf_get_has_alpha (shipped));
+  g_assert_cmpint (gdk_pixbuf_get_width (shipped), ==, SLIDE_WIDTH * SLIDE_STEPS);
+  g_assert_cmpint (gdk_pixbuf_get_height (shipped), ==, SLIDE_HEIGHT);
+
+  /* slide.h is stale if this fails, run make update-slide */
+  g_assert (gdk_color_parse (SLIDE_COLOR, &color));
+  atlas = create_atlas (png, &color);
+  width = gdk_pixbuf_get_width (atlas) * 3;
+  for (y = 0; y < SLIDE_HEIGHT; y++)
+    {
+      a = gdk_pixbuf_get_pixels (atlas) + y * gdk_pixbuf_get_rowstride (atlas);
+      b = gdk_pixbuf_get_pixels (shipped) + y * gdk_pixbuf_get_rowstride (shipped);
+      g_assert (memcmp (a, b, width) == 0);
+    }
+
+  g_object_unref (G_OBJECT (atlas));
+  g_object_unref (G_OBJECT (shipped));
+  g_object_unref (G_OBJECT (png));
+}
+
+
+int
+main (int argc, char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+  xfsm_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/mice/atlas-blend", test_mice_atlas_blend);
+  g_test_add_func ("/mice/slide-steps", test_mice_slide_steps);
+  g_test_add_func ("/mice/slide-current", test_mice_slide_current);
+
+  return g_test_run ();
+}
@@ -0,0 +1,322 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * The logout screenshot is scaled down to the thumbnail size. These
+ * tests check the thumbnail geometry and the box filter that reads
+ * the MIT-SHM image, against a plain per pixel average.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <xfce4-session/xfsm-settings.c>
+#include <xfce4-session/xfsm-logout-dialog.c>
+
+#include <tests/xfsm-test.h>
+
+
+/* the dialog is never shown */
+XfsmShutdown *
+xfsm_shutdown_get (void)
+{
+  return NULL;
+}
+
+
+gboolean
+xfsm_shutdown_can_restart (XfsmShutdown  *shutdown,
+                           gboolean      *can_restart,
+                           GError       **error)
+{
+  return FALSE;
+}
+
+
+gboolean
+xfsm_shutdown_can_shutdown (XfsmShutdown  *shutdown,
+                            gboolean      *can_shutdown,
+                            GError       **error)
+{
+  return FALSE;
+}
+
+
+gboolean
+xfsm_shutdown_can_suspend (XfsmShutdown  *shutdown,
+                           gboolean      *can_suspend,
+                           gboolean      *auth_suspend,
+                           GError       **error)
+{
+  return FALSE;
+}
+
+
+gboolean
+xfsm_shutdown_can_hibernate (XfsmShutdown  *shutdown,
+                             gboolean      *can_hibernate,
+                             gboolean      *auth_hibernate,
+                             GError       **error)
+{
+  return FALSE;
+}
+
+
+gboolean
+xfsm_shutdown_can_save_session (XfsmShutdown *shutdown)
+{
+  return FALSE;
+}
+
+
+XfsmFadeout *
+xfsm_fadeout_new (GdkDisplay *display)
+{
+  return NULL;
+}
+
+
+void
+xfsm_fadeout_destroy (XfsmFadeout *fadeout)
+{
+}
+
+
+/* nothing is written */
+gchar *
+xfsm_thumbs_get_filename (const gchar *display_name)
+{
+  return NULL;
+}
+
+
+gboolean
+xfsm_thumbs_store (const gchar  *filename,
+                   const gchar  *session_name,
+                   GdkPixbuf    *thumb,
+                   GError      **error)
+{
+  return TRUE;
+}
+
+
+static void
+test_screenshot_thumb_size (void)
+{
+  gint width, height;
+
+  xfsm_logout_dialog_thumb_size (1920, 1080, &width, &height);
+  g_assert_cmpint (width, ==, SHOTSIZE);
+  g_assert_cmpint (height, ==, 36);
+
+  xfsm_logout_dialog_thumb_size (1080, 1920, &width, &height);
+  g_assert_cmpint (width, ==, 36);
+  g_assert_cmpint (height, ==, SHOTSIZE);
+
+  xfsm_logout_dialog_thumb_size (1280, 1024, &width, &height);
+  g_assert_cmpint (width, ==, SHOTSIZE);
+  g_assert_cmpint (height, ==, 51);
+
+  xfsm_logout_dialog_thumb_size (SHOTSIZE, SHOTSIZE, &width, &height);
+  g_assert_cmpint (width, ==, SHOTSIZE);
+  g_assert_cmpint (height, ==, SHOTSIZE);
+
+  /* never collapses to nothing */
+  xfsm_logout_dialog_thumb_size (10000, 10, &width, &height);
+  g_assert_cmpint (width, ==, SHOTSIZE);
+  g_assert_cmpint (height, ==, 1);
+}
+
+
+#ifdef HAVE_XEXT
+/* an x8r8g8b8 image as XShmCreateImage() sets it up, the padding at
+ * the end of the lines and the unused byte of each pixel are filled
+ * with garbage the filter must not pick up */
+static XImage *
+image_new (gint     width,
+           gint     height,
+           gint     padding,
+           GRand   *rand)
+{
+  XImage  *image;
+  guint32 *row;
+  gint     x, y;
+
+  image = g_new0 (XImage, 1);
+  image->width = width;
+  image->height = height;
+  image->bits_per_pixel = 32;
+  image->bytes_per_line = (width + padding) * 4;
+  image->data = g_malloc ((gsize) image->bytes_per_line * height);
+
+  for (y = 0; y < height; y++)
+    {
+      row = (guint32 *) (image->data + (gsize) y * image->bytes_per_line);
+      for (x = 0; x < width + padding; x++)
+        {
+          if (x < width)
+            row[x] = 0xff000000 | (g_rand_int (rand) & 0xffffff);
+          else
+            row[x] = 0xffffffff;
+        }
+    }
+
+  return image;
+}
+
+
+static void
+image_free (XImage *image)
+{
+  g_free (image->data);
+  g_free (image);
+}
+
+
+/* averages the source pixels covered by every thumbnail pixel one at
+ * a time and compares the result with the filtered thumbnail */
+static void
+assert_box (XImage    *image,
+            GdkPixbuf *thumb)
+{
+  gint     dest_width = gdk_pixbuf_get_width (thumb);
+  gint     dest_height = gdk_pixbuf_get_height (thumb);
+  guchar  *pixels = gdk_pixbuf_get_pixels (thumb);
+  gint     rowstride = gdk_pixbuf_get_rowstride (thumb);
+  guint32  pixel;
+  guint    sums[3];
+  guint    area;
+  gint     sx0, sx1, sy0, sy1;
+  gint     dx, dy, sx, sy, c;
+
+  for (dy = 0; dy < dest_height; dy++)
+    for (dx = 0; dx < dest_width; dx++)
+      {
+        sx0 = dx * image->width / dest_width;
+        sx1 = MAX ((dx + 1) * image->width / dest_width, sx0 + 1);
+        sy0 = dy * image->height / dest_height;
+        sy1 = MAX ((dy + 1) * image->height / dest_height, sy0 + 1);
+
+        sums[0] = sums[1] = sums[2] = 0;
+        for (sy = sy0; sy < sy1; sy++)
+          for (sx = sx0; sx < sx1; sx++)
+            {
+              pixel = ((guint32 *) (image->data + (gsize) sy * image->bytes_per_line))[sx];
+              sums[0] += (pixel >> 16) & 0xff;
+              sums[1] += (pixel >> 8) & 0xff;
+              sums[2] += pixel & 0xff;
+            }
+
+        area = (sx1 - sx0) * (sy1 - sy0);
+        for (c = 0; c < 3; c++)
+          g_assert_cmpuint (pixels[dy * rowstride + dx * 3 + c], ==, sums[c] / area);
+      }
+}
+
+
+static void
+test_screenshot_box (void)
+{
+  static const gint sizes[][4] =
+  {
+    /* source, thumbnail */
+    { 4, 2, 2, 1 },
+    { 5, 3, 2, 2 },
+    { 1920, 1080, 64, 36 },
+    { 1366, 768, 64, 36 },
+    { 1280, 1024, 64, 51 },
+    { 3, 3, 8, 8 },
+    { 1, 1, 1, 1 },
+  };
+  GdkPixbuf *thumb;
+  XImage    *image;
+  GRand     *rand;
+  guint      n;
+
+  rand = g_rand_new_with_seed (42);
+
+  for (n = 0; n < G_N_ELEMENTS (sizes); n++)
+    {
+      image = image_new (sizes[n][0], sizes[n][1], n % 3, rand);
+      thumb = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, sizes[n][2], sizes[n][3]);
+
+      xfsm_logout_dialog_screenshot_box (image, thumb);
+      assert_box (image, thumb);
+
+      g_object_unref (G_OBJECT (thumb));
+      image_free (image);
+    }
+
+  g_rand_free (rand);
+}
+
+
+static void
+test_screenshot_box_exact (void)
+{
+  static const guint32 pixels[] =
+  {
+    0x00ff0000, 0x00ff0000, 0x00000010, 0x00000030,
+    0x0000ff00, 0x00ff0000, 0x00000020, 0x00000040,
+  };
+  GdkPixbuf *thumb;
+  XImage     image = { 0, };
+  guchar    *dest;
+
+  image.width = 4;
+  image.height = 2;
+  image.bytes_per_line = 16;
+  image.data = (gchar *) pixels;
+
+  thumb = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, 2, 1);
+  xfsm_logout_dialog_screenshot_box (&image, thumb);
+
+  dest = gdk_pixbuf_get_pixels (thumb);
+  g_assert_cmpuint (dest[0], ==, 0xbf);
+  g_assert_cmpuint (dest[1], ==, 0x3f);
+  g_assert_cmpuint (dest[2], ==, 0x00);
+  g_assert_cmpuint (dest[3], ==, 0x00);
+  g_assert_cmpuint (dest[4], ==, 0x00);
+  g_assert_cmpuint (dest[5], ==, 0x28);
+
+  g_object_unref (G_OBJECT (thumb));
+}
+#endif
+
+
+int
+main (int argc, char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+  xfsm_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/screenshot/thumb-size", test_screenshot_thumb_size);
+#ifdef HAVE_XEXT
+  g_test_add_func ("/screenshot/box", test_screenshot_box);
+  g_test_add_func ("/screenshot/box-exact", test_screenshot_box_exact);
+#endif
+
+  return g_test_run ();
+}
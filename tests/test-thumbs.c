@@ -0,0 +1,391 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * The session thumbnail atlas: which slot a session is stored in, how
+ * the oldest slot is reused once all of them are taken, and that the
+ * pixels make it back out of the mapped file.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <xfce4-session/xfsm-thumbs.c>
+
+#include <tests/xfsm-test.h>
+
+
+static gchar *directory = NULL;
+
+
+static gchar *
+atlas_filename (const gchar *name)
+{
+  return g_build_filename (directory, name, NULL);
+}
+
+
+static GdkPixbuf *
+thumb_new (gint     width,
+           gint     height,
+           gboolean has_alpha,
+           guint    seed)
+{
+  GdkPixbuf *thumb;
+  guchar    *pixels;
+  gint       rowstride, n_channels;
+  gint       x, y, c;
+
+  thumb = gdk_pixbuf_new (GDK_COLORSPACE_RGB, has_alpha, 8, width, height);
+  pixels = gdk_pixbuf_get_pixels (thumb);
+  rowstride = gdk_pixbuf_get_rowstride (thumb);
+  n_channels = gdk_pixbuf_get_n_channels (thumb);
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      for (c = 0; c < n_channels; c++)
+        pixels[y * rowstride + x * n_channels + c] = (x * 7 + y * 13 + c * 31 + seed) & 0xff;
+
+  return thumb;
+}
+
+
+static void
+store (const gchar *filename,
+       const gchar *session_name,
+       guint        seed)
+{
+  GdkPixbuf *thumb;
+  GError    *error = NULL;
+
+  thumb = thumb_new (XFSM_THUMBS_SIZE, 36, FALSE, seed);
+  g_assert (xfsm_thumbs_store (filename, session_name, thumb, &error));
+  g_assert_no_error (error);
+  g_object_unref (G_OBJECT (thumb));
+}
+
+
+static ThumbsEntry *
+read_index (const gchar *filename)
+{
+  ThumbsEntry *entries;
+  gint         fd;
+
+  entries = g_new0 (ThumbsEntry, THUMBS_SLOTS);
+  fd = g_open (filename, O_RDONLY, 0);
+  g_assert_cmpint (fd, >=, 0);
+  g_assert (xfsm_thumbs_read_index (fd, entries));
+  close (fd);
+
+  return entries;
+}
+
+
+static void
+write_index (const gchar *filename,
+             ThumbsEntry *entries)
+{
+  gint fd;
+
+  fd = g_open (filename, O_WRONLY, 0);
+  g_assert_cmpint (fd, >=, 0);
+  g_assert (xfsm_thumbs_pwrite (fd, entries, THUMBS_SLOTS * sizeof (ThumbsEntry),
+                                sizeof (ThumbsHeader), NULL));
+  close (fd);
+}
+
+
+static void
+assert_thumb_equal (GdkPixbuf *expected,
+                    GdkPixbuf *thumb)
+{
+  const guchar *a, *b;
+  gint          x, y;
+
+  g_assert (thumb != NULL);
+  g_assert_cmpint (gdk_pixbuf_get_width (thumb), ==, gdk_pixbuf_get_width (expected));
+  g_assert_cmpint (gdk_pixbuf_get_height (thumb), ==, gdk_pixbuf_get_height (expected));
+
+  for (y = 0; y < gdk_pixbuf_get_height (expected); y++)
+    {
+      a = gdk_pixbuf_get_pixels (expected) + y * gdk_pixbuf_get_rowstride (expected);
+      b = gdk_pixbuf_get_pixels (thumb) + y * gdk_pixbuf_get_rowstride (thumb);
+      for (x = 0; x < gdk_pixbuf_get_width (expected); x++, a += 3, b += 4)
+        {
+          g_assert_cmpuint (b[0], ==, a[0]);
+          g_assert_cmpuint (b[1], ==, a[1]);
+          g_assert_cmpuint (b[2], ==, a[2]);
+          g_assert_cmpuint (b[3], ==, 0xff);
+        }
+    }
+}
+
+
+static void
+test_thumbs_lookup (void)
+{
+  XfsmThumbs *thumbs;
+  GdkPixbuf  *expected;
+  GdkPixbuf  *thumb;
+  gchar      *filename;
+  guchar     *pixels;
+
+  filename = atlas_filename ("lookup.atlas");
+
+  g_assert (xfsm_thumbs_open (filename) == NULL);
+
+  store (filename, "Default", 1);
+  expected = thumb_new (XFSM_THUMBS_SIZE, 36, FALSE, 1);
+
+  thumbs = xfsm_thumbs_open (filename);
+  g_assert (thumbs != NULL);
+  thumb = xfsm_thumbs_lookup (thumbs, "Default");
+  assert_thumb_equal (expected, thumb);
+  g_object_unref (G_OBJECT (thumb));
+  g_assert (xfsm_thumbs_lookup (thumbs, "Other") == NULL);
+  xfsm_thumbs_close (thumbs);
+  g_object_unref (G_OBJECT (expected));
+
+  /* replaced in place */
+  store (filename, "Default", 2);
+  expected = thumb_new (XFSM_THUMBS_SIZE, 36, FALSE, 2);
+  thumbs = xfsm_thumbs_open (filename);
+  thumb = xfsm_thumbs_lookup (thumbs, "Default");
+  assert_thumb_equal (expected, thumb);
+  g_object_unref (G_OBJECT (thumb));
+  xfsm_thumbs_close (thumbs);
+  g_object_unref (G_OBJECT (expected));
+
+  /* transparent pixels are premultiplied in the atlas */
+  expected = thumb_new (4, 4, TRUE, 3);
+  pixels = gdk_pixbuf_get_pixels (expected);
+  pixels[3] = 0;
+  pixels[7] = 0xff;
+  pixels[11] = 0x80;
+  g_assert (xfsm_thumbs_store (filename, "Alpha", expected, NULL));
+  thumbs = xfsm_thumbs_open (filename);
+  thumb = xfsm_thumbs_lookup (thumbs, "Alpha");
+  g_assert (thumb != NULL);
+  pixels = gdk_pixbuf_get_pixels (thumb);
+  g_assert_cmpuint (pixels[0], ==, 0);
+  g_assert_cmpuint (pixels[3], ==, 0);
+  g_assert (memcmp (pixels + 4, gdk_pixbuf_get_pixels (expected) + 4, 4) == 0);
+  g_assert_cmpint (ABS (pixels[8] - gdk_pixbuf_get_pixels (expected)[8]), <=, 1);
+  g_assert_cmpuint (pixels[11], ==, 0x80);
+  g_object_unref (G_OBJECT (thumb));
+  xfsm_thumbs_close (thumbs);
+  g_object_unref (G_OBJECT (expected));
+
+  g_free (filename);
+}
+
+
+static void
+test_thumbs_slots (void)
+{
+  ThumbsEntry *entries;
+  gchar       *filename;
+  gchar        name[32];
+  guint        n;
+
+  filename = atlas_filename ("slots.atlas");
+
+  /* the free slots are taken in order */
+  for (n = 0; n < THUMBS_SLOTS; n++)
+    {
+      g_snprintf (name, sizeof (name), "Session %u", n);
+      store (filename, name, n);
+    }
+
+  entries = read_index (filename);
+  for (n = 0; n < THUMBS_SLOTS; n++)
+    {
+      g_snprintf (name, sizeof (name), "Session %u", n);
+      g_assert_cmpstr (entries[n].name, ==, name);
+      g_assert_cmpuint (entries[n].width, ==, XFSM_THUMBS_SIZE);
+      g_assert_cmpuint (entries[n].height, ==, 36);
+    }
+  g_free (entries);
+
+  /* a session keeps its slot */
+  store (filename, "Session 5", 100);
+  entries = read_index (filename);
+  g_assert_cmpstr (entries[5].name, ==, "Session 5");
+  g_assert_cmpstr (entries[6].name, ==, "Session 6");
+  g_free (entries);
+
+  /* a freed slot is taken before the oldest one */
+  entries = read_index (filename);
+  for (n = 0; n < THUMBS_SLOTS; n++)
+    entries[n].stamp = 1000 + n;
+  memset (entries + 9, 0, sizeof (ThumbsEntry));
+  write_index (filename, entries);
+  g_free (entries);
+
+  store (filename, "Free", 0);
+  entries = read_index (filename);
+  g_assert_cmpstr (entries[9].name, ==, "Free");
+  g_assert_cmpstr (entries[0].name, ==, "Session 0");
+  g_free (entries);
+
+  g_free (filename);
+}
+
+
+static void
+test_thumbs_evict (void)
+{
+  XfsmThumbs  *thumbs;
+  ThumbsEntry *entries;
+  GdkPixbuf   *thumb;
+  gchar       *filename;
+  gchar        name[32];
+  guint        n;
+
+  filename = atlas_filename ("evict.atlas");
+
+  for (n = 0; n < THUMBS_SLOTS; n++)
+    {
+      g_snprintf (name, sizeof (name), "Session %u", n);
+      store (filename, name, n);
+    }
+
+  /* once all slots are taken the oldest is reused */
+  entries = read_index (filename);
+  for (n = 0; n < THUMBS_SLOTS; n++)
+    entries[n].stamp = 1000 + n;
+  entries[17].stamp = 10;
+  entries[40].stamp = 20;
+  write_index (filename, entries);
+  g_free (entries);
+
+  store (filename, "New", 7);
+  entries = read_index (filename);
+  g_assert_cmpstr (entries[17].name, ==, "New");
+  g_assert_cmpuint (entries[17].stamp, >, 1000);
+  g_free (entries);
+
+  store (filename, "Newer", 8);
+  entries = read_index (filename);
+  g_assert_cmpstr (entries[40].name, ==, "Newer");
+  g_free (entries);
+
+  thumbs = xfsm_thumbs_open (filename);
+  g_assert (thumbs != NULL);
+  g_assert (xfsm_thumbs_lookup (thumbs, "Session 17") == NULL);
+  g_assert (xfsm_thumbs_lookup (thumbs, "Session 40") == NULL);
+  thumb = xfsm_thumbs_lookup (thumbs, "Session 41");
+  g_assert (thumb != NULL);
+  g_object_unref (G_OBJECT (thumb));
+  thumb = xfsm_thumbs_lookup (thumbs, "New");
+  g_assert (thumb != NULL);
+  g_object_unref (G_OBJECT (thumb));
+  xfsm_thumbs_close (thumbs);
+
+  g_free (filename);
+}
+
+
+static void
+test_thumbs_prune (void)
+{
+  XfsmThumbs  *thumbs;
+  ThumbsEntry *entries;
+  gchar       *filename;
+  gchar       *keep[] = { "Default", "Work", NULL };
+
+  filename = atlas_filename ("prune.atlas");
+
+  store (filename, "Default", 0);
+  store (filename, "Gone", 1);
+  store (filename, "Work", 2);
+
+  xfsm_thumbs_prune (filename, keep);
+
+  entries = read_index (filename);
+  g_assert_cmpstr (entries[0].name, ==, "Default");
+  g_assert_cmpstr (entries[1].name, ==, "");
+  g_assert_cmpstr (entries[2].name, ==, "Work");
+  g_free (entries);
+
+  thumbs = xfsm_thumbs_open (filename);
+  g_assert (xfsm_thumbs_lookup (thumbs, "Gone") == NULL);
+  xfsm_thumbs_close (thumbs);
+
+  g_free (filename);
+}
+
+
+static void
+test_thumbs_invalid (void)
+{
+  GdkPixbuf *thumb;
+  GError    *error = NULL;
+  gchar     *filename;
+  gchar     *name;
+
+  filename = atlas_filename ("invalid.atlas");
+
+  /* not an atlas, it is started over */
+  g_assert (g_file_set_contents (filename, "PNG", -1, NULL));
+  g_assert (xfsm_thumbs_open (filename) == NULL);
+  store (filename, "Default", 0);
+  xfsm_thumbs_close (xfsm_thumbs_open (filename));
+
+  name = g_strnfill (THUMBS_NAME_SIZE, 'x');
+  thumb = thumb_new (8, 8, FALSE, 0);
+  g_assert (!xfsm_thumbs_store (filename, name, thumb, &error));
+  g_assert_error (error, G_FILE_ERROR, G_FILE_ERROR_NAMETOOLONG);
+  g_error_free (error);
+  g_object_unref (G_OBJECT (thumb));
+  g_free (name);
+
+  g_free (filename);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  gint result;
+
+  g_test_init (&argc, &argv, NULL);
+  xfsm_test_init (&argc, &argv, NULL);
+
+  directory = xfsm_test_mkdtemp ();
+
+  g_test_add_func ("/thumbs/lookup", test_thumbs_lookup);
+  g_test_add_func ("/thumbs/slots", test_thumbs_slots);
+  g_test_add_func ("/thumbs/evict", test_thumbs_evict);
+  g_test_add_func ("/thumbs/prune", test_thumbs_prune);
+  g_test_add_func ("/thumbs/invalid", test_thumbs_invalid);
+
+  result = g_test_run ();
+
+  xfsm_test_rmtree (directory);
+  g_free (directory);
+
+  return result;
+}
@@ -0,0 +1,737 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <X11/ICE/ICElib.h>
+
+#include <glib/gstdio.h>
+
+#include <xfce4-session/xfsm-global.h>
+
+#include <tests/xfsm-test.h>
+#include <tests/xfsm-test-session.h>
+
+
+/* time the manager may take to come up, its private bus included */
+#define SESSION_START_TIMEOUT  (10 * 1000)
+
+/* time the manager may take to exit once it was asked to */
+#define SESSION_STOP_TIMEOUT   (2 * 1000)
+
+
+struct _XfsmTestSession
+{
+  gchar *dir;
+  gchar *address;
+  GPid   pid;
+  guint  exited;
+  gint   status;
+};
+
+struct _XfsmTestClient
+{
+  XfsmTestSession           *session;
+  SmcConn                    conn;
+  gchar                     *id;
+  guint                      watch_id;
+  guint                      close_id;
+  const XfsmTestClientFuncs *funcs;
+  gpointer                   user_data;
+};
+
+
+/* the failsafe session only reports the address of the manager, the
+ * clients are up to the test */
+static const gchar settings_template[] =
+  "[/general]\n"
+  "SessionName=Test\n"
+  "FailsafeSessionName=Failsafe\n"
+  "AutoSave=false\n"
+  "\n"
+  "[/sessions/Failsafe]\n"
+  "IsFailsafe=true\n"
+  "Count=1\n"
+  "Client0_Command=/bin/sh;-c;echo \"$SESSION_MANAGER\" > %s.tmp && mv %s.tmp %s;\n"
+  "\n"
+  "%s\n";
+
+/* a saved session writes the address from its first client instead,
+ * the failsafe session is only used if there is none */
+static const gchar session_template[] =
+  "[Session: Test]\n"
+  "Count=%u\n"
+  "Client0_ClientId=1xfsm-test-address\n"
+  "Client0_Hostname=local/localhost\n"
+  "Client0_Program=sh\n"
+  "Client0_Priority=0\n"
+  "Client0_RestartCommand=/bin/sh,-c,echo \"$SESSION_MANAGER\" > %s.tmp && mv %s.tmp %s\n"
+  "%s";
+
+
+static void
+xfsm_test_session_setup (gpointer user_data)
+{
+  /* take the private bus down along with the manager */
+  setpgid (0, 0);
+}
+
+
+static void
+xfsm_test_session_exited (GPid     pid,
+                          gint     status,
+                          gpointer user_data)
+{
+  XfsmTestSession *session = user_data;
+
+  session->status = status;
+  session->exited = 1;
+}
+
+
+static gboolean
+xfsm_test_session_timeout (gpointer user_data)
+{
+  gboolean *timed_out = user_data;
+
+  *timed_out = TRUE;
+
+  return FALSE;
+}
+
+
+/* runs the main loop until *@count reached @target. returns FALSE if
+ * that did not happen within @timeout_ms */
+gboolean
+xfsm_test_session_wait_count (const guint *count,
+                              guint        target,
+                              guint        timeout_ms)
+{
+  gboolean timed_out = FALSE;
+  guint    timeout_id;
+
+  timeout_id = g_timeout_add (timeout_ms, xfsm_test_session_timeout, &timed_out);
+
+  while (*count < target && !timed_out)
+    g_main_context_iteration (NULL, TRUE);
+
+  if (!timed_out)
+    g_source_remove (timeout_id);
+
+  return *count >= target;
+}
+
+
+/* starts xfce4-session --headless, with @settings (key file groups,
+ * see xfsm-settings.c) added to the defaults. returns NULL if the
+ * manager can't be run here. */
+XfsmTestSession *
+xfsm_test_session_start (const gchar *settings)
+{
+  return xfsm_test_session_restore (settings, NULL, 0);
+}
+
+
+/* like xfsm_test_session_start(), but the manager restores a saved
+ * session. @clients are the Client1_ to Client@n_clients_ entries of
+ * the session file, see xfsm_properties_store(). */
+XfsmTestSession *
+xfsm_test_session_restore (const gchar *settings,
+                           const gchar *clients,
+                           guint        n_clients)
+{
+  XfsmTestSession *session;
+  const gchar     *binary;
+  GError          *error = NULL;
+  gchar           *address_file;
+  gchar           *settings_file;
+  gchar           *session_file;
+  gchar           *contents;
+  gchar           *path;
+  gchar          **envp;
+  gchar           *argv[5];
+  gint             n;
+
+  binary = g_getenv ("XFSM_TEST_BINARY");
+  if (binary == NULL)
+    binary = XFSM_TEST_BINARY;
+
+  if (!g_file_test (binary, G_FILE_TEST_IS_EXECUTABLE))
+    {
+      g_printerr ("%s has not been built\n", binary);
+      return NULL;
+    }
+
+  path = g_find_program_in_path ("dbus-daemon");
+  if (path == NULL)
+    {
+      g_printerr ("dbus-daemon is needed to run the session manager headless\n");
+      return NULL;
+    }
+  g_free (path);
+
+  session = g_new0 (XfsmTestSession, 1);
+  session->dir = xfsm_test_mkdtemp ();
+
+  address_file = g_build_filename (session->dir, "address", NULL);
+  settings_file = g_build_filename (session->dir, "settings", NULL);
+
+  contents = g_strdup_printf (settings_template, address_file, address_file,
+                              address_file, settings != NULL ? settings : "");
+  if (!g_file_set_contents (settings_file, contents, -1, &error))
+    g_error ("Unable to write %s: %s", settings_file, error->message);
+  g_free (contents);
+
+  /* where the manager looks for the session without a display, see
+   * xfsm_manager_load() */
+  if (clients != NULL)
+    {
+      path = g_build_filename (session->dir, "cache", "sessions", NULL);
+      g_mkdir_with_parents (path, 0700);
+      session_file = g_build_filename (path, "xfce4-session-headless", NULL);
+      g_free (path);
+
+      contents = g_strdup_printf (session_template, n_clients + 1, address_file,
+                                  address_file, address_file, clients);
+      if (!g_file_set_contents (session_file, contents, -1, &error))
+        g_error ("Unable to write %s: %s", session_file, error->message);
+      g_free (contents);
+      g_free (session_file);
+    }
+
+  /* the clients of the test authenticate with the same file */
+  path = g_build_filename (session->dir, "ICEauthority", NULL);
+  g_setenv ("ICEAUTHORITY", path, TRUE);
+  g_free (path);
+
+  /* keep the manager away from the files and the autostart items of
+   * the user running the test */
+  envp = g_get_environ ();
+  envp = g_environ_unsetenv (envp, "SESSION_MANAGER");
+  envp = g_environ_unsetenv (envp, "DISPLAY");
+  envp = g_environ_unsetenv (envp, "DBUS_SESSION_BUS_ADDRESS");
+  envp = g_environ_setenv (envp, "HOME", session->dir, TRUE);
+
+  path = g_build_filename (session->dir, "config", NULL);
+  envp = g_environ_setenv (envp, "XDG_CONFIG_HOME", path, TRUE);
+  g_free (path);
+  path = g_build_filename (session->dir, "xdg", NULL);
+  envp = g_environ_setenv (envp, "XDG_CONFIG_DIRS", path, TRUE);
+  g_free (path);
+  path = g_build_filename (session->dir, "cache", NULL);
+  envp = g_environ_setenv (envp, "XDG_CACHE_HOME", path, TRUE);
+  g_free (path);
+  path = g_build_filename (session->dir, "data", NULL);
+  envp = g_environ_setenv (envp, "XDG_DATA_HOME", path, TRUE);
+  g_free (path);
+
+  n = 0;
+  argv[n++] = (gchar *) binary;
+  argv[n++] = "--headless";
+  argv[n++] = "--settings";
+  argv[n++] = settings_file;
+  argv[n] = NULL;
+
+  if (!g_spawn_async (session->dir, argv, envp,
+                      G_SPAWN_DO_NOT_REAP_CHILD
+                      | (xfsm_is_verbose_enabled () ? 0 : G_SPAWN_STDOUT_TO_DEV_NULL),
+                      xfsm_test_session_setup, NULL,
+                      &session->pid, &error))
+    {
+      g_printerr ("Unable to start %s: %s\n", binary, error->message);
+      g_error_free (error);
+      g_strfreev (envp);
+      g_free (settings_file);
+      g_free (address_file);
+      xfsm_test_rmtree (session->dir);
+      g_free (session->dir);
+      g_free (session);
+      return NULL;
+    }
+
+  g_child_watch_add (session->pid, xfsm_test_session_exited, session);
+
+  g_strfreev (envp);
+  g_free (settings_file);
+
+  /* the failsafe or the first saved client writes the address once
+   * the manager listens */
+  for (n = 0; n < SESSION_START_TIMEOUT / 10 && !session->exited; ++n)
+    {
+      if (g_file_get_contents (address_file, &session->address, NULL, NULL))
+        break;
+      xfsm_test_session_wait_count (&session->exited, 1, 10);
+    }
+
+  g_free (address_file);
+
+  if (session->address == NULL || *g_strstrip (session->address) == '\0')
+    {
+      g_printerr ("The session manager did not come up\n");
+      xfsm_test_session_free (session);
+      return NULL;
+    }
+
+  xfsm_verbose ("Session manager %d listening on %s\n",
+                (gint) session->pid, session->address);
+
+  return session;
+}
+
+
+/* stops the manager if it is still running and removes its files */
+void
+xfsm_test_session_free (XfsmTestSession *session)
+{
+  if (session->pid > 0)
+    {
+      /* the whole group, a manager that exited on its own may still
+       * have left its bus behind */
+      kill (-session->pid, SIGTERM);
+      if (!xfsm_test_session_wait (session, SESSION_STOP_TIMEOUT))
+        {
+          kill (-session->pid, SIGKILL);
+          xfsm_test_session_wait (session, SESSION_STOP_TIMEOUT);
+        }
+
+      g_spawn_close_pid (session->pid);
+    }
+
+  xfsm_test_rmtree (session->dir);
+
+  g_free (session->dir);
+  g_free (session->address);
+  g_free (session);
+}
+
+
+const gchar *
+xfsm_test_session_get_address (XfsmTestSession *session)
+{
+  return session->address;
+}
+
+
+GPid
+xfsm_test_session_get_pid (XfsmTestSession *session)
+{
+  return session->pid;
+}
+
+
+/* the wait status of the manager, once xfsm_test_session_wait()
+ * returned TRUE */
+gint
+xfsm_test_session_get_status (XfsmTestSession *session)
+{
+  return session->status;
+}
+
+
+/* runs the main loop until the manager exited, FALSE if it is still
+ * running after @timeout_ms */
+gboolean
+xfsm_test_session_wait (XfsmTestSession *session,
+                        guint            timeout_ms)
+{
+  return xfsm_test_session_wait_count (&session->exited, 1, timeout_ms);
+}
+
+
+/* CPU time the manager used so far and its resident set, from /proc.
+ * returns FALSE if that is not available */
+gboolean
+xfsm_test_session_get_usage (XfsmTestSession *session,
+                             gint64          *cpu_usec,
+                             gint64          *rss_kb,
+                             gint64          *peak_rss_kb)
+{
+  gchar   *filename;
+  gchar   *contents;
+  gchar   *p;
+  gchar  **fields;
+  gboolean succeed = FALSE;
+
+  *cpu_usec = *rss_kb = *peak_rss_kb = 0;
+
+  if (session->exited)
+    return FALSE;
+
+  /* utime and stime are the 12th and 13th field after the command,
+   * which may contain spaces itself */
+  filename = g_strdup_printf ("/proc/%d/stat", (gint) session->pid);
+  if (g_file_get_contents (filename, &contents, NULL, NULL))
+    {
+      p = strrchr (contents, ')');
+      if (p != NULL)
+        {
+          fields = g_strsplit (p + 2, " ", 14);
+          if (g_strv_length (fields) >= 14)
+            {
+              *cpu_usec = (g_ascii_strtoll (fields[11], NULL, 10)
+                           + g_ascii_strtoll (fields[12], NULL, 10))
+                          * G_USEC_PER_SEC / sysconf (_SC_CLK_TCK);
+              succeed = TRUE;
+            }
+          g_strfreev (fields);
+        }
+      g_free (contents);
+    }
+  g_free (filename);
+
+  filename = g_strdup_printf ("/proc/%d/status", (gint) session->pid);
+  if (g_file_get_contents (filename, &contents, NULL, NULL))
+    {
+      p = strstr (contents, "VmRSS:");
+      if (p != NULL)
+        *rss_kb = g_ascii_strtoll (p + 6, NULL, 10);
+      p = strstr (contents, "VmHWM:");
+      if (p != NULL)
+        *peak_rss_kb = g_ascii_strtoll (p + 6, NULL, 10);
+      g_free (contents);
+    }
+  g_free (filename);
+
+  return succeed;
+}
+
+
+static void
+xfsm_test_ice_io_error (IceConn ice_conn)
+{
+  /* the default handler exits, the watch notices the closed
+   * connection instead */
+}
+
+
+static gboolean
+xfsm_test_client_close_idle (gpointer user_data)
+{
+  XfsmTestClient *client = user_data;
+
+  client->close_id = 0;
+
+  if (client->watch_id != 0)
+    {
+      g_source_remove (client->watch_id);
+      client->watch_id = 0;
+    }
+
+  if (client->conn != NULL)
+    {
+      SmcCloseConnection (client->conn, 0, NULL);
+      client->conn = NULL;
+    }
+
+  return FALSE;
+}
+
+
+static gboolean
+xfsm_test_client_process (GIOChannel  *channel,
+                          GIOCondition condition,
+                          gpointer     user_data)
+{
+  XfsmTestClient          *client = user_data;
+  IceProcessMessagesStatus status;
+
+  status = IceProcessMessages (SmcGetIceConnection (client->conn), NULL, NULL);
+  if (status == IceProcessMessagesIOError
+      || status == IceProcessMessagesConnectionClosed)
+    {
+      client->watch_id = 0;
+      if (client->close_id == 0)
+        client->close_id = g_idle_add (xfsm_test_client_close_idle, client);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+
+static void
+xfsm_test_client_save_yourself (SmcConn   conn,
+                                SmPointer client_data,
+                                gint      save_type,
+                                Bool      shutdown,
+                                gint      interact_style,
+                                Bool      fast)
+{
+  XfsmTestClient *client = client_data;
+
+  if (client->funcs != NULL && client->funcs->save_yourself != NULL)
+    {
+      client->funcs->save_yourself (client, save_type, shutdown,
+                                    interact_style, fast, client->user_data);
+    }
+  else
+    {
+      SmcSaveYourselfDone (conn, True);
+    }
+}
+
+
+static void
+xfsm_test_client_die (SmcConn   conn,
+                      SmPointer client_data)
+{
+  XfsmTestClient *client = client_data;
+
+  if (client->funcs != NULL && client->funcs->die != NULL)
+    client->funcs->die (client, client->user_data);
+
+  /* not from within IceProcessMessages() */
+  if (client->close_id == 0)
+    client->close_id = g_idle_add (xfsm_test_client_close_idle, client);
+}
+
+
+static void
+xfsm_test_client_save_complete (SmcConn   conn,
+                                SmPointer client_data)
+{
+  XfsmTestClient *client = client_data;
+
+  if (client->funcs != NULL && client->funcs->save_complete != NULL)
+    client->funcs->save_complete (client, client->user_data);
+}
+
+
+static void
+xfsm_test_client_shutdown_cancelled (SmcConn   conn,
+                                     SmPointer client_data)
+{
+  XfsmTestClient *client = client_data;
+
+  if (client->funcs != NULL && client->funcs->shutdown_cancelled != NULL)
+    client->funcs->shutdown_cancelled (client, client->user_data);
+}
+
+
+static void
+xfsm_test_client_interact (SmcConn   conn,
+                           SmPointer client_data)
+{
+  XfsmTestClient *client = client_data;
+
+  if (client->funcs != NULL && client->funcs->interact != NULL)
+    client->funcs->interact (client, client->user_data);
+  else
+    SmcInteractDone (conn, False);
+}
+
+
+/* registers a new client with the manager, which blocks until the
+ * manager replied. the save_yourself callback of @funcs has to send
+ * SaveYourselfDone itself. */
+XfsmTestClient *
+xfsm_test_client_new (XfsmTestSession           *session,
+                      const gchar               *previous_id,
+                      const XfsmTestClientFuncs *funcs,
+                      gpointer                   user_data)
+{
+  static gboolean  handler_set = FALSE;
+  XfsmTestClient  *client;
+  SmcCallbacks     callbacks;
+  GIOChannel      *channel;
+  gchar           *client_id = NULL;
+  gchar            error[256] = "";
+
+  if (!handler_set)
+    {
+      IceSetIOErrorHandler (xfsm_test_ice_io_error);
+      handler_set = TRUE;
+    }
+
+  client = g_new0 (XfsmTestClient, 1);
+  client->session = session;
+  client->funcs = funcs;
+  client->user_data = user_data;
+
+  callbacks.save_yourself.callback = xfsm_test_client_save_yourself;
+  callbacks.save_yourself.client_data = client;
+  callbacks.die.callback = xfsm_test_client_die;
+  callbacks.die.client_data = client;
+  callbacks.save_complete.callback = xfsm_test_client_save_complete;
+  callbacks.save_complete.client_data = client;
+  callbacks.shutdown_cancelled.callback = xfsm_test_client_shutdown_cancelled;
+  callbacks.shutdown_cancelled.client_data = client;
+
+  client->conn = SmcOpenConnection (session->address, client,
+                                    SmProtoMajor, SmProtoMinor,
+                                    SmcSaveYourselfProcMask | SmcDieProcMask
+                                    | SmcSaveCompleteProcMask
+                                    | SmcShutdownCancelledProcMask,
+                                    &callbacks, (gchar *) previous_id, &client_id,
+                                    sizeof (error), error);
+  if (client->conn == NULL)
+    {
+      g_printerr ("Unable to connect to the session manager: %s\n", error);
+      g_free (client);
+      return NULL;
+    }
+
+  client->id = g_strdup (client_id);
+  free (client_id);
+
+  channel = g_io_channel_unix_new (IceConnectionNumber (SmcGetIceConnection (client->conn)));
+  client->watch_id = g_io_add_watch (channel, G_IO_IN | G_IO_ERR | G_IO_HUP,
+                                     xfsm_test_client_process, client);
+  g_io_channel_unref (channel);
+
+  return client;
+}
+
+
+/* disconnects the client, if the manager did not do that already */
+void
+xfsm_test_client_free (XfsmTestClient *client)
+{
+  if (client->close_id != 0)
+    g_source_remove (client->close_id);
+
+  xfsm_test_client_close_idle (client);
+
+  g_free (client->id);
+  g_free (client);
+}
+
+
+SmcConn
+xfsm_test_client_get_conn (XfsmTestClient *client)
+{
+  return client->conn;
+}
+
+
+const gchar *
+xfsm_test_client_get_id (XfsmTestClient *client)
+{
+  return client->id;
+}
+
+
+gboolean
+xfsm_test_client_is_connected (XfsmTestClient *client)
+{
+  return client->conn != NULL && client->close_id == 0;
+}
+
+
+/* asks for the interaction granted to the interact callback */
+void
+xfsm_test_client_request_interact (XfsmTestClient *client)
+{
+  SmcInteractRequest (client->conn, SmDialogNormal,
+                      xfsm_test_client_interact, client);
+}
+
+
+/* what a typical toolkit client sets right after registering */
+void
+xfsm_test_client_set_properties (XfsmTestClient *client,
+                                 const gchar    *program)
+{
+  SmPropValue  program_val, restart_vals[3], clone_val, cwd_val;
+  SmPropValue  user_val, pid_val, hint_val, priority_val;
+  SmProp       prop[8];
+  SmProp      *props[8];
+  gchar        pid[16];
+  guchar       hint = SmRestartIfRunning;
+  guchar       priority = 50;
+  guint        n;
+
+  g_snprintf (pid, sizeof (pid), "%d", (gint) getpid ());
+
+#define VALUE(val, str) \
+  G_STMT_START { (val).value = (SmPointer) (str); (val).length = strlen (str); } G_STMT_END
+
+  VALUE (program_val, program);
+  VALUE (restart_vals[0], program);
+  VALUE (restart_vals[1], "--sm-client-id");
+  VALUE (restart_vals[2], client->id);
+  VALUE (clone_val, program);
+  VALUE (cwd_val, g_get_home_dir ());
+  VALUE (user_val, g_get_user_name ());
+  VALUE (pid_val, pid);
+  hint_val.value = &hint;
+  hint_val.length = 1;
+  priority_val.value = &priority;
+  priority_val.length = 1;
+
+#undef VALUE
+
+  prop[0].name = SmProgram;
+  prop[0].type = SmARRAY8;
+  prop[0].num_vals = 1;
+  prop[0].vals = &program_val;
+  prop[1].name = SmRestartCommand;
+  prop[1].type = SmLISTofARRAY8;
+  prop[1].num_vals = 3;
+  prop[1].vals = restart_vals;
+  prop[2].name = SmCloneCommand;
+  prop[2].type = SmLISTofARRAY8;
+  prop[2].num_vals = 1;
+  prop[2].vals = &clone_val;
+  prop[3].name = SmCurrentDirectory;
+  prop[3].type = SmARRAY8;
+  prop[3].num_vals = 1;
+  prop[3].vals = &cwd_val;
+  prop[4].name = SmUserID;
+  prop[4].type = SmARRAY8;
+  prop[4].num_vals = 1;
+  prop[4].vals = &user_val;
+  prop[5].name = SmProcessID;
+  prop[5].type = SmARRAY8;
+  prop[5].num_vals = 1;
+  prop[5].vals = &pid_val;
+  prop[6].name = SmRestartStyleHint;
+  prop[6].type = SmCARD8;
+  prop[6].num_vals = 1;
+  prop[6].vals = &hint_val;
+  prop[7].name = "_GSM_Priority";
+  prop[7].type = SmCARD8;
+  prop[7].num_vals = 1;
+  prop[7].vals = &priority_val;
+
+  for (n = 0; n < G_N_ELEMENTS (props); ++n)
+    props[n] = prop + n;
+
+  SmcSetProperties (client->conn, G_N_ELEMENTS (props), props);
+}
@@ -0,0 +1,96 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Runs xfce4-session --headless in a scratch home for the protocol
+ * tests and benchmarks, and connects synthetic libSM clients to it.
+ * The manager gets its own process group, so it and its private bus
+ * are gone once the session is freed, whatever state it is in.
+ */
+
+#ifndef __XFSM_TEST_SESSION_H__
+#define __XFSM_TEST_SESSION_H__
+
+#include <glib.h>
+
+#include <X11/SM/SMlib.h>
+
+G_BEGIN_DECLS;
+
+typedef struct _XfsmTestSession XfsmTestSession;
+typedef struct _XfsmTestClient  XfsmTestClient;
+
+/* what a client does when the manager talks to it. unset callbacks
+ * answer SaveYourself right away and close the connection on Die. */
+typedef struct
+{
+  void (*save_yourself)      (XfsmTestClient *client,
+                              gint            save_type,
+                              gboolean        shutdown,
+                              gint            interact_style,
+                              gboolean        fast,
+                              gpointer        user_data);
+  void (*interact)           (XfsmTestClient *client,
+                              gpointer        user_data);
+  void (*die)                (XfsmTestClient *client,
+                              gpointer        user_data);
+  void (*save_complete)      (XfsmTestClient *client,
+                              gpointer        user_data);
+  void (*shutdown_cancelled) (XfsmTestClient *client,
+                              gpointer        user_data);
+} XfsmTestClientFuncs;
+
+XfsmTestSession *xfsm_test_session_start       (const gchar     *settings);
+XfsmTestSession *xfsm_test_session_restore     (const gchar     *settings,
+                                                const gchar     *clients,
+                                                guint            n_clients);
+void             xfsm_test_session_free        (XfsmTestSession *session);
+
+const gchar     *xfsm_test_session_get_address (XfsmTestSession *session);
+GPid             xfsm_test_session_get_pid     (XfsmTestSession *session);
+gint             xfsm_test_session_get_status  (XfsmTestSession *session);
+gboolean         xfsm_test_session_wait        (XfsmTestSession *session,
+                                                guint            timeout_ms);
+gboolean         xfsm_test_session_wait_count  (const guint     *count,
+                                                guint            target,
+                                                guint            timeout_ms);
+gboolean         xfsm_test_session_get_usage   (XfsmTestSession *session,
+                                                gint64          *cpu_usec,
+                                                gint64          *rss_kb,
+                                                gint64          *peak_rss_kb);
+
+XfsmTestClient  *xfsm_test_client_new          (XfsmTestSession           *session,
+                                                const gchar               *previous_id,
+                                                const XfsmTestClientFuncs *funcs,
+                                                gpointer                   user_data);
+void             xfsm_test_client_free         (XfsmTestClient  *client);
+
+SmcConn          xfsm_test_client_get_conn     (XfsmTestClient  *client);
+const gchar     *xfsm_test_client_get_id       (XfsmTestClient  *client);
+gboolean         xfsm_test_client_is_connected (XfsmTestClient  *client);
+
+void             xfsm_test_client_request_interact (XfsmTestClient *client);
+
+void             xfsm_test_client_set_properties (XfsmTestClient *client,
+                                                  const gchar    *program);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_TEST_SESSION_H__ */
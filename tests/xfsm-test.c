@@ -0,0 +1,244 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDARG_H
+#include <stdarg.h>
+#endif
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <glib/gstdio.h>
+
+#include <xfce4-session/xfsm-global.h>
+
+#include <tests/xfsm-test.h>
+
+
+struct _XfsmBench
+{
+  gchar  *name;
+  GArray *samples;
+  gint64  start;
+};
+
+
+/* what xfsm-global.c provides */
+gboolean          verbose = FALSE;
+gboolean          xfsm_headless = TRUE;
+XfsmSplashScreen *splash_screen = NULL;
+
+
+void
+xfsm_enable_verbose (void)
+{
+  verbose = TRUE;
+}
+
+
+gboolean
+xfsm_is_verbose_enabled (void)
+{
+  return verbose;
+}
+
+
+void
+xfsm_verbose_real (const char *func,
+                   const char *file,
+                   int         line,
+                   const char *format,
+                   ...)
+{
+  va_list valist;
+
+  if (!verbose)
+    return;
+
+  fprintf (stderr, "%s:%d %s(): ", file, line, func);
+  va_start (valist, format);
+  vfprintf (stderr, format, valist);
+  va_end (valist);
+}
+
+
+/* parses the options of a test, nothing here needs a display */
+void
+xfsm_test_init (gint         *argc,
+                gchar      ***argv,
+                GOptionEntry *entries)
+{
+  GOptionContext *context;
+  GError         *error = NULL;
+
+#if !GLIB_CHECK_VERSION (2, 36, 0)
+  g_type_init ();
+#endif
+
+  context = g_option_context_new (NULL);
+  if (entries != NULL)
+    g_option_context_add_main_entries (context, entries, NULL);
+  if (!g_option_context_parse (context, argc, argv, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      exit (EXIT_FAILURE);
+    }
+  g_option_context_free (context);
+
+  if (g_getenv ("XFSM_VERBOSE") != NULL)
+    xfsm_enable_verbose ();
+}
+
+
+XfsmBench *
+xfsm_bench_new (const gchar *name)
+{
+  XfsmBench *bench;
+
+  bench = g_new0 (XfsmBench, 1);
+  bench->name = g_strdup (name);
+  bench->samples = g_array_new (FALSE, FALSE, sizeof (gint64));
+
+  return bench;
+}
+
+
+void
+xfsm_bench_free (XfsmBench *bench)
+{
+  g_array_free (bench->samples, TRUE);
+  g_free (bench->name);
+  g_free (bench);
+}
+
+
+void
+xfsm_bench_start (XfsmBench *bench)
+{
+  bench->start = g_get_monotonic_time ();
+}
+
+
+void
+xfsm_bench_stop (XfsmBench *bench)
+{
+  xfsm_bench_add (bench, g_get_monotonic_time () - bench->start);
+}
+
+
+void
+xfsm_bench_add (XfsmBench *bench,
+                gint64     usec)
+{
+  g_array_append_val (bench->samples, usec);
+}
+
+
+static gint
+xfsm_bench_compare (gconstpointer a,
+                    gconstpointer b)
+{
+  gint64 x = *(const gint64 *) a;
+  gint64 y = *(const gint64 *) b;
+
+  return x < y ? -1 : (x > y);
+}
+
+
+/* nearest rank, 0 is the minimum and 100 the maximum */
+gint64
+xfsm_bench_percentile (XfsmBench *bench,
+                       guint      percent)
+{
+  guint rank;
+
+  if (bench->samples->len == 0)
+    return 0;
+
+  g_array_sort (bench->samples, xfsm_bench_compare);
+
+  rank = (bench->samples->len * MIN (percent, 100) + 99) / 100;
+  return g_array_index (bench->samples, gint64, rank > 0 ? rank - 1 : 0);
+}
+
+
+void
+xfsm_bench_report (XfsmBench *bench)
+{
+  g_print ("%-40s %6u  min %8" G_GINT64_FORMAT "  p50 %8" G_GINT64_FORMAT
+           "  p90 %8" G_GINT64_FORMAT "  p99 %8" G_GINT64_FORMAT
+           "  max %8" G_GINT64_FORMAT " usec\n",
+           bench->name, bench->samples->len,
+           xfsm_bench_percentile (bench, 0),
+           xfsm_bench_percentile (bench, 50),
+           xfsm_bench_percentile (bench, 90),
+           xfsm_bench_percentile (bench, 99),
+           xfsm_bench_percentile (bench, 100));
+}
+
+
+/* a fresh directory for the files of a test */
+gchar *
+xfsm_test_mkdtemp (void)
+{
+  gchar *path;
+
+  path = g_build_filename (g_get_tmp_dir (), "xfsm-test-XXXXXX", NULL);
+  if (mkdtemp (path) == NULL)
+    g_error ("Unable to create a directory in %s", g_get_tmp_dir ());
+
+  return path;
+}
+
+
+void
+xfsm_test_rmtree (const gchar *path)
+{
+  const gchar *name;
+  gchar       *child;
+  GDir        *dir;
+
+  dir = g_dir_open (path, 0, NULL);
+  if (dir != NULL)
+    {
+      while ((name = g_dir_read_name (dir)) != NULL)
+        {
+          child = g_build_filename (path, name, NULL);
+          xfsm_test_rmtree (child);
+          g_free (child);
+        }
+      g_dir_close (dir);
+      g_rmdir (path);
+    }
+  else
+    {
+      g_unlink (path);
+    }
+}
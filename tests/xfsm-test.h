@@ -0,0 +1,59 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Shared by the tests and benchmarks. The units under test are compiled
+ * into each program by including their source file, which gives the
+ * tests access to static functions. This file provides what
+ * xfsm-global.c provides to them in xfce4-session, plus a timer that
+ * collects samples and prints percentiles.
+ */
+
+#ifndef __XFSM_TEST_H__
+#define __XFSM_TEST_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+typedef struct _XfsmBench XfsmBench;
+
+void       xfsm_test_init        (gint         *argc,
+                                  gchar      ***argv,
+                                  GOptionEntry *entries);
+
+XfsmBench *xfsm_bench_new        (const gchar *name);
+void       xfsm_bench_free       (XfsmBench   *bench);
+
+void       xfsm_bench_start      (XfsmBench   *bench);
+void       xfsm_bench_stop       (XfsmBench   *bench);
+void       xfsm_bench_add        (XfsmBench   *bench,
+                                  gint64       usec);
+
+gint64     xfsm_bench_percentile (XfsmBench   *bench,
+                                  guint        percent);
+void       xfsm_bench_report     (XfsmBench   *bench);
+
+gchar     *xfsm_test_mkdtemp     (void);
+void       xfsm_test_rmtree      (const gchar *path);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_TEST_H__ */
@@ -0,0 +1,288 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * XSMP protocol benchmark. Starts a headless xfce4-session and drives
+ * --clients synthetic libSM clients through a whole session:
+ *
+ *   register       SmcOpenConnection() and the usual SetProperties
+ *   checkpoint     a global SaveYourself, answered after --save-delay
+ *   churn          clients that register and disconnect right away
+ *   logout         a shutdown SaveYourself, every --interact-every'th
+ *                  client asks to interact first, until SmDie
+ *
+ * Latency percentiles are reported per phase, along with the CPU time
+ * the manager used in it and its resident set afterwards. The paths
+ * covered are sm_register_client(), xfsm_manager_save_yourself_global(),
+ * xfsm_manager_complete_saveyourself() and
+ * xfsm_manager_perform_shutdown().
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#include <tests/xfsm-test.h>
+#include <tests/xfsm-test-session.h>
+
+
+#define PHASE_TIMEOUT  (60 * 1000)
+
+
+typedef struct
+{
+  XfsmTestClient *client;
+  gint            index;
+} BenchClient;
+
+
+static gint n_clients = 100;
+static gint n_checkpoints = 10;
+static gint n_churn = 100;
+static gint save_delay = 0;
+static gint interact_every = 10;
+
+static GOptionEntry option_entries[] =
+{
+  { "clients", 'n', 0, G_OPTION_ARG_INT, &n_clients, "Number of clients", "N" },
+  { "checkpoints", 'c', 0, G_OPTION_ARG_INT, &n_checkpoints, "Number of global checkpoints", "N" },
+  { "churn", 0, 0, G_OPTION_ARG_INT, &n_churn, "Clients that register and disconnect right away", "N" },
+  { "save-delay", 'd', 0, G_OPTION_ARG_INT, &save_delay, "Milliseconds a client takes to save", "MS" },
+  { "interact-every", 'i', 0, G_OPTION_ARG_INT, &interact_every, "Every N'th client interacts on logout, 0 for none", "N" },
+  { NULL }
+};
+
+static XfsmTestSession *session;
+
+static XfsmBench *register_bench;
+static XfsmBench *checkpoint_bench;
+static XfsmBench *churn_bench;
+static XfsmBench *die_bench;
+
+static gint64     logout_start;
+static guint      n_saved;
+static guint      n_died;
+
+
+static gboolean
+save_done (gpointer user_data)
+{
+  BenchClient *bench_client = user_data;
+
+  if (xfsm_test_client_is_connected (bench_client->client))
+    SmcSaveYourselfDone (xfsm_test_client_get_conn (bench_client->client), True);
+
+  return FALSE;
+}
+
+
+static void
+save_later (BenchClient *bench_client)
+{
+  if (save_delay > 0)
+    g_timeout_add (save_delay, save_done, bench_client);
+  else
+    save_done (bench_client);
+}
+
+
+static void
+client_save_yourself (XfsmTestClient *client,
+                      gint            save_type,
+                      gboolean        shutdown,
+                      gint            interact_style,
+                      gboolean        fast,
+                      gpointer        user_data)
+{
+  BenchClient *bench_client = user_data;
+
+  if (shutdown
+      && interact_style != SmInteractStyleNone
+      && interact_every > 0
+      && bench_client->index % interact_every == 0)
+    {
+      xfsm_test_client_request_interact (client);
+      return;
+    }
+
+  save_later (bench_client);
+}
+
+
+static void
+client_interact (XfsmTestClient *client,
+                 gpointer        user_data)
+{
+  /* nothing to ask, done right away */
+  SmcInteractDone (xfsm_test_client_get_conn (client), False);
+  save_later (user_data);
+}
+
+
+static void
+client_die (XfsmTestClient *client,
+            gpointer        user_data)
+{
+  xfsm_bench_add (die_bench, g_get_monotonic_time () - logout_start);
+  n_died++;
+}
+
+
+static void
+client_save_complete (XfsmTestClient *client,
+                      gpointer        user_data)
+{
+  n_saved++;
+}
+
+
+static const XfsmTestClientFuncs client_funcs =
+{
+  client_save_yourself,
+  client_interact,
+  client_die,
+  client_save_complete,
+  NULL
+};
+
+
+/* prints the CPU time the manager used since the last call */
+static void
+report_usage (const gchar *phase)
+{
+  static gint64 last_cpu_usec = 0;
+  gint64        cpu_usec, rss_kb, peak_rss_kb;
+
+  if (!xfsm_test_session_get_usage (session, &cpu_usec, &rss_kb, &peak_rss_kb))
+    return;
+
+  g_print ("%-40s %8" G_GINT64_FORMAT " usec CPU  %8" G_GINT64_FORMAT " kB RSS  %8"
+           G_GINT64_FORMAT " kB peak\n", phase, cpu_usec - last_cpu_usec, rss_kb, peak_rss_kb);
+
+  last_cpu_usec = cpu_usec;
+}
+
+
+int
+main (int argc, char **argv)
+{
+  BenchClient    *clients;
+  XfsmTestClient *client;
+  gint            n;
+
+  xfsm_test_init (&argc, &argv, option_entries);
+
+  /* clients are asked to save on logout */
+  session = xfsm_test_session_start ("[/general]\nAutoSave=true\n");
+  if (session == NULL)
+    {
+      g_print ("skipped, the session manager can't be run here\n");
+      return EXIT_SUCCESS;
+    }
+
+  register_bench = xfsm_bench_new ("register");
+  checkpoint_bench = xfsm_bench_new ("checkpoint");
+  churn_bench = xfsm_bench_new ("register and disconnect");
+  die_bench = xfsm_bench_new ("logout to SmDie");
+
+  report_usage ("manager started");
+
+  clients = g_new0 (BenchClient, n_clients);
+  for (n = 0; n < n_clients; ++n)
+    {
+      clients[n].index = n;
+
+      xfsm_bench_start (register_bench);
+      clients[n].client = xfsm_test_client_new (session, NULL, &client_funcs, clients + n);
+      xfsm_bench_stop (register_bench);
+
+      if (clients[n].client == NULL)
+        g_error ("Client %d failed to register", n);
+
+      xfsm_test_client_set_properties (clients[n].client, "/usr/bin/xsmp-bench");
+    }
+
+  report_usage ("register");
+
+  for (n = 0; n < n_checkpoints; ++n)
+    {
+      n_saved = 0;
+      xfsm_bench_start (checkpoint_bench);
+
+      SmcRequestSaveYourself (xfsm_test_client_get_conn (clients[0].client),
+                              SmSaveLocal, False, SmInteractStyleNone, False, True);
+
+      if (!xfsm_test_session_wait_count (&n_saved, n_clients, PHASE_TIMEOUT))
+        g_error ("Only %u of %d clients completed checkpoint %d", n_saved, n_clients, n);
+
+      xfsm_bench_stop (checkpoint_bench);
+    }
+
+  report_usage ("checkpoint");
+
+  for (n = 0; n < n_churn; ++n)
+    {
+      xfsm_bench_start (churn_bench);
+      client = xfsm_test_client_new (session, NULL, NULL, NULL);
+      if (client == NULL)
+        g_error ("Churn client %d failed to register", n);
+      xfsm_test_client_free (client);
+      xfsm_bench_stop (churn_bench);
+    }
+
+  report_usage ("churn");
+
+  logout_start = g_get_monotonic_time ();
+  SmcRequestSaveYourself (xfsm_test_client_get_conn (clients[0].client),
+                          SmSaveBoth, True, SmInteractStyleAny, False, True);
+
+  if (!xfsm_test_session_wait_count (&n_died, n_clients, PHASE_TIMEOUT))
+    g_error ("Only %u of %d clients were told to die", n_died, n_clients);
+
+  report_usage ("logout");
+
+  if (!xfsm_test_session_wait (session, PHASE_TIMEOUT))
+    g_error ("The session manager did not exit after the logout");
+
+  g_print ("%-40s %8" G_GINT64_FORMAT " usec\n", "logout to manager exit",
+           g_get_monotonic_time () - logout_start);
+
+  xfsm_bench_report (register_bench);
+  xfsm_bench_report (checkpoint_bench);
+  xfsm_bench_report (churn_bench);
+  xfsm_bench_report (die_bench);
+
+  for (n = 0; n < n_clients; ++n)
+    xfsm_test_client_free (clients[n].client);
+  g_free (clients);
+
+  xfsm_bench_free (register_bench);
+  xfsm_bench_free (checkpoint_bench);
+  xfsm_bench_free (churn_bench);
+  xfsm_bench_free (die_bench);
+
+  xfsm_test_session_free (session);
+
+  return EXIT_SUCCESS;
+}
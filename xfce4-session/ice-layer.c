@@ -52,10 +52,18 @@
 #include <xfce4-session/xfsm-global.h>
 #include <xfce4-session/xfsm-manager.h>
 
+/* maximum number of messages handled per wakeup of a connection, so
+ * one chatty client can't starve the others */
+#define ICE_MESSAGE_BUDGET  32
+
+/* time a new connection may take to complete the ICE handshake */
+#define ICE_ACCEPT_TIMEOUT  20
+
 typedef struct
 {
   XfsmManager *manager;
   IceConn ice_conn;
+  guint accept_timeout_id;
 } XfsmIceConnData;
 
 
@@ -67,6 +75,8 @@ static gboolean ice_process_messages  (GIOChannel  *channel,
 static gboolean ice_connection_accept (GIOChannel  *channel,
                                        GIOCondition condition,
                                        gpointer     watch_data);
+static gboolean ice_connection_accept_timeout (gpointer user_data);
+static gboolean ice_connection_accepted       (XfsmIceConnData *icdata);
 static FILE *ice_tmpfile              (char **name);
 static void ice_auth_add              (FILE *,
                                        FILE *,
@@ -100,6 +110,18 @@ ice_error_handler (IceConn ice_conn)
 }
 
 
+static void
+ice_conn_data_free (gpointer data)
+{
+  XfsmIceConnData *icdata = data;
+
+  if (icdata->accept_timeout_id != 0)
+    g_source_remove (icdata->accept_timeout_id);
+
+  g_free (icdata);
+}
+
+
 static gboolean
 ice_process_messages (GIOChannel  *channel,
                       GIOCondition condition,
@@ -107,16 +129,58 @@ ice_process_messages (GIOChannel  *channel,
 {
   IceProcessMessagesStatus status;
   XfsmIceConnData         *icdata = user_data;
+  GPollFD                  pfd;
+  guint                    n_handled = 0;
 
-  status = IceProcessMessages (icdata->ice_conn, NULL, NULL);
+  pfd.fd = IceConnectionNumber (icdata->ice_conn);
+  pfd.events = G_IO_IN;
 
-  if (status == IceProcessMessagesIOError)
+  /* handle everything the client has queued up in one go instead of
+   * one message per main loop iteration.  IceProcessMessages() blocks
+   * until a complete message has been read, so only go on while
+   * there is more input waiting on the socket. */
+  while (n_handled < ICE_MESSAGE_BUDGET)
     {
-      xfsm_manager_close_connection_by_ice_conn (icdata->manager,
-                                                 icdata->ice_conn);
+      status = IceProcessMessages (icdata->ice_conn, NULL, NULL);
 
-      /* remove the I/O watch */
-      return FALSE;
+      if (status == IceProcessMessagesIOError)
+        {
+          if (icdata->accept_timeout_id != 0)
+            {
+              g_warning ("I/O error opening ICE connection %p",
+                         (gpointer) icdata->ice_conn);
+              IceSetShutdownNegotiation (icdata->ice_conn, False);
+              IceCloseConnection (icdata->ice_conn);
+            }
+          else
+            {
+              xfsm_manager_close_connection_by_ice_conn (icdata->manager,
+                                                         icdata->ice_conn);
+            }
+
+          /* remove the I/O watch */
+          return FALSE;
+        }
+      else if (status == IceProcessMessagesConnectionClosed)
+        {
+          /* the connection is gone, and with it the I/O watch */
+          return FALSE;
+        }
+
+      n_handled++;
+
+      if (icdata->accept_timeout_id != 0 && !ice_connection_accepted (icdata))
+        return FALSE;
+
+      pfd.revents = 0;
+      if (g_poll (&pfd, 1, 0) <= 0 || (pfd.revents & G_IO_IN) == 0)
+        break;
+    }
+
+  if (n_handled > 1)
+    {
+      xfsm_verbose ("ICE connection fd = %d, %u messages in one wakeup\n",
+                    pfd.fd, n_handled);
     }
 
   /* keep the I/O watch running */
@@ -138,10 +202,19 @@ ice_connection_watch (IceConn     ice_conn,
 
   if (opening)
     {
-      XfsmIceConnData *icdata = g_new(XfsmIceConnData, 1);
+      XfsmIceConnData *icdata = g_new0 (XfsmIceConnData, 1);
       icdata->manager = manager;
       icdata->ice_conn = ice_conn;
 
+      /* the handshake of a newly accepted connection is done by the
+       * regular message watch, see ice_connection_accepted() */
+      if (IceConnectionStatus (ice_conn) == IceConnectPending)
+        {
+          icdata->accept_timeout_id = g_timeout_add_seconds (ICE_ACCEPT_TIMEOUT,
+                                                             ice_connection_accept_timeout,
+                                                             icdata);
+        }
+
       fd = IceConnectionNumber (ice_conn);
 
       /* Make sure we don't pass on these file descriptors to an
@@ -157,7 +230,7 @@ ice_connection_watch (IceConn     ice_conn,
       watchid = g_io_add_watch_full (channel, G_PRIORITY_DEFAULT,
                                      G_IO_ERR | G_IO_HUP | G_IO_IN,
                                      ice_process_messages,
-                                     icdata, (GDestroyNotify) g_free);
+                                     icdata, ice_conn_data_free);
       g_io_channel_unref (channel);
 
       *watch_data = (IcePointer) GUINT_TO_POINTER (watchid);
@@ -170,47 +243,77 @@ ice_connection_watch (IceConn     ice_conn,
 }
 
 
+/* checks whether a new connection left the pending state after a
+ * message has been processed.  Returns FALSE if the connection was
+ * rejected and has been closed. */
+static gboolean
+ice_connection_accepted (XfsmIceConnData *icdata)
+{
+  IceConnectStatus cstatus;
+
+  cstatus = IceConnectionStatus (icdata->ice_conn);
+  if (cstatus == IceConnectPending)
+    return TRUE;
+
+  g_source_remove (icdata->accept_timeout_id);
+  icdata->accept_timeout_id = 0;
+
+  if (cstatus == IceConnectAccepted)
+    return TRUE;
+
+  if (cstatus == IceConnectIOError)
+    {
+      g_warning ("I/O error opening ICE connection %p",
+                 (gpointer) icdata->ice_conn);
+    }
+  else
+    {
+      g_warning ("ICE connection %p rejected", (gpointer) icdata->ice_conn);
+    }
+
+  IceSetShutdownNegotiation (icdata->ice_conn, False);
+  IceCloseConnection (icdata->ice_conn);
+
+  return FALSE;
+}
+
+
+static gboolean
+ice_connection_accept_timeout (gpointer user_data)
+{
+  XfsmIceConnData *icdata = user_data;
+
+  icdata->accept_timeout_id = 0;
+
+  g_warning ("ICE connection %p did not complete the handshake within "
+             "%d seconds, closing it", (gpointer) icdata->ice_conn,
+             ICE_ACCEPT_TIMEOUT);
+
+  /* this also removes the I/O watch and frees icdata */
+  IceSetShutdownNegotiation (icdata->ice_conn, False);
+  IceCloseConnection (icdata->ice_conn);
+
+  return FALSE;
+}
+
+
 static gboolean
 ice_connection_accept (GIOChannel  *channel,
                        GIOCondition condition,
                        gpointer     watch_data)
 {
-  IceConnectStatus cstatus;
   IceAcceptStatus  astatus;
   IceListenObj     ice_listener = (IceListenObj) watch_data;
-  IceConn          ice_conn;
 
-  ice_conn = IceAcceptConnection (ice_listener, &astatus);
+  /* the handshake is not waited for here, the connection watch takes
+   * over from here on, so a slow client can't stall the manager */
+  IceAcceptConnection (ice_listener, &astatus);
 
   if (astatus != IceAcceptSuccess)
     {
       g_warning ("Failed to accept ICE connection on listener %p",
                  (gpointer) ice_listener);
     }
-  else
-    {
-      /* Wait for the connection to leave pending state */
-      do
-        {
-          IceProcessMessages (ice_conn, NULL, NULL);
-        }
-      while ((cstatus = IceConnectionStatus (ice_conn)) == IceConnectPending);
-
-      if (cstatus != IceConnectAccepted)
-        {
-          if (cstatus == IceConnectIOError)
-            {
-              g_warning ("I/O error opening ICE connection %p", (gpointer) ice_conn);
-            }
-          else
-            {
-              g_warning ("ICE connection %p rejected", (gpointer) ice_conn);
-            }
-
-          IceSetShutdownNegotiation (ice_conn, False);
-          IceCloseConnection (ice_conn);
-        }
-    }
 
   return TRUE;
 }
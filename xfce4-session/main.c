@@ -42,6 +42,12 @@
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
@@ -63,21 +69,33 @@
 #include <xfce4-session/sm-layer.h>
 #include <xfce4-session/xfsm-dns.h>
 #include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-latency.h>
+#include <xfce4-session/xfsm-logout-dialog.h>
 #include <xfce4-session/xfsm-manager.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <xfce4-session/xfsm-shutdown.h>
 #include <xfce4-session/xfsm-startup.h>
+#include <xfce4-session/xfsm-trace.h>
+#include <xfce4-session/xfsm-wnck.h>
 #include <xfce4-session/xfsm-error.h>
 
 static gboolean opt_disable_tcp = FALSE;
 static gboolean opt_version = FALSE;
+static gboolean opt_headless = FALSE;
+static gchar   *opt_settings = NULL;
 
 static GOptionEntry option_entries[] =
 {
   { "disable-tcp", '\0', 0, G_OPTION_ARG_NONE, &opt_disable_tcp, N_("Disable binding to TCP ports"), NULL },
+  { "headless", '\0', 0, G_OPTION_ARG_NONE, &opt_headless, N_("Run without a display, for testing"), NULL },
+  { "settings", '\0', 0, G_OPTION_ARG_FILENAME, &opt_settings, N_("Read the settings from FILE instead of Xfconf"), N_("FILE") },
   { "version", 'V', 0, G_OPTION_ARG_NONE, &opt_version, N_("Print version information and exit"), NULL },
   { NULL }
 };
 
+/* the private bus daemon of headless mode */
+static GPid private_bus_pid = 0;
+
 static void
 setup_environment (void)
 {
@@ -99,7 +117,8 @@ setup_environment (void)
     xfsm_enable_verbose ();
 
   /* pass correct DISPLAY to children, in case of --display in argv */
-  g_setenv ("DISPLAY", gdk_display_get_name (gdk_display_get_default ()), TRUE);
+  if (!xfsm_headless)
+    g_setenv ("DISPLAY", gdk_display_get_name (gdk_display_get_default ()), TRUE);
 
   /* this is for compatibility with the GNOME Display Manager */
   lang = g_getenv ("GDM_LANG");
@@ -126,14 +145,14 @@ setup_environment (void)
 }
 
 static void
-init_display (XfsmManager   *manager,
-              GdkDisplay    *dpy,
-              XfconfChannel *channel,
-              gboolean       disable_tcp)
+init_display (XfsmManager  *manager,
+              GdkDisplay   *dpy,
+              XfsmSettings *settings,
+              gboolean      disable_tcp)
 {
   gchar *engine;
 
-  engine = xfconf_channel_get_string (channel, "/splash/Engine", "mice");
+  engine = xfsm_settings_get_string (settings, "/splash/Engine", "mice");
 
   splash_screen = xfsm_splash_screen_new (dpy, engine);
   g_free (engine);
@@ -141,7 +160,7 @@ init_display (XfsmManager   *manager,
 
   gdk_flush ();
 
-  sm_init (channel, disable_tcp, manager);
+  sm_init (settings, disable_tcp, manager);
 
   /* gtk resource files may have changed */
   gtk_rc_reparse_all ();
@@ -232,18 +251,117 @@ xfsm_dbus_require_session (gint argc, gchar **argv)
   return FALSE;
 }
 
+static gboolean
+xfsm_dbus_start_private_bus (void)
+{
+  gchar      *argv[] = { "dbus-daemon", "--session", "--nofork", "--print-address=1", NULL };
+  GIOChannel *channel;
+  GError     *error = NULL;
+  gchar      *address = NULL;
+  gint        out_fd;
+
+  if (!g_spawn_async_with_pipes (NULL, argv, NULL,
+                                 G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
+                                 NULL, NULL, &private_bus_pid,
+                                 NULL, &out_fd, NULL, &error))
+    {
+      g_printerr ("%s: Unable to start a private D-Bus daemon: %s\n",
+                  PACKAGE_NAME, error->message);
+      g_error_free (error);
+      return FALSE;
+    }
+
+  /* the daemon prints its address once it accepts connections */
+  channel = g_io_channel_unix_new (out_fd);
+  g_io_channel_set_close_on_unref (channel, TRUE);
+  g_io_channel_read_line (channel, &address, NULL, NULL, NULL);
+  g_io_channel_unref (channel);
+
+  if (address == NULL || *g_strstrip (address) == '\0')
+    {
+      g_printerr ("%s: The private D-Bus daemon did not report its address\n",
+                  PACKAGE_NAME);
+      g_free (address);
+      return FALSE;
+    }
+
+  g_setenv ("DBUS_SESSION_BUS_ADDRESS", address, TRUE);
+  g_free (address);
+
+  return TRUE;
+}
+
+static void
+xfsm_dbus_stop_private_bus (void)
+{
+  if (private_bus_pid <= 0)
+    return;
+
+  kill (private_bus_pid, SIGTERM);
+  while (waitpid (private_bus_pid, NULL, 0) < 0 && errno == EINTR)
+    ;
+  g_spawn_close_pid (private_bus_pid);
+  private_bus_pid = 0;
+}
+
+/* --headless has to be known before the options are parsed, to not
+ * re-execute through dbus-launch and to not open the display */
+static gboolean
+xfsm_args_headless (gint    argc,
+                    gchar **argv)
+{
+  gint i;
+
+  for (i = 1; i < argc; ++i)
+    if (strcmp (argv[i], "--headless") == 0)
+      return TRUE;
+
+  return FALSE;
+}
+
+static gboolean
+xfsm_parse_args (gint     *argc,
+                 gchar  ***argv,
+                 GError  **error)
+{
+  GOptionContext *context;
+  gboolean        succeed;
+
+  if (!xfsm_headless)
+    return gtk_init_with_args (argc, argv, "", option_entries, GETTEXT_PACKAGE, error);
+
+  /* same as above, but without opening the display */
+#if !GLIB_CHECK_VERSION (2, 36, 0)
+  g_type_init ();
+#endif
+
+  context = g_option_context_new ("");
+  g_option_context_add_main_entries (context, option_entries, GETTEXT_PACKAGE);
+  succeed = g_option_context_parse (context, argc, argv, error);
+  g_option_context_free (context);
+
+  return succeed;
+}
+
 int
 main (int argc, char **argv)
 {
   XfsmManager      *manager;
   GError           *error = NULL;
   GdkDisplay       *dpy;
-  XfconfChannel    *channel;
+  XfsmSettings     *settings;
   XfsmShutdownType  shutdown_type;
   XfsmShutdown     *shutdown_helper;
   gboolean          succeed = TRUE;
 
-  if (!xfsm_dbus_require_session (argc, argv))
+  xfsm_headless = xfsm_args_headless (argc, argv);
+  if (xfsm_headless)
+    {
+      /* never touch the services of the user's session */
+      if (!xfsm_dbus_start_private_bus ())
+        return EXIT_FAILURE;
+    }
+  else if (!xfsm_dbus_require_session (argc, argv))
     return EXIT_SUCCESS;
 
   xfce_textdomain (GETTEXT_PACKAGE, PACKAGE_LOCALE_DIR, "UTF-8");
@@ -251,12 +369,13 @@ main (int argc, char **argv)
   /* install required signal handlers */
   signal (SIGPIPE, SIG_IGN);
 
-  if (!gtk_init_with_args (&argc, &argv, "", option_entries, GETTEXT_PACKAGE, &error))
+  if (!xfsm_parse_args (&argc, &argv, &error))
     {
       g_print ("%s: %s.\n", G_LOG_DOMAIN, error->message);
       g_print (_("Type '%s --help' for usage."), G_LOG_DOMAIN);
       g_print ("\n");
       g_error_free (error);
+      xfsm_dbus_stop_private_bus ();
       return EXIT_FAILURE;
     }
 
@@ -268,45 +387,85 @@ main (int argc, char **argv)
       g_print (_("Please report bugs to <%s>."), PACKAGE_BUGREPORT);
       g_print ("\n");
 
+      xfsm_dbus_stop_private_bus ();
       return EXIT_SUCCESS;
     }
 
-  if (!xfconf_init (&error))
+  if (xfsm_headless)
     {
-      xfce_dialog_show_error (NULL, error, _("Unable to contact settings server"));
-      g_error_free (error);
+      /* nothing to ask libwnck without a display */
+      xfsm_wnck_set_backend (xfsm_wnck_get_stub_backend ());
     }
 
-  /* fake a client id for the manager, so the legacy management does not
-   * recognize us to be a session client.
-   */
-  gdk_set_sm_client_id (xfsm_generate_client_id (NULL));
+  /* settings from a key file replace the xfconf channel, a headless
+   * session without one runs with the defaults */
+  if (opt_settings != NULL || xfsm_headless)
+    {
+      if (!xfsm_settings_use_keyfile (opt_settings, &error))
+        {
+          g_printerr ("%s: Unable to load settings from %s: %s\n",
+                      PACKAGE_NAME, opt_settings, error->message);
+          g_error_free (error);
+          xfsm_dbus_stop_private_bus ();
+          return EXIT_FAILURE;
+        }
+    }
+
+  /* start recording the startup timeline */
+  xfsm_trace_init ();
+
+  /* client latencies learned in previous sessions */
+  xfsm_latency_init ();
+
+  if (!xfsm_headless)
+    {
+      if (!xfconf_init (&error))
+        {
+          xfce_dialog_show_error (NULL, error, _("Unable to contact settings server"));
+          g_error_free (error);
+        }
+
+      /* fake a client id for the manager, so the legacy management does not
+       * recognize us to be a session client.
+       */
+      gdk_set_sm_client_id (xfsm_generate_client_id (NULL));
+    }
 
   xfsm_dbus_init ();
 
   manager = xfsm_manager_new ();
   setup_environment ();
 
-  channel = xfsm_open_config ();
+  settings = xfsm_settings_get ();
 
-  dpy = gdk_display_get_default ();
-  init_display (manager, dpy, channel, opt_disable_tcp);
+  if (G_LIKELY (!xfsm_headless))
+    {
+      dpy = gdk_display_get_default ();
+      init_display (manager, dpy, settings, opt_disable_tcp);
+
+      if (!opt_disable_tcp && xfsm_settings_get_bool (settings, "/security/EnableTcp", FALSE))
+        {
+          /* verify that the DNS settings are ok */
+          xfsm_splash_screen_next (splash_screen, _("Verifying DNS settings"));
+          xfsm_dns_check ();
+        }
 
-  if (!opt_disable_tcp && xfconf_channel_get_bool (channel, "/security/EnableTcp", FALSE))
+      xfsm_splash_screen_next (splash_screen, _("Loading session data"));
+    }
+  else
     {
-      /* verify that the DNS settings are ok */
-      xfsm_splash_screen_next (splash_screen, _("Verifying DNS settings"));
-      xfsm_dns_check ();
+      /* no splash screen and no gtk resources to reload */
+      sm_init (settings, opt_disable_tcp, manager);
     }
 
-  xfsm_splash_screen_next (splash_screen, _("Loading session data"));
-
-  xfsm_startup_init (channel);
-  xfsm_manager_load (manager, channel);
+  xfsm_startup_init (settings);
+  xfsm_manager_load (manager, settings);
   xfsm_manager_restart (manager);
 
   gtk_main ();
 
+  xfsm_logout_dialog_screenshot_flush ();
+  xfsm_latency_flush ();
   xfsm_startup_shutdown ();
 
   shutdown_type = xfsm_manager_get_shutdown_type (manager);
@@ -315,13 +474,14 @@ main (int argc, char **argv)
   shutdown_helper = xfsm_shutdown_get ();
 
   g_object_unref (manager);
-  g_object_unref (channel);
 
   xfsm_dbus_cleanup ();
   ice_cleanup ();
 
-  if (shutdown_type == XFSM_SHUTDOWN_SHUTDOWN
-      || shutdown_type == XFSM_SHUTDOWN_RESTART)
+  /* a headless session only ends the session manager */
+  if (!xfsm_headless
+      && (shutdown_type == XFSM_SHUTDOWN_SHUTDOWN
+          || shutdown_type == XFSM_SHUTDOWN_RESTART))
     {
       succeed = xfsm_shutdown_try_type (shutdown_helper, shutdown_type, &error);
       if (!succeed)
@@ -330,5 +490,7 @@ main (int argc, char **argv)
 
   g_object_unref (shutdown_helper);
 
+  xfsm_dbus_stop_private_bus ();
+
   return succeed ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -102,14 +102,14 @@ static IceListenObj *listen_objs;
 
 
 void
-sm_init (XfconfChannel *channel,
-         gboolean       disable_tcp,
-         XfsmManager   *manager)
+sm_init (XfsmSettings *settings,
+         gboolean      disable_tcp,
+         XfsmManager  *manager)
 {
   char *network_idlist;
   char  error[2048];
 
-  if (disable_tcp || !xfconf_channel_get_bool (channel, "/security/EnableTcp", FALSE))
+  if (disable_tcp || !xfsm_settings_get_bool (settings, "/security/EnableTcp", FALSE))
     {
 #ifdef HAVE__ICETRANSNOLISTEN
       _IceTransNoListen ("tcp");
@@ -413,19 +413,13 @@ sm_get_properties (SmsConn   sms_conn,
 {
   XfsmClient     *client     = (XfsmClient *) client_data;
   XfsmProperties *properties = xfsm_client_get_properties (client);
-  SmProp        **props      = NULL;
+  SmProp        **props;
   gint            num_props  = 0;
 
   xfsm_verbose ("Client Id = %s, received GET PROPERTIES\n\n", properties->client_id);
 
-  xfsm_properties_extract (properties, &num_props, &props);
+  /* owned by the properties */
+  props = xfsm_properties_get_sm_props (properties, &num_props);
 
   SmsReturnProperties (sms_conn, num_props, props);
-
-  if (num_props > 0)
-    {
-      while (num_props-- > 0)
-        SmFreeProperty (props[num_props]);
-      free (props);
-    }
 }
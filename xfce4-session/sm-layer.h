@@ -22,13 +22,13 @@
 #ifndef __SM_LAYER_H__
 #define __SM_LAYER_H__
 
-#include <xfconf/xfconf.h>
 #include <libxfce4util/libxfce4util.h>
 
 #include <xfce4-session/xfsm-manager.h>
+#include <xfce4-session/xfsm-settings.h>
 
-void sm_init (XfconfChannel *channel,
-              gboolean       disable_tcp,
-              XfsmManager   *manager);
+void sm_init (XfsmSettings *settings,
+              gboolean      disable_tcp,
+              XfsmManager  *manager);
 
 #endif /* !__SM_LAYER_H__ */
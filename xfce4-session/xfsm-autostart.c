@@ -0,0 +1,725 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Index of the XDG autostart directories. Parsing every desktop file and
+ * walking $PATH for every TryExec is slow on network home directories,
+ * so the parsed items are kept in sessions/autostart-index.rc in the
+ * cache directory:
+ *
+ *   - the file list is reused as long as the mtimes of the autostart
+ *     directories did not change,
+ *   - an item is reused as long as the inode, size and mtime of all
+ *     its desktop files did not change,
+ *   - a TryExec result is reused as long as $PATH and the mtimes of
+ *     its directories did not change.
+ *
+ * The index is validated and updated in a worker thread, started early
+ * in xfsm_startup_init(), while the session is being restored.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <gio/gio.h>
+#include <glib/gstdio.h>
+#include <libxfce4util/libxfce4util.h>
+
+#include <xfce4-session/xfsm-autostart.h>
+#include <xfce4-session/xfsm-global.h>
+
+
+#define INDEX_VERSION 2
+
+
+typedef struct
+{
+  gchar    **dirs;       /* autostart directories, highest priority first */
+  gchar     *path;       /* $PATH */
+  gchar    **path_dirs;
+  gchar     *cache_file;
+  GPtrArray *items;
+} XfsmAutostartScan;
+
+typedef struct
+{
+  XfsmAutostartFunc func;
+  gpointer          user_data;
+} XfsmAutostartWaiter;
+
+
+static GPtrArray *autostart_items = NULL;
+static GSList    *autostart_waiters = NULL;
+static gboolean   autostart_scanning = FALSE;
+
+
+static void
+xfsm_autostart_item_free (XfsmAutostartItem *item)
+{
+  g_free (item->name);
+  g_free (item->path);
+  g_free (item->exec);
+  g_free (item->try_exec);
+  g_strfreev (item->after);
+  g_slice_free (XfsmAutostartItem, item);
+}
+
+
+static gint
+xfsm_autostart_compare_names (gconstpointer a,
+                              gconstpointer b)
+{
+  return strcmp (*(gchar * const *) a, *(gchar * const *) b);
+}
+
+
+/* stamp of a file or directory, NULL if it changed too recently to tell
+ * a later change in the same second apart */
+static gchar *
+xfsm_autostart_stamp (const gchar *filename,
+                      time_t       now)
+{
+  GStatBuf sb;
+
+  if (g_stat (filename, &sb) != 0)
+    return g_strdup ("-");
+
+  if (sb.st_mtime >= now - 1)
+    return NULL;
+
+  return g_strdup_printf ("%lu:%lu:%ld",
+                          (gulong) sb.st_ino,
+                          (gulong) sb.st_size,
+                          (glong) sb.st_mtime);
+}
+
+
+/* joined stamps of all @filenames, NULL if one of them is too fresh */
+static gchar *
+xfsm_autostart_stamps (gchar  **filenames,
+                       time_t   now)
+{
+  GString *stamps;
+  gchar   *stamp;
+  guint    n;
+
+  stamps = g_string_new (NULL);
+  for (n = 0; filenames[n] != NULL; ++n)
+    {
+      stamp = xfsm_autostart_stamp (filenames[n], now);
+      if (stamp == NULL)
+        {
+          g_string_free (stamps, TRUE);
+          return NULL;
+        }
+
+      if (n > 0)
+        g_string_append_c (stamps, ';');
+      g_string_append (stamps, stamp);
+      g_free (stamp);
+    }
+
+  return g_string_free (stamps, FALSE);
+}
+
+
+/* whether @try_exec is an executable, like g_find_program_in_path()
+ * but searching the @path_dirs captured in the main thread */
+static gboolean
+xfsm_autostart_check_try_exec (const gchar *try_exec,
+                               gchar      **path_dirs)
+{
+  gboolean result = FALSE;
+  gchar   *program;
+  gchar   *filename;
+  gchar   *p;
+  guint    n;
+
+  if (*try_exec == '/')
+    return access (try_exec, X_OK) == 0;
+
+  program = g_strdup (try_exec);
+  p = strchr (program, ' ');
+  if (G_UNLIKELY (p != NULL))
+    *p = '\0';
+
+  if (strchr (program, G_DIR_SEPARATOR) != NULL)
+    {
+      result = access (program, X_OK) == 0;
+    }
+  else
+    {
+      for (n = 0; !result && path_dirs[n] != NULL; ++n)
+        {
+          filename = g_build_filename (*path_dirs[n] != '\0' ? path_dirs[n] : ".",
+                                       program, NULL);
+          result = g_file_test (filename, G_FILE_TEST_IS_EXECUTABLE)
+                   && !g_file_test (filename, G_FILE_TEST_IS_DIR)
+                   && access (filename, X_OK) == 0;
+          g_free (filename);
+        }
+    }
+
+  g_free (program);
+
+  return result;
+}
+
+
+/* the first of @rcs that has @key, like xfce_rc_config_open() merges
+ * the config dirs */
+static XfceRc *
+xfsm_autostart_lookup (GPtrArray   *rcs,
+                       const gchar *key)
+{
+  guint n;
+
+  for (n = 0; n < rcs->len; ++n)
+    if (xfce_rc_has_entry (g_ptr_array_index (rcs, n), key))
+      return g_ptr_array_index (rcs, n);
+
+  return NULL;
+}
+
+
+static gboolean
+xfsm_autostart_read_bool (GPtrArray   *rcs,
+                          const gchar *key,
+                          gboolean     fallback)
+{
+  XfceRc *rc = xfsm_autostart_lookup (rcs, key);
+  return rc != NULL ? xfce_rc_read_bool_entry (rc, key, fallback) : fallback;
+}
+
+
+static const gchar *
+xfsm_autostart_read_entry (GPtrArray   *rcs,
+                           const gchar *key)
+{
+  XfceRc *rc = xfsm_autostart_lookup (rcs, key);
+  return rc != NULL ? xfce_rc_read_entry (rc, key, NULL) : NULL;
+}
+
+
+static gchar **
+xfsm_autostart_read_list (GPtrArray   *rcs,
+                          const gchar *key)
+{
+  XfceRc *rc = xfsm_autostart_lookup (rcs, key);
+  return rc != NULL ? xfce_rc_read_list_entry (rc, key, ";") : NULL;
+}
+
+
+static gboolean
+xfsm_autostart_list_has_xfce (GPtrArray   *rcs,
+                              const gchar *key,
+                              gboolean    *has_xfce)
+{
+  XfceRc  *rc = xfsm_autostart_lookup (rcs, key);
+  gchar  **list;
+  guint    n;
+
+  if (rc == NULL)
+    return FALSE;
+
+  list = xfce_rc_read_list_entry (rc, key, ";");
+  if (list == NULL)
+    return FALSE;
+
+  for (n = 0, *has_xfce = FALSE; list[n] != NULL; ++n)
+    if (g_ascii_strcasecmp (list[n], "XFCE") == 0)
+      *has_xfce = TRUE;
+
+  g_strfreev (list);
+
+  return TRUE;
+}
+
+
+static XfsmAutostartItem *
+xfsm_autostart_parse (gchar      **filenames,
+                      const gchar *name)
+{
+  XfsmAutostartItem *item = NULL;
+  GPtrArray         *rcs;
+  const gchar       *type;
+  gboolean           has_xfce;
+  XfceRc            *rc;
+  guint              n;
+
+  rcs = g_ptr_array_new ();
+  for (n = 0; filenames[n] != NULL; ++n)
+    {
+      if (!g_file_test (filenames[n], G_FILE_TEST_IS_REGULAR))
+        continue;
+
+      rc = xfce_rc_simple_open (filenames[n], TRUE);
+      if (G_UNLIKELY (rc == NULL))
+        continue;
+
+      xfce_rc_set_group (rc, "Desktop Entry");
+      g_ptr_array_add (rcs, rc);
+
+      if (rcs->len == 1)
+        {
+          item = g_slice_new0 (XfsmAutostartItem);
+          item->name = g_strdup (name);
+          item->path = g_strdup (filenames[n]);
+        }
+    }
+
+  if (rcs->len == 0)
+    {
+      g_ptr_array_free (rcs, TRUE);
+      return NULL;
+    }
+
+  item->hidden = xfsm_autostart_read_bool (rcs, "Hidden", FALSE);
+
+  item->show_in_xfce = TRUE;
+  if (!xfsm_autostart_read_bool (rcs, "X-XFCE-Autostart-Override", FALSE)
+      && xfsm_autostart_list_has_xfce (rcs, "OnlyShowIn", &has_xfce))
+    item->show_in_xfce = has_xfce;
+  if (xfsm_autostart_list_has_xfce (rcs, "NotShowIn", &has_xfce) && has_xfce)
+    item->show_in_xfce = FALSE;
+
+  type = xfsm_autostart_read_entry (rcs, "Type");
+  item->application = type == NULL || g_ascii_strcasecmp (type, "Application") == 0;
+
+  item->exec = g_strdup (xfsm_autostart_read_entry (rcs, "Exec"));
+  item->try_exec = g_strdup (xfsm_autostart_read_entry (rcs, "TryExec"));
+  item->after = xfsm_autostart_read_list (rcs, "X-XFCE-After");
+  item->terminal = xfsm_autostart_read_bool (rcs, "Terminal", FALSE);
+  item->startup_notify = xfsm_autostart_read_bool (rcs, "StartupNotify", FALSE);
+
+  g_ptr_array_foreach (rcs, (GFunc) xfce_rc_close, NULL);
+  g_ptr_array_free (rcs, TRUE);
+
+  return item;
+}
+
+
+static XfsmAutostartItem *
+xfsm_autostart_load_cached (XfceRc      *cache,
+                            const gchar *name)
+{
+  XfsmAutostartItem *item;
+
+  item = g_slice_new0 (XfsmAutostartItem);
+  item->name = g_strdup (name);
+  item->path = g_strdup (xfce_rc_read_entry (cache, "Path", NULL));
+  item->exec = g_strdup (xfce_rc_read_entry (cache, "Exec", NULL));
+  item->try_exec = g_strdup (xfce_rc_read_entry (cache, "TryExec", NULL));
+  item->after = xfce_rc_read_list_entry (cache, "After", ";");
+  item->hidden = xfce_rc_read_bool_entry (cache, "Hidden", FALSE);
+  item->show_in_xfce = xfce_rc_read_bool_entry (cache, "ShowInXfce", TRUE);
+  item->application = xfce_rc_read_bool_entry (cache, "Application", TRUE);
+  item->try_exec_valid = xfce_rc_read_bool_entry (cache, "TryExecValid", TRUE);
+  item->terminal = xfce_rc_read_bool_entry (cache, "Terminal", FALSE);
+  item->startup_notify = xfce_rc_read_bool_entry (cache, "StartupNotify", FALSE);
+
+  return item;
+}
+
+
+static void
+xfsm_autostart_store_cached (XfceRc            *cache,
+                             XfsmAutostartItem *item,
+                             const gchar       *stamp)
+{
+  xfce_rc_set_group (cache, item->name);
+  xfce_rc_write_entry (cache, "Stamp", stamp);
+  xfce_rc_write_entry (cache, "Path", item->path);
+  if (item->exec != NULL)
+    xfce_rc_write_entry (cache, "Exec", item->exec);
+  if (item->try_exec != NULL)
+    xfce_rc_write_entry (cache, "TryExec", item->try_exec);
+  if (item->after != NULL)
+    xfce_rc_write_list_entry (cache, "After", item->after, ";");
+  xfce_rc_write_bool_entry (cache, "Hidden", item->hidden);
+  xfce_rc_write_bool_entry (cache, "ShowInXfce", item->show_in_xfce);
+  xfce_rc_write_bool_entry (cache, "Application", item->application);
+  xfce_rc_write_bool_entry (cache, "TryExecValid", item->try_exec_valid);
+  xfce_rc_write_bool_entry (cache, "Terminal", item->terminal);
+  xfce_rc_write_bool_entry (cache, "StartupNotify", item->startup_notify);
+}
+
+
+/* names of the desktop files in all autostart directories */
+static gchar **
+xfsm_autostart_read_dirs (gchar **dirs)
+{
+  GHashTable  *names;
+  GPtrArray   *result;
+  const gchar *name;
+  gchar       *copy;
+  GDir        *dp;
+  guint        n;
+
+  names = g_hash_table_new (g_str_hash, g_str_equal);
+  result = g_ptr_array_new ();
+
+  for (n = 0; dirs[n] != NULL; ++n)
+    {
+      dp = g_dir_open (dirs[n], 0, NULL);
+      if (dp == NULL)
+        continue;
+
+      while ((name = g_dir_read_name (dp)) != NULL)
+        {
+          if (g_str_has_suffix (name, ".desktop")
+              && g_hash_table_lookup (names, name) == NULL)
+            {
+              copy = g_strdup (name);
+              g_hash_table_insert (names, copy, copy);
+              g_ptr_array_add (result, copy);
+            }
+        }
+
+      g_dir_close (dp);
+    }
+
+  g_hash_table_destroy (names);
+
+  g_ptr_array_sort (result, xfsm_autostart_compare_names);
+  g_ptr_array_add (result, NULL);
+
+  return (gchar **) g_ptr_array_free (result, FALSE);
+}
+
+
+static gchar **
+xfsm_autostart_build_filenames (gchar      **dirs,
+                                const gchar *name)
+{
+  gchar **filenames;
+  guint   n;
+
+  filenames = g_new0 (gchar *, g_strv_length (dirs) + 1);
+  for (n = 0; dirs[n] != NULL; ++n)
+    filenames[n] = g_build_filename (dirs[n], name, NULL);
+
+  return filenames;
+}
+
+
+static void
+xfsm_autostart_scan_run (XfsmAutostartScan *scan,
+                         gboolean           write_cache)
+{
+  XfsmAutostartItem *item;
+  const gchar       *value;
+  gboolean           path_valid = FALSE;
+  XfceRc            *cache = NULL;
+  XfceRc            *out = NULL;
+  gchar            **names = NULL;
+  gchar            **filenames;
+  gchar             *dir_stamps;
+  gchar             *path_stamps;
+  gchar             *stamp;
+  gchar             *dirs;
+  gchar             *tmp_file;
+  time_t             now = time (NULL);
+  guint              n;
+
+  scan->items = g_ptr_array_new_with_free_func ((GDestroyNotify) xfsm_autostart_item_free);
+
+  dirs = g_strjoinv (";", scan->dirs);
+  dir_stamps = xfsm_autostart_stamps (scan->dirs, now);
+  path_stamps = xfsm_autostart_stamps (scan->path_dirs, now);
+
+  if (scan->cache_file != NULL && g_file_test (scan->cache_file, G_FILE_TEST_IS_REGULAR))
+    {
+      cache = xfce_rc_simple_open (scan->cache_file, TRUE);
+      if (cache != NULL)
+        {
+          xfce_rc_set_group (cache, "Index");
+          if (xfce_rc_read_int_entry (cache, "Version", 0) != INDEX_VERSION
+              || g_strcmp0 (xfce_rc_read_entry (cache, "Directories", NULL), dirs) != 0)
+            {
+              xfce_rc_close (cache);
+              cache = NULL;
+            }
+        }
+    }
+
+  if (cache != NULL)
+    {
+      /* nothing was added or removed */
+      value = xfce_rc_read_entry (cache, "DirectoryStamps", NULL);
+      if (dir_stamps != NULL && g_strcmp0 (value, dir_stamps) == 0)
+        names = xfce_rc_read_list_entry (cache, "Files", ";");
+
+      /* no program was added or removed */
+      path_valid = path_stamps != NULL
+                   && g_strcmp0 (xfce_rc_read_entry (cache, "Path", NULL), scan->path) == 0
+                   && g_strcmp0 (xfce_rc_read_entry (cache, "PathStamps", NULL), path_stamps) == 0;
+    }
+
+  if (names == NULL)
+    names = xfsm_autostart_read_dirs (scan->dirs);
+
+  if (write_cache && scan->cache_file != NULL)
+    {
+      tmp_file = g_strconcat (scan->cache_file, ".tmp", NULL);
+      g_unlink (tmp_file);
+      out = xfce_rc_simple_open (tmp_file, FALSE);
+      if (out != NULL)
+        {
+          xfce_rc_set_group (out, "Index");
+          xfce_rc_write_int_entry (out, "Version", INDEX_VERSION);
+          xfce_rc_write_entry (out, "Directories", dirs);
+          xfce_rc_write_entry (out, "DirectoryStamps", dir_stamps != NULL ? dir_stamps : "");
+          xfce_rc_write_list_entry (out, "Files", names, ";");
+          xfce_rc_write_entry (out, "Path", scan->path);
+          xfce_rc_write_entry (out, "PathStamps", path_stamps != NULL ? path_stamps : "");
+        }
+    }
+  else
+    {
+      tmp_file = NULL;
+    }
+
+  for (n = 0; names[n] != NULL; ++n)
+    {
+      filenames = xfsm_autostart_build_filenames (scan->dirs, names[n]);
+      stamp = xfsm_autostart_stamps (filenames, now);
+
+      item = NULL;
+      if (cache != NULL && stamp != NULL && xfce_rc_has_group (cache, names[n]))
+        {
+          xfce_rc_set_group (cache, names[n]);
+          if (g_strcmp0 (xfce_rc_read_entry (cache, "Stamp", NULL), stamp) == 0)
+            {
+              item = xfsm_autostart_load_cached (cache, names[n]);
+
+              /* absolute TryExec are cheap to check, relative ones only
+               * if $PATH changed */
+              if (item->try_exec != NULL && (*item->try_exec == '/' || !path_valid))
+                item->try_exec_valid = xfsm_autostart_check_try_exec (item->try_exec, scan->path_dirs);
+            }
+        }
+
+      if (item == NULL)
+        {
+          xfsm_verbose ("Autostart: parsing %s\n", names[n]);
+
+          item = xfsm_autostart_parse (filenames, names[n]);
+          if (item != NULL)
+            {
+              item->try_exec_valid = item->try_exec == NULL
+                                     || xfsm_autostart_check_try_exec (item->try_exec,
+                                                                       scan->path_dirs);
+            }
+        }
+
+      if (item != NULL)
+        {
+          g_ptr_array_add (scan->items, item);
+
+          if (out != NULL && stamp != NULL)
+            xfsm_autostart_store_cached (out, item, stamp);
+        }
+
+      g_free (stamp);
+      g_strfreev (filenames);
+    }
+
+  if (cache != NULL)
+    xfce_rc_close (cache);
+
+  if (out != NULL)
+    {
+      xfce_rc_close (out);
+      if (g_rename (tmp_file, scan->cache_file) != 0)
+        g_unlink (tmp_file);
+    }
+
+  g_free (tmp_file);
+  g_strfreev (names);
+  g_free (dir_stamps);
+  g_free (path_stamps);
+  g_free (dirs);
+}
+
+
+static XfsmAutostartScan *
+xfsm_autostart_scan_new (void)
+{
+  XfsmAutostartScan *scan;
+  const gchar       *path;
+  gchar            **dirs;
+  guint              n;
+
+  scan = g_slice_new0 (XfsmAutostartScan);
+
+  dirs = xfce_resource_dirs (XFCE_RESOURCE_CONFIG);
+  scan->dirs = g_new0 (gchar *, g_strv_length (dirs) + 1);
+  for (n = 0; dirs[n] != NULL; ++n)
+    scan->dirs[n] = g_build_filename (dirs[n], "autostart", NULL);
+  g_strfreev (dirs);
+
+  /* same default as g_find_program_in_path() */
+  path = g_getenv ("PATH");
+  scan->path = g_strdup (path != NULL ? path : "/bin:/usr/bin:.");
+  scan->path_dirs = g_strsplit (scan->path, G_SEARCHPATH_SEPARATOR_S, -1);
+
+  scan->cache_file = xfce_resource_save_location (XFCE_RESOURCE_CACHE,
+                                                  "sessions/autostart-index.rc",
+                                                  TRUE);
+
+  return scan;
+}
+
+
+static void
+xfsm_autostart_scan_free (XfsmAutostartScan *scan)
+{
+  if (scan->items != NULL)
+    g_ptr_array_free (scan->items, TRUE);
+  g_strfreev (scan->dirs);
+  g_strfreev (scan->path_dirs);
+  g_free (scan->path);
+  g_free (scan->cache_file);
+  g_slice_free (XfsmAutostartScan, scan);
+}
+
+
+static void
+xfsm_autostart_scan_done (GObject      *source_object,
+                          GAsyncResult *result,
+                          gpointer      user_data)
+{
+  XfsmAutostartScan   *scan = user_data;
+  XfsmAutostartWaiter *waiter;
+  GSList              *waiters;
+  GSList              *lp;
+
+  autostart_scanning = FALSE;
+
+  /* xfsm_autostart_load_sync() may have been faster */
+  if (autostart_items == NULL)
+    {
+      autostart_items = scan->items;
+      scan->items = NULL;
+    }
+  xfsm_autostart_scan_free (scan);
+
+  xfsm_verbose ("Autostart: index of %u items ready\n", autostart_items->len);
+
+  waiters = g_slist_reverse (autostart_waiters);
+  autostart_waiters = NULL;
+  for (lp = waiters; lp != NULL; lp = lp->next)
+    {
+      waiter = lp->data;
+      waiter->func (autostart_items, waiter->user_data);
+      g_slice_free (XfsmAutostartWaiter, waiter);
+    }
+  g_slist_free (waiters);
+}
+
+
+/* runs in a worker thread */
+static void
+xfsm_autostart_scan_thread (GTask        *task,
+                            gpointer      source_object,
+                            gpointer      task_data,
+                            GCancellable *cancellable)
+{
+  xfsm_autostart_scan_run (task_data, TRUE);
+  g_task_return_boolean (task, TRUE);
+}
+
+
+/* validates and updates the autostart index in the background */
+void
+xfsm_autostart_scan (void)
+{
+  XfsmAutostartScan *scan;
+  GTask             *task;
+
+  if (autostart_scanning || autostart_items != NULL)
+    return;
+
+  autostart_scanning = TRUE;
+
+  scan = xfsm_autostart_scan_new ();
+  task = g_task_new (NULL, NULL, xfsm_autostart_scan_done, scan);
+  g_task_set_task_data (task, scan, NULL);
+  g_task_run_in_thread (task, xfsm_autostart_scan_thread);
+  g_object_unref (task);
+}
+
+
+/* calls @func with the autostart items once the index is ready, right
+ * away if it is */
+void
+xfsm_autostart_load (XfsmAutostartFunc func,
+                     gpointer          user_data)
+{
+  XfsmAutostartWaiter *waiter;
+
+  if (autostart_items != NULL)
+    {
+      func (autostart_items, user_data);
+      return;
+    }
+
+  waiter = g_slice_new (XfsmAutostartWaiter);
+  waiter->func = func;
+  waiter->user_data = user_data;
+  autostart_waiters = g_slist_prepend (autostart_waiters, waiter);
+
+  xfsm_autostart_scan ();
+}
+
+
+/* returns the autostart items, scanning in the main thread if the
+ * index is not ready yet */
+GPtrArray *
+xfsm_autostart_load_sync (void)
+{
+  XfsmAutostartScan *scan;
+
+  if (autostart_items == NULL)
+    {
+      scan = xfsm_autostart_scan_new ();
+      xfsm_autostart_scan_run (scan, FALSE);
+      autostart_items = scan->items;
+      scan->items = NULL;
+      xfsm_autostart_scan_free (scan);
+    }
+
+  return autostart_items;
+}
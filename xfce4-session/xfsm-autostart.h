@@ -0,0 +1,58 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_AUTOSTART_H__
+#define __XFSM_AUTOSTART_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+/* an autostart/<name> desktop file, merged over all XDG config dirs */
+typedef struct _XfsmAutostartItem XfsmAutostartItem;
+
+struct _XfsmAutostartItem
+{
+  gchar   *name;
+  gchar   *path;            /* the file with the highest priority */
+  gchar   *exec;
+  gchar   *try_exec;
+  gchar  **after;           /* X-XFCE-After, see xfsm-startup.c */
+
+  guint    hidden : 1;
+  guint    show_in_xfce : 1; /* OnlyShowIn, NotShowIn and override */
+  guint    application : 1;  /* Type is Application or unset */
+  guint    try_exec_valid : 1;
+  guint    terminal : 1;
+  guint    startup_notify : 1;
+};
+
+typedef void (*XfsmAutostartFunc) (GPtrArray *items,
+                                   gpointer   user_data);
+
+void       xfsm_autostart_scan      (void);
+
+void       xfsm_autostart_load      (XfsmAutostartFunc func,
+                                     gpointer          user_data);
+GPtrArray *xfsm_autostart_load_sync (void);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_AUTOSTART_H__ */
@@ -24,6 +24,9 @@
 #include <config.h>
 #endif
 
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
@@ -52,8 +55,14 @@ struct _XfsmClient
   XfsmClientState  state;
   XfsmProperties  *properties;
   SmsConn          sms_conn;
+  gint64           connect_time;
+  gint64           register_time;  /* wall clock, see GetAllClients() */
+  guint64          generation;     /* see xfsm_client_bump_generation() */
 
   DBusGConnection *dbus_conn;
+
+  GHashTable      *pending_props;  /* names changed since the last flush */
+  guint            pending_props_id;
 };
 
 typedef struct _XfsmClientClass
@@ -71,6 +80,10 @@ typedef struct _XfsmClientClass
 
   void (*sm_property_deleted) (XfsmClient  *client,
                                const gchar *name);
+
+  void (*sm_properties_changed) (XfsmClient  *client,
+                                 GHashTable  *properties,
+                                 gchar      **deleted);
 } XfsmClientClass;
 
 typedef struct
@@ -84,6 +97,7 @@ enum
   SIG_STATE_CHANGED = 0,
   SIG_SM_PROPERTY_CHANGED,
   SIG_SM_PROPERTY_DELETED,
+  SIG_SM_PROPERTIES_CHANGED,
   N_SIGS
 };
 
@@ -95,10 +109,15 @@ static void    xfsm_properties_discard_command_changed (XfsmProperties *properti
 static void    xfsm_client_dbus_class_init (XfsmClientClass *klass);
 static void    xfsm_client_dbus_init (XfsmClient *client);
 static void    xfsm_client_dbus_cleanup (XfsmClient *client);
+static gboolean xfsm_client_properties_foreach (gpointer key,
+                                                gpointer value,
+                                                gpointer data);
 
 
 static guint signals[N_SIGS] = { 0, };
 
+static guint64 client_generation = 0;
+
 
 G_DEFINE_TYPE(XfsmClient, xfsm_client, G_TYPE_OBJECT)
 
@@ -140,6 +159,19 @@ xfsm_client_class_init (XfsmClientClass *klass)
                                                    G_TYPE_NONE, 1,
                                                    G_TYPE_STRING);
 
+  signals[SIG_SM_PROPERTIES_CHANGED] = g_signal_new ("sm-properties-changed",
+                                                     XFSM_TYPE_CLIENT,
+                                                     G_SIGNAL_RUN_LAST,
+                                                     G_STRUCT_OFFSET (XfsmClientClass,
+                                                                      sm_properties_changed),
+                                                     NULL, NULL,
+                                                     xfsm_marshal_VOID__BOXED_BOXED,
+                                                     G_TYPE_NONE, 2,
+                                                     dbus_g_type_get_map ("GHashTable",
+                                                                          G_TYPE_STRING,
+                                                                          G_TYPE_VALUE),
+                                                     G_TYPE_STRV);
+
   xfsm_client_dbus_class_init (klass);
 }
 
@@ -157,6 +189,11 @@ xfsm_client_finalize (GObject *obj)
 
   xfsm_client_dbus_cleanup (client);
 
+  if (client->pending_props_id != 0)
+    g_source_remove (client->pending_props_id);
+  if (client->pending_props != NULL)
+    g_hash_table_destroy (client->pending_props);
+
   if (client->properties != NULL)
     xfsm_properties_free (client->properties);
 
@@ -212,6 +249,86 @@ xfsm_client_signal_prop_change (XfsmClient *client,
 }
 
 
+static gboolean
+xfsm_client_flush_prop_changes (gpointer user_data)
+{
+  XfsmClient     *client = XFSM_CLIENT (user_data);
+  XfsmProperties *properties = client->properties;
+  GHashTable     *pending = client->pending_props;
+  GHashTable     *changed;
+  GPtrArray      *deleted;
+  GHashTableIter  iter;
+  gpointer        name;
+  const GValue   *value;
+
+  client->pending_props_id = 0;
+  client->pending_props = NULL;
+
+  if (G_UNLIKELY (pending == NULL))
+    return FALSE;
+
+  if (G_UNLIKELY (properties == NULL))
+    {
+      g_hash_table_destroy (pending);
+      return FALSE;
+    }
+
+  /* the values are looked up now rather than copied when queued: a
+   * property set several times (or set and then deleted) within the
+   * window is only reported once, with its current state */
+  changed = g_hash_table_new (g_str_hash, g_str_equal);
+  deleted = g_ptr_array_sized_new (4);
+
+  g_hash_table_iter_init (&iter, pending);
+  while (g_hash_table_iter_next (&iter, &name, NULL))
+    {
+      value = xfsm_properties_get (properties, name);
+      if (value != NULL)
+        g_hash_table_insert (changed, name, (GValue *) value);
+      else
+        g_ptr_array_add (deleted, name);
+    }
+  g_ptr_array_add (deleted, NULL);
+
+  xfsm_verbose ("Client Id = %s, %u properties changed, %u deleted\n\n",
+                client->id, g_hash_table_size (changed), deleted->len - 1);
+
+  g_signal_emit (client, signals[SIG_SM_PROPERTIES_CHANGED], 0,
+                 changed, (gchar **) deleted->pdata);
+
+  g_ptr_array_free (deleted, TRUE);
+  g_hash_table_destroy (changed);
+  g_hash_table_destroy (pending);
+
+  return FALSE;
+}
+
+
+/* SetProperties and DeleteProperties requests that arrive before the
+ * main loop goes idle are folded into a single SmPropertiesChanged */
+static void
+xfsm_client_queue_prop_change (XfsmClient  *client,
+                               const gchar *name)
+{
+  if (client->pending_props == NULL)
+    {
+      client->pending_props = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                     g_free, NULL);
+    }
+
+  if (!g_hash_table_lookup_extended (client->pending_props, name, NULL, NULL))
+    g_hash_table_insert (client->pending_props, g_strdup (name), NULL);
+
+  client->generation = xfsm_client_bump_generation ();
+
+  if (client->pending_props_id == 0)
+    {
+      client->pending_props_id = g_idle_add (xfsm_client_flush_prop_changes,
+                                             client);
+    }
+}
+
+
 
 XfsmClient*
 xfsm_client_new (XfsmManager *manager,
@@ -226,6 +343,7 @@ xfsm_client_new (XfsmManager *manager,
   client->manager = manager;
   client->sms_conn = sms_conn;
   client->state = XFSM_CLIENT_IDLE;
+  client->connect_time = g_get_monotonic_time ();
 
   return client;
 }
@@ -243,6 +361,7 @@ xfsm_client_set_initial_properties (XfsmClient     *client,
   client->properties = properties;
 
   client->id = g_strdup (properties->client_id);
+  client->register_time = g_get_real_time ();
 
   g_free (client->object_path);
   client->object_path = g_strconcat (XFSM_CLIENT_OBJECT_PATH_PREFIX,
@@ -251,6 +370,8 @@ xfsm_client_set_initial_properties (XfsmClient     *client,
               "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789_",
               '_');
 
+  client->generation = xfsm_client_bump_generation ();
+
   xfsm_client_dbus_init (client);
 }
 
@@ -273,6 +394,7 @@ xfsm_client_set_state (XfsmClient     *client,
     {
       XfsmClientState old_state = client->state;
       client->state = state;
+      client->generation = xfsm_client_bump_generation ();
       g_signal_emit (client, signals[SIG_STATE_CHANGED], 0, old_state, state);
     }
 }
@@ -343,12 +465,15 @@ xfsm_client_merge_properties (XfsmClient *client,
             old_discard = g_strdupv (old_discard);
         }
 
+      /* a client setting a property to the value it already has
+       * is not reported */
       if (xfsm_properties_set_from_smprop (properties, prop))
         {
           if (old_discard)
             xfsm_properties_discard_command_changed (properties, old_discard);
 
           xfsm_client_signal_prop_change (client, prop->name);
+          xfsm_client_queue_prop_change (client, prop->name);
         }
 
       g_strfreev (old_discard);
@@ -375,6 +500,7 @@ xfsm_client_delete_properties (XfsmClient *client,
         {
           g_signal_emit (client, signals[SIG_SM_PROPERTY_DELETED], 0,
                          prop_names[n]);
+          xfsm_client_queue_prop_change (client, prop_names[n]);
         }
     }
 }
@@ -388,6 +514,128 @@ xfsm_client_get_object_path (XfsmClient *client)
 }
 
 
+gint64
+xfsm_client_get_connect_time (XfsmClient *client)
+{
+  g_return_val_if_fail (XFSM_IS_CLIENT (client), 0);
+  return client->connect_time;
+}
+
+
+/* the generation is a counter shared by all clients that is bumped
+ * whenever a client is registered, changes state or properties, or
+ * goes away.  D-Bus pollers pass the last generation they have seen
+ * to GetClientsSince() to only receive what changed after it. */
+guint64
+xfsm_client_bump_generation (void)
+{
+  return ++client_generation;
+}
+
+
+guint64
+xfsm_client_get_current_generation (void)
+{
+  return client_generation;
+}
+
+
+guint64
+xfsm_client_get_generation (XfsmClient *client)
+{
+  g_return_val_if_fail (XFSM_IS_CLIENT (client), 0);
+  return client->generation;
+}
+
+
+static void
+xfsm_client_dbus_value_free (gpointer data)
+{
+  GValue *value = data;
+
+  g_value_unset (value);
+  g_free (value);
+}
+
+
+static GValue *
+xfsm_client_dbus_value_new (GType type)
+{
+  GValue *value = g_new0 (GValue, 1);
+
+  return g_value_init (value, type);
+}
+
+
+/* one entry of GetAllClients() and GetClientsSince(), see
+ * xfsm-manager-dbus.xml for the keys.  The property values point
+ * into the client's properties, so the result must be sent before
+ * returning to the main loop. */
+GHashTable *
+xfsm_client_to_dbus (XfsmClient *client)
+{
+  GHashTable  *dict;
+  GHashTable  *props;
+  GValue      *value;
+  const gchar *pid_str;
+  guint        pid = 0;
+
+  g_return_val_if_fail (XFSM_IS_CLIENT (client), NULL);
+
+  dict = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+                                xfsm_client_dbus_value_free);
+
+  value = xfsm_client_dbus_value_new (DBUS_TYPE_G_OBJECT_PATH);
+  g_value_set_boxed (value, client->object_path);
+  g_hash_table_insert (dict, "object-path", value);
+
+  value = xfsm_client_dbus_value_new (G_TYPE_STRING);
+  g_value_set_string (value, client->id);
+  g_hash_table_insert (dict, "id", value);
+
+  value = xfsm_client_dbus_value_new (G_TYPE_UINT);
+  g_value_set_uint (value, client->state);
+  g_hash_table_insert (dict, "state", value);
+
+  if (client->properties != NULL)
+    {
+      pid_str = xfsm_properties_get_string (client->properties, SmProcessID);
+      if (pid_str != NULL)
+        pid = strtoul (pid_str, NULL, 10);
+      else if (client->properties->pid > 0)
+        pid = client->properties->pid;
+    }
+
+  value = xfsm_client_dbus_value_new (G_TYPE_UINT);
+  g_value_set_uint (value, pid);
+  g_hash_table_insert (dict, "pid", value);
+
+  value = xfsm_client_dbus_value_new (G_TYPE_UINT64);
+  g_value_set_uint64 (value, client->register_time);
+  g_hash_table_insert (dict, "registration-time", value);
+
+  value = xfsm_client_dbus_value_new (G_TYPE_UINT64);
+  g_value_set_uint64 (value, client->generation);
+  g_hash_table_insert (dict, "generation", value);
+
+  props = g_hash_table_new (g_str_hash, g_str_equal);
+  if (client->properties != NULL)
+    {
+      xfsm_properties_foreach (client->properties,
+                               xfsm_client_properties_foreach,
+                               props);
+    }
+
+  value = xfsm_client_dbus_value_new (dbus_g_type_get_map ("GHashTable",
+                                                           G_TYPE_STRING,
+                                                           G_TYPE_VALUE));
+  g_value_take_boxed (value, props);
+  g_hash_table_insert (dict, "properties", value);
+
+  return dict;
+}
+
+
 
 /*
  * dbus server impl
@@ -480,9 +728,9 @@ xfsm_client_dbus_get_state (XfsmClient *client,
 
 
 static gboolean
-xfsm_client_properties_tree_foreach (gpointer key,
-                                     gpointer value,
-                                     gpointer data)
+xfsm_client_properties_foreach (gpointer key,
+                                gpointer value,
+                                gpointer data)
 {
   gchar       *prop_name = key;
   GValue      *prop_value = value;
@@ -509,9 +757,9 @@ xfsm_client_dbus_get_all_sm_properties (XfsmClient *client,
 
   *OUT_properties = g_hash_table_new_full (g_str_hash, g_str_equal,
                                            NULL, NULL);
-  g_tree_foreach (properties->sm_properties,
-                  xfsm_client_properties_tree_foreach,
-                  *OUT_properties);
+  xfsm_properties_foreach (properties,
+                           xfsm_client_properties_foreach,
+                           *OUT_properties);
 
   return TRUE;
 }
@@ -538,9 +786,9 @@ xfsm_client_dbus_get_sm_properties (XfsmClient  *client,
 
   for (i = 0; names[i]; ++i)
     {
-      GValue *value = g_tree_lookup (properties->sm_properties, names[i]);
+      const GValue *value = xfsm_properties_get (properties, names[i]);
       if (G_LIKELY (value))
-        g_hash_table_insert (*OUT_properties, names[i], value);
+        g_hash_table_insert (*OUT_properties, names[i], (GValue *) value);
     }
 
   return TRUE;
@@ -554,9 +802,10 @@ xfsm_client_dbus_merge_properties_ht (gpointer key,
 {
   gchar          *prop_name = key;
   GValue         *prop_value = value;
-  XfsmProperties *properties = user_data;
+  XfsmClient     *client = user_data;
 
-  xfsm_properties_set (properties, prop_name, prop_value);
+  if (xfsm_properties_set (client->properties, prop_name, prop_value))
+    xfsm_client_queue_prop_change (client, prop_name);
 }
 
 
@@ -573,7 +822,7 @@ xfsm_client_dbus_set_sm_properties (XfsmClient *client,
     }
 
   g_hash_table_foreach (properties, xfsm_client_dbus_merge_properties_ht,
-                        client->properties);
+                        client);
 
   return TRUE;
 }
@@ -77,6 +77,16 @@ void xfsm_client_delete_properties (XfsmClient *client,
 
 const gchar *xfsm_client_get_object_path (XfsmClient *client);
 
+/* monotonic time of the ICE connection */
+gint64 xfsm_client_get_connect_time (XfsmClient *client);
+
+guint64 xfsm_client_bump_generation (void);
+guint64 xfsm_client_get_current_generation (void);
+guint64 xfsm_client_get_generation (XfsmClient *client);
+
+/* the client's entry for the GetAllClients() D-Bus reply */
+GHashTable *xfsm_client_to_dbus (XfsmClient *client);
+
 G_END_DECLS
 
 #endif /* !__XFSM_CLIENT_H__ */
@@ -24,6 +24,7 @@
 #include <dbus/dbus-glib-lowlevel.h>
 
 #include <xfce4-session/xfsm-consolekit.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <libxfsm/xfsm-util.h>
 
 
@@ -400,11 +401,11 @@ xfsm_consolekit_can_shutdown (XfsmConsolekit  *consolekit,
 static gboolean
 lock_screen (GError **error)
 {
-  XfconfChannel *channel;
+  XfsmSettings  *settings;
   gboolean       ret = TRUE;
 
-  channel = xfsm_open_config ();
-  if (xfconf_channel_get_bool (channel, "/shutdown/LockScreen", FALSE))
+  settings = xfsm_settings_get ();
+  if (xfsm_settings_get_bool (settings, "/shutdown/LockScreen", FALSE))
       ret = g_spawn_command_line_async ("xflock4", error);
 
   return ret;
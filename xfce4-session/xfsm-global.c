@@ -52,6 +52,7 @@
 
 /* global variables */
 gboolean          verbose = FALSE;
+gboolean          xfsm_headless = FALSE;
 XfsmSplashScreen *splash_screen = NULL;
 
 void
@@ -158,18 +159,38 @@ xfsm_generate_client_id (SmsConn sms_conn)
 }
 
 
+/* the name session files are keyed on, there is no display to name
+ * them after in headless mode */
+gchar *
+xfsm_get_display_name (void)
+{
+  if (xfsm_headless)
+    return g_strdup ("headless");
+
+  return xfsm_gdk_display_get_fullname (gdk_display_get_default ());
+}
+
+
+/* looks @name up in the thumbnail atlas @thumbs, which may be %NULL,
+ * and falls back to the PNG thumbnails written before the atlas */
 GdkPixbuf *
-xfsm_load_session_preview (const gchar *name)
+xfsm_load_session_preview (XfsmThumbs  *thumbs,
+                           const gchar *name)
 {
-  GdkDisplay *display;
   GdkPixbuf  *pb = NULL;
   gchar *display_name;
   gchar *filename;
   gchar *path;
 
+  if (thumbs != NULL)
+    {
+      pb = xfsm_thumbs_lookup (thumbs, name);
+      if (pb != NULL)
+        return pb;
+    }
+
   /* determine thumb file */
-  display = gdk_display_get_default ();
-  display_name = xfsm_gdk_display_get_fullname (display);
+  display_name = xfsm_get_display_name ();
   path = g_strconcat ("sessions/thumbs-", display_name, "/", name, ".png", NULL);
   filename = xfce_resource_lookup (XFCE_RESOURCE_CACHE, path);
   g_free (display_name);
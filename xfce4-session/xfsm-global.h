@@ -27,6 +27,7 @@
 #include <X11/SM/SMlib.h>
 
 #include <xfce4-session/xfsm-splash-screen.h>
+#include <xfce4-session/xfsm-thumbs.h>
 #include <dbus/dbus.h>
 
 typedef struct _FailsafeClient FailsafeClient;
@@ -43,6 +44,7 @@ void xfsm_failsafe_client_free (FailsafeClient *fclient);
 
 
 extern gboolean          verbose;
+extern gboolean          xfsm_headless;
 extern XfsmSplashScreen *splash_screen;
 
 
@@ -67,7 +69,10 @@ void xfsm_verbose_real (const char *func,
 
 gchar *xfsm_generate_client_id (SmsConn sms_conn) G_GNUC_PURE;
 
-GdkPixbuf *xfsm_load_session_preview (const gchar *name);
+gchar *xfsm_get_display_name (void);
+
+GdkPixbuf *xfsm_load_session_preview (XfsmThumbs  *thumbs,
+                                      const gchar *name);
 
 GValue *xfsm_g_value_new (GType gtype);
 void    xfsm_g_value_free (GValue *value);
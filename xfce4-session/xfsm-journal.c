@@ -0,0 +1,217 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Checkpoint journal. Instead of rewriting the whole session file on
+ * every checkpoint, only clients whose properties changed since the last
+ * store are appended to <session file>.journal, as an XfceRc group:
+ *
+ *   [Session: <name>]
+ *   Base=<JournalBase of the session group this record applies to>
+ *   Count=<number of clients>
+ *   Clients=<key of client 0>,<key of client 1>,...
+ *   J<record>C<n>_ClientId=...          (changed clients only)
+ *   Legacy..., Screen%d_ActiveWorkspace, LastAccess
+ *
+ * A key starting with "Client" refers to the client stored under that
+ * prefix in the session file, any other key to a record in the journal.
+ * Records are appended, XfceRc merges repeated groups and the last value
+ * of every entry wins. A full store writes a new JournalBase to the
+ * session file and removes the journal, leftover records that don't
+ * match the JournalBase are ignored.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <glib/gstdio.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-journal.h>
+#include <xfce4-session/xfsm-legacy.h>
+#include <xfce4-session/xfsm-properties.h>
+
+
+gchar *
+xfsm_journal_get_filename (const gchar *session_file)
+{
+  return g_strconcat (session_file, ".journal", NULL);
+}
+
+
+gboolean
+xfsm_journal_exists (const gchar *session_file)
+{
+  GStatBuf sb;
+  gchar   *filename;
+  gboolean exists;
+
+  filename = xfsm_journal_get_filename (session_file);
+  exists = g_stat (filename, &sb) == 0 && sb.st_size > 0;
+  g_free (filename);
+
+  return exists;
+}
+
+
+/* loads the clients of @group (already selected in @rc) with the
+ * journal applied. returns FALSE if there is no usable journal for the
+ * group, the caller has to load the session file as is then. */
+gboolean
+xfsm_journal_load (const gchar *session_file,
+                   XfceRc      *rc,
+                   const gchar *group,
+                   GQueue      *properties)
+{
+  XfsmProperties *client;
+  const gchar    *base;
+  XfceRc         *journal;
+  gchar          *filename;
+  gchar         **keys;
+  gint            count;
+  gint            n;
+
+  base = xfce_rc_read_entry (rc, "JournalBase", NULL);
+  if (base == NULL || !xfsm_journal_exists (session_file))
+    return FALSE;
+
+  filename = xfsm_journal_get_filename (session_file);
+  journal = xfce_rc_simple_open (filename, TRUE);
+  g_free (filename);
+  if (G_UNLIKELY (journal == NULL))
+    return FALSE;
+
+  if (!xfce_rc_has_group (journal, group))
+    {
+      xfce_rc_close (journal);
+      return FALSE;
+    }
+
+  xfce_rc_set_group (journal, group);
+  if (g_strcmp0 (xfce_rc_read_entry (journal, "Base", NULL), base) != 0)
+    {
+      xfsm_verbose ("Ignoring stale session journal for %s\n", group);
+      xfce_rc_close (journal);
+      return FALSE;
+    }
+
+  keys = xfce_rc_read_list_entry (journal, "Clients", NULL);
+  count = xfce_rc_read_int_entry (journal, "Count", 0);
+  if (keys == NULL || (gint) g_strv_length (keys) != count)
+    {
+      g_warning ("Session journal for %s is broken, ignoring it", group);
+      g_strfreev (keys);
+      xfce_rc_close (journal);
+      return FALSE;
+    }
+
+  xfsm_verbose ("Loading %s from the session journal\n", group);
+
+  /* same order as xfsm_manager_load_session() */
+  for (n = count - 1; n >= 0; --n)
+    {
+      if (g_str_has_prefix (keys[n], "Client"))
+        client = xfsm_properties_load (rc, keys[n]);
+      else
+        client = xfsm_properties_load (journal, keys[n]);
+
+      if (G_UNLIKELY (client == NULL))
+        continue;
+
+      g_queue_push_tail (properties, client);
+    }
+
+  /* legacy applications are stored with every record */
+  if (count > 0)
+    xfsm_legacy_load_session (journal, properties);
+
+  g_strfreev (keys);
+  xfce_rc_close (journal);
+
+  return TRUE;
+}
+
+
+/* appends @record to the journal and syncs it.
+ * may be called from a worker thread. */
+gboolean
+xfsm_journal_append (const gchar *session_file,
+                     const gchar *record,
+                     gsize        length)
+{
+  gchar   *filename;
+  gssize   written;
+  gsize    offset;
+  gboolean succeed = FALSE;
+  gint     fd;
+
+  filename = xfsm_journal_get_filename (session_file);
+  fd = g_open (filename, O_WRONLY | O_APPEND | O_CREAT, 0600);
+  if (fd >= 0)
+    {
+      for (offset = 0; offset < length; offset += written)
+        {
+          written = write (fd, record + offset, length - offset);
+          if (written < 0 && errno == EINTR)
+            written = 0;
+          else if (written < 0)
+            break;
+        }
+
+      succeed = offset == length && fsync (fd) == 0;
+      if (!succeed)
+        g_warning ("Failed to write session journal %s: %s", filename, g_strerror (errno));
+
+      close (fd);
+    }
+  else
+    {
+      g_warning ("Failed to open session journal %s: %s", filename, g_strerror (errno));
+    }
+
+  g_free (filename);
+
+  return succeed;
+}
+
+
+void
+xfsm_journal_remove (const gchar *session_file)
+{
+  gchar *filename;
+
+  filename = xfsm_journal_get_filename (session_file);
+  g_unlink (filename);
+  g_free (filename);
+}
@@ -0,0 +1,50 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_JOURNAL_H__
+#define __XFSM_JOURNAL_H__
+
+#include <glib.h>
+
+#include <libxfce4util/libxfce4util.h>
+
+G_BEGIN_DECLS;
+
+/* compact the journal into the session file after this many records */
+#define XFSM_JOURNAL_MAX_RECORDS 32
+
+gchar    *xfsm_journal_get_filename (const gchar *session_file);
+
+gboolean  xfsm_journal_exists       (const gchar *session_file);
+
+gboolean  xfsm_journal_load         (const gchar *session_file,
+                                     XfceRc      *rc,
+                                     const gchar *group,
+                                     GQueue      *properties);
+
+gboolean  xfsm_journal_append       (const gchar *session_file,
+                                     const gchar *record,
+                                     gsize        length);
+
+void      xfsm_journal_remove       (const gchar *session_file);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_JOURNAL_H__ */
@@ -0,0 +1,429 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Remembers how long every program (SmProgram) took to register after
+ * being launched and to complete a SaveYourself, across sessions. The
+ * startup and save timeouts of a client are derived from the 99th
+ * percentile of its recent samples instead of one global constant, so
+ * crashing fast clients are noticed early and slow but healthy ones are
+ * not given up on. A client that runs into its timeout records the
+ * timeout as a sample, so the next one is longer.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <dbus/dbus-glib.h>
+#include <libxfce4util/libxfce4util.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-latency.h>
+
+
+/* samples kept per program and kind */
+#define N_SAMPLES   20
+
+/* samples needed before the learned timeout is used */
+#define MIN_SAMPLES 3
+
+/* learned timeout = p99 * MARGIN, clamped to the limits below */
+#define MARGIN      3
+
+/* write changes to disk after this many seconds */
+#define FLUSH_DELAY 30
+
+
+typedef struct
+{
+  guint samples[N_SAMPLES]; /* milliseconds, oldest first once full */
+  guint n_samples;
+  guint next;
+} XfsmLatencySamples;
+
+typedef struct
+{
+  XfsmLatencySamples kinds[XFSM_LATENCY_N_KINDS];
+} XfsmLatencyEntry;
+
+
+static const struct
+{
+  const gchar *name;
+  const gchar *dbus_name;
+  guint        floor;
+  guint        ceiling;
+} kind_info[XFSM_LATENCY_N_KINDS] =
+{
+  { "Startup", "startup",  3 * 1000,     60 * 1000 },
+  { "Save",    "save",    10 * 1000, 5 * 60 * 1000 },
+};
+
+
+static GHashTable *latency_entries = NULL;
+static gboolean    latency_dirty = FALSE;
+static guint       latency_flush_id = 0;
+
+
+static gchar *
+xfsm_latency_get_filename (gboolean create)
+{
+  return xfce_resource_save_location (XFCE_RESOURCE_CACHE,
+                                      "sessions/client-latencies.rc",
+                                      create);
+}
+
+
+static XfsmLatencyEntry *
+xfsm_latency_lookup (const gchar *program,
+                     gboolean     create)
+{
+  XfsmLatencyEntry *entry;
+
+  entry = g_hash_table_lookup (latency_entries, program);
+  if (entry == NULL && create)
+    {
+      entry = g_slice_new0 (XfsmLatencyEntry);
+      g_hash_table_insert (latency_entries, g_strdup (program), entry);
+    }
+
+  return entry;
+}
+
+
+static void
+xfsm_latency_add_sample (XfsmLatencySamples *samples,
+                         guint               msec)
+{
+  samples->samples[samples->next] = msec;
+  samples->next = (samples->next + 1) % N_SAMPLES;
+  if (samples->n_samples < N_SAMPLES)
+    samples->n_samples++;
+}
+
+
+static void
+xfsm_latency_entry_free (gpointer data)
+{
+  g_slice_free (XfsmLatencyEntry, data);
+}
+
+
+void
+xfsm_latency_init (void)
+{
+  XfsmLatencyEntry *entry;
+  XfceRc           *rc;
+  gchar           **groups;
+  gchar           **values;
+  gchar            *filename;
+  guint             kind;
+  guint             n, m;
+
+  g_return_if_fail (latency_entries == NULL);
+
+  latency_entries = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                           g_free, xfsm_latency_entry_free);
+
+  filename = xfsm_latency_get_filename (FALSE);
+  if (filename == NULL)
+    return;
+
+  rc = xfce_rc_simple_open (filename, TRUE);
+  g_free (filename);
+  if (rc == NULL)
+    return;
+
+  groups = xfce_rc_get_groups (rc);
+  for (n = 0; groups != NULL && groups[n] != NULL; ++n)
+    {
+      if (!xfce_rc_has_group (rc, groups[n]))
+        continue;
+
+      xfce_rc_set_group (rc, groups[n]);
+      entry = NULL;
+
+      for (kind = 0; kind < XFSM_LATENCY_N_KINDS; ++kind)
+        {
+          values = xfce_rc_read_list_entry (rc, kind_info[kind].name, ",");
+          if (values == NULL)
+            continue;
+
+          if (entry == NULL)
+            entry = xfsm_latency_lookup (groups[n], TRUE);
+
+          for (m = 0; values[m] != NULL; ++m)
+            xfsm_latency_add_sample (&entry->kinds[kind], strtoul (values[m], NULL, 10));
+
+          g_strfreev (values);
+        }
+    }
+  g_strfreev (groups);
+
+  xfce_rc_close (rc);
+
+  xfsm_verbose ("Loaded save and startup latencies of %u programs\n",
+                g_hash_table_size (latency_entries));
+}
+
+
+void
+xfsm_latency_flush (void)
+{
+  XfsmLatencySamples *samples;
+  XfsmLatencyEntry   *entry;
+  GHashTableIter      iter;
+  gpointer            program;
+  XfceRc             *rc;
+  gchar              *filename;
+  gchar             **values;
+  guint               kind;
+  guint               n;
+
+  if (!latency_dirty)
+    return;
+
+  if (latency_flush_id != 0)
+    {
+      g_source_remove (latency_flush_id);
+      latency_flush_id = 0;
+    }
+
+  latency_dirty = FALSE;
+
+  filename = xfsm_latency_get_filename (TRUE);
+  if (G_UNLIKELY (filename == NULL))
+    return;
+
+  /* rewrite the file from scratch */
+  unlink (filename);
+  rc = xfce_rc_simple_open (filename, FALSE);
+  g_free (filename);
+  if (G_UNLIKELY (rc == NULL))
+    return;
+
+  g_hash_table_iter_init (&iter, latency_entries);
+  while (g_hash_table_iter_next (&iter, &program, (gpointer) &entry))
+    {
+      xfce_rc_set_group (rc, program);
+
+      for (kind = 0; kind < XFSM_LATENCY_N_KINDS; ++kind)
+        {
+          samples = &entry->kinds[kind];
+          if (samples->n_samples == 0)
+            continue;
+
+          /* oldest sample first, so they're loaded in the same order */
+          values = g_new0 (gchar *, samples->n_samples + 1);
+          for (n = 0; n < samples->n_samples; ++n)
+            {
+              values[n] = g_strdup_printf ("%u",
+                                           samples->samples[(samples->next + N_SAMPLES
+                                                             - samples->n_samples + n) % N_SAMPLES]);
+            }
+          xfce_rc_write_list_entry (rc, kind_info[kind].name, values, ",");
+          g_strfreev (values);
+        }
+    }
+
+  xfce_rc_close (rc);
+}
+
+
+static gboolean
+xfsm_latency_flush_timeout (gpointer user_data)
+{
+  latency_flush_id = 0;
+  xfsm_latency_flush ();
+  return FALSE;
+}
+
+
+/* records that @program took @latency microseconds */
+void
+xfsm_latency_record (const gchar     *program,
+                     XfsmLatencyKind  kind,
+                     gint64           latency)
+{
+  XfsmLatencyEntry *entry;
+
+  g_return_if_fail (kind < XFSM_LATENCY_N_KINDS);
+
+  /* the program is used as group name in the rc file */
+  if (latency_entries == NULL
+      || program == NULL
+      || *program == '\0'
+      || strpbrk (program, "[]\n") != NULL)
+    return;
+
+  entry = xfsm_latency_lookup (program, TRUE);
+  xfsm_latency_add_sample (&entry->kinds[kind], MAX (latency, 0) / 1000);
+
+  latency_dirty = TRUE;
+
+  if (latency_flush_id == 0)
+    {
+      latency_flush_id = g_timeout_add_seconds (FLUSH_DELAY,
+                                                xfsm_latency_flush_timeout,
+                                                NULL);
+    }
+}
+
+
+static gint
+xfsm_latency_compare (gconstpointer a,
+                      gconstpointer b)
+{
+  guint ua = *(const guint *) a;
+  guint ub = *(const guint *) b;
+
+  return ua < ub ? -1 : (ua > ub ? 1 : 0);
+}
+
+
+/* 99th percentile of @samples in milliseconds */
+static guint
+xfsm_latency_get_p99 (const XfsmLatencySamples *samples)
+{
+  guint sorted[N_SAMPLES];
+  guint n;
+
+  if (samples->n_samples == 0)
+    return 0;
+
+  memcpy (sorted, samples->samples, sizeof (sorted));
+  qsort (sorted, samples->n_samples, sizeof (guint), xfsm_latency_compare);
+
+  /* nearest rank */
+  n = (samples->n_samples * 99 + 99) / 100;
+
+  return sorted[n - 1];
+}
+
+
+/* timeout in milliseconds for @program, @fallback if there are not
+ * enough samples yet */
+guint
+xfsm_latency_get_timeout (const gchar     *program,
+                          XfsmLatencyKind  kind,
+                          guint            fallback)
+{
+  XfsmLatencyEntry *entry;
+  guint             timeout;
+
+  g_return_val_if_fail (kind < XFSM_LATENCY_N_KINDS, fallback);
+
+  if (latency_entries == NULL || program == NULL)
+    return fallback;
+
+  entry = xfsm_latency_lookup (program, FALSE);
+  if (entry == NULL || entry->kinds[kind].n_samples < MIN_SAMPLES)
+    return fallback;
+
+  timeout = xfsm_latency_get_p99 (&entry->kinds[kind]) * MARGIN;
+
+  return CLAMP (timeout, kind_info[kind].floor, kind_info[kind].ceiling);
+}
+
+
+static void
+xfsm_latency_dict_insert_uint (GHashTable  *dict,
+                               const gchar *key,
+                               guint        number)
+{
+  GValue *value = g_new0 (GValue, 1);
+
+  g_value_init (value, G_TYPE_UINT);
+  g_value_set_uint (value, number);
+  g_hash_table_insert (dict, g_strdup (key), value);
+}
+
+
+static void
+xfsm_latency_value_free (gpointer data)
+{
+  g_value_unset (data);
+  g_free (data);
+}
+
+
+/* one a{sv} per program, see GetClientTimeouts in xfsm-manager-dbus.xml */
+GPtrArray *
+xfsm_latency_to_dbus (void)
+{
+  XfsmLatencyEntry *entry;
+  GHashTableIter    iter;
+  GHashTable       *dict;
+  GPtrArray        *result;
+  gpointer          program;
+  GValue           *value;
+  gchar            *key;
+  guint             kind;
+  guint             timeout;
+
+  result = g_ptr_array_new ();
+  if (latency_entries == NULL)
+    return result;
+
+  g_hash_table_iter_init (&iter, latency_entries);
+  while (g_hash_table_iter_next (&iter, &program, (gpointer) &entry))
+    {
+      dict = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+                                    xfsm_latency_value_free);
+
+      value = g_new0 (GValue, 1);
+      g_value_init (value, G_TYPE_STRING);
+      g_value_set_string (value, program);
+      g_hash_table_insert (dict, g_strdup ("program"), value);
+
+      for (kind = 0; kind < XFSM_LATENCY_N_KINDS; ++kind)
+        {
+          /* 0 means the default timeout is used */
+          timeout = xfsm_latency_get_timeout (program, kind, 0);
+
+          key = g_strconcat (kind_info[kind].dbus_name, "-p99", NULL);
+          xfsm_latency_dict_insert_uint (dict, key, xfsm_latency_get_p99 (&entry->kinds[kind]));
+          g_free (key);
+
+          key = g_strconcat (kind_info[kind].dbus_name, "-timeout", NULL);
+          xfsm_latency_dict_insert_uint (dict, key, timeout);
+          g_free (key);
+
+          key = g_strconcat (kind_info[kind].dbus_name, "-samples", NULL);
+          xfsm_latency_dict_insert_uint (dict, key, entry->kinds[kind].n_samples);
+          g_free (key);
+        }
+
+      g_ptr_array_add (result, dict);
+    }
+
+  return result;
+}
@@ -0,0 +1,50 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_LATENCY_H__
+#define __XFSM_LATENCY_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+typedef enum
+{
+  XFSM_LATENCY_STARTUP = 0, /* spawn until RegisterClient */
+  XFSM_LATENCY_SAVE,        /* SaveYourself until SaveYourselfDone */
+  XFSM_LATENCY_N_KINDS,
+} XfsmLatencyKind;
+
+void       xfsm_latency_init        (void);
+void       xfsm_latency_flush       (void);
+
+void       xfsm_latency_record      (const gchar     *program,
+                                     XfsmLatencyKind  kind,
+                                     gint64           latency);
+
+guint      xfsm_latency_get_timeout (const gchar     *program,
+                                     XfsmLatencyKind  kind,
+                                     guint            fallback);
+
+GPtrArray *xfsm_latency_to_dbus     (void);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_LATENCY_H__ */
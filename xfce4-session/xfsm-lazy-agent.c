@@ -0,0 +1,354 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Lazy ssh-agent. xfce4-session listens on a socket in a private
+ * directory and exports it as SSH_AUTH_SOCK right away. The first
+ * connection is left in the listen backlog and the agent is started on
+ * a neighbouring path. Once it is running, its socket is renamed over
+ * ours, so new connections go straight to the agent, and the
+ * connections that were queued on our socket are relayed to it from the
+ * main loop until they close.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+#include <sys/un.h>
+
+#include <glib/gstdio.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-lazy-agent.h>
+
+
+/* a connection that reached the lazy socket before the real agent
+ * took it over */
+typedef struct
+{
+  gint  fds[2];      /* client, agent */
+  guint watch_ids[2];
+} XfsmLazyAgentRelay;
+
+
+static XfsmLazyAgentStartFunc lazy_agent_func = NULL;
+static gpointer               lazy_agent_data = NULL;
+static gchar                 *lazy_agent_dir = NULL;
+static gchar                 *lazy_agent_socket = NULL;
+static gchar                 *lazy_agent_real_socket = NULL;
+static gint                   lazy_agent_fd = -1;
+static guint                  lazy_agent_watch_id = 0;
+
+
+static void
+xfsm_lazy_agent_relay_free (XfsmLazyAgentRelay *relay)
+{
+  guint n;
+
+  for (n = 0; n < 2; ++n)
+    {
+      if (relay->watch_ids[n] != 0)
+        g_source_remove (relay->watch_ids[n]);
+      close (relay->fds[n]);
+    }
+
+  g_slice_free (XfsmLazyAgentRelay, relay);
+}
+
+
+static gboolean
+xfsm_lazy_agent_relay_forward (GIOChannel   *channel,
+                               GIOCondition  condition,
+                               gpointer      user_data)
+{
+  XfsmLazyAgentRelay *relay = user_data;
+  gchar               buffer[4096];
+  gssize              n, written;
+  gssize              done;
+  guint               from;
+
+  from = g_io_channel_unix_get_fd (channel) == relay->fds[0] ? 0 : 1;
+
+  n = read (relay->fds[from], buffer, sizeof (buffer));
+  if (n < 0 && errno == EINTR)
+    return TRUE;
+
+  /* agent messages are small, a blocking write is fine here */
+  for (done = 0; n > 0 && done < n; done += written)
+    {
+      written = write (relay->fds[1 - from], buffer + done, n - done);
+      if (written < 0 && errno == EINTR)
+        written = 0;
+      else if (written < 0)
+        n = -1;
+    }
+
+  if (n > 0)
+    return TRUE;
+
+  /* one side hung up */
+  relay->watch_ids[from] = 0;
+  xfsm_lazy_agent_relay_free (relay);
+
+  return FALSE;
+}
+
+
+static gint
+xfsm_lazy_agent_socket_new (const gchar         *path,
+                            struct sockaddr_un  *addr)
+{
+  gint fd;
+
+  if (strlen (path) >= sizeof (addr->sun_path))
+    {
+      errno = ENAMETOOLONG;
+      return -1;
+    }
+
+  memset (addr, 0, sizeof (*addr));
+  addr->sun_family = AF_UNIX;
+  strcpy (addr->sun_path, path);
+
+  fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (fd >= 0)
+    fcntl (fd, F_SETFD, FD_CLOEXEC);
+
+  return fd;
+}
+
+
+static void
+xfsm_lazy_agent_close (void)
+{
+  if (lazy_agent_watch_id != 0)
+    {
+      g_source_remove (lazy_agent_watch_id);
+      lazy_agent_watch_id = 0;
+    }
+
+  if (lazy_agent_fd >= 0)
+    {
+      close (lazy_agent_fd);
+      lazy_agent_fd = -1;
+    }
+}
+
+
+static gboolean
+xfsm_lazy_agent_connect (GIOChannel   *channel,
+                         GIOCondition  condition,
+                         gpointer      user_data)
+{
+  xfsm_verbose ("First connection to %s, starting the agent\n", lazy_agent_socket);
+
+  /* the connection stays in the backlog until the agent is running */
+  lazy_agent_watch_id = 0;
+
+  lazy_agent_real_socket = g_strconcat (lazy_agent_socket, ".real", NULL);
+  lazy_agent_func (lazy_agent_real_socket, lazy_agent_data);
+
+  return FALSE;
+}
+
+
+/* exports SSH_AUTH_SOCK right away and calls @func on the first
+ * connection to it */
+gboolean
+xfsm_lazy_agent_init (XfsmLazyAgentStartFunc func,
+                      gpointer               user_data)
+{
+  struct sockaddr_un  addr;
+  GIOChannel         *channel;
+  gchar              *dir;
+  gchar              *socket_path;
+  gint                fd;
+
+  g_return_val_if_fail (func != NULL, FALSE);
+  g_return_val_if_fail (lazy_agent_socket == NULL, FALSE);
+
+  dir = g_build_filename (g_get_tmp_dir (), "ssh-XXXXXX", NULL);
+  if (mkdtemp (dir) == NULL)
+    {
+      g_warning ("Failed to create the ssh-agent socket directory: %s",
+                 g_strerror (errno));
+      g_free (dir);
+      return FALSE;
+    }
+
+  socket_path = g_strdup_printf ("%s/agent.%d", dir, (gint) getpid ());
+
+  fd = xfsm_lazy_agent_socket_new (socket_path, &addr);
+  if (fd < 0
+      || bind (fd, (struct sockaddr *) &addr, sizeof (addr)) < 0
+      || listen (fd, SOMAXCONN) < 0)
+    {
+      g_warning ("Failed to listen on %s: %s", socket_path, g_strerror (errno));
+      if (fd >= 0)
+        close (fd);
+      g_unlink (socket_path);
+      g_rmdir (dir);
+      g_free (socket_path);
+      g_free (dir);
+      return FALSE;
+    }
+
+  fcntl (fd, F_SETFL, fcntl (fd, F_GETFL) | O_NONBLOCK);
+
+  lazy_agent_func = func;
+  lazy_agent_data = user_data;
+  lazy_agent_dir = dir;
+  lazy_agent_socket = socket_path;
+  lazy_agent_fd = fd;
+
+  channel = g_io_channel_unix_new (fd);
+  lazy_agent_watch_id = g_io_add_watch (channel, G_IO_IN,
+                                        xfsm_lazy_agent_connect,
+                                        NULL);
+  g_io_channel_unref (channel);
+
+  g_setenv ("SSH_AUTH_SOCK", socket_path, TRUE);
+
+  xfsm_verbose ("The agent will be started on the first connection to %s\n", socket_path);
+
+  return TRUE;
+}
+
+
+/* hands the lazy socket over to the agent, or closes it if the agent
+ * could not be started */
+void
+xfsm_lazy_agent_ready (gboolean started)
+{
+  XfsmLazyAgentRelay *relay;
+  struct sockaddr_un  addr;
+  GIOChannel         *channel;
+  gint                client_fd;
+  gint                agent_fd;
+  guint               n;
+
+  g_return_if_fail (lazy_agent_real_socket != NULL);
+
+  if (!started)
+    {
+      xfsm_lazy_agent_close ();
+      return;
+    }
+
+  /* the clients keep using our socket path */
+  g_setenv ("SSH_AUTH_SOCK", lazy_agent_socket, TRUE);
+
+  /* move the socket of the agent over ours, new connections go
+   * straight to the agent from now on */
+  if (rename (lazy_agent_real_socket, lazy_agent_socket) < 0)
+    {
+      g_warning ("Failed to move the ssh-agent socket to %s: %s",
+                 lazy_agent_socket, g_strerror (errno));
+      xfsm_lazy_agent_close ();
+      return;
+    }
+
+  /* forward the connections that were queued on our socket */
+  for (;;)
+    {
+      client_fd = accept (lazy_agent_fd, NULL, NULL);
+      if (client_fd < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          break;
+        }
+
+      fcntl (client_fd, F_SETFD, FD_CLOEXEC);
+
+      agent_fd = xfsm_lazy_agent_socket_new (lazy_agent_socket, &addr);
+      if (agent_fd < 0
+          || connect (agent_fd, (struct sockaddr *) &addr, sizeof (addr)) < 0)
+        {
+          g_warning ("Failed to connect to ssh-agent: %s", g_strerror (errno));
+          if (agent_fd >= 0)
+            close (agent_fd);
+          close (client_fd);
+          continue;
+        }
+
+      relay = g_slice_new0 (XfsmLazyAgentRelay);
+      relay->fds[0] = client_fd;
+      relay->fds[1] = agent_fd;
+
+      for (n = 0; n < 2; ++n)
+        {
+          channel = g_io_channel_unix_new (relay->fds[n]);
+          relay->watch_ids[n] = g_io_add_watch (channel, G_IO_IN | G_IO_HUP | G_IO_ERR,
+                                                xfsm_lazy_agent_relay_forward, relay);
+          g_io_channel_unref (channel);
+        }
+    }
+
+  xfsm_lazy_agent_close ();
+}
+
+
+/* the path exported as SSH_AUTH_SOCK, NULL if the agent is not lazy */
+const gchar *
+xfsm_lazy_agent_get_socket (void)
+{
+  return lazy_agent_socket;
+}
+
+
+void
+xfsm_lazy_agent_shutdown (void)
+{
+  if (lazy_agent_socket == NULL)
+    return;
+
+  /* the agent was never used or could not remove its socket, which
+   * we moved */
+  xfsm_lazy_agent_close ();
+  g_unlink (lazy_agent_socket);
+  g_rmdir (lazy_agent_dir);
+
+  g_free (lazy_agent_real_socket);
+  g_free (lazy_agent_socket);
+  g_free (lazy_agent_dir);
+  lazy_agent_real_socket = NULL;
+  lazy_agent_socket = NULL;
+  lazy_agent_dir = NULL;
+}
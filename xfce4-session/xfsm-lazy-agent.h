@@ -0,0 +1,45 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_LAZY_AGENT_H__
+#define __XFSM_LAZY_AGENT_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+/* called on the first connection to the lazy socket, has to start the
+ * agent listening on |agent_socket| and call xfsm_lazy_agent_ready()
+ * once the agent reported its environment */
+typedef void (*XfsmLazyAgentStartFunc) (const gchar *agent_socket,
+                                        gpointer     user_data);
+
+gboolean     xfsm_lazy_agent_init       (XfsmLazyAgentStartFunc func,
+                                         gpointer               user_data);
+
+void         xfsm_lazy_agent_ready      (gboolean               started);
+
+const gchar *xfsm_lazy_agent_get_socket (void);
+
+void         xfsm_lazy_agent_shutdown   (void);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_LAZY_AGENT_H__ */
@@ -50,13 +50,13 @@
 #ifdef HAVE_SYS_TYPES_H
 #include <sys/types.h>
 #endif
-#ifdef HAVE_SYS_TIME_H
-#include <sys/time.h>
-#endif
 
 #ifdef HAVE_MEMORY_H
 #include <memory.h>
 #endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
@@ -66,16 +66,18 @@
 
 #include <X11/Xatom.h>
 #include <X11/Xlib.h>
-#include <X11/Xutil.h>
+
+#ifdef LEGACY_SESSION_MANAGEMENT
+#include <xcb/xcb.h>
+#endif
 
 #include <gdk/gdkx.h>
 
 #include <libxfce4ui/libxfce4ui.h>
 
-#include <libwnck/libwnck.h>
-
 #include <xfce4-session/xfsm-global.h>
 #include <xfce4-session/xfsm-legacy.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <libxfsm/xfsm-util.h>
 
 
@@ -83,6 +85,19 @@
 
 #define WM_SAVE_YOURSELF_TIMEOUT  4000
 
+/* the default startup priority of restarted legacy applications,
+ * see /general/LegacyPriority */
+#define LEGACY_PRIORITY  50
+
+/* how a restarted legacy application is recognized by its window */
+#define LegacyCommand  "_XFSM_LegacyCommand"
+#define LegacyClass    "_XFSM_LegacyClass"
+
+/* upper bounds for property reads, in 32 bit units */
+#define CLIENT_LIST_LENGTH   65536
+#define WM_COMMAND_LENGTH    65536
+#define STRING_LENGTH        1024
+
 enum
 {
   SM_ERROR,
@@ -104,23 +119,41 @@ struct _SmWindow
 };
 #define SM_WINDOW(window) ((SmWindow *) (window))
 
+/* a window while its properties are queried */
 typedef struct
 {
-  gint screen_num;
-  gchar **command;
-} SmRestartApp;
-#define SM_RESTART_APP(a) ((SmRestartApp *) (a))
+  xcb_window_t              window;
+  xcb_window_t              leader;
+  gint                      screen_num;
+  xcb_get_property_cookie_t cookies[3];
+} SmCandidate;
+
+/* a session save in progress.  the legacy applications are queried
+ * over a connection of our own, so the events we select on their
+ * windows don't end up in gdk, and the replies are read from the
+ * main loop instead of blocking it */
+typedef struct
+{
+  xcb_connection_t   *connection;
+  guint               watch_id;
+  guint               timeout_id;
+  gint                awaiting_replies;
+  XfsmLegacySaveFunc  func;
+  gpointer            user_data;
+} SmSave;
 
 
-static GList *restart_apps = NULL;
-static GList *window_list = NULL;
+static GList  *window_list = NULL;
+static SmSave *current_save = NULL;
+static guint   restart_serial = 0;
 
 
 /* X Atoms */
-static Atom _XA_WM_PROTOCOLS     = None;
-static Atom _XA_WM_SAVE_YOURSELF = None;
-static Atom _XA_WM_CLIENT_LEADER = None;
-static Atom _XA_SM_CLIENT_ID     = None;
+static xcb_atom_t _XA_WM_PROTOCOLS     = XCB_ATOM_NONE;
+static xcb_atom_t _XA_WM_SAVE_YOURSELF = XCB_ATOM_NONE;
+static xcb_atom_t _XA_WM_CLIENT_LEADER = XCB_ATOM_NONE;
+static xcb_atom_t _XA_SM_CLIENT_ID     = XCB_ATOM_NONE;
+static xcb_atom_t _XA_NET_CLIENT_LIST  = XCB_ATOM_NONE;
 
 
 static SmWindow*
@@ -170,336 +203,585 @@ sm_window_list_clear (void)
 }
 
 
-static gboolean
-sm_window_list_contains (Window window)
+static xcb_get_property_cookie_t
+sm_get_property (xcb_connection_t *connection,
+                 xcb_window_t      window,
+                 xcb_atom_t        property,
+                 xcb_atom_t        type,
+                 guint32           length)
 {
-  GList *lp;
+  return xcb_get_property (connection, FALSE, window, property, type, 0, length);
+}
 
-  for (lp = window_list; lp != NULL; lp = lp->next)
-    if (SM_WINDOW (lp->data)->wid == window)
-      return TRUE;
 
-  return FALSE;
+/* NULL if the window is gone */
+static xcb_get_property_reply_t*
+sm_get_property_reply (xcb_connection_t          *connection,
+                       xcb_get_property_cookie_t  cookie)
+{
+  xcb_get_property_reply_t *reply;
+  xcb_generic_error_t      *error = NULL;
+
+  reply = xcb_get_property_reply (connection, cookie, &error);
+  if (error != NULL)
+    {
+      free (error);
+      free (reply);
+      return NULL;
+    }
+
+  return reply;
 }
 
 
-static int
-wins_error_handler (Display *display, XErrorEvent *event)
+static gboolean
+sm_reply_is_string (xcb_get_property_reply_t *reply)
 {
-  GList *lp;
-  for (lp = window_list; lp != NULL; lp = lp->next)
-    if (SM_WINDOW (lp->data)->wid == event->resourceid)
-      SM_WINDOW (lp->data)->type = SM_ERROR;
-  return 0;
+  return reply != NULL
+      && reply->type == XCB_ATOM_STRING
+      && reply->format == 8
+      && xcb_get_property_value_length (reply) > 0;
 }
 
 
-static gboolean
-has_xsmp_support (Window window)
+/* splits a list of nul terminated strings, as used by
+ * WM_COMMAND and WM_CLASS */
+static gchar**
+sm_reply_get_strings (xcb_get_property_reply_t *reply)
 {
-  XTextProperty tp;
-  gboolean has_it = FALSE;
+  GPtrArray   *strings;
+  const gchar *data;
+  gint         length;
+  gint         start;
+  gint         i;
+
+  if (!sm_reply_is_string (reply))
+    return NULL;
 
-  if (XGetTextProperty (gdk_display, window, &tp, _XA_SM_CLIENT_ID))
+  data = xcb_get_property_value (reply);
+  length = xcb_get_property_value_length (reply);
+
+  strings = g_ptr_array_new ();
+  for (start = 0, i = 0; i <= length; ++i)
     {
-      if (tp.encoding == XA_STRING && tp.format == 8 && tp.nitems != 0)
-        has_it = TRUE;
+      if (i < length && data[i] != '\0')
+        continue;
+
+      /* the last string is usually terminated too */
+      if (i == length && start == length)
+        break;
 
-      if (tp.value != NULL)
-        XFree ((char *) tp.value);
+      g_ptr_array_add (strings, g_strndup (data + start, i - start));
+      start = i + 1;
     }
+  g_ptr_array_add (strings, NULL);
 
-  return has_it;
+  return (gchar **) g_ptr_array_free (strings, FALSE);
 }
 
 
-static gchar**
-get_wmcommand (Window window)
+static void
+sm_save_intern_atoms (xcb_connection_t *connection)
 {
-  gchar **result = NULL;
-  Status status;
-  char **argv;
-  int argc, i;
-
-  gdk_error_trap_push ();
-  status = XGetCommand (gdk_display, window, &argv, &argc);
-  if (gdk_error_trap_pop ())
-    return NULL;
-
-  if (status && argv && argc > 0)
+  static const gchar *names[] =
+  {
+    "WM_PROTOCOLS",
+    "WM_SAVE_YOURSELF",
+    "WM_CLIENT_LEADER",
+    "SM_CLIENT_ID",
+    "_NET_CLIENT_LIST",
+  };
+  xcb_atom_t *atoms[] =
+  {
+    &_XA_WM_PROTOCOLS,
+    &_XA_WM_SAVE_YOURSELF,
+    &_XA_WM_CLIENT_LEADER,
+    &_XA_SM_CLIENT_ID,
+    &_XA_NET_CLIENT_LIST,
+  };
+  xcb_intern_atom_cookie_t  cookies[G_N_ELEMENTS (names)];
+  xcb_intern_atom_reply_t  *reply;
+  guint                     n;
+
+  if (_XA_NET_CLIENT_LIST != XCB_ATOM_NONE)
+    return;
+
+  /* send all requests before waiting for the first reply */
+  for (n = 0; n < G_N_ELEMENTS (names); ++n)
+    cookies[n] = xcb_intern_atom (connection, FALSE, strlen (names[n]), names[n]);
+
+  for (n = 0; n < G_N_ELEMENTS (names); ++n)
     {
-      result = g_new0 (gchar *, argc + 1);
-      for (i = 0; i < argc; ++i)
-        result[i] = g_strdup (argv[i]);
-      XFreeStringList (argv);
+      reply = xcb_intern_atom_reply (connection, cookies[n], NULL);
+      if (reply != NULL)
+        {
+          *atoms[n] = reply->atom;
+          free (reply);
+        }
     }
-
-  return result;
 }
 
 
-static gchar*
-get_wmclientmachine (Window window)
+/* fills the window list with the client leaders of the managed
+ * windows on all screens that do not speak XSMP.  every step sends
+ * the requests for all windows first and reads the replies after,
+ * so the whole query takes four round trips */
+static void
+sm_save_query_windows (SmSave *save)
 {
-  XTextProperty tp;
-  gchar *result = NULL;
-  Status status;
+  xcb_connection_t          *connection = save->connection;
+  xcb_screen_iterator_t      iter;
+  xcb_get_property_cookie_t *list_cookies;
+  xcb_get_property_reply_t  *reply;
+  xcb_window_t              *xids;
+  xcb_atom_t                *protocols;
+  GArray                    *candidates;
+  GArray                    *leaders;
+  GHashTable                *seen;
+  SmCandidate                candidate;
+  SmCandidate               *cp;
+  gchar                    **wm_class;
+  gint                       n_screens;
+  gint                       type;
+  gint                       n, i;
+
+  /* the managed windows of all screens */
+  iter = xcb_setup_roots_iterator (xcb_get_setup (connection));
+  n_screens = iter.rem;
+  list_cookies = g_new (xcb_get_property_cookie_t, n_screens);
+  for (n = 0; iter.rem > 0; ++n, xcb_screen_next (&iter))
+    {
+      list_cookies[n] = sm_get_property (connection, iter.data->root,
+                                         _XA_NET_CLIENT_LIST, XCB_ATOM_WINDOW,
+                                         CLIENT_LIST_LENGTH);
+    }
 
-  gdk_error_trap_push ();
-  status = XGetWMClientMachine (gdk_display, window, &tp);
-  if (gdk_error_trap_pop ())
-    return NULL;
+  candidates = g_array_new (FALSE, TRUE, sizeof (SmCandidate));
+  for (n = 0; n < n_screens; ++n)
+    {
+      reply = sm_get_property_reply (connection, list_cookies[n]);
+      if (reply != NULL && reply->type == XCB_ATOM_WINDOW && reply->format == 32)
+        {
+          xids = xcb_get_property_value (reply);
+          for (i = 0; i < xcb_get_property_value_length (reply) / 4; ++i)
+            {
+              memset (&candidate, 0, sizeof (candidate));
+              candidate.window = xids[i];
+              candidate.screen_num = n;
+              g_array_append_val (candidates, candidate);
+            }
+        }
+      free (reply);
+    }
+  g_free (list_cookies);
 
-  if (status)
+  /* their client leaders, and whether they speak XSMP themselves */
+  for (n = 0; n < (gint) candidates->len; ++n)
     {
-      if (tp.encoding == XA_STRING && tp.format == 8 && tp.nitems != 0)
-        result = g_strdup ((char *) tp.value);
+      cp = &g_array_index (candidates, SmCandidate, n);
+      cp->cookies[0] = sm_get_property (connection, cp->window,
+                                        _XA_WM_CLIENT_LEADER, XCB_ATOM_WINDOW, 1);
+      cp->cookies[1] = sm_get_property (connection, cp->window,
+                                        _XA_SM_CLIENT_ID, XCB_ATOM_STRING, 1);
+    }
+
+  leaders = g_array_new (FALSE, TRUE, sizeof (SmCandidate));
+  seen = g_hash_table_new (NULL, NULL);
+  for (n = 0; n < (gint) candidates->len; ++n)
+    {
+      cp = &g_array_index (candidates, SmCandidate, n);
+
+      cp->leader = cp->window;
+      reply = sm_get_property_reply (connection, cp->cookies[0]);
+      if (reply == NULL)
+        cp->leader = XCB_WINDOW_NONE;
+      else if (reply->type == XCB_ATOM_WINDOW && reply->format == 32
+               && xcb_get_property_value_length (reply) >= 4)
+        cp->leader = *((xcb_window_t *) xcb_get_property_value (reply));
+      free (reply);
+
+      reply = sm_get_property_reply (connection, cp->cookies[1]);
+      if (sm_reply_is_string (reply))
+        cp->leader = XCB_WINDOW_NONE;
+      free (reply);
+
+      if (cp->leader == XCB_WINDOW_NONE
+          || g_hash_table_lookup (seen, GUINT_TO_POINTER (cp->leader)) != NULL)
+        {
+          xfsm_verbose ("window has no client leader or supports xspm, skipping\n");
+          continue;
+        }
+
+      g_hash_table_insert (seen, GUINT_TO_POINTER (cp->leader), cp);
 
-      if (tp.value != NULL)
-        XFree ((char *) tp.value);
+      memset (&candidate, 0, sizeof (candidate));
+      candidate.window = cp->leader;
+      candidate.screen_num = cp->screen_num;
+      g_array_append_val (leaders, candidate);
     }
+  g_hash_table_destroy (seen);
+  g_array_free (candidates, TRUE);
 
-  if (result == NULL)
-    result = g_strdup ("localhost");
+  /* what the client leaders support */
+  for (n = 0; n < (gint) leaders->len; ++n)
+    {
+      cp = &g_array_index (leaders, SmCandidate, n);
+      cp->cookies[0] = sm_get_property (connection, cp->window,
+                                        _XA_SM_CLIENT_ID, XCB_ATOM_STRING, 1);
+      cp->cookies[1] = sm_get_property (connection, cp->window,
+                                        _XA_WM_PROTOCOLS, XCB_ATOM_ATOM,
+                                        STRING_LENGTH);
+      cp->cookies[2] = sm_get_property (connection, cp->window,
+                                        XCB_ATOM_WM_CLASS, XCB_ATOM_STRING,
+                                        STRING_LENGTH);
+    }
+
+  for (n = 0; n < (gint) leaders->len; ++n)
+    {
+      cp = &g_array_index (leaders, SmCandidate, n);
+
+      reply = sm_get_property_reply (connection, cp->cookies[0]);
+      if (reply == NULL || sm_reply_is_string (reply))
+        {
+          xfsm_verbose ("window has no client leader or supports xspm, skipping\n");
+          free (reply);
+          /* drop the other replies */
+          xcb_discard_reply (connection, cp->cookies[1].sequence);
+          xcb_discard_reply (connection, cp->cookies[2].sequence);
+          continue;
+        }
+      free (reply);
 
-  return result;
+      type = SM_WMCOMMAND;
+      reply = sm_get_property_reply (connection, cp->cookies[1]);
+      if (reply != NULL && reply->type == XCB_ATOM_ATOM && reply->format == 32)
+        {
+          protocols = xcb_get_property_value (reply);
+          for (i = 0; i < xcb_get_property_value_length (reply) / 4; ++i)
+            if (protocols[i] == _XA_WM_SAVE_YOURSELF)
+              {
+                type = SM_WMSAVEYOURSELF;
+                break;
+              }
+        }
+      free (reply);
+
+      reply = sm_get_property_reply (connection, cp->cookies[2]);
+      wm_class = sm_reply_get_strings (reply);
+      free (reply);
+
+      window_list = g_list_prepend (window_list,
+                                    sm_window_new (cp->window, cp->screen_num, type,
+                                                   wm_class != NULL && wm_class[0] != NULL
+                                                   ? g_strdup (wm_class[0]) : NULL,
+                                                   wm_class != NULL && wm_class[0] != NULL
+                                                   && wm_class[1] != NULL
+                                                   ? g_strdup (wm_class[1]) : NULL));
+      g_strfreev (wm_class);
+    }
+  window_list = g_list_reverse (window_list);
+
+  g_array_free (leaders, TRUE);
 }
 
-static Window
-get_clientleader (Window window)
+
+static void
+sm_save_send_save_yourself (SmSave *save)
 {
-  Atom type;
-  int format, status;
-  unsigned long nitems = 0;
-  unsigned long extra = 0;
-  unsigned char *data = 0;
-  Window result = window;
-
-  status = XGetWindowProperty (gdk_display, window, _XA_WM_CLIENT_LEADER,
-                               0, 10000, FALSE, XA_WINDOW, &type, &format,
-                               &nitems, &extra, &data);
-  if (status  == Success)
+  const guint32               mask = XCB_EVENT_MASK_PROPERTY_CHANGE
+                                     | XCB_EVENT_MASK_STRUCTURE_NOTIFY;
+  xcb_client_message_event_t  ev;
+  SmWindow                   *sm_window;
+  GList                      *lp;
+
+  for (lp = window_list; lp != NULL; lp = lp->next)
     {
-      if (data != NULL && nitems > 0)
-          result = *((Window *) data);
-      XFree(data);
+      sm_window = SM_WINDOW (lp->data);
+      if (sm_window->type != SM_WMSAVEYOURSELF)
+        continue;
+
+      ++save->awaiting_replies;
+
+      memset (&ev, 0, sizeof (ev));
+      ev.response_type = XCB_CLIENT_MESSAGE;
+      ev.window = sm_window->wid;
+      ev.type = _XA_WM_PROTOCOLS;
+      ev.format = 32;
+      ev.data.data32[0] = _XA_WM_SAVE_YOURSELF;
+      ev.data.data32[1] = XCB_CURRENT_TIME;
+
+      xcb_change_window_attributes (save->connection, sm_window->wid,
+                                    XCB_CW_EVENT_MASK, &mask);
+      xcb_send_event (save->connection, FALSE, sm_window->wid,
+                      XCB_EVENT_MASK_NO_EVENT, (const gchar *) &ev);
     }
 
-  return result;
+  xcb_flush (save->connection);
 }
 
-#endif
-
 
-void
-xfsm_legacy_perform_session_save (void)
+static void
+sm_save_window_replied (SmSave       *save,
+                        xcb_window_t  window,
+                        gboolean      failed)
 {
-#ifdef LEGACY_SESSION_MANAGEMENT
-  XErrorHandler old_handler;
-  WnckScreen *screen;
-  GList *windows;
-  GList *lp;
-  Window leader;
-  Display *display;
-  Atom *protocols;
-  int nprotocols;
-  XClassHint class_hint;
   SmWindow *sm_window;
-  int n, i;
-  int type;
-  gchar *wmclass1;
-  gchar *wmclass2;
-  Window root, window;
-  XEvent ev;
-  int awaiting_replies = 0;
-  GTimer *timer;
-
-  /* clear window list */
-  sm_window_list_clear ();
+  GList    *lp;
 
-  /* query X atoms */
-  if (_XA_WM_SAVE_YOURSELF == None)
+  for (lp = window_list; lp != NULL; lp = lp->next)
     {
-      _XA_SM_CLIENT_ID = XInternAtom (gdk_display, "SM_CLIENT_ID", False);
-      _XA_WM_PROTOCOLS = XInternAtom (gdk_display, "WM_PROTOCOLS", False);
-      _XA_WM_SAVE_YOURSELF = XInternAtom (gdk_display, "WM_SAVE_YOURSELF",
-                                          False);
-      _XA_WM_CLIENT_LEADER = XInternAtom (gdk_display, "WM_CLIENT_LEADER",
-                                          False);
-    }
+      sm_window = SM_WINDOW (lp->data);
+      if (sm_window->wid != window)
+        continue;
 
-  /* install custom X error handler */
-  old_handler = XSetErrorHandler (wins_error_handler);
+      if (sm_window->type == SM_WMSAVEYOURSELF)
+        --save->awaiting_replies;
 
-  /* query mapped windows on all screens */
-  for (n = 0; n < ScreenCount (gdk_display); ++n)
-    {
-      screen = wnck_screen_get (n);
-      wnck_screen_force_update (screen);
+      if (failed)
+        sm_window->type = SM_ERROR;
+      else if (sm_window->type != SM_ERROR)
+        sm_window->type = SM_WMCOMMAND;
+    }
+}
 
-      windows = wnck_screen_get_windows (screen);
 
-      for (lp = windows; lp != NULL; lp = lp->next)
+static void
+sm_save_handle_events (SmSave *save)
+{
+  xcb_generic_event_t *event;
+
+  while ((event = xcb_poll_for_event (save->connection)) != NULL)
+    {
+      switch (event->response_type & ~0x80)
         {
-          window = wnck_window_get_xid (WNCK_WINDOW (lp->data));
-          leader = get_clientleader (window);
-          if (leader == None || sm_window_list_contains (leader)
-              || has_xsmp_support (window) || has_xsmp_support (leader))
+        case 0:
+          /* the window was destroyed before we got to it */
+          sm_save_window_replied (save,
+                                  ((xcb_generic_error_t *) event)->resource_id,
+                                  TRUE);
+          break;
+
+        case XCB_UNMAP_NOTIFY:
+          sm_save_window_replied (save,
+                                  ((xcb_unmap_notify_event_t *) event)->window,
+                                  FALSE);
+          break;
+
+        case XCB_PROPERTY_NOTIFY:
+          if (((xcb_property_notify_event_t *) event)->atom == XCB_ATOM_WM_COMMAND)
             {
-              xfsm_verbose ("window has no client leader or supports xspm, skipping\n");
-              continue;
+              sm_save_window_replied (save,
+                                      ((xcb_property_notify_event_t *) event)->window,
+                                      FALSE);
             }
+          break;
+        }
 
-          type = SM_WMCOMMAND;
-          wmclass1 = NULL;
-          wmclass2 = NULL;
+      free (event);
+    }
+}
 
-          nprotocols = 0;
-          protocols = NULL;
 
-          if (XGetWMProtocols (gdk_display, leader, &protocols, &nprotocols))
-            {
-              for (i = 0; i < nprotocols; ++i)
-                if (protocols[i] == _XA_WM_SAVE_YOURSELF)
-                  {
-                    type = SM_WMSAVEYOURSELF;
-                    break;
-                  }
-              XFree ((void *) protocols);
-            }
+static void
+sm_save_free (SmSave *save)
+{
+  if (save->watch_id != 0)
+    g_source_remove (save->watch_id);
+  if (save->timeout_id != 0)
+    g_source_remove (save->timeout_id);
 
-          if (XGetClassHint (gdk_display, leader, &class_hint))
-            {
-              wmclass2 = g_strdup (class_hint.res_class);
-              wmclass1 = g_strdup (class_hint.res_name);
-              XFree (class_hint.res_class);
-              XFree (class_hint.res_name);
-            }
+  xcb_disconnect (save->connection);
+  g_free (save);
+}
 
-          sm_window = sm_window_new (leader, n, type, wmclass1, wmclass2);
-          window_list = g_list_append (window_list, sm_window);
-        }
-    }
 
-  /* open fresh display for sending WM_SAVE_YOURSELF commands */
-  XSync (gdk_display, False);
-  display = XOpenDisplay (DisplayString (gdk_display));
-  if (display == NULL)
+/* reads the saved commands and hands the result to the manager */
+static void
+sm_save_finish (SmSave *save)
+{
+  xcb_get_property_cookie_t *cookies;
+  xcb_get_property_reply_t  *reply;
+  XfsmLegacySaveFunc         func = save->func;
+  gpointer                   user_data = save->user_data;
+  SmWindow                  *sm_window;
+  GList                     *lp;
+  gint                       n_windows;
+  gint                       n;
+
+  n_windows = g_list_length (window_list);
+  cookies = g_new0 (xcb_get_property_cookie_t, 2 * n_windows);
+
+  for (lp = window_list, n = 0; lp != NULL; lp = lp->next, n += 2)
     {
-      XSetErrorHandler (old_handler);
-      return;
+      sm_window = SM_WINDOW (lp->data);
+      if (sm_window->type == SM_ERROR)
+        continue;
+
+      cookies[n] = sm_get_property (save->connection, sm_window->wid,
+                                    XCB_ATOM_WM_COMMAND, XCB_ATOM_STRING,
+                                    WM_COMMAND_LENGTH);
+      cookies[n + 1] = sm_get_property (save->connection, sm_window->wid,
+                                        XCB_ATOM_WM_CLIENT_MACHINE,
+                                        XCB_ATOM_STRING, STRING_LENGTH);
     }
 
-  /* grab keyboard/pointer (XXX - check pointer pos first?) */
-  root = DefaultRootWindow (display);
-  XGrabKeyboard (display, root, False, GrabModeAsync, GrabModeAsync,
-                 CurrentTime);
-  XGrabPointer (display, root, False, Button1Mask | Button2Mask | Button3Mask,
-                GrabModeAsync, GrabModeAsync, None, None, CurrentTime);
-  for (lp = window_list; lp != NULL; lp = lp->next)
+  for (lp = window_list, n = 0; lp != NULL; lp = lp->next, n += 2)
     {
       sm_window = SM_WINDOW (lp->data);
-      if (sm_window->type == SM_WMSAVEYOURSELF)
-        {
-          ++awaiting_replies;
-
-          bzero (&ev, sizeof (ev));
-
-          ev.xclient.type = ClientMessage;
-          ev.xclient.window = sm_window->wid;
-          ev.xclient.message_type = _XA_WM_PROTOCOLS;
-          ev.xclient.format = 32;
-          ev.xclient.data.l[0] = _XA_WM_SAVE_YOURSELF;
-          ev.xclient.data.l[1] = CurrentTime;
-          XSelectInput (display, sm_window->wid,
-                        PropertyChangeMask | StructureNotifyMask);
-          XSendEvent (display, sm_window->wid, False, 0, &ev);
-        }
-    }
+      if (sm_window->type == SM_ERROR)
+        continue;
 
-  /* wait for change in WM_COMMAND with timeout */
-  XFlush (display);
-  timer = g_timer_new ();
-  while (awaiting_replies > 0)
-    {
-      if (XPending (display))
-        {
-          XNextEvent (display, &ev);
-          if (ev.type == UnmapNotify || (ev.type == PropertyNotify
-                && ev.xproperty.atom == XA_WM_COMMAND))
-            {
-              for (lp = window_list; lp != NULL; lp = lp->next)
-                {
-                  if (SM_WINDOW (lp->data)->wid == ev.xany.window
-                      && SM_WINDOW (lp->data)->type != SM_WMCOMMAND)
-                    {
-                      --awaiting_replies;
-                      if (SM_WINDOW (lp->data)->type != SM_ERROR)
-                        SM_WINDOW (lp->data)->type = SM_WMCOMMAND;
-                    }
-                }
-            }
-        }
-      else
+      reply = sm_get_property_reply (save->connection, cookies[n]);
+      sm_window->wm_command = sm_reply_get_strings (reply);
+      free (reply);
+
+      reply = sm_get_property_reply (save->connection, cookies[n + 1]);
+      if (reply != NULL)
         {
-          struct timeval tv;
-          fd_set fds;
-          int msecs;
-          int fd;
-          int ret;
-
-          msecs = (int)(g_timer_elapsed (timer, NULL) * 1000);
-          if (msecs >= WM_SAVE_YOURSELF_TIMEOUT)
-            break;
-
-          fd = ConnectionNumber (display);
-          FD_ZERO (&fds);
-          FD_SET (fd, &fds);
-          tv.tv_sec = (WM_SAVE_YOURSELF_TIMEOUT - msecs) / 1000;
-          tv.tv_usec = ((WM_SAVE_YOURSELF_TIMEOUT - msecs) % 1000) * 1000;
-          ret = select (fd + 1, &fds, NULL, &fds, &tv);
-          if (ret == -1)
-            {
-              perror ("select");
-            }
-          else if (ret == 0)
+          if (sm_reply_is_string (reply))
             {
-              g_warning ("xfsm_legacy_perform_session_save, select: no data before timeout reached");
+              sm_window->wm_client_machine =
+                g_strndup (xcb_get_property_value (reply),
+                           xcb_get_property_value_length (reply));
             }
+          else
+            sm_window->wm_client_machine = g_strdup ("localhost");
         }
+      free (reply);
+
+      if (sm_window->wm_command == NULL || sm_window->wm_client_machine == NULL)
+        sm_window->type = SM_ERROR;
     }
-  g_timer_destroy (timer);
 
-  /* Terminate work in new display */
-  XAllowEvents (display, ReplayPointer, CurrentTime);
-  XAllowEvents (display, ReplayKeyboard, CurrentTime);
-  XSync (display, False);
-  XCloseDisplay (display);
-  XSetErrorHandler (old_handler);
+  g_free (cookies);
 
-  for (lp = window_list; lp != NULL; lp = lp->next)
+  current_save = NULL;
+  sm_save_free (save);
+
+  if (func != NULL)
+    func (user_data);
+}
+
+
+static gboolean
+sm_save_io (GIOChannel   *source,
+            GIOCondition  condition,
+            gpointer      user_data)
+{
+  SmSave *save = user_data;
+
+  sm_save_handle_events (save);
+
+  if (save->awaiting_replies > 0
+      && !xcb_connection_has_error (save->connection))
+    return TRUE;
+
+  save->watch_id = 0;
+  sm_save_finish (save);
+
+  return FALSE;
+}
+
+
+static gboolean
+sm_save_timeout (gpointer user_data)
+{
+  SmSave *save = user_data;
+
+  xfsm_verbose ("%d legacy applications did not answer WM_SAVE_YOURSELF in time\n",
+                save->awaiting_replies);
+
+  save->timeout_id = 0;
+  sm_save_finish (save);
+
+  return FALSE;
+}
+
+
+/* returns FALSE if the X server could not be reached */
+static gboolean
+sm_save_start (XfsmLegacySaveFunc func,
+               gpointer           user_data)
+{
+  xcb_connection_t *connection;
+  GIOChannel       *channel;
+  SmSave           *save;
+
+  connection = xcb_connect (DisplayString (gdk_display), NULL);
+  if (xcb_connection_has_error (connection))
     {
-      sm_window = SM_WINDOW (lp->data);
-      if (sm_window->type != SM_ERROR)
-        {
-          sm_window->wm_command = get_wmcommand (sm_window->wid);
-          sm_window->wm_client_machine = get_wmclientmachine (sm_window->wid);
-          if (sm_window->wm_command == NULL || sm_window->wm_client_machine == NULL)
-            sm_window->type = SM_ERROR;
-        }
+      g_warning ("Unable to connect to the X server to save legacy applications");
+      xcb_disconnect (connection);
+      return FALSE;
     }
+
+  save = g_new0 (SmSave, 1);
+  save->connection = connection;
+  save->func = func;
+  save->user_data = user_data;
+
+  sm_save_intern_atoms (connection);
+  sm_save_query_windows (save);
+  sm_save_send_save_yourself (save);
+
+  if (save->awaiting_replies == 0)
+    {
+      sm_save_finish (save);
+      return TRUE;
+    }
+
+  /* wait for the changes in WM_COMMAND from the main loop */
+  channel = g_io_channel_unix_new (xcb_get_file_descriptor (connection));
+  save->watch_id = g_io_add_watch (channel, G_IO_IN | G_IO_HUP | G_IO_ERR,
+                                   sm_save_io, save);
+  g_io_channel_unref (channel);
+
+  save->timeout_id = g_timeout_add (WM_SAVE_YOURSELF_TIMEOUT,
+                                    sm_save_timeout, save);
+
+  current_save = save;
+
+  return TRUE;
+}
+
 #endif
+
+
+void
+xfsm_legacy_perform_session_save (XfsmLegacySaveFunc func,
+                                  gpointer           user_data)
+{
+#ifdef LEGACY_SESSION_MANAGEMENT
+  /* a save still running belongs to an aborted checkpoint */
+  if (current_save != NULL)
+    {
+      sm_save_free (current_save);
+      current_save = NULL;
+    }
+
+  /* clear window list */
+  sm_window_list_clear ();
+
+  /* there are no X11 windows to ask in headless mode */
+  if (!xfsm_headless && sm_save_start (func, user_data))
+    return;
+#endif
+
+  if (func != NULL)
+    func (user_data);
 }
 
 
 void
-xfsm_legacy_store_session (XfceRc *rc)
+xfsm_legacy_store_session (GKeyFile    *file,
+                           const gchar *group)
 {
 #ifdef LEGACY_SESSION_MANAGEMENT
   int count = 0;
   SmWindow *sm_window;
   GList *lp;
   gchar buffer[256];
+  gchar *value;
 
   for (lp = window_list; lp != NULL; lp = lp->next)
     {
@@ -528,32 +810,43 @@ xfsm_legacy_store_session (XfceRc *rc)
             }
 
           g_snprintf (buffer, 256, "Legacy%d_Screen", count);
-          xfce_rc_write_int_entry (rc, buffer, sm_window->screen_num);
+          g_key_file_set_integer (file, group, buffer, sm_window->screen_num);
 
           g_snprintf (buffer, 256, "Legacy%d_Command", count);
-          xfce_rc_write_list_entry (rc, buffer, sm_window->wm_command, NULL);
+          value = g_strjoinv (",", sm_window->wm_command);
+          g_key_file_set_string (file, group, buffer, value);
+          g_free (value);
 
           g_snprintf (buffer, 256, "Legacy%d_ClientMachine", count);
-          xfce_rc_write_entry (rc, buffer, sm_window->wm_client_machine);
+          g_key_file_set_string (file, group, buffer, sm_window->wm_client_machine);
+
+          if (sm_window->wm_class1 != NULL && sm_window->wm_class2 != NULL)
+            {
+              value = g_strconcat (sm_window->wm_class1, ",", sm_window->wm_class2, NULL);
+              g_snprintf (buffer, 256, "Legacy%d_Class", count);
+              g_key_file_set_string (file, group, buffer, value);
+              g_free (value);
+            }
 
           ++count;
         }
     }
 
-  xfce_rc_write_int_entry (rc, "LegacyCount", count);
+  g_key_file_set_integer (file, group, "LegacyCount", count);
 #endif
 }
 
 
 void
-xfsm_legacy_load_session (XfceRc *rc)
+xfsm_legacy_load_session (XfceRc *rc,
+                          GQueue *properties)
 {
 #ifdef LEGACY_SESSION_MANAGEMENT
   gchar buffer[256];
   int count;
   int i;
   gchar **command;
-  SmRestartApp *app;
+  gchar **wm_class;
   int screen_num;
 
   count = xfce_rc_read_int_entry (rc, "LegacyCount", 0);
@@ -576,13 +869,115 @@ xfsm_legacy_load_session (XfceRc *rc)
           g_free (dbg_command);
         }
 
-      app = g_new0 (SmRestartApp, 1);
-      app->screen_num = screen_num;
-      app->command = command;
+      g_snprintf (buffer, 256, "Legacy%d_Class", i);
+      wm_class = xfce_rc_read_list_entry (rc, buffer, NULL);
+
+      xfsm_legacy_add_restart_app (screen_num, command, wm_class, properties);
+    }
+#endif
+}
+
+
+void
+xfsm_legacy_add_restart_app (gint     screen_num,
+                             gchar  **command,
+                             gchar  **wm_class,
+                             GQueue  *properties)
+{
+#ifdef LEGACY_SESSION_MANAGEMENT
+  XfsmProperties *app;
+  GdkDisplay     *display;
+  GPtrArray      *restart_command;
+  gchar          *client_id;
+  gchar          *screen_name;
+  gint            priority;
+  gint            n;
+
+  /* nothing would ever map a window in headless mode */
+  if (xfsm_headless || command[0] == NULL)
+    {
+      g_strfreev (command);
+      g_strfreev (wm_class);
+      return;
+    }
+
+  /* the scheduler starts it like any other client, so it needs a
+   * client id, but it won't ever register with it */
+  client_id = g_strdup_printf ("xfsm-legacy-%u", ++restart_serial);
+  app = xfsm_properties_new (client_id, NULL);
+  app->legacy = TRUE;
+  g_free (client_id);
+
+  restart_command = g_ptr_array_new ();
+  display = gdk_display_get_default ();
+  if (screen_num > 0 && screen_num < gdk_display_get_n_screens (display))
+    {
+      /* like xfsm_start_application() */
+      g_ptr_array_add (restart_command, g_strdup ("env"));
+      screen_name = gdk_screen_make_display_name (gdk_display_get_screen (display, screen_num));
+      g_ptr_array_add (restart_command, g_strconcat ("DISPLAY=", screen_name, NULL));
+      g_free (screen_name);
+    }
+  for (n = 0; command[n] != NULL; ++n)
+    g_ptr_array_add (restart_command, g_strdup (command[n]));
+  g_ptr_array_add (restart_command, NULL);
+
+  priority = xfsm_settings_get_int (xfsm_settings_get (),
+                                    "/general/LegacyPriority",
+                                    LEGACY_PRIORITY);
+
+  xfsm_properties_set_string (app, SmProgram, command[0]);
+  xfsm_properties_set_strv (app, SmRestartCommand, (gchar **) restart_command->pdata);
+  xfsm_properties_set_uchar (app, GsmPriority, CLAMP (priority, 0, 255));
+  xfsm_properties_set_strv (app, LegacyCommand, command);
+  if (wm_class != NULL && g_strv_length (wm_class) == 2)
+    xfsm_properties_set_strv (app, LegacyClass, wm_class);
+
+  g_queue_push_tail (properties, app);
+
+  g_strfreev ((gchar **) g_ptr_array_free (restart_command, FALSE));
+#endif
+
+  g_strfreev (command);
+  g_strfreev (wm_class);
+}
+
+
+gboolean
+xfsm_legacy_window_matches (XfsmProperties           *properties,
+                            const XfsmWnckWindowInfo *info)
+{
+#ifdef LEGACY_SESSION_MANAGEMENT
+  gchar **command;
+  gchar **wm_class;
+  gint    n;
 
-      restart_apps = g_list_append (restart_apps, app);
+  if (!properties->legacy)
+    return FALSE;
+
+  /* env execs the command, so the pid is the one we spawned */
+  if (info->pid > 0 && info->pid == properties->pid)
+    return TRUE;
+
+  command = xfsm_properties_get_strv (properties, LegacyCommand);
+  if (command != NULL && info->command != NULL)
+    {
+      for (n = 0; command[n] != NULL && info->command[n] != NULL; ++n)
+        if (strcmp (command[n], info->command[n]) != 0)
+          break;
+
+      if (command[n] == NULL && info->command[n] == NULL)
+        return TRUE;
     }
+
+  wm_class = xfsm_properties_get_strv (properties, LegacyClass);
+  if (wm_class != NULL
+      && g_strcmp0 (wm_class[0], info->res_name) == 0
+      && g_strcmp0 (wm_class[1], info->res_class) == 0)
+    return TRUE;
 #endif
+
+  return FALSE;
 }
 
 
@@ -596,6 +991,9 @@ xfsm_legacy_init (void)
   Window root;
   int n;
 
+  if (xfsm_headless)
+    return;
+
   dpy = gdk_display;
 
   /* Some CDE apps are broken (thanks again to Craig for the Sun Box :).
@@ -621,35 +1019,18 @@ xfsm_legacy_init (void)
 
 
 void
-xfsm_legacy_startup (void)
+xfsm_legacy_shutdown (void)
 {
 #ifdef LEGACY_SESSION_MANAGEMENT
-  GdkScreen *screen;
+  SmWindow *sm_window;
   GList *lp;
 
-  for (lp = restart_apps; lp != NULL; lp = lp->next)
+  if (current_save != NULL)
     {
-      screen = gdk_display_get_screen (gdk_display_get_default (),
-                                       SM_RESTART_APP (lp->data)->screen_num);
-      xfsm_start_application (SM_RESTART_APP (lp->data)->command, NULL,
-                              screen, NULL, NULL, NULL);
-      g_strfreev (SM_RESTART_APP (lp->data)->command);
-      g_free (lp->data);
+      sm_save_free (current_save);
+      current_save = NULL;
     }
 
-  g_list_free (restart_apps);
-  restart_apps = NULL;
-#endif
-}
-
-
-void
-xfsm_legacy_shutdown (void)
-{
-#ifdef LEGACY_SESSION_MANAGEMENT
-  SmWindow *sm_window;
-  GList *lp;
-
   gdk_error_trap_push ();
 
   /* kill 'em all! */
@@ -26,12 +26,26 @@
 
 #include <libxfce4util/libxfce4util.h>
 
+#include <xfce4-session/xfsm-properties.h>
+#include <xfce4-session/xfsm-wnck.h>
 
-void xfsm_legacy_perform_session_save (void);
-void xfsm_legacy_store_session (XfceRc *rc);
-void xfsm_legacy_load_session (XfceRc *rc);
+
+typedef void (*XfsmLegacySaveFunc) (gpointer user_data);
+
+/* asks the legacy applications to save themselves, |func| is
+ * called once they did or the timeout expired */
+void xfsm_legacy_perform_session_save (XfsmLegacySaveFunc func,
+                                       gpointer           user_data);
+void xfsm_legacy_store_session (GKeyFile *file, const gchar *group);
+
+/* the saved legacy applications are added to |properties| and
+ * started by the scheduler, see xfsm-startup.c */
+void xfsm_legacy_load_session (XfceRc *rc, GQueue *properties);
+void xfsm_legacy_add_restart_app (gint screen_num, gchar **command,
+                                  gchar **wm_class, GQueue *properties);
+gboolean xfsm_legacy_window_matches (XfsmProperties *properties,
+                                     const XfsmWnckWindowInfo *info);
 void xfsm_legacy_init (void);
-void xfsm_legacy_startup (void);
 void xfsm_legacy_shutdown (void);
 
 #endif /* !__XFSM_LEGACY_H__ */
@@ -52,17 +52,25 @@
 #include <xfce4-session/xfsm-fadeout.h>
 #include <xfce4-session/xfsm-global.h>
 #include <xfce4-session/xfsm-legacy.h>
+#include <xfce4-session/xfsm-settings.h>
+#include <xfce4-session/xfsm-thumbs.h>
 #include <xfce4-session/xfsm-error.h>
 
 #ifdef GDK_WINDOWING_X11
 #include <X11/Xlib.h>
 #include <gdk/gdkx.h>
+#ifdef HAVE_XEXT
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#endif
 #endif
 
 
 
 #define BORDER   6
-#define SHOTSIZE 64
+#define SHOTSIZE XFSM_THUMBS_SIZE
 
 
 
@@ -112,12 +120,29 @@ struct _XfsmLogoutDialog
   XfsmShutdown     *shutdown;
 };
 
+/* the screen taken before the dialog is shown, scaled down and
+ * written by a worker once the user logs out */
+typedef struct
+{
+  GdkPixbuf *thumb;
+#ifdef HAVE_XEXT
+  XImage    *image;        /* the full screen in a MIT-SHM segment */
+#endif
+  gchar     *filename;
+  gchar     *session_name;
+} XfsmScreenshot;
+
 
 
 G_DEFINE_TYPE (XfsmLogoutDialog, xfsm_logout_dialog, GTK_TYPE_DIALOG)
 
 
 
+/* screenshots still being written by a worker */
+static guint screenshot_saves_pending = 0;
+
+
+
 static void
 xfsm_logout_dialog_class_init (XfsmLogoutDialogClass *klass)
 {
@@ -149,7 +174,7 @@ xfsm_logout_dialog_init (XfsmLogoutDialog *dialog)
   gboolean       auth_suspend = FALSE;
   gboolean       auth_hibernate = FALSE;
   GError        *error = NULL;
-  XfconfChannel *channel;
+  XfsmSettings  *settings;
   GtkWidget     *image;
   GtkWidget     *separator;
   gboolean       upower_not_found = FALSE;
@@ -163,9 +188,9 @@ xfsm_logout_dialog_init (XfsmLogoutDialog *dialog)
   gtk_window_set_resizable (GTK_WINDOW (dialog), FALSE);
 
   /* load xfconf settings */
-  channel = xfsm_open_config ();
+  settings = xfsm_settings_get ();
   if (xfsm_shutdown_can_save_session (dialog->shutdown))
-    save_session = xfconf_channel_get_bool (channel, "/general/SaveOnExit", TRUE);
+    save_session = xfsm_settings_get_bool (settings, "/general/SaveOnExit", TRUE);
 
   main_vbox = gtk_vbox_new (FALSE, BORDER);
   gtk_box_pack_start (GTK_BOX (GTK_DIALOG (dialog)->vbox), main_vbox, TRUE, TRUE, 0);
@@ -278,7 +303,7 @@ xfsm_logout_dialog_init (XfsmLogoutDialog *dialog)
    *
    * Hide the button if UPower is not installed or system cannot suspend
    **/
-  if (xfconf_channel_get_bool (channel, "/shutdown/ShowSuspend", TRUE))
+  if (xfsm_settings_get_bool (settings, "/shutdown/ShowSuspend", TRUE))
     {
       if (xfsm_shutdown_can_suspend (dialog->shutdown, &can_suspend, &auth_suspend, &error))
         {
@@ -312,7 +337,7 @@ xfsm_logout_dialog_init (XfsmLogoutDialog *dialog)
    * Hide the button if UPower is not installed or system cannot suspend
    **/
   if (!upower_not_found
-      && xfconf_channel_get_bool (channel, "/shutdown/ShowHibernate", TRUE))
+      && xfsm_settings_get_bool (settings, "/shutdown/ShowHibernate", TRUE))
     {
       if (xfsm_shutdown_can_hibernate (dialog->shutdown, &can_hibernate, &auth_hibernate, &error))
         {
@@ -341,7 +366,7 @@ xfsm_logout_dialog_init (XfsmLogoutDialog *dialog)
    * Save session
    **/
   if (xfsm_shutdown_can_save_session (dialog->shutdown)
-      && !xfconf_channel_get_bool (channel, "/general/AutoSave", FALSE))
+      && !xfsm_settings_get_bool (settings, "/general/AutoSave", FALSE))
     {
       dialog->save_session = gtk_check_button_new_with_mnemonic (_("_Save session for future logins"));
       gtk_toggle_button_set_active (GTK_TOGGLE_BUTTON (dialog->save_session), save_session);
@@ -486,13 +511,203 @@ xfsm_logout_dialog_button (const gchar      *title,
 
 
 
-static GdkPixbuf *
+static void
+xfsm_logout_dialog_thumb_size (gint  source_width,
+                               gint  source_height,
+                               gint *dest_width,
+                               gint *dest_height)
+{
+  gdouble wratio;
+  gdouble hratio;
+
+  wratio = (gdouble) source_width  / (gdouble) SHOTSIZE;
+  hratio = (gdouble) source_height / (gdouble) SHOTSIZE;
+
+  if (hratio > wratio)
+    {
+      *dest_width  = rint (source_width / hratio);
+      *dest_height = SHOTSIZE;
+    }
+  else
+    {
+      *dest_width  = SHOTSIZE;
+      *dest_height = rint (source_height / wratio);
+    }
+
+  *dest_width = MAX (*dest_width, 1);
+  *dest_height = MAX (*dest_height, 1);
+}
+
+
+
+#ifdef HAVE_XEXT
+/* box filters a 32bpp x8r8g8b8 image into the rgb thumbnail, each
+ * source pixel is read once and the inner loops are kept free of
+ * branches so the compiler can vectorize them */
+static void
+xfsm_logout_dialog_screenshot_box (XImage    *image,
+                                   GdkPixbuf *thumb)
+{
+  gint     dest_width = gdk_pixbuf_get_width (thumb);
+  gint     dest_height = gdk_pixbuf_get_height (thumb);
+  gint     rowstride = gdk_pixbuf_get_rowstride (thumb);
+  guchar  *pixels = gdk_pixbuf_get_pixels (thumb);
+  guint32 *sums;
+  gint    *columns;
+  gint     dx, dy, sx, sy;
+  gint     sy0, sy1, sx0, sx1;
+  guint    area;
+  guchar  *dest;
+
+  /* the first source column of each destination column */
+  columns = g_new (gint, dest_width + 1);
+  for (dx = 0; dx <= dest_width; dx++)
+    columns[dx] = (gint) ((gint64) dx * image->width / dest_width);
+
+  sums = g_new (guint32, dest_width * 3);
+
+  for (dy = 0; dy < dest_height; dy++)
+    {
+      sy0 = (gint64) dy * image->height / dest_height;
+      sy1 = (gint64) (dy + 1) * image->height / dest_height;
+      sy1 = MAX (sy1, sy0 + 1);
+
+      memset (sums, 0, sizeof (guint32) * dest_width * 3);
+
+      for (sy = sy0; sy < sy1; sy++)
+        {
+          const guint32 *row = (const guint32 *) (image->data + (gsize) sy * image->bytes_per_line);
+
+          for (dx = 0; dx < dest_width; dx++)
+            {
+              guint32 r = 0, g = 0, b = 0;
+
+              sx1 = MAX (columns[dx + 1], columns[dx] + 1);
+              for (sx = columns[dx]; sx < sx1; sx++)
+                {
+                  r += (row[sx] >> 16) & 0xff;
+                  g += (row[sx] >> 8) & 0xff;
+                  b += row[sx] & 0xff;
+                }
+
+              sums[dx * 3] += r;
+              sums[dx * 3 + 1] += g;
+              sums[dx * 3 + 2] += b;
+            }
+        }
+
+      dest = pixels + dy * rowstride;
+      for (dx = 0; dx < dest_width; dx++)
+        {
+          sx0 = columns[dx];
+          sx1 = MAX (columns[dx + 1], sx0 + 1);
+          area = (sx1 - sx0) * (sy1 - sy0);
+
+          dest[dx * 3] = sums[dx * 3] / area;
+          dest[dx * 3 + 1] = sums[dx * 3 + 1] / area;
+          dest[dx * 3 + 2] = sums[dx * 3 + 2] / area;
+        }
+    }
+
+  g_free (sums);
+  g_free (columns);
+}
+
+
+
+/* grabs the root window through a MIT-SHM segment. the segment is
+ * only detached from the X server, so the box filter can read the
+ * screen from a worker without another copy */
+static XImage *
+xfsm_logout_dialog_screenshot_shm (GdkScreen *screen,
+                                   gint       width,
+                                   gint       height)
+{
+  Display         *dpy = GDK_DISPLAY_XDISPLAY (gdk_screen_get_display (screen));
+  gint             screen_num = gdk_screen_get_number (screen);
+  XShmSegmentInfo  shminfo;
+  XImage          *image;
+  gboolean         succeed;
+
+  if (!XShmQueryExtension (dpy))
+    return NULL;
+
+  image = XShmCreateImage (dpy, DefaultVisual (dpy, screen_num),
+                           DefaultDepth (dpy, screen_num), ZPixmap,
+                           NULL, &shminfo, width, height);
+  if (G_UNLIKELY (image == NULL))
+    return NULL;
+
+  /* only the common x8r8g8b8 layout is handled here */
+  if (image->bits_per_pixel != 32
+      || image->red_mask != 0xff0000
+      || image->green_mask != 0xff00
+      || image->blue_mask != 0xff
+      || image->byte_order != (G_BYTE_ORDER == G_LITTLE_ENDIAN ? LSBFirst : MSBFirst))
+    {
+      XDestroyImage (image);
+      return NULL;
+    }
+
+  shminfo.shmid = shmget (IPC_PRIVATE, (gsize) image->bytes_per_line * image->height,
+                          IPC_CREAT | 0600);
+  if (shminfo.shmid < 0)
+    {
+      XDestroyImage (image);
+      return NULL;
+    }
+
+  shminfo.shmaddr = image->data = shmat (shminfo.shmid, NULL, 0);
+  shminfo.readOnly = False;
+
+  if (shminfo.shmaddr == (gchar *) -1)
+    {
+      shmctl (shminfo.shmid, IPC_RMID, NULL);
+      image->data = NULL;
+      XDestroyImage (image);
+      return NULL;
+    }
+
+  /* fails with BadAccess on remote displays */
+  gdk_error_trap_push ();
+  XShmAttach (dpy, &shminfo);
+  XSync (dpy, False);
+
+  /* the segment goes away once both sides detached */
+  shmctl (shminfo.shmid, IPC_RMID, NULL);
+
+  succeed = XShmGetImage (dpy, GDK_WINDOW_XID (gdk_screen_get_root_window (screen)),
+                          image, 0, 0, AllPlanes);
+  XShmDetach (dpy, &shminfo);
+  XSync (dpy, False);
+
+  /* the segment info lives on this stack */
+  image->obdata = NULL;
+
+  if (gdk_error_trap_pop () != 0 || !succeed)
+    {
+      shmdt (shminfo.shmaddr);
+      image->data = NULL;
+      XDestroyImage (image);
+      return NULL;
+    }
+
+  return image;
+}
+#endif
+
+
+
+/* returns the screen, to be scaled down to the thumbnail size */
+static XfsmScreenshot *
 xfsm_logout_dialog_screenshot_new (GdkScreen *screen)
 {
-  GdkRectangle  rect, screen_rect;
-  GdkWindow    *window;
-  GdkPixbuf    *screenshot;
-  gint          x, y;
+  XfsmScreenshot *shot;
+  GdkRectangle    rect, screen_rect;
+  GdkWindow      *window;
+  GdkPixbuf      *screenshot;
+  gint            x, y;
+  gint            dest_width, dest_height;
 
   g_return_val_if_fail (GDK_IS_SCREEN (screen), NULL);
 
@@ -511,100 +726,152 @@ xfsm_logout_dialog_screenshot_new (GdkScreen *screen)
   if (!gdk_rectangle_intersect (&rect, &screen_rect, &rect))
     return NULL;
 
-  screenshot = gdk_pixbuf_get_from_drawable  (NULL,
-                                             GDK_DRAWABLE (window),
-                                             NULL,
-                                             0, 0,
-                                             0, 0,
-                                             rect.width,
-                                             rect.height);
+  shot = g_slice_new0 (XfsmScreenshot);
+
+#ifdef HAVE_XEXT
+  shot->image = xfsm_logout_dialog_screenshot_shm (screen, rect.width, rect.height);
+  if (shot->image == NULL)
+#endif
+    {
+      screenshot = gdk_pixbuf_get_from_drawable  (NULL,
+                                                 GDK_DRAWABLE (window),
+                                                 NULL,
+                                                 0, 0,
+                                                 0, 0,
+                                                 rect.width,
+                                                 rect.height);
+      if (G_UNLIKELY (screenshot == NULL))
+        {
+          g_slice_free (XfsmScreenshot, shot);
+          return NULL;
+        }
+
+      xfsm_logout_dialog_thumb_size (rect.width, rect.height,
+                                     &dest_width, &dest_height);
+      shot->thumb = gdk_pixbuf_scale_simple (screenshot, dest_width, dest_height,
+                                             GDK_INTERP_BILINEAR);
+      g_object_unref (G_OBJECT (screenshot));
+    }
 
   gdk_display_beep (gdk_screen_get_display (screen));
 
-  return screenshot;
+  return shot;
 }
 
 
 
-static GdkPixbuf *
-exo_gdk_pixbuf_scale_ratio (GdkPixbuf *source,
-                            gint       dest_size)
+static void
+xfsm_logout_dialog_screenshot_free (XfsmScreenshot *shot)
 {
-  gdouble wratio;
-  gdouble hratio;
-  gint    source_width;
-  gint    source_height;
-  gint    dest_width;
-  gint    dest_height;
+#ifdef HAVE_XEXT
+  if (shot->image != NULL)
+    {
+      shmdt (shot->image->data);
+      shot->image->data = NULL;
+      XDestroyImage (shot->image);
+    }
+#endif
 
-  g_return_val_if_fail (GDK_IS_PIXBUF (source), NULL);
-  g_return_val_if_fail (dest_size > 0, NULL);
+  if (shot->thumb != NULL)
+    g_object_unref (G_OBJECT (shot->thumb));
 
-  source_width  = gdk_pixbuf_get_width  (source);
-  source_height = gdk_pixbuf_get_height (source);
+  g_free (shot->filename);
+  g_free (shot->session_name);
+  g_slice_free (XfsmScreenshot, shot);
+}
 
-  wratio = (gdouble) source_width  / (gdouble) dest_size;
-  hratio = (gdouble) source_height / (gdouble) dest_size;
 
-  if (hratio > wratio)
+
+static void
+xfsm_logout_dialog_screenshot_done (GObject      *source_object,
+                                    GAsyncResult *result,
+                                    gpointer      user_data)
+{
+  g_assert (screenshot_saves_pending > 0);
+  screenshot_saves_pending--;
+}
+
+
+
+/* scales the screen down and writes the thumbnail into the atlas
+ * next to the session save */
+static void
+xfsm_logout_dialog_screenshot_thread (GTask        *task,
+                                      gpointer      source_object,
+                                      gpointer      task_data,
+                                      GCancellable *cancellable)
+{
+  XfsmScreenshot *shot = task_data;
+  GError         *error = NULL;
+  gboolean        succeed = TRUE;
+#ifdef HAVE_XEXT
+  gint            dest_width, dest_height;
+
+  if (shot->image != NULL)
     {
-      dest_width  = rint (source_width / hratio);
-      dest_height = dest_size;
+      xfsm_logout_dialog_thumb_size (shot->image->width, shot->image->height,
+                                     &dest_width, &dest_height);
+      shot->thumb = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, dest_width, dest_height);
+      if (G_LIKELY (shot->thumb != NULL))
+        xfsm_logout_dialog_screenshot_box (shot->image, shot->thumb);
+
+      /* the full screen is not needed anymore */
+      shmdt (shot->image->data);
+      shot->image->data = NULL;
+      XDestroyImage (shot->image);
+      shot->image = NULL;
     }
-  else
+#endif
+
+  if (shot->thumb != NULL
+      && !xfsm_thumbs_store (shot->filename, shot->session_name, shot->thumb, &error))
     {
-      dest_width  = dest_size;
-      dest_height = rint (source_height / wratio);
+      g_warning ("Failed to save session screenshot: %s", error->message);
+      g_error_free (error);
+      succeed = FALSE;
     }
 
-  return gdk_pixbuf_scale_simple (source, MAX (dest_width, 1),
-                                  MAX (dest_height, 1), GDK_INTERP_BILINEAR);
+  g_task_return_boolean (task, succeed);
 }
 
 
 
+/* takes over @shot */
 static void
-xfsm_logout_dialog_screenshot_save (GdkPixbuf   *screenshot,
-                                    GdkScreen   *screen,
-                                    const gchar *session_name)
+xfsm_logout_dialog_screenshot_save (XfsmScreenshot *shot,
+                                    GdkScreen      *screen,
+                                    const gchar    *session_name)
 {
-  GdkPixbuf  *scaled;
-  gchar      *path;
   gchar      *display_name;
   GdkDisplay *dpy;
-  GError     *error = NULL;
-  gchar      *filename;
+  GTask      *task;
 
-  g_return_if_fail (GDK_IS_PIXBUF (screenshot));
+  g_return_if_fail (shot != NULL);
   g_return_if_fail (GDK_IS_SCREEN (screen));
 
-  scaled = exo_gdk_pixbuf_scale_ratio (screenshot, SHOTSIZE);
-  if (G_LIKELY (scaled != NULL))
+  dpy = gdk_screen_get_display (screen);
+  display_name = xfsm_gdk_display_get_fullname (dpy);
+  shot->filename = xfsm_thumbs_get_filename (display_name);
+
+  if (!shot->filename)
     {
-      dpy = gdk_screen_get_display (screen);
-      display_name = xfsm_gdk_display_get_fullname (dpy);
-      path = g_strconcat ("sessions/thumbs-", display_name, "/", session_name, ".png", NULL);
-      filename = xfce_resource_save_location (XFCE_RESOURCE_CACHE, path, TRUE);
+      g_warning ("Unable to save screenshot, "
+                 "error calling xfce_resource_save_location for display %s, "
+                 "check your permissions", display_name);
       g_free (display_name);
-      g_free (path);
+      xfsm_logout_dialog_screenshot_free (shot);
+      return;
+    }
 
-      if (!filename)
-        {
-          g_warning ("Unable to save screenshot, "
-                     "error calling xfce_resource_save_location with %s, "
-                     "check your permissions", path);
-          return;
-        }
+  g_free (display_name);
 
-      if (!gdk_pixbuf_save (scaled, filename, "png", &error, NULL))
-        {
-          g_warning ("Failed to save session screenshot: %s", error->message);
-          g_error_free (error);
-        }
+  shot->session_name = g_strdup (session_name);
 
-      g_free (filename);
-      g_object_unref (G_OBJECT (scaled));
-    }
+  screenshot_saves_pending++;
+  task = g_task_new (NULL, NULL, xfsm_logout_dialog_screenshot_done, NULL);
+  g_task_set_task_data (task, shot, (GDestroyNotify) xfsm_logout_dialog_screenshot_free);
+  g_task_run_in_thread (task, xfsm_logout_dialog_screenshot_thread);
+  g_object_unref (task);
 }
 
 
@@ -655,10 +922,10 @@ xfsm_logout_dialog (const gchar      *session_name,
   GtkWidget        *dialog;
   GdkScreen        *screen;
   gint              monitor;
-  GdkPixbuf        *screenshot = NULL;
+  XfsmScreenshot   *screenshot = NULL;
   XfsmFadeout      *fadeout = NULL;
   XfsmLogoutDialog *xfsm_dialog;
-  XfconfChannel    *channel = xfsm_open_config ();
+  XfsmSettings     *settings = xfsm_settings_get ();
   gboolean          autosave;
   XfsmShutdown     *shutdown;
 
@@ -667,13 +934,13 @@ xfsm_logout_dialog (const gchar      *session_name,
 
   shutdown = xfsm_shutdown_get ();
   if (xfsm_shutdown_can_save_session (shutdown))
-    autosave = xfconf_channel_get_bool (channel, "/general/AutoSave", FALSE);
+    autosave = xfsm_settings_get_bool (settings, "/general/AutoSave", FALSE);
   else
     autosave = FALSE;
   g_object_unref (shutdown);
 
   /* check if we need to bother the user */
-  if (!xfconf_channel_get_bool (channel, "/general/PromptOnLogout", TRUE))
+  if (!xfsm_settings_get_bool (settings, "/general/PromptOnLogout", TRUE))
     {
       *return_type = XFSM_SHUTDOWN_LOGOUT;
       *return_save_session = autosave;
@@ -711,7 +978,7 @@ xfsm_logout_dialog (const gchar      *session_name,
         }
 
       /* make a screenshot */
-      if (xfconf_channel_get_bool (channel, "/general/ShowScreenshots", TRUE))
+      if (xfsm_settings_get_bool (settings, "/general/ShowScreenshots", TRUE))
         screenshot = xfsm_logout_dialog_screenshot_new (screen);
 
       /* display fadeout */
@@ -771,8 +1038,8 @@ xfsm_logout_dialog (const gchar      *session_name,
   /* store channel settings if everything worked fine */
   if (result == GTK_RESPONSE_OK)
     {
-      xfconf_channel_set_string (channel, "/general/SessionName", session_name);
-      xfconf_channel_set_bool (channel, "/general/SaveOnExit", *return_save_session);
+      xfsm_settings_set_string (settings, "/general/SessionName", session_name);
+      xfsm_settings_set_bool (settings, "/general/SaveOnExit", *return_save_session);
     }
 
   /* save the screenshot */
@@ -780,8 +1047,19 @@ xfsm_logout_dialog (const gchar      *session_name,
     {
       if (result == GTK_RESPONSE_OK)
         xfsm_logout_dialog_screenshot_save (screenshot, screen, session_name);
-      g_object_unref (G_OBJECT (screenshot));
+      else
+        xfsm_logout_dialog_screenshot_free (screenshot);
     }
 
   return (result == GTK_RESPONSE_OK);
 }
+
+
+
+/* waits for the screenshot writes started by the logout dialog */
+void
+xfsm_logout_dialog_screenshot_flush (void)
+{
+  while (screenshot_saves_pending > 0)
+    g_main_context_iteration (NULL, TRUE);
+}
@@ -40,4 +40,6 @@ gboolean   xfsm_logout_dialog          (const gchar      *session_name,
                                         XfsmShutdownType *return_type,
                                         gboolean         *return_save_session);
 
+void       xfsm_logout_dialog_screenshot_flush (void);
+
 #endif
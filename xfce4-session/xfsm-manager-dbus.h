@@ -341,6 +341,110 @@ dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_POINTER (GClosure     *closure,
   g_value_set_boolean (return_value, v_return);
 }
 
+/* BOOLEAN:POINTER,POINTER,POINTER */
+extern void dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER_POINTER (GClosure     *closure,
+                                                                             GValue       *return_value,
+                                                                             guint         n_param_values,
+                                                                             const GValue *param_values,
+                                                                             gpointer      invocation_hint,
+                                                                             gpointer      marshal_data);
+void
+dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER_POINTER (GClosure     *closure,
+                                                                 GValue       *return_value G_GNUC_UNUSED,
+                                                                 guint         n_param_values,
+                                                                 const GValue *param_values,
+                                                                 gpointer      invocation_hint G_GNUC_UNUSED,
+                                                                 gpointer      marshal_data)
+{
+  typedef gboolean (*GMarshalFunc_BOOLEAN__POINTER_POINTER_POINTER) (gpointer     data1,
+                                                                     gpointer     arg_1,
+                                                                     gpointer     arg_2,
+                                                                     gpointer     arg_3,
+                                                                     gpointer     data2);
+  register GMarshalFunc_BOOLEAN__POINTER_POINTER_POINTER callback;
+  register GCClosure *cc = (GCClosure*) closure;
+  register gpointer data1, data2;
+  gboolean v_return;
+
+  g_return_if_fail (return_value != NULL);
+  g_return_if_fail (n_param_values == 4);
+
+  if (G_CCLOSURE_SWAP_DATA (closure))
+    {
+      data1 = closure->data;
+      data2 = g_value_peek_pointer (param_values + 0);
+    }
+  else
+    {
+      data1 = g_value_peek_pointer (param_values + 0);
+      data2 = closure->data;
+    }
+  callback = (GMarshalFunc_BOOLEAN__POINTER_POINTER_POINTER) (marshal_data ? marshal_data : cc->callback);
+
+  v_return = callback (data1,
+                       g_marshal_value_peek_pointer (param_values + 1),
+                       g_marshal_value_peek_pointer (param_values + 2),
+                       g_marshal_value_peek_pointer (param_values + 3),
+                       data2);
+
+  g_value_set_boolean (return_value, v_return);
+}
+
+/* BOOLEAN:UINT64,POINTER,POINTER,POINTER,POINTER,POINTER */
+extern void dbus_glib_marshal_xfsm_manager_BOOLEAN__UINT64_POINTER_POINTER_POINTER_POINTER_POINTER (GClosure     *closure,
+                                                                                                    GValue       *return_value,
+                                                                                                    guint         n_param_values,
+                                                                                                    const GValue *param_values,
+                                                                                                    gpointer      invocation_hint,
+                                                                                                    gpointer      marshal_data);
+void
+dbus_glib_marshal_xfsm_manager_BOOLEAN__UINT64_POINTER_POINTER_POINTER_POINTER_POINTER (GClosure     *closure,
+                                                                                        GValue       *return_value G_GNUC_UNUSED,
+                                                                                        guint         n_param_values,
+                                                                                        const GValue *param_values,
+                                                                                        gpointer      invocation_hint G_GNUC_UNUSED,
+                                                                                        gpointer      marshal_data)
+{
+  typedef gboolean (*GMarshalFunc_BOOLEAN__UINT64_POINTER_POINTER_POINTER_POINTER_POINTER) (gpointer     data1,
+                                                                                            guint64      arg_1,
+                                                                                            gpointer     arg_2,
+                                                                                            gpointer     arg_3,
+                                                                                            gpointer     arg_4,
+                                                                                            gpointer     arg_5,
+                                                                                            gpointer     arg_6,
+                                                                                            gpointer     data2);
+  register GMarshalFunc_BOOLEAN__UINT64_POINTER_POINTER_POINTER_POINTER_POINTER callback;
+  register GCClosure *cc = (GCClosure*) closure;
+  register gpointer data1, data2;
+  gboolean v_return;
+
+  g_return_if_fail (return_value != NULL);
+  g_return_if_fail (n_param_values == 7);
+
+  if (G_CCLOSURE_SWAP_DATA (closure))
+    {
+      data1 = closure->data;
+      data2 = g_value_peek_pointer (param_values + 0);
+    }
+  else
+    {
+      data1 = g_value_peek_pointer (param_values + 0);
+      data2 = closure->data;
+    }
+  callback = (GMarshalFunc_BOOLEAN__UINT64_POINTER_POINTER_POINTER_POINTER_POINTER) (marshal_data ? marshal_data : cc->callback);
+
+  v_return = callback (data1,
+                       g_marshal_value_peek_uint64 (param_values + 1),
+                       g_marshal_value_peek_pointer (param_values + 2),
+                       g_marshal_value_peek_pointer (param_values + 3),
+                       g_marshal_value_peek_pointer (param_values + 4),
+                       g_marshal_value_peek_pointer (param_values + 5),
+                       g_marshal_value_peek_pointer (param_values + 6),
+                       data2);
+
+  g_value_set_boolean (return_value, v_return);
+}
+
 G_END_DECLS
 
 #endif /* __dbus_glib_marshal_xfsm_manager_MARSHAL_H__ */
@@ -349,23 +453,29 @@ G_END_DECLS
 static const DBusGMethodInfo dbus_glib_xfsm_manager_methods[] = {
   { (GCallback) xfsm_manager_dbus_get_info, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER_POINTER_POINTER, 0 },
   { (GCallback) xfsm_manager_dbus_list_clients, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 80 },
-  { (GCallback) xfsm_manager_dbus_get_state, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 137 },
-  { (GCallback) xfsm_manager_dbus_checkpoint, dbus_glib_marshal_xfsm_manager_BOOLEAN__STRING_POINTER, 188 },
-  { (GCallback) xfsm_manager_dbus_logout, dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_BOOLEAN_POINTER, 244 },
-  { (GCallback) xfsm_manager_dbus_shutdown, dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_POINTER, 310 },
-  { (GCallback) xfsm_manager_dbus_can_shutdown, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 362 },
-  { (GCallback) xfsm_manager_dbus_restart, dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_POINTER, 423 },
-  { (GCallback) xfsm_manager_dbus_can_restart, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 474 },
-  { (GCallback) xfsm_manager_dbus_suspend, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER, 533 },
-  { (GCallback) xfsm_manager_dbus_can_suspend, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 569 },
-  { (GCallback) xfsm_manager_dbus_hibernate, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER, 628 },
-  { (GCallback) xfsm_manager_dbus_can_hibernate, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 666 },
+  { (GCallback) xfsm_manager_dbus_get_all_clients, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER_POINTER, 137 },
+  { (GCallback) xfsm_manager_dbus_get_clients_since, dbus_glib_marshal_xfsm_manager_BOOLEAN__UINT64_POINTER_POINTER_POINTER_POINTER_POINTER, 219 },
+  { (GCallback) xfsm_manager_dbus_get_state, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 356 },
+  { (GCallback) xfsm_manager_dbus_checkpoint, dbus_glib_marshal_xfsm_manager_BOOLEAN__STRING_POINTER, 407 },
+  { (GCallback) xfsm_manager_dbus_logout, dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_BOOLEAN_POINTER, 463 },
+  { (GCallback) xfsm_manager_dbus_shutdown, dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_POINTER, 529 },
+  { (GCallback) xfsm_manager_dbus_can_shutdown, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 581 },
+  { (GCallback) xfsm_manager_dbus_restart, dbus_glib_marshal_xfsm_manager_BOOLEAN__BOOLEAN_POINTER, 642 },
+  { (GCallback) xfsm_manager_dbus_can_restart, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 693 },
+  { (GCallback) xfsm_manager_dbus_suspend, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER, 752 },
+  { (GCallback) xfsm_manager_dbus_can_suspend, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 788 },
+  { (GCallback) xfsm_manager_dbus_hibernate, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER, 847 },
+  { (GCallback) xfsm_manager_dbus_can_hibernate, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 885 },
+  { (GCallback) xfsm_manager_dbus_get_startup_trace, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 948 },
+  { (GCallback) xfsm_manager_dbus_get_save_latencies, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER_POINTER, 1006 },
+  { (GCallback) xfsm_manager_dbus_get_client_timeouts, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 1090 },
+  { (GCallback) xfsm_manager_dbus_get_protocol_stats, dbus_glib_marshal_xfsm_manager_BOOLEAN__POINTER_POINTER, 1158 },
 };
 
 const DBusGObjectInfo dbus_glib_xfsm_manager_object_info = {  1,
   dbus_glib_xfsm_manager_methods,
-  13,
-"org.xfce.Session.Manager\0GetInfo\0S\0name\0O\0F\0N\0s\0version\0O\0F\0N\0s\0vendor\0O\0F\0N\0s\0\0org.xfce.Session.Manager\0ListClients\0S\0clients\0O\0F\0N\0ao\0\0org.xfce.Session.Manager\0GetState\0S\0state\0O\0F\0N\0u\0\0org.xfce.Session.Manager\0Checkpoint\0S\0session_name\0I\0s\0\0org.xfce.Session.Manager\0Logout\0S\0show_dialog\0I\0b\0allow_save\0I\0b\0\0org.xfce.Session.Manager\0Shutdown\0S\0allow_save\0I\0b\0\0org.xfce.Session.Manager\0CanShutdown\0S\0can_shutdown\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0Restart\0S\0allow_save\0I\0b\0\0org.xfce.Session.Manager\0CanRestart\0S\0can_restart\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0Suspend\0S\0\0org.xfce.Session.Manager\0CanSuspend\0S\0can_suspend\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0Hibernate\0S\0\0org.xfce.Session.Manager\0CanHibernate\0S\0can_hibernate\0O\0F\0N\0b\0\0\0",
+  19,
+"org.xfce.Session.Manager\0GetInfo\0S\0name\0O\0F\0N\0s\0version\0O\0F\0N\0s\0vendor\0O\0F\0N\0s\0\0org.xfce.Session.Manager\0ListClients\0S\0clients\0O\0F\0N\0ao\0\0org.xfce.Session.Manager\0GetAllClients\0S\0generation\0O\0F\0N\0t\0clients\0O\0F\0N\0aa{sv}\0\0org.xfce.Session.Manager\0GetClientsSince\0S\0generation\0I\0t\0current_generation\0O\0F\0N\0t\0full\0O\0F\0N\0b\0clients\0O\0F\0N\0aa{sv}\0removed\0O\0F\0N\0ao\0\0org.xfce.Session.Manager\0GetState\0S\0state\0O\0F\0N\0u\0\0org.xfce.Session.Manager\0Checkpoint\0S\0session_name\0I\0s\0\0org.xfce.Session.Manager\0Logout\0S\0show_dialog\0I\0b\0allow_save\0I\0b\0\0org.xfce.Session.Manager\0Shutdown\0S\0allow_save\0I\0b\0\0org.xfce.Session.Manager\0CanShutdown\0S\0can_shutdown\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0Restart\0S\0allow_save\0I\0b\0\0org.xfce.Session.Manager\0CanRestart\0S\0can_restart\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0Suspend\0S\0\0org.xfce.Session.Manager\0CanSuspend\0S\0can_suspend\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0Hibernate\0S\0\0org.xfce.Session.Manager\0CanHibernate\0S\0can_hibernate\0O\0F\0N\0b\0\0org.xfce.Session.Manager\0GetStartupTrace\0S\0trace\0O\0F\0N\0s\0\0org.xfce.Session.Manager\0GetSaveLatencies\0S\0bounds\0O\0F\0N\0au\0latencies\0O\0F\0N\0aa{sv}\0\0org.xfce.Session.Manager\0GetClientTimeouts\0S\0timeouts\0O\0F\0N\0aa{sv}\0\0org.xfce.Session.Manager\0GetProtocolStats\0S\0stats\0O\0F\0N\0a{sv}\0\0\0",
 "org.xfce.Session.Manager\0StateChanged\0org.xfce.Session.Manager\0ClientRegistered\0org.xfce.Session.Manager\0ShutdownCancelled\0\0",
 "\0"
 };
@@ -25,6 +25,12 @@
 #include <config.h>
 #endif
 
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
 #ifdef HAVE_MEMORY_H
 #include <memory.h>
 #endif
@@ -34,6 +40,9 @@
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
 #ifdef HAVE_TIME_H
 #include <time.h>
 #endif
@@ -66,11 +75,10 @@
 #include <X11/ICE/ICElib.h>
 #include <X11/SM/SMlib.h>
 
+#include <glib/gstdio.h>
 #include <gdk-pixbuf/gdk-pixdata.h>
 #include <gtk/gtk.h>
 
-#include <libwnck/libwnck.h>
-
 #include <libxfce4ui/libxfce4ui.h>
 
 #include <libxfsm/xfsm-splash-engine.h>
@@ -80,8 +88,17 @@
 #include <xfce4-session/xfsm-chooser-icon.h>
 #include <xfce4-session/xfsm-chooser.h>
 #include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-journal.h>
+#include <xfce4-session/xfsm-latency.h>
 #include <xfce4-session/xfsm-legacy.h>
+#include <xfce4-session/xfsm-save-coordinator.h>
+#include <xfce4-session/xfsm-session-cache.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <xfce4-session/xfsm-startup.h>
+#include <xfce4-session/xfsm-stats.h>
+#include <xfce4-session/xfsm-thumbs.h>
+#include <xfce4-session/xfsm-trace.h>
+#include <xfce4-session/xfsm-wnck.h>
 #include <xfce4-session/xfsm-marshal.h>
 #include <xfce4-session/xfsm-error.h>
 #include <xfce4-session/xfsm-logout-dialog.h>
@@ -89,6 +106,9 @@
 
 #define DEFAULT_SESSION_NAME "Default"
 
+/* number of removed clients remembered for GetClientsSince() */
+#define REMOVED_CLIENTS_MAX 64
+
 
 struct _XfsmManager
 {
@@ -99,6 +119,7 @@ struct _XfsmManager
   XfsmShutdownType  shutdown_type;
   XfsmShutdown     *shutdown_helper;
   gboolean          save_session;
+  gboolean          legacy_saving;
 
   gboolean         session_chooser;
   gchar           *session_name;
@@ -115,11 +136,48 @@ struct _XfsmManager
   GQueue          *restart_properties;
   GQueue          *running_clients;
 
+  /* indexes into the queues above, so registrations and disconnects
+   * don't scan them: client id -> link in starting_properties and
+   * pending_properties, XfsmClient -> link in running_clients and
+   * IceConn -> XfsmClient for the connected running clients */
+  GHashTable      *starting_index;
+  GHashTable      *pending_index;
+  GHashTable      *running_index;
+  GHashTable      *ice_index;
+  guint            n_connected;
+
+  /* removed clients for GetClientsSince(), oldest first; removals
+   * up to removed_floor have been dropped from the queue */
+  GQueue          *removed_clients;
+  guint64          removed_floor;
+
   gboolean         failsafe_mode;
   GQueue          *failsafe_clients;
 
   guint            die_timeout_id;
 
+  /* monotonic time the last checkpoint or logout started */
+  gint64           save_started;
+
+  /* pending saves of the running clients */
+  XfsmSaveCoordinator *save_coordinator;
+
+  /* session store, see xfsm_manager_store_session() */
+  gchar           *store_checksum;
+  GStatBuf         store_stat;     /* the session file the last write left */
+  gchar           *store_contents;
+  GQueue          *store_queue;
+  gboolean         store_running;
+  gboolean         quit_pending;
+
+  /* the checkpoint is complete, waiting for its session store */
+  gboolean         checkpoint_storing;
+
+  /* checkpoint journal, see xfsm-journal.c */
+  gchar           *journal_base;
+  gchar           *journal_clients;
+  guint            journal_records;
+
   DBusGConnection *session_bus;
 };
 
@@ -143,6 +201,7 @@ typedef struct
   XfsmManager *manager;
   XfsmClient  *client;
   guint        timeout_id;
+  guint        timeout;
 } XfsmSaveTimeoutData;
 
 typedef struct
@@ -152,6 +211,23 @@ typedef struct
   gboolean         allow_save;
 } ShutdownIdleData;
 
+typedef struct
+{
+  XfsmManager          *manager;
+  gchar                *session_file;
+  gchar                *contents;
+  gsize                 length;
+  gboolean              journal;
+  XfsmManagerStoreFunc  func;
+  gpointer              user_data;
+} XfsmStoreData;
+
+typedef struct
+{
+  gchar   *object_path;
+  guint64  generation;
+} XfsmRemovedClient;
+
 enum
 {
   SIG_STATE_CHANGED = 0,
@@ -170,8 +246,12 @@ static void       xfsm_manager_cancel_client_save_timeout (XfsmManager *manager,
                                                            XfsmClient  *client);
 static gboolean   xfsm_manager_save_timeout (gpointer user_data);
 static void       xfsm_manager_load_settings (XfsmManager   *manager,
-                                              XfconfChannel *channel);
+                                              XfsmSettings  *settings);
 static gboolean   xfsm_manager_load_session (XfsmManager *manager);
+static void       xfsm_manager_quit (XfsmManager *manager);
+static void       xfsm_manager_remove_client (XfsmManager *manager,
+                                              XfsmClient  *client);
+static void       xfsm_removed_client_free (XfsmRemovedClient *removed);
 static void       xfsm_manager_dbus_class_init (XfsmManagerClass *klass);
 static void       xfsm_manager_dbus_init (XfsmManager *manager);
 static void       xfsm_manager_dbus_cleanup (XfsmManager *manager);
@@ -237,13 +317,21 @@ xfsm_manager_init (XfsmManager *manager)
   manager->starting_properties = g_queue_new ();
   manager->restart_properties = g_queue_new ();
   manager->running_clients = g_queue_new ();
+  manager->starting_index = g_hash_table_new (g_str_hash, g_str_equal);
+  manager->pending_index = g_hash_table_new (g_str_hash, g_str_equal);
+  manager->running_index = g_hash_table_new (g_direct_hash, g_direct_equal);
+  manager->ice_index = g_hash_table_new (g_direct_hash, g_direct_equal);
+  manager->removed_clients = g_queue_new ();
   manager->failsafe_clients = g_queue_new ();
+  manager->store_queue = g_queue_new ();
+  manager->save_coordinator = xfsm_save_coordinator_new ();
 }
 
 static void
 xfsm_manager_finalize (GObject *obj)
 {
   XfsmManager *manager = XFSM_MANAGER(obj);
+  GList       *lp;
 
   xfsm_manager_dbus_cleanup (manager);
 
@@ -252,6 +340,11 @@ xfsm_manager_finalize (GObject *obj)
 
   g_object_unref (manager->shutdown_helper);
 
+  g_hash_table_destroy (manager->starting_index);
+  g_hash_table_destroy (manager->pending_index);
+  g_hash_table_destroy (manager->running_index);
+  g_hash_table_destroy (manager->ice_index);
+
   g_queue_foreach (manager->pending_properties, (GFunc) xfsm_properties_free, NULL);
   g_queue_free (manager->pending_properties);
 
@@ -261,15 +354,31 @@ xfsm_manager_finalize (GObject *obj)
   g_queue_foreach (manager->restart_properties, (GFunc) xfsm_properties_free, NULL);
   g_queue_free (manager->restart_properties);
 
-  g_queue_foreach (manager->running_clients, (GFunc) g_object_unref, NULL);
+  for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
+       lp;
+       lp = lp->next)
+    {
+      xfsm_save_coordinator_remove_client (manager->save_coordinator, lp->data);
+      g_object_unref (lp->data);
+    }
   g_queue_free (manager->running_clients);
+  g_queue_foreach (manager->removed_clients, (GFunc) xfsm_removed_client_free, NULL);
+  g_queue_free (manager->removed_clients);
+  xfsm_save_coordinator_free (manager->save_coordinator);
 
   g_queue_foreach (manager->failsafe_clients, (GFunc) xfsm_failsafe_client_free, NULL);
   g_queue_free (manager->failsafe_clients);
 
+  /* pending stores hold a reference on the manager */
+  g_queue_free (manager->store_queue);
+
   g_free (manager->session_name);
   g_free (manager->session_file);
   g_free (manager->checkpoint_session_name);
+  g_free (manager->store_checksum);
+  g_free (manager->store_contents);
+  g_free (manager->journal_base);
+  g_free (manager->journal_clients);
 
   G_OBJECT_CLASS (xfsm_manager_parent_class)->finalize (obj);
 }
@@ -317,48 +426,99 @@ xfsm_manager_new (void)
 }
 
 
+/* the first of several properties with the same client id wins, like
+ * it did for the linear search */
+static void
+xfsm_manager_index_properties (GHashTable *index,
+                               GList      *link)
+{
+  XfsmProperties *properties = XFSM_PROPERTIES (link->data);
+
+  if (g_hash_table_lookup (index, properties->client_id) == NULL)
+    g_hash_table_insert (index, properties->client_id, link);
+}
+
+
+static XfsmProperties *
+xfsm_manager_unlink_properties (GQueue     *queue,
+                                GHashTable *index,
+                                GList      *link)
+{
+  XfsmProperties *properties = XFSM_PROPERTIES (link->data);
+
+  if (g_hash_table_lookup (index, properties->client_id) == link)
+    g_hash_table_remove (index, properties->client_id);
+  g_queue_delete_link (queue, link);
+
+  return properties;
+}
+
+
 static gboolean
 xfsm_manager_startup (XfsmManager *manager)
 {
+  GList *lp;
+
   xfsm_startup_foreign (manager);
   g_queue_sort (manager->pending_properties, (GCompareDataFunc) xfsm_properties_compare, NULL);
+
+  /* the pending properties are complete once the session is loaded */
+  for (lp = g_queue_peek_head_link (manager->pending_properties); lp != NULL; lp = lp->next)
+    {
+      xfsm_manager_index_properties (manager->pending_index, lp);
+      xfsm_startup_index_add (lp->data, TRUE);
+    }
+
+  xfsm_stats_probe_start ();
   xfsm_startup_begin (manager);
   return FALSE;
 }
 
 
 static void
-xfsm_manager_restore_active_workspace (XfsmManager *manager,
-                                       XfceRc      *rc)
+xfsm_manager_restore_active_workspace (XfsmManager *manager)
 {
-  WnckWorkspace  *workspace;
-  GdkDisplay     *display;
-  WnckScreen     *screen;
-  gchar           buffer[1024];
-  gint            n, m;
+  XfsmSessionCache *cache;
+  XfceRc           *rc = NULL;
+  gchar             buffer[1024];
+  gint              n, m;
 
-  display = gdk_display_get_default ();
-  for (n = 0; n < gdk_display_get_n_screens (display); ++n)
+  cache = xfsm_session_cache_open (manager->session_file);
+  if (cache == NULL)
+    {
+      rc = xfce_rc_simple_open (manager->session_file, TRUE);
+      if (G_UNLIKELY (rc == NULL))
+        return;
+
+      g_snprintf (buffer, 1024, "Session: %s", manager->session_name);
+      xfce_rc_set_group (rc, buffer);
+    }
+
+  for (n = 0; n < xfsm_wnck_get_n_screens (); ++n)
     {
       g_snprintf (buffer, 1024, "Screen%d_ActiveWorkspace", n);
       xfsm_verbose ("Attempting to restore %s\n", buffer);
-      if (!xfce_rc_has_entry (rc, buffer))
+      if (cache != NULL)
+        m = xfsm_session_cache_get_active_workspace (cache, manager->session_name, n);
+      else if (xfce_rc_has_entry (rc, buffer))
+        m = xfce_rc_read_int_entry (rc, buffer, 0);
+      else
+        m = -1;
+
+      if (m < 0)
         {
           xfsm_verbose ("no entry found\n");
           continue;
         }
 
-      m = xfce_rc_read_int_entry (rc, buffer, 0);
-
-      screen = wnck_screen_get (n);
-      wnck_screen_force_update (screen);
-
-      if (wnck_screen_get_workspace_count (screen) > m)
-        {
-          workspace = wnck_screen_get_workspace (screen, m);
-          wnck_workspace_activate (workspace, GDK_CURRENT_TIME);
-        }
+      if (xfsm_wnck_get_workspace_count (n) > m)
+        xfsm_wnck_activate_workspace (n, m);
     }
+
+  if (cache != NULL)
+    xfsm_session_cache_close (cache);
+  else
+    xfce_rc_close (rc);
 }
 
 
@@ -412,7 +572,7 @@ xfsm_manager_handle_failed_properties (XfsmManager    *manager,
           else
             {
               /* put it back in the starting list */
-              g_queue_push_tail (manager->starting_properties, properties);
+              xfsm_manager_add_starting_properties (manager, properties);
             }
         }
     }
@@ -481,11 +641,23 @@ xfsm_manager_choose_session (XfsmManager *manager,
   gboolean         load = FALSE;
   GList           *sessions = NULL;
   GList           *lp;
+  GPtrArray       *names;
+  XfsmThumbs      *thumbs;
   gchar          **groups;
+  gchar           *display_name;
+  gchar           *thumbs_file;
   gchar           *name;
   gint             result;
   gint             n;
 
+  /* all previews come from one mapped atlas */
+  display_name = xfsm_get_display_name ();
+  thumbs_file = xfsm_thumbs_get_filename (display_name);
+  thumbs = thumbs_file != NULL ? xfsm_thumbs_open (thumbs_file) : NULL;
+  g_free (display_name);
+
+  names = g_ptr_array_new ();
+
   groups = xfce_rc_get_groups (rc);
   for (n = 0; groups[n] != NULL; ++n)
     {
@@ -495,7 +667,8 @@ xfsm_manager_choose_session (XfsmManager *manager,
           session = g_new0 (XfsmSessionInfo, 1);
           session->name = groups[n] + 9;
           session->atime = xfce_rc_read_int_entry (rc, "LastAccess", 0);
-          session->preview = xfsm_load_session_preview (session->name);
+          session->preview = xfsm_load_session_preview (thumbs, session->name);
+          g_ptr_array_add (names, session->name);
 
           if (session->preview == NULL)
             {
@@ -515,6 +688,16 @@ xfsm_manager_choose_session (XfsmManager *manager,
   if (preview_default != NULL)
     g_object_unref (preview_default);
 
+  /* forget the thumbnails of deleted sessions */
+  xfsm_thumbs_close (thumbs);
+  if (thumbs_file != NULL)
+    {
+      g_ptr_array_add (names, NULL);
+      xfsm_thumbs_prune (thumbs_file, (gchar **) names->pdata);
+      g_free (thumbs_file);
+    }
+  g_ptr_array_free (names, TRUE);
+
   if (sessions != NULL)
     {
       result = xfsm_splash_screen_choose (splash_screen, sessions,
@@ -553,10 +736,12 @@ xfsm_manager_choose_session (XfsmManager *manager,
 static gboolean
 xfsm_manager_load_session (XfsmManager *manager)
 {
-  XfsmProperties *properties;
-  gchar           buffer[1024];
-  XfceRc         *rc;
-  gint            count;
+  XfsmSessionCache *cache;
+  XfsmProperties   *properties;
+  gchar             buffer[1024];
+  XfceRc           *rc;
+  gboolean          loaded;
+  gint              count;
 
   if (!g_file_test (manager->session_file, G_FILE_TEST_IS_REGULAR))
     {
@@ -564,6 +749,26 @@ xfsm_manager_load_session (XfsmManager *manager)
       return FALSE;
     }
 
+  /* the chooser needs all sessions from the rc file anyway, otherwise
+   * try the compiled session cache first. it doesn't know about
+   * checkpoints in the journal though. */
+  if (!manager->session_chooser && !xfsm_journal_exists (manager->session_file))
+    {
+      cache = xfsm_session_cache_open (manager->session_file);
+      if (cache != NULL)
+        {
+          loaded = xfsm_session_cache_load (cache, manager->session_name,
+                                            manager->pending_properties);
+          xfsm_session_cache_close (cache);
+
+          if (loaded)
+            {
+              xfsm_verbose ("Finished loading clients from session cache\n");
+              return g_queue_peek_head (manager->pending_properties) != NULL;
+            }
+        }
+    }
+
   rc = xfce_rc_simple_open (manager->session_file, FALSE);
   if (G_UNLIKELY (rc == NULL))
   {
@@ -582,6 +787,15 @@ xfsm_manager_load_session (XfsmManager *manager)
   xfsm_verbose ("loading %s\n", buffer);
 
   xfce_rc_set_group (rc, buffer);
+
+  /* the session wasn't stored cleanly, apply the checkpoints since */
+  if (xfsm_journal_load (manager->session_file, rc, buffer,
+                         manager->pending_properties))
+    {
+      xfce_rc_close (rc);
+      return g_queue_peek_head (manager->pending_properties) != NULL;
+    }
+
   count = xfce_rc_read_int_entry (rc, "Count", 0);
   if (G_UNLIKELY (count <= 0))
     {
@@ -610,7 +824,7 @@ xfsm_manager_load_session (XfsmManager *manager)
   xfsm_verbose ("Finished loading clients from rc file\n");
 
   /* load legacy applications */
-  xfsm_legacy_load_session (rc);
+  xfsm_legacy_load_session (rc, manager->pending_properties);
 
   xfce_rc_close (rc);
 
@@ -620,7 +834,7 @@ xfsm_manager_load_session (XfsmManager *manager)
 
 static gboolean
 xfsm_manager_load_failsafe (XfsmManager   *manager,
-                            XfconfChannel *channel,
+                            XfsmSettings  *settings,
                             gchar        **error)
 {
   FailsafeClient *fclient;
@@ -634,7 +848,7 @@ xfsm_manager_load_failsafe (XfsmManager   *manager,
   gint            i;
   gint            n_screen;
 
-  failsafe_name = xfconf_channel_get_string (channel, "/general/FailsafeSessionName", NULL);
+  failsafe_name = xfsm_settings_get_string (settings, "/general/FailsafeSessionName", NULL);
   if (G_UNLIKELY (!failsafe_name))
     {
       if (error)
@@ -645,7 +859,7 @@ xfsm_manager_load_failsafe (XfsmManager   *manager,
 
   g_snprintf (propbuf, sizeof (propbuf), "/sessions/%s/IsFailsafe",
               failsafe_name);
-  if (!xfconf_channel_get_bool (channel, propbuf, FALSE))
+  if (!xfsm_settings_get_bool (settings, propbuf, FALSE))
     {
       if (error)
         {
@@ -659,19 +873,19 @@ xfsm_manager_load_failsafe (XfsmManager   *manager,
   display = gdk_display_get_default ();
 
   g_snprintf (propbuf, sizeof (propbuf), "/sessions/%s/Count", failsafe_name);
-  count = xfconf_channel_get_int (channel, propbuf, 0);
+  count = xfsm_settings_get_int (settings, propbuf, 0);
 
   for (i = 0; i < count; ++i)
     {
       g_snprintf (command_entry, sizeof (command_entry),
                   "/sessions/%s/Client%d_Command", failsafe_name, i);
-      command = xfconf_channel_get_string_list (channel, command_entry);
+      command = xfsm_settings_get_string_list (settings, command_entry);
       if (G_UNLIKELY (command == NULL))
         continue;
 
       g_snprintf (screen_entry, sizeof (screen_entry),
                   "/sessions/%s/Client%d_PerScreen", failsafe_name, i);
-      if (xfconf_channel_get_bool (channel, screen_entry, FALSE))
+      if (!xfsm_headless && xfsm_settings_get_bool (settings, screen_entry, FALSE))
         {
           for (n_screen = 0; n_screen < gdk_display_get_n_screens (display); ++n_screen)
             {
@@ -706,20 +920,22 @@ xfsm_manager_load_failsafe (XfsmManager   *manager,
 
 static void
 xfsm_manager_load_settings (XfsmManager   *manager,
-                            XfconfChannel *channel)
+                            XfsmSettings  *settings)
 {
   gboolean session_loaded = FALSE;
 
-  manager->session_name = xfconf_channel_get_string (channel,
-                                                     "/general/SessionName",
-                                                     DEFAULT_SESSION_NAME);
+  manager->session_name = xfsm_settings_get_string (settings,
+                                                    "/general/SessionName",
+                                                    DEFAULT_SESSION_NAME);
   if (G_UNLIKELY (manager->session_name[0] == '\0'))
     {
       g_free (manager->session_name);
       manager->session_name = g_strdup (DEFAULT_SESSION_NAME);
     }
 
-  manager->session_chooser = xfconf_channel_get_bool (channel, "/chooser/AlwaysDisplay", FALSE);
+  /* there is no splash screen to show the chooser in headless mode */
+  manager->session_chooser = !xfsm_headless
+    && xfsm_settings_get_bool (settings, "/chooser/AlwaysDisplay", FALSE);
 
   session_loaded = xfsm_manager_load_session (manager);
 
@@ -732,8 +948,14 @@ xfsm_manager_load_settings (XfsmManager   *manager,
     {
       gchar *errorstr = NULL;
 
-      if (!xfsm_manager_load_failsafe (manager, channel, &errorstr))
+      if (!xfsm_manager_load_failsafe (manager, settings, &errorstr))
         {
+          if (xfsm_headless)
+            {
+              g_printerr ("%s: %s\n", PACKAGE_NAME, errorstr);
+              exit (EXIT_FAILURE);
+            }
+
           if (G_LIKELY (splash_screen != NULL))
             {
               xfsm_splash_screen_free (splash_screen);
@@ -757,8 +979,8 @@ xfsm_manager_load_settings (XfsmManager   *manager,
 
 
 void
-xfsm_manager_load (XfsmManager   *manager,
-                   XfconfChannel *channel)
+xfsm_manager_load (XfsmManager  *manager,
+                   XfsmSettings *settings)
 {
   gchar *display_name;
   gchar *resource_name;
@@ -766,11 +988,15 @@ xfsm_manager_load (XfsmManager   *manager,
   gchar *s;
 #endif
 
-  manager->compat_gnome = xfconf_channel_get_bool (channel, "/compat/LaunchGNOME", FALSE);
-  manager->compat_kde = xfconf_channel_get_bool (channel, "/compat/LaunchKDE", FALSE);
-  manager->start_at = xfconf_channel_get_bool (channel, "/general/StartAssistiveTechnologies", FALSE);
+  /* the compat startups and at-spi need an X display */
+  if (!xfsm_headless)
+    {
+      manager->compat_gnome = xfsm_settings_get_bool (settings, "/compat/LaunchGNOME", FALSE);
+      manager->compat_kde = xfsm_settings_get_bool (settings, "/compat/LaunchKDE", FALSE);
+      manager->start_at = xfsm_settings_get_bool (settings, "/general/StartAssistiveTechnologies", FALSE);
+    }
 
-  display_name  = xfsm_gdk_display_get_fullname (gdk_display_get_default ());
+  display_name  = xfsm_get_display_name ();
 
 #ifdef HAVE_OS_CYGWIN
   /* rename a colon (:) to a hash (#) under cygwin. windows doesn't like
@@ -785,15 +1011,18 @@ xfsm_manager_load (XfsmManager   *manager,
   g_free (resource_name);
   g_free (display_name);
 
-  xfsm_manager_load_settings (manager, channel);
+  xfsm_manager_load_settings (manager, settings);
 }
 
 
 gboolean
 xfsm_manager_restart (XfsmManager *manager)
 {
-  GdkPixbuf *preview;
-  unsigned   steps;
+  XfsmThumbs *thumbs;
+  GdkPixbuf  *preview;
+  gchar      *display_name;
+  gchar      *thumbs_file;
+  unsigned    steps;
 
   g_assert (manager->session_name != NULL);
 
@@ -801,12 +1030,21 @@ xfsm_manager_restart (XfsmManager *manager)
   xfsm_legacy_init ();
 
   /* tell splash screen that the session is starting now */
-  preview = xfsm_load_session_preview (manager->session_name);
-  if (preview == NULL)
-    preview = gdk_pixbuf_new_from_inline (-1, xfsm_chooser_icon_data, FALSE, NULL);
-  steps = g_queue_get_length (manager->failsafe_mode ? manager->failsafe_clients : manager->pending_properties);
-  xfsm_splash_screen_start (splash_screen, manager->session_name, preview, steps);
-  g_object_unref (preview);
+  if (G_LIKELY (splash_screen != NULL))
+    {
+      display_name = xfsm_get_display_name ();
+      thumbs_file = xfsm_thumbs_get_filename (display_name);
+      thumbs = thumbs_file != NULL ? xfsm_thumbs_open (thumbs_file) : NULL;
+      preview = xfsm_load_session_preview (thumbs, manager->session_name);
+      xfsm_thumbs_close (thumbs);
+      g_free (thumbs_file);
+      g_free (display_name);
+      if (preview == NULL)
+        preview = gdk_pixbuf_new_from_inline (-1, xfsm_chooser_icon_data, FALSE, NULL);
+      steps = g_queue_get_length (manager->failsafe_mode ? manager->failsafe_clients : manager->pending_properties);
+      xfsm_splash_screen_start (splash_screen, manager->session_name, preview, steps);
+      g_object_unref (preview);
+    }
 
   g_idle_add ((GSourceFunc) xfsm_manager_startup, manager);
 
@@ -817,25 +1055,18 @@ xfsm_manager_restart (XfsmManager *manager)
 void
 xfsm_manager_signal_startup_done (XfsmManager *manager)
 {
-  gchar buffer[1024];
-  XfceRc *rc;
-
   xfsm_verbose ("Manager finished startup, entering IDLE mode now\n\n");
   xfsm_manager_set_state (manager, XFSM_MANAGER_IDLE);
 
+  xfsm_trace_startup_done ();
+  xfsm_stats_probe_stop ();
+
   if (!manager->failsafe_mode)
     {
       /* restore active workspace, this has to be done after the
        * window manager is up, so we do it last.
        */
-      g_snprintf (buffer, 1024, "Session: %s", manager->session_name);
-      rc = xfce_rc_simple_open (manager->session_file, TRUE);
-      xfce_rc_set_group (rc, buffer);
-      xfsm_manager_restore_active_workspace (manager, rc);
-      xfce_rc_close (rc);
-
-      /* start legacy applications now */
-      xfsm_legacy_startup ();
+      xfsm_manager_restore_active_workspace (manager);
     }
 }
 
@@ -886,23 +1117,21 @@ xfsm_manager_register_client (XfsmManager *manager,
 
   if (previous_id != NULL)
     {
-      lp = g_queue_find_custom (manager->starting_properties,
-                                previous_id,
-                                (GCompareFunc) xfsm_properties_compare_id);
+      lp = g_hash_table_lookup (manager->starting_index, previous_id);
       if (lp != NULL)
         {
-          properties = XFSM_PROPERTIES (lp->data);
-          g_queue_delete_link (manager->starting_properties, lp);
+          properties = xfsm_manager_unlink_properties (manager->starting_properties,
+                                                       manager->starting_index, lp);
+          xfsm_startup_index_remove (properties, FALSE);
         }
       else
         {
-          lp = g_queue_find_custom (manager->pending_properties,
-                                    previous_id,
-                                    (GCompareFunc) xfsm_properties_compare_id);
+          lp = g_hash_table_lookup (manager->pending_index, previous_id);
           if (lp != NULL)
             {
-              properties = XFSM_PROPERTIES (lp->data);
-              g_queue_delete_link (manager->pending_properties, lp);
+              properties = xfsm_manager_unlink_properties (manager->pending_properties,
+                                                           manager->pending_index, lp);
+              xfsm_startup_index_remove (properties, TRUE);
             }
         }
 
@@ -924,6 +1153,15 @@ xfsm_manager_register_client (XfsmManager *manager,
           properties->startup_timeout_id = 0;
         }
 
+      /* remember how long the client took to come up */
+      if (properties->spawn_time > 0)
+        {
+          xfsm_latency_record (xfsm_properties_get_string (properties, SmProgram),
+                               XFSM_LATENCY_STARTUP,
+                               g_get_monotonic_time () - properties->spawn_time);
+          properties->spawn_time = 0;
+        }
+
       /* cancel the old child watch, and replace it with one that
        * doesn't really do anything but reap the child */
       xfsm_properties_set_default_child_watch (properties);
@@ -948,9 +1186,23 @@ xfsm_manager_register_client (XfsmManager *manager,
     }
 
   g_queue_push_tail (manager->running_clients, client);
+  g_hash_table_insert (manager->running_index, client,
+                       g_queue_peek_tail_link (manager->running_clients));
+  g_hash_table_insert (manager->ice_index, SmsGetIceConnection (sms_conn), client);
+  manager->n_connected++;
+  xfsm_save_coordinator_add_client (manager->save_coordinator, client);
+
+  xfsm_trace_mark_full (xfsm_client_get_id (client),
+                        xfsm_properties_get_string (properties, SmProgram),
+                        -1, XFSM_TRACE_CONNECT,
+                        xfsm_client_get_connect_time (client));
+  xfsm_trace_mark (xfsm_client_get_id (client), XFSM_TRACE_REGISTER);
 
   SmsRegisterClientReply (sms_conn, (char *) xfsm_client_get_id (client));
 
+  xfsm_stats_record (XFSM_STATS_REGISTER,
+                     g_get_monotonic_time () - xfsm_client_get_connect_time (client));
+
   g_signal_emit (manager, signals[SIG_CLIENT_REGISTERED], 0,
                  xfsm_client_get_object_path (client));
 
@@ -967,9 +1219,10 @@ xfsm_manager_register_client (XfsmManager *manager,
        * the starting_properties. If there was no match above,
        * previous_id will be NULL here.  We don't need to continue when
        * in failsafe mode because in that case the failsafe session is
-       * started all at once.
+       * started all at once.  Clients that only waited for this one
+       * are started right away.
        */
-      if (g_queue_peek_head (manager->starting_properties) == NULL)
+      if (!manager->failsafe_mode)
         xfsm_startup_session_continue (manager);
     }
 
@@ -1114,6 +1367,20 @@ xfsm_manager_interact_done (XfsmManager *manager,
 }
 
 
+static void
+xfsm_manager_legacy_save_done (gpointer user_data)
+{
+  XfsmManager *manager = XFSM_MANAGER (user_data);
+
+  manager->legacy_saving = FALSE;
+
+  /* the checkpoint may have been cancelled meanwhile */
+  if (manager->state == XFSM_MANAGER_CHECKPOINT
+      || manager->state == XFSM_MANAGER_SHUTDOWN)
+    xfsm_manager_complete_saveyourself (manager);
+}
+
+
 static void
 xfsm_manager_save_yourself_global (XfsmManager     *manager,
                                    gint             save_type,
@@ -1124,6 +1391,7 @@ xfsm_manager_save_yourself_global (XfsmManager     *manager,
                                    gboolean         allow_shutdown_save)
 {
   gboolean  shutdown_save = allow_shutdown_save;
+  GList    *clients;
   GList    *lp;
   GError   *error = NULL;
 
@@ -1135,7 +1403,15 @@ xfsm_manager_save_yourself_global (XfsmManager     *manager,
         {
           /* if we're not specifying fast shutdown, and we're ok with
            * prompting then ask the user what to do */
-          if (!xfsm_logout_dialog (manager->session_name, &manager->shutdown_type, &shutdown_save))
+          if (xfsm_headless)
+            {
+              /* nobody to ask, log out like the dialog does when
+               * PromptOnLogout is disabled */
+              manager->shutdown_type = XFSM_SHUTDOWN_LOGOUT;
+              shutdown_save = xfsm_settings_get_bool (xfsm_settings_get (),
+                                                      "/general/AutoSave", FALSE);
+            }
+          else if (!xfsm_logout_dialog (manager->session_name, &manager->shutdown_type, &shutdown_save))
             return;
 
           /* |allow_shutdown_save| is ignored if we prompt the user.  i think
@@ -1152,9 +1428,14 @@ xfsm_manager_save_yourself_global (XfsmManager     *manager,
       if (manager->shutdown_type == XFSM_SHUTDOWN_SUSPEND
           || manager->shutdown_type == XFSM_SHUTDOWN_HIBERNATE)
         {
-          if (!xfsm_shutdown_try_type (manager->shutdown_helper,
-                                       manager->shutdown_type,
-                                       &error))
+          /* never put the machine running a headless session to sleep */
+          if (xfsm_headless)
+            {
+              g_warning ("Not suspending or hibernating in headless mode");
+            }
+          else if (!xfsm_shutdown_try_type (manager->shutdown_helper,
+                                            manager->shutdown_type,
+                                            &error))
             {
               xfce_message_dialog (NULL, _("Shutdown Failed"),
                                    GTK_STOCK_DIALOG_ERROR,
@@ -1188,14 +1469,13 @@ xfsm_manager_save_yourself_global (XfsmManager     *manager,
                           shutdown
                           ? XFSM_MANAGER_SHUTDOWN
                           : XFSM_MANAGER_CHECKPOINT);
+  manager->save_started = g_get_monotonic_time ();
 
-  /* handle legacy applications first! */
-  if (manager->save_session)
-      xfsm_legacy_perform_session_save ();
+  /* clients that took longest last time are asked first */
+  clients = g_list_copy (g_queue_peek_head_link (manager->running_clients));
+  clients = xfsm_save_coordinator_sort_clients (manager->save_coordinator, clients);
 
-  for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
-       lp;
-       lp = lp->next)
+  for (lp = clients; lp; lp = lp->next)
     {
       XfsmClient *client = lp->data;
       XfsmProperties *properties = xfsm_client_get_properties (client);
@@ -1216,6 +1496,16 @@ xfsm_manager_save_yourself_global (XfsmManager     *manager,
       xfsm_client_set_state (client, XFSM_CLIENT_SAVING);
       xfsm_manager_start_client_save_timeout (manager, client);
     }
+
+  g_list_free (clients);
+
+  /* the legacy applications save alongside the XSMP clients, the
+   * session is stored once both are done */
+  if (manager->save_session)
+    {
+      manager->legacy_saving = TRUE;
+      xfsm_legacy_perform_session_save (xfsm_manager_legacy_save_done, manager);
+    }
 }
 
 
@@ -1314,6 +1604,7 @@ xfsm_manager_save_yourself_done (XfsmManager *manager,
   if (xfsm_client_get_state (client) == XFSM_CLIENT_SAVINGLOCAL)
     {
       /* client completed local SaveYourself */
+      xfsm_trace_mark (xfsm_client_get_id (client), XFSM_TRACE_SAVE_LOCAL);
       xfsm_client_set_state (client, XFSM_CLIENT_IDLE);
       SmsSaveComplete (xfsm_client_get_sms_connection (client));
     }
@@ -1332,13 +1623,66 @@ xfsm_manager_save_yourself_done (XfsmManager *manager,
 }
 
 
+static void
+xfsm_removed_client_free (XfsmRemovedClient *removed)
+{
+  g_free (removed->object_path);
+  g_slice_free (XfsmRemovedClient, removed);
+}
+
+
+/* drops a client from the running list and remembers it for
+ * GetClientsSince() */
+static void
+xfsm_manager_remove_client (XfsmManager *manager,
+                            XfsmClient  *client)
+{
+  XfsmRemovedClient *removed;
+  GList             *lp;
+
+  xfsm_save_coordinator_remove_client (manager->save_coordinator, client);
+
+  lp = g_hash_table_lookup (manager->running_index, client);
+  if (G_LIKELY (lp != NULL))
+    {
+      g_hash_table_remove (manager->running_index, client);
+      g_queue_delete_link (manager->running_clients, lp);
+    }
+
+  if (xfsm_client_get_object_path (client) != NULL)
+    {
+      removed = g_slice_new (XfsmRemovedClient);
+      removed->object_path = g_strdup (xfsm_client_get_object_path (client));
+      removed->generation = xfsm_client_bump_generation ();
+      g_queue_push_tail (manager->removed_clients, removed);
+
+      if (g_queue_get_length (manager->removed_clients) > REMOVED_CLIENTS_MAX)
+        {
+          removed = g_queue_pop_head (manager->removed_clients);
+          manager->removed_floor = removed->generation;
+          xfsm_removed_client_free (removed);
+        }
+    }
+
+  g_object_unref (client);
+}
+
+
 void
 xfsm_manager_close_connection (XfsmManager *manager,
                                XfsmClient  *client,
                                gboolean     cleanup)
 {
   IceConn ice_conn;
-  GList *lp;
+
+  /* the connection may be reused for the next client */
+  if (xfsm_client_get_state (client) != XFSM_CLIENT_DISCONNECTED
+      && g_hash_table_lookup (manager->running_index, client) != NULL)
+    {
+      ice_conn = SmsGetIceConnection (xfsm_client_get_sms_connection (client));
+      g_hash_table_remove (manager->ice_index, ice_conn);
+      manager->n_connected--;
+    }
 
   xfsm_client_set_state (client, XFSM_CLIENT_DISCONNECTED);
   xfsm_manager_cancel_client_save_timeout (manager, client);
@@ -1354,14 +1698,8 @@ xfsm_manager_close_connection (XfsmManager *manager,
 
   if (manager->state == XFSM_MANAGER_SHUTDOWNPHASE2)
     {
-      for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
-           lp;
-           lp = lp->next)
-        {
-          XfsmClient *cl = lp->data;
-          if (xfsm_client_get_state (cl) != XFSM_CLIENT_DISCONNECTED)
-            return;
-        }
+      if (manager->n_connected > 0)
+        return;
 
       /* all clients finished the DIE phase in time */
       if (manager->die_timeout_id)
@@ -1369,7 +1707,7 @@ xfsm_manager_close_connection (XfsmManager *manager,
           g_source_remove (manager->die_timeout_id);
           manager->die_timeout_id = 0;
         }
-      gtk_main_quit ();
+      xfsm_manager_quit (manager);
     }
   else if (manager->state == XFSM_MANAGER_SHUTDOWN || manager->state == XFSM_MANAGER_CHECKPOINT)
     {
@@ -1378,8 +1716,7 @@ xfsm_manager_close_connection (XfsmManager *manager,
                     xfsm_client_get_id (client));
 
       /* stupid client disconnected in CheckPoint state, prepare to be nuked! */
-      g_queue_remove (manager->running_clients, client);
-      g_object_unref (client);
+      xfsm_manager_remove_client (manager, client);
       xfsm_manager_complete_saveyourself (manager);
     }
   else
@@ -1399,8 +1736,7 @@ xfsm_manager_close_connection (XfsmManager *manager,
 
       /* regardless of the restart style hint, the current instance of
        * the client is gone, so remove it from the client list and free it. */
-      g_queue_remove (manager->running_clients, client);
-      g_object_unref (client);
+      xfsm_manager_remove_client (manager, client);
     }
 }
 
@@ -1409,19 +1745,11 @@ void
 xfsm_manager_close_connection_by_ice_conn (XfsmManager *manager,
                                            IceConn      ice_conn)
 {
-  GList *lp;
+  XfsmClient *client;
 
-  for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
-       lp;
-       lp = lp->next)
-    {
-      XfsmClient *client = lp->data;
-      if (SmsGetIceConnection (xfsm_client_get_sms_connection (client)) == ice_conn)
-        {
-          xfsm_manager_close_connection (manager, client, FALSE);
-          break;
-        }
-    }
+  client = g_hash_table_lookup (manager->ice_index, ice_conn);
+  if (client != NULL)
+    xfsm_manager_close_connection (manager, client, FALSE);
 
   /* be sure to close the Ice connection in any case */
   IceSetShutdownNegotiation (ice_conn, False);
@@ -1451,6 +1779,33 @@ xfsm_manager_terminate_client (XfsmManager *manager,
 }
 
 
+static void
+xfsm_manager_quit (XfsmManager *manager)
+{
+  /* the session file may still be on its way to the disk */
+  if (manager->store_running)
+    {
+      xfsm_verbose ("Waiting for the session store to complete before quitting\n");
+      manager->quit_pending = TRUE;
+      return;
+    }
+
+  gtk_main_quit ();
+}
+
+
+static gboolean
+xfsm_manager_die_timeout (gpointer user_data)
+{
+  XfsmManager *manager = XFSM_MANAGER (user_data);
+
+  manager->die_timeout_id = 0;
+  xfsm_manager_quit (manager);
+
+  return FALSE;
+}
+
+
 void
 xfsm_manager_perform_shutdown (XfsmManager *manager)
 {
@@ -1468,6 +1823,12 @@ xfsm_manager_perform_shutdown (XfsmManager *manager)
       SmsDie (xfsm_client_get_sms_connection (client));
     }
 
+  if (manager->save_started != 0)
+    {
+      xfsm_stats_record (XFSM_STATS_SHUTDOWN,
+                         g_get_monotonic_time () - manager->save_started);
+    }
+
   /* check for SmRestartAnyway clients that have already quit and
    * set a ShutdownCommand */
   for (lp = g_queue_peek_nth_link (manager->restart_properties, 0);
@@ -1500,69 +1861,73 @@ xfsm_manager_perform_shutdown (XfsmManager *manager)
 
   /* give all clients the chance to close the connection */
   manager->die_timeout_id = g_timeout_add (DIE_TIMEOUT,
-                                           (GSourceFunc) gtk_main_quit,
-                                           NULL);
+                                           xfsm_manager_die_timeout,
+                                           manager);
 }
 
 
 gboolean
 xfsm_manager_check_clients_saving (XfsmManager *manager)
 {
+  return xfsm_save_coordinator_is_saving (manager->save_coordinator);
+}
+
+
+gboolean
+xfsm_manager_maybe_enter_phase2 (XfsmManager *manager)
+{
+  gboolean entered_phase2 = FALSE;
+  GList *clients;
   GList *lp;
 
-  for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
-       lp;
-       lp = lp->next)
+  clients = xfsm_save_coordinator_get_phase2_clients (manager->save_coordinator);
+  for (lp = clients; lp; lp = lp->next)
     {
       XfsmClient *client = lp->data;
-      XfsmClientState state = xfsm_client_get_state (client);
-      switch (state)
-        {
-          case XFSM_CLIENT_SAVING:
-          case XFSM_CLIENT_WAITFORINTERACT:
-          case XFSM_CLIENT_INTERACTING:
-            return TRUE;
-          default:
-            break;
-        }
+
+      entered_phase2 = TRUE;
+      SmsSaveYourselfPhase2 (xfsm_client_get_sms_connection (client));
+      xfsm_client_set_state (client, XFSM_CLIENT_SAVING);
+      xfsm_manager_start_client_save_timeout (manager, client);
+
+      xfsm_verbose ("Client Id = %s enters SAVE YOURSELF PHASE2.\n\n",
+                    xfsm_client_get_id (client));
     }
+  g_list_free (clients);
 
-  return FALSE;
+  return entered_phase2;
 }
 
 
-gboolean
-xfsm_manager_maybe_enter_phase2 (XfsmManager *manager)
+static void
+xfsm_manager_checkpoint_done (XfsmManager *manager,
+                              gboolean     success,
+                              gpointer     user_data)
 {
-  gboolean entered_phase2 = FALSE;
   GList *lp;
 
+  manager->checkpoint_storing = FALSE;
+
+  /* reset all clients to idle state */
+  xfsm_manager_set_state (manager, XFSM_MANAGER_IDLE);
   for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
        lp;
        lp = lp->next)
     {
       XfsmClient *client = lp->data;
-
-      if (xfsm_client_get_state (client) == XFSM_CLIENT_WAITFORPHASE2)
-        {
-          entered_phase2 = TRUE;
-          SmsSaveYourselfPhase2 (xfsm_client_get_sms_connection (client));
-          xfsm_client_set_state (client, XFSM_CLIENT_SAVING);
-          xfsm_manager_start_client_save_timeout (manager, client);
-
-          xfsm_verbose ("Client Id = %s enters SAVE YOURSELF PHASE2.\n\n",
-                        xfsm_client_get_id (client));
-        }
+      xfsm_client_set_state (client, XFSM_CLIENT_IDLE);
+      SmsSaveComplete (xfsm_client_get_sms_connection (client));
     }
-
-  return entered_phase2;
 }
 
 
 void
 xfsm_manager_complete_saveyourself (XfsmManager *manager)
 {
-  GList *lp;
+  /* already completed, clients that disconnect or report late while
+   * the session is being stored must not complete it a second time */
+  if (manager->checkpoint_storing)
+    return;
 
   /* Check if still clients in SAVING state or if we have to enter PHASE2
    * now. In either case, SaveYourself cannot be completed in this run.
@@ -1570,27 +1935,34 @@ xfsm_manager_complete_saveyourself (XfsmManager *manager)
   if (xfsm_manager_check_clients_saving (manager) || xfsm_manager_maybe_enter_phase2 (manager))
     return;
 
-  xfsm_verbose ("Manager finished SAVE YOURSELF, session data will be stored now.\n\n");
+  /* the legacy applications did not answer yet */
+  if (manager->legacy_saving)
+    return;
 
-  /* all clients done, store session data */
-  if (manager->save_session)
-    xfsm_manager_store_session (manager);
+  xfsm_verbose ("Manager finished SAVE YOURSELF, session data will be stored now.\n\n");
 
   if (manager->state == XFSM_MANAGER_CHECKPOINT)
     {
-      /* reset all clients to idle state */
-      xfsm_manager_set_state (manager, XFSM_MANAGER_IDLE);
-      for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
-           lp;
-           lp = lp->next)
+      xfsm_stats_record (XFSM_STATS_CHECKPOINT,
+                         g_get_monotonic_time () - manager->save_started);
+
+      /* all clients done, store session data and complete the
+       * checkpoint once it is on disk */
+      if (manager->save_session)
         {
-          XfsmClient *client = lp->data;
-          xfsm_client_set_state (client, XFSM_CLIENT_IDLE);
-          SmsSaveComplete (xfsm_client_get_sms_connection (client));
+          manager->checkpoint_storing = TRUE;
+          xfsm_manager_store_session (manager, xfsm_manager_checkpoint_done, NULL);
         }
+      else
+        xfsm_manager_checkpoint_done (manager, TRUE, NULL);
     }
   else
     {
+      /* the session file is written in the background while the
+       * clients are asked to die, xfsm_manager_quit() waits for it */
+      if (manager->save_session)
+        xfsm_manager_store_session (manager, NULL, NULL);
+
       /* shutdown the session */
       xfsm_manager_perform_shutdown (manager);
     }
@@ -1601,11 +1973,21 @@ static gboolean
 xfsm_manager_save_timeout (gpointer user_data)
 {
   XfsmSaveTimeoutData *stdata = user_data;
+  XfsmProperties      *properties;
 
   xfsm_verbose ("Client id = %s, received SAVE TIMEOUT\n"
                 "   Client will be disconnected now.\n\n",
                 xfsm_client_get_id (stdata->client));
 
+  /* give it more time next time */
+  properties = xfsm_client_get_properties (stdata->client);
+  if (properties != NULL)
+    {
+      xfsm_latency_record (xfsm_properties_get_string (properties, SmProgram),
+                           XFSM_LATENCY_SAVE,
+                           (gint64) stdata->timeout * 1000);
+    }
+
   /* returning FALSE below will free the data */
   g_object_steal_data (G_OBJECT (stdata->client), "--save-timeout-id");
 
@@ -1620,11 +2002,18 @@ xfsm_manager_start_client_save_timeout (XfsmManager *manager,
                                         XfsmClient  *client)
 {
   XfsmSaveTimeoutData *sdata = g_new(XfsmSaveTimeoutData, 1);
+  XfsmProperties      *properties = xfsm_client_get_properties (client);
 
   sdata->manager = manager;
   sdata->client = client;
+  /* how long the client gets depends on how long it took before */
+  sdata->timeout = xfsm_latency_get_timeout (properties != NULL
+                                             ? xfsm_properties_get_string (properties, SmProgram)
+                                             : NULL,
+                                             XFSM_LATENCY_SAVE,
+                                             SAVE_TIMEOUT);
   /* |sdata| will get freed when the source gets removed */
-  sdata->timeout_id = g_timeout_add_full (G_PRIORITY_DEFAULT, SAVE_TIMEOUT,
+  sdata->timeout_id = g_timeout_add_full (G_PRIORITY_DEFAULT, sdata->timeout,
                                           xfsm_manager_save_timeout,
                                           sdata, (GDestroyNotify) g_free);
   /* ... or, if the object gets destroyed first, the source will get
@@ -1645,58 +2034,278 @@ xfsm_manager_cancel_client_save_timeout (XfsmManager *manager,
 }
 
 
-void
-xfsm_manager_store_session (XfsmManager *manager)
-{
-  WnckWorkspace *workspace;
-  GdkDisplay    *display;
-  WnckScreen    *screen;
-  XfceRc        *rc;
-  GList         *lp;
-  gchar          prefix[64];
-  gchar         *backup;
-  gchar         *group;
-  gint           count = 0;
-  gint           n, m;
-
-  /* open file for writing, creates it if it doesn't exist */
-  rc = xfce_rc_simple_open (manager->session_file, FALSE);
-  if (G_UNLIKELY (rc == NULL))
+static void xfsm_manager_store_session_next (XfsmManager *manager);
+
+
+static void
+xfsm_manager_store_session_done (GObject      *source_object,
+                                 GAsyncResult *result,
+                                 gpointer      user_data)
+{
+  XfsmStoreData *sdata = user_data;
+  XfsmManager   *manager = sdata->manager;
+  gboolean       success;
+
+  success = g_task_propagate_boolean (G_TASK (result), NULL);
+
+  xfsm_verbose ("Session store %s\n", success ? "completed" : "failed");
+
+  manager->store_running = FALSE;
+
+  /* don't know what made it to the disk, start over with a full store
+   * and don't skip the next one because its contents look the same */
+  if (!success
+      || (sdata->contents != NULL && !sdata->journal
+          && g_stat (sdata->session_file, &manager->store_stat) != 0))
+    {
+      g_free (manager->journal_base);
+      manager->journal_base = NULL;
+      g_free (manager->store_checksum);
+      manager->store_checksum = NULL;
+    }
+
+  if (sdata->func != NULL)
+    sdata->func (manager, success, sdata->user_data);
+
+  g_free (sdata->session_file);
+  g_free (sdata->contents);
+  g_slice_free (XfsmStoreData, sdata);
+
+  if (!g_queue_is_empty (manager->store_queue))
+    xfsm_manager_store_session_next (manager);
+  else if (manager->quit_pending)
+    gtk_main_quit ();
+
+  g_object_unref (manager);
+}
+
+
+/* writes the new contents to a scratch file next to the session file,
+ * syncs it and renames it over the session file, so a crash leaves
+ * either the old or the new one. runs in a worker thread, must not
+ * touch the manager */
+static gboolean
+xfsm_manager_store_session_write (XfsmStoreData *sdata)
+{
+  GStatBuf  sb;
+  gchar    *scratch_file;
+  gchar    *backup;
+  gssize    written;
+  gsize     offset;
+  gboolean  succeed;
+  gint      fd;
+
+  scratch_file = g_strconcat (sdata->session_file, ".XXXXXX", NULL);
+  fd = g_mkstemp (scratch_file);
+  if (G_UNLIKELY (fd < 0))
     {
       fprintf (stderr,
                "xfce4-session: Unable to open session file %s for "
                "writing. Session data will not be stored. Please check "
                "your installation.\n",
-               manager->session_file);
-      return;
+               sdata->session_file);
+      g_free (scratch_file);
+      return FALSE;
     }
 
-  /* backup the old session file first */
-  if (g_file_test (manager->session_file, G_FILE_TEST_IS_REGULAR))
+  /* g_mkstemp() creates the file readable by the owner only, keep
+   * the mode of the session file it replaces */
+  if (g_stat (sdata->session_file, &sb) == 0)
+    fchmod (fd, sb.st_mode & 0777);
+  else
+    fchmod (fd, 0644);
+
+  for (offset = 0; offset < sdata->length; offset += written)
     {
-      backup = g_strconcat (manager->session_file, ".bak", NULL);
-      unlink (backup);
-      if (link (manager->session_file, backup))
-          g_warning ("Failed to create session file backup");
-      g_free (backup);
+      written = write (fd, sdata->contents + offset, sdata->length - offset);
+      if (written < 0 && errno == EINTR)
+        written = 0;
+      else if (written < 0)
+        break;
     }
 
-  if (manager->state == XFSM_MANAGER_CHECKPOINT && manager->checkpoint_session_name != NULL)
-    group = g_strconcat ("Session: ", manager->checkpoint_session_name, NULL);
+  succeed = offset == sdata->length && fsync (fd) == 0;
+  if (!succeed)
+    g_warning ("Failed to write session file %s: %s", scratch_file, g_strerror (errno));
+
+  close (fd);
+
+  if (succeed)
+    {
+      /* backup the old session file first */
+      if (g_file_test (sdata->session_file, G_FILE_TEST_IS_REGULAR))
+        {
+          backup = g_strconcat (sdata->session_file, ".bak", NULL);
+          unlink (backup);
+          if (link (sdata->session_file, backup))
+              g_warning ("Failed to create session file backup");
+          g_free (backup);
+        }
+
+      if (g_rename (scratch_file, sdata->session_file) != 0)
+        {
+          g_warning ("Failed to replace session file %s: %s",
+                     sdata->session_file, g_strerror (errno));
+          succeed = FALSE;
+        }
+    }
+
+  if (succeed)
+    {
+      /* the journal was compacted into the session file */
+      xfsm_journal_remove (sdata->session_file);
+
+      /* compile the session file for a faster startup next time */
+      xfsm_session_cache_compile (sdata->session_file);
+    }
   else
-    group = g_strconcat ("Session: ", manager->session_name, NULL);
-  xfce_rc_delete_group (rc, group, TRUE);
-  xfce_rc_set_group (rc, group);
-  g_free (group);
+    {
+      g_unlink (scratch_file);
+    }
+
+  g_free (scratch_file);
+
+  return succeed;
+}
+
+
+/* runs in a worker thread, must not touch the manager */
+static void
+xfsm_manager_store_session_thread (GTask        *task,
+                                   gpointer      source_object,
+                                   gpointer      task_data,
+                                   GCancellable *cancellable)
+{
+  XfsmStoreData *sdata = task_data;
+  gboolean       success;
+
+  if (sdata->journal)
+    success = xfsm_journal_append (sdata->session_file, sdata->contents, sdata->length);
+  else
+    success = xfsm_manager_store_session_write (sdata);
+
+  g_task_return_boolean (task, success);
+}
+
+
+static void
+xfsm_manager_store_session_next (XfsmManager *manager)
+{
+  XfsmStoreData *sdata;
+  GTask         *task;
+
+  /* one store at a time, so they hit the disk in order */
+  if (manager->store_running)
+    return;
+
+  sdata = g_queue_pop_head (manager->store_queue);
+  if (sdata == NULL)
+    return;
+
+  manager->store_running = TRUE;
+
+  task = g_task_new (NULL, NULL, xfsm_manager_store_session_done, sdata);
+
+  if (sdata->contents == NULL)
+    {
+      /* nothing to write, GTask reports completion from an idle */
+      g_task_return_boolean (task, TRUE);
+    }
+  else
+    {
+      g_task_set_task_data (task, sdata, NULL);
+      g_task_run_in_thread (task, xfsm_manager_store_session_thread);
+    }
+
+  g_object_unref (task);
+}
+
+
+/* hashes @contents, leaving out the entries that change with every store */
+static gchar *
+xfsm_manager_store_session_checksum (const gchar *contents,
+                                     gsize        length)
+{
+  GChecksum   *checksum;
+  const gchar *line;
+  const gchar *next;
+  const gchar *end = contents + length;
+  gchar       *result;
+
+  checksum = g_checksum_new (G_CHECKSUM_SHA1);
+
+  for (line = contents; line < end; line = next)
+    {
+      next = memchr (line, '\n', end - line);
+      next = (next != NULL) ? next + 1 : end;
+
+      if (!g_str_has_prefix (line, "LastAccess=")
+          && !g_str_has_prefix (line, "JournalBase="))
+        g_checksum_update (checksum, (const guchar *) line, next - line);
+    }
+
+  result = g_strdup (g_checksum_get_string (checksum));
+  g_checksum_free (checksum);
+
+  return result;
+}
+
+
+/* the most recent contents of the session file: what a pending store
+ * is about to write, or what is on disk right now */
+static GKeyFile *
+xfsm_manager_store_session_load (XfsmManager *manager)
+{
+  GKeyFile *file;
+  GError   *error = NULL;
+  gboolean  loaded;
+
+  file = g_key_file_new ();
+
+  if ((manager->store_running || !g_queue_is_empty (manager->store_queue))
+      && manager->store_contents != NULL)
+    {
+      loaded = g_key_file_load_from_data (file, manager->store_contents, -1,
+                                          G_KEY_FILE_NONE, &error);
+    }
+  else
+    {
+      loaded = g_key_file_load_from_file (file, manager->session_file,
+                                          G_KEY_FILE_NONE, &error);
+      if (!loaded && g_error_matches (error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+        {
+          g_error_free (error);
+          return file;
+        }
+    }
+
+  if (G_UNLIKELY (!loaded))
+    {
+      /* the store keeps the old file as .bak */
+      g_warning ("Failed to read session file %s, it will be replaced: %s",
+                 manager->session_file, error->message);
+      g_error_free (error);
+
+      g_key_file_free (file);
+      file = g_key_file_new ();
+    }
+
+  return file;
+}
+
+
+/* the clients stored with the session, in order */
+static GList *
+xfsm_manager_store_session_clients (XfsmManager *manager)
+{
+  GList *clients = NULL;
+  GList *lp;
 
   for (lp = g_queue_peek_nth_link (manager->restart_properties, 0);
        lp;
        lp = lp->next)
     {
-      XfsmProperties *properties = lp->data;
-      g_snprintf (prefix, 64, "Client%d_", count);
-      xfsm_properties_store (properties, rc, prefix);
-      ++count;
+      clients = g_list_prepend (clients, lp->data);
     }
 
   for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
@@ -1715,34 +2324,274 @@ xfsm_manager_store_session (XfsmManager *manager)
       if (restart_style_hint == SmRestartNever)
         continue;
 
-      g_snprintf (prefix, 64, "Client%d_", count);
-      xfsm_properties_store (xfsm_client_get_properties (client), rc, prefix);
-      ++count;
+      clients = g_list_prepend (clients, properties);
     }
 
-  xfce_rc_write_int_entry (rc, "Count", count);
+  return g_list_reverse (clients);
+}
+
+
+static void
+xfsm_manager_store_session_state (XfsmManager *manager,
+                                  GKeyFile    *file,
+                                  const gchar *group)
+{
+  gchar prefix[64];
+  gint  n, m;
 
   /* store legacy applications state */
-  xfsm_legacy_store_session (rc);
+  xfsm_legacy_store_session (file, group);
 
   /* store current workspace numbers */
-  display = gdk_display_get_default ();
-  for (n = 0; n < gdk_display_get_n_screens (display); ++n)
+  for (n = 0; n < xfsm_wnck_get_n_screens (); ++n)
     {
-      screen = wnck_screen_get (n);
-      wnck_screen_force_update (screen);
-
-      workspace = wnck_screen_get_active_workspace (screen);
-      m = wnck_workspace_get_number (workspace);
+      m = xfsm_wnck_get_active_workspace (n);
 
       g_snprintf (prefix, 64, "Screen%d_ActiveWorkspace", n);
-      xfce_rc_write_int_entry (rc, prefix, m);
+      g_key_file_set_integer (file, group, prefix, m);
     }
+}
+
+
+/*
+ * Appends the clients that changed since the last store to the session
+ * journal, see xfsm-journal.c. Returns FALSE if a full store is needed
+ * instead.
+ */
+static gboolean
+xfsm_manager_store_session_journal (XfsmManager   *manager,
+                                    XfsmStoreData *sdata)
+{
+  XfsmProperties *properties;
+  GKeyFile       *file;
+  GList          *clients;
+  GList          *lp;
+  gchar         **keys;
+  gchar          *group;
+  gchar          *joined;
+  gint            n_dirty = 0;
+  gint            n;
+
+  /* only checkpoints of the running session go to the journal, the
+   * session file is compacted regularly and on logout */
+  if (manager->state != XFSM_MANAGER_CHECKPOINT
+      || (manager->checkpoint_session_name != NULL
+          && strcmp (manager->checkpoint_session_name, manager->session_name) != 0)
+      || manager->journal_base == NULL
+      || manager->journal_records >= XFSM_JOURNAL_MAX_RECORDS)
+    return FALSE;
+
+  clients = xfsm_manager_store_session_clients (manager);
+
+  keys = g_new0 (gchar *, g_list_length (clients) + 1);
+  for (lp = clients, n = 0; lp != NULL; lp = lp->next, ++n)
+    {
+      properties = lp->data;
+      if (properties->dirty || properties->journal_key == NULL)
+        ++n_dirty;
+      keys[n] = properties->journal_key;
+    }
+  joined = g_strjoinv (",", keys);
+  g_free (keys);
+
+  if (n_dirty == 0 && g_strcmp0 (joined, manager->journal_clients) == 0)
+    {
+      xfsm_verbose ("No client changed since the last checkpoint\n");
+      g_list_free (clients);
+      g_free (joined);
+      return TRUE;
+    }
+
+  g_free (joined);
+
+  ++manager->journal_records;
+
+  file = g_key_file_new ();
+  group = g_strconcat ("Session: ", manager->session_name, NULL);
+
+  g_key_file_set_string (file, group, "Base", manager->journal_base);
+  g_key_file_set_integer (file, group, "Count", g_list_length (clients));
+
+  keys = g_new0 (gchar *, g_list_length (clients) + 1);
+  for (lp = clients, n = 0; lp != NULL; lp = lp->next, ++n)
+    {
+      properties = lp->data;
+      if (properties->dirty || properties->journal_key == NULL)
+        {
+          g_free (properties->journal_key);
+          properties->journal_key = g_strdup_printf ("J%uC%d_", manager->journal_records, n);
+          properties->dirty = FALSE;
+          xfsm_properties_store (properties, file, group, properties->journal_key);
+        }
+      keys[n] = properties->journal_key;
+    }
+
+  g_free (manager->journal_clients);
+  manager->journal_clients = g_strjoinv (",", keys);
+  g_key_file_set_string (file, group, "Clients", manager->journal_clients);
+  g_free (keys);
+
+  xfsm_manager_store_session_state (manager, file, group);
 
   /* remember time */
-  xfce_rc_write_int_entry (rc, "LastAccess", time (NULL));
+  g_key_file_set_integer (file, group, "LastAccess", time (NULL));
 
-  xfce_rc_close (rc);
+  sdata->contents = g_key_file_to_data (file, &sdata->length, NULL);
+  sdata->journal = TRUE;
+
+  g_key_file_free (file);
+  g_free (group);
+
+  xfsm_verbose ("Appending %d of %d clients to the session journal\n",
+                n_dirty, g_list_length (clients));
+
+  g_list_free (clients);
+
+  return TRUE;
+}
+
+
+/* whether the session file is still the one the last write left, it
+ * may have been removed or replaced behind our back */
+static gboolean
+xfsm_manager_store_session_on_disk (XfsmManager *manager)
+{
+  GStatBuf sb;
+
+  /* a pending store has not reached the disk yet */
+  if (manager->store_running || !g_queue_is_empty (manager->store_queue))
+    return FALSE;
+
+  return g_stat (manager->session_file, &sb) == 0
+    && sb.st_ino == manager->store_stat.st_ino
+    && sb.st_size == manager->store_stat.st_size
+    && sb.st_mtim.tv_sec == manager->store_stat.st_mtim.tv_sec
+    && sb.st_mtim.tv_nsec == manager->store_stat.st_mtim.tv_nsec;
+}
+
+
+/*
+ * Serialises the session into memory and hands it to a worker thread,
+ * which writes it to a scratch file, syncs it and renames it over the
+ * session file. @func is called in the main loop once that is done.
+ * The write is skipped if nothing changed since the last store.
+ * Checkpoints only append the changed clients to the session journal.
+ */
+void
+xfsm_manager_store_session (XfsmManager         *manager,
+                            XfsmManagerStoreFunc func,
+                            gpointer             user_data)
+{
+  XfsmProperties *properties;
+  XfsmStoreData  *sdata;
+  GKeyFile       *file;
+  GList          *clients;
+  GList          *lp;
+  gboolean        current;
+  gchar           prefix[64];
+  gchar          *contents;
+  gchar          *checksum;
+  gchar          *journal_base = NULL;
+  gchar          *group;
+  gsize           length;
+  gint            count = 0;
+
+  sdata = g_slice_new0 (XfsmStoreData);
+  sdata->manager = g_object_ref (manager);
+  sdata->session_file = g_strdup (manager->session_file);
+  sdata->func = func;
+  sdata->user_data = user_data;
+
+  if (xfsm_manager_store_session_journal (manager, sdata))
+    goto queue;
+
+  file = xfsm_manager_store_session_load (manager);
+
+  current = manager->state != XFSM_MANAGER_CHECKPOINT
+            || manager->checkpoint_session_name == NULL
+            || strcmp (manager->checkpoint_session_name, manager->session_name) == 0;
+
+  if (current)
+    group = g_strconcat ("Session: ", manager->session_name, NULL);
+  else
+    group = g_strconcat ("Session: ", manager->checkpoint_session_name, NULL);
+  g_key_file_remove_group (file, group, NULL);
+
+  clients = xfsm_manager_store_session_clients (manager);
+  for (lp = clients; lp != NULL; lp = lp->next)
+    {
+      properties = lp->data;
+      g_snprintf (prefix, 64, "Client%d_", count);
+      xfsm_properties_store (properties, file, group, prefix);
+      ++count;
+
+      if (current)
+        {
+          g_free (properties->journal_key);
+          properties->journal_key = g_strdup (prefix);
+          properties->dirty = FALSE;
+        }
+    }
+  g_list_free (clients);
+
+  g_key_file_set_integer (file, group, "Count", count);
+
+  xfsm_manager_store_session_state (manager, file, group);
+
+  /* journal records written from now on apply to this version */
+  if (current)
+    {
+      journal_base = g_strdup_printf ("%lx-%08x", (gulong) time (NULL), g_random_int ());
+      g_key_file_set_string (file, group, "JournalBase", journal_base);
+    }
+
+  /* remember time */
+  g_key_file_set_integer (file, group, "LastAccess", time (NULL));
+
+  contents = g_key_file_to_data (file, &length, NULL);
+  g_key_file_free (file);
+  g_free (group);
+
+  /* compare everything but the journal base and the access time with
+   * the last store, unless the journal has newer data that has to be
+   * compacted or the file on disk is not what the last store wrote */
+  checksum = xfsm_manager_store_session_checksum (contents, length);
+  if (manager->store_checksum != NULL
+      && strcmp (checksum, manager->store_checksum) == 0
+      && (!current || manager->journal_records == 0)
+      && xfsm_manager_store_session_on_disk (manager))
+    {
+      xfsm_verbose ("Session data unchanged, not writing %s\n", manager->session_file);
+
+      g_free (journal_base);
+      g_free (checksum);
+      g_free (contents);
+    }
+  else
+    {
+      g_free (manager->store_checksum);
+      manager->store_checksum = checksum;
+
+      if (current)
+        {
+          g_free (manager->journal_base);
+          manager->journal_base = journal_base;
+          manager->journal_records = 0;
+          g_free (manager->journal_clients);
+          manager->journal_clients = NULL;
+        }
+
+      /* the next store starts from here while this one is pending */
+      g_free (manager->store_contents);
+      manager->store_contents = g_strdup (contents);
+
+      sdata->contents = contents;
+      sdata->length = length;
+    }
+
+queue:
+  g_queue_push_tail (manager->store_queue, sdata);
+  xfsm_manager_store_session_next (manager);
 
   g_free (manager->checkpoint_session_name);
   manager->checkpoint_session_name = NULL;
@@ -1763,6 +2612,8 @@ xfsm_manager_get_state (XfsmManager *manager)
 }
 
 
+/* the starting and pending queues are indexed, change them only
+ * through the functions below */
 GQueue *
 xfsm_manager_get_queue (XfsmManager         *manager,
                         XfsmManagerQueueType q_type)
@@ -1786,6 +2637,73 @@ xfsm_manager_get_queue (XfsmManager         *manager,
 }
 
 
+void
+xfsm_manager_add_starting_properties (XfsmManager    *manager,
+                                      XfsmProperties *properties)
+{
+  g_queue_push_tail (manager->starting_properties, properties);
+  xfsm_manager_index_properties (manager->starting_index,
+                                 g_queue_peek_tail_link (manager->starting_properties));
+  xfsm_startup_index_add (properties, FALSE);
+}
+
+
+/* appends @properties to the pending queue, which is not sorted by
+ * priority again */
+void
+xfsm_manager_add_pending_properties (XfsmManager    *manager,
+                                     XfsmProperties *properties)
+{
+  g_queue_push_tail (manager->pending_properties, properties);
+  xfsm_manager_index_properties (manager->pending_index,
+                                 g_queue_peek_tail_link (manager->pending_properties));
+  xfsm_startup_index_add (properties, TRUE);
+}
+
+
+gboolean
+xfsm_manager_has_starting_properties (XfsmManager    *manager,
+                                      XfsmProperties *properties)
+{
+  GList *lp;
+
+  lp = g_hash_table_lookup (manager->starting_index, properties->client_id);
+  return lp != NULL && lp->data == properties;
+}
+
+
+/* returns FALSE if @properties wasn't starting */
+gboolean
+xfsm_manager_remove_starting_properties (XfsmManager    *manager,
+                                         XfsmProperties *properties)
+{
+  if (!xfsm_manager_has_starting_properties (manager, properties))
+    return FALSE;
+
+  xfsm_manager_unlink_properties (manager->starting_properties,
+                                  manager->starting_index,
+                                  g_hash_table_lookup (manager->starting_index,
+                                                       properties->client_id));
+  xfsm_startup_index_remove (properties, FALSE);
+  return TRUE;
+}
+
+
+/* removes @link from the pending queue and returns its properties */
+XfsmProperties *
+xfsm_manager_take_pending_properties (XfsmManager *manager,
+                                      GList       *link)
+{
+  XfsmProperties *properties;
+
+  properties = xfsm_manager_unlink_properties (manager->pending_properties,
+                                               manager->pending_index, link);
+  xfsm_startup_index_remove (properties, TRUE);
+
+  return properties;
+}
+
+
 gboolean
 xfsm_manager_get_use_failsafe_mode (XfsmManager *manager)
 {
@@ -1833,6 +2751,17 @@ static gboolean xfsm_manager_dbus_get_info (XfsmManager *manager,
 static gboolean xfsm_manager_dbus_list_clients (XfsmManager *manager,
                                                 GPtrArray  **OUT_clients,
                                                 GError     **error);
+static gboolean xfsm_manager_dbus_get_all_clients (XfsmManager *manager,
+                                                   guint64     *OUT_generation,
+                                                   GPtrArray  **OUT_clients,
+                                                   GError     **error);
+static gboolean xfsm_manager_dbus_get_clients_since (XfsmManager *manager,
+                                                     guint64      generation,
+                                                     guint64     *OUT_generation,
+                                                     gboolean    *OUT_full,
+                                                     GPtrArray  **OUT_clients,
+                                                     GPtrArray  **OUT_removed,
+                                                     GError     **error);
 static gboolean xfsm_manager_dbus_get_state (XfsmManager *manager,
                                              guint       *OUT_state,
                                              GError     **error);
@@ -1865,6 +2794,19 @@ static gboolean xfsm_manager_dbus_hibernate (XfsmManager *manager,
 static gboolean xfsm_manager_dbus_can_hibernate (XfsmManager *manager,
                                                  gboolean    *can_hibernate,
                                                  GError     **error);
+static gboolean xfsm_manager_dbus_get_startup_trace (XfsmManager *manager,
+                                                     gchar      **OUT_trace,
+                                                     GError     **error);
+static gboolean xfsm_manager_dbus_get_save_latencies (XfsmManager *manager,
+                                                      GArray     **OUT_bounds,
+                                                      GPtrArray  **OUT_latencies,
+                                                      GError     **error);
+static gboolean xfsm_manager_dbus_get_client_timeouts (XfsmManager *manager,
+                                                       GPtrArray  **OUT_timeouts,
+                                                       GError     **error);
+static gboolean xfsm_manager_dbus_get_protocol_stats (XfsmManager *manager,
+                                                      GHashTable **OUT_stats,
+                                                      GError     **error);
 
 
 /* eader needs the above fwd decls */
@@ -1976,6 +2918,76 @@ xfsm_manager_dbus_list_clients (XfsmManager *manager,
 }
 
 
+static gboolean
+xfsm_manager_dbus_get_all_clients (XfsmManager *manager,
+                                   guint64     *OUT_generation,
+                                   GPtrArray  **OUT_clients,
+                                   GError     **error)
+{
+  gboolean full;
+
+  return xfsm_manager_dbus_get_clients_since (manager, 0, OUT_generation,
+                                              &full, OUT_clients, NULL,
+                                              error);
+}
+
+
+static gboolean
+xfsm_manager_dbus_get_clients_since (XfsmManager *manager,
+                                     guint64      generation,
+                                     guint64     *OUT_generation,
+                                     gboolean    *OUT_full,
+                                     GPtrArray  **OUT_clients,
+                                     GPtrArray  **OUT_removed,
+                                     GError     **error)
+{
+  XfsmRemovedClient *removed;
+  XfsmClient        *client;
+  GList             *lp;
+
+  *OUT_generation = xfsm_client_get_current_generation ();
+
+  /* a generation from before the oldest removal we still know about
+   * (or from a previous session manager instance) can't be answered
+   * with a delta, so the caller gets the complete table instead */
+  *OUT_full = (generation == 0
+               || generation < manager->removed_floor
+               || generation > *OUT_generation);
+  if (*OUT_full)
+    generation = 0;
+
+  *OUT_clients = g_ptr_array_new ();
+
+  for (lp = g_queue_peek_nth_link (manager->running_clients, 0);
+       lp;
+       lp = lp->next)
+    {
+      client = XFSM_CLIENT (lp->data);
+      if (xfsm_client_get_generation (client) > generation)
+        g_ptr_array_add (*OUT_clients, xfsm_client_to_dbus (client));
+    }
+
+  if (OUT_removed == NULL)
+    return TRUE;
+
+  *OUT_removed = g_ptr_array_new ();
+  if (*OUT_full)
+    return TRUE;
+
+  for (lp = g_queue_peek_tail_link (manager->removed_clients);
+       lp != NULL;
+       lp = lp->prev)
+    {
+      removed = lp->data;
+      if (removed->generation <= generation)
+        break;
+      g_ptr_array_add (*OUT_removed, g_strdup (removed->object_path));
+    }
+
+  return TRUE;
+}
+
+
 static gboolean
 xfsm_manager_dbus_get_state (XfsmManager *manager,
                              guint       *OUT_state,
@@ -2128,6 +3140,14 @@ xfsm_manager_dbus_suspend (XfsmManager *manager,
                            GError     **error)
 {
   g_return_val_if_fail (XFSM_IS_MANAGER (manager), FALSE);
+
+  if (xfsm_headless)
+    {
+      g_set_error (error, XFSM_ERROR, XFSM_ERROR_UNSUPPORTED,
+                   _("Not supported in headless mode"));
+      return FALSE;
+    }
+
   return xfsm_shutdown_try_suspend (manager->shutdown_helper, error);
 }
 
@@ -2155,6 +3175,14 @@ xfsm_manager_dbus_hibernate (XfsmManager *manager,
                              GError     **error)
 {
   g_return_val_if_fail (XFSM_IS_MANAGER (manager), FALSE);
+
+  if (xfsm_headless)
+    {
+      g_set_error (error, XFSM_ERROR, XFSM_ERROR_UNSUPPORTED,
+                   _("Not supported in headless mode"));
+      return FALSE;
+    }
+
   return xfsm_shutdown_try_hibernate (manager->shutdown_helper, error);
 }
 
@@ -2176,3 +3204,45 @@ xfsm_manager_dbus_can_hibernate (XfsmManager *manager,
 
   return retval;
 }
+
+
+static gboolean
+xfsm_manager_dbus_get_startup_trace (XfsmManager *manager,
+                                     gchar      **OUT_trace,
+                                     GError     **error)
+{
+  *OUT_trace = xfsm_trace_to_json ();
+  return TRUE;
+}
+
+
+static gboolean
+xfsm_manager_dbus_get_save_latencies (XfsmManager *manager,
+                                      GArray     **OUT_bounds,
+                                      GPtrArray  **OUT_latencies,
+                                      GError     **error)
+{
+  *OUT_bounds = xfsm_save_coordinator_get_bounds ();
+  *OUT_latencies = xfsm_save_coordinator_get_histograms (manager->save_coordinator);
+  return TRUE;
+}
+
+
+static gboolean
+xfsm_manager_dbus_get_client_timeouts (XfsmManager *manager,
+                                       GPtrArray  **OUT_timeouts,
+                                       GError     **error)
+{
+  *OUT_timeouts = xfsm_latency_to_dbus ();
+  return TRUE;
+}
+
+
+static gboolean
+xfsm_manager_dbus_get_protocol_stats (XfsmManager *manager,
+                                      GHashTable **OUT_stats,
+                                      GError     **error)
+{
+  *OUT_stats = xfsm_stats_to_dbus ();
+  return TRUE;
+}
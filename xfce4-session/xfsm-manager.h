@@ -25,11 +25,11 @@
 
 #include <glib-object.h>
 
-#include <xfconf/xfconf.h>
 #include <libxfce4util/libxfce4util.h>
 
 #include <xfce4-session/xfsm-client.h>
 #include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <xfce4-session/xfsm-shutdown.h>
 
 G_BEGIN_DECLS
@@ -73,8 +73,8 @@ GType xfsm_manager_get_type (void) G_GNUC_CONST;
 
 XfsmManager *xfsm_manager_new (void);
 
-void xfsm_manager_load (XfsmManager   *manager,
-                        XfconfChannel *channel);
+void xfsm_manager_load (XfsmManager  *manager,
+                        XfsmSettings *settings);
 
 gboolean xfsm_manager_restart (XfsmManager *manager);
 
@@ -140,7 +140,14 @@ gboolean xfsm_manager_run_command (XfsmManager          *manager,
                                    const XfsmProperties *properties,
                                    const gchar          *command);
 
-void xfsm_manager_store_session (XfsmManager *manager);
+/* called once the session file was stored, or the store failed */
+typedef void (*XfsmManagerStoreFunc) (XfsmManager *manager,
+                                      gboolean     success,
+                                      gpointer     user_data);
+
+void xfsm_manager_store_session (XfsmManager         *manager,
+                                 XfsmManagerStoreFunc func,
+                                 gpointer             user_data);
 
 void xfsm_manager_complete_saveyourself (XfsmManager *manager);
 
@@ -151,6 +158,17 @@ XfsmManagerState xfsm_manager_get_state (XfsmManager *manager);
 GQueue *xfsm_manager_get_queue (XfsmManager         *manager,
                                 XfsmManagerQueueType q_type);
 
+void            xfsm_manager_add_starting_properties    (XfsmManager    *manager,
+                                                         XfsmProperties *properties);
+void            xfsm_manager_add_pending_properties     (XfsmManager    *manager,
+                                                         XfsmProperties *properties);
+gboolean        xfsm_manager_has_starting_properties    (XfsmManager    *manager,
+                                                         XfsmProperties *properties);
+gboolean        xfsm_manager_remove_starting_properties (XfsmManager    *manager,
+                                                         XfsmProperties *properties);
+XfsmProperties *xfsm_manager_take_pending_properties    (XfsmManager    *manager,
+                                                         GList          *link);
+
 gboolean xfsm_manager_get_use_failsafe_mode (XfsmManager *manager);
 
 gboolean xfsm_manager_get_compat_startup (XfsmManager          *manager,
@@ -22,6 +22,14 @@ G_GNUC_INTERNAL void xfsm_marshal_VOID__STRING_BOXED (GClosure     *closure,
                                                       gpointer      invocation_hint,
                                                       gpointer      marshal_data);
 
+/* VOID:BOXED,BOXED (xfsm-marshal.list:3) */
+G_GNUC_INTERNAL void xfsm_marshal_VOID__BOXED_BOXED (GClosure     *closure,
+                                                     GValue       *return_value,
+                                                     guint         n_param_values,
+                                                     const GValue *param_values,
+                                                     gpointer      invocation_hint,
+                                                     gpointer      marshal_data);
+
 G_END_DECLS
 
 #endif /* __xfsm_marshal_MARSHAL_H__ */
@@ -40,14 +40,6 @@
 #include <xfce4-session/xfsm-properties.h>
 
 
-/* local prototypes */
-static SmProp* strv_to_property (const gchar  *name,
-                                 gchar       **argv)  G_GNUC_PURE;
-static SmProp* str_to_property  (const gchar  *name,
-                                 const gchar  *value) G_GNUC_PURE;
-static SmProp* int_to_property  (const gchar  *name,
-                                 gint          value) G_GNUC_PURE;
-
 /* these three structs hold lists of properties that we save in
  * and load from the session file */
 static const struct
@@ -55,6 +47,7 @@ static const struct
   const gchar *name;
   const gchar *xsmp_name;
 } strv_properties[] = {
+  { "After", XfsmAfter },
   { "CloneCommand", SmCloneCommand },
   { "DiscardCommand", SmDiscardCommand },
   { "Environment", SmEnvironment },
@@ -88,19 +81,19 @@ static const struct
 };
 
 
-#ifndef HAVE_STRDUP
-static char*
-strdup (const char *s)
+static gboolean
+strv_equal (gchar **a,
+            gchar **b)
 {
-  char *t;
+  if (a == NULL || b == NULL)
+    return a == b;
 
-  t = (char *) malloc (strlen (s) + 1);
-  if (t != NULL)
-    strcpy (t, s);
+  for (; *a != NULL && *b != NULL; ++a, ++b)
+    if (strcmp (*a, *b) != 0)
+      return FALSE;
 
-  return t;
+  return *a == *b;
 }
-#endif
 
 
 static gchar*
@@ -115,70 +108,309 @@ compose (gchar       *buffer,
 }
 
 
-static SmProp*
-strv_to_property (const gchar *name,
-                  gchar      **argv)
+/* properties every client has and that are looked at a lot get a
+ * fixed slot in XfsmProperties instead of an entry in the sorted
+ * array, keep in sync with the XFSM_PROPERTIES_SLOT_* enum */
+static const gchar *slot_names[XFSM_PROPERTIES_N_SLOTS] =
 {
-  SmProp *prop;
-  gint    argc;
+  SmProgram,
+  SmRestartStyleHint,
+  GsmPriority,
+};
+
+static GQuark slot_quarks[XFSM_PROPERTIES_N_SLOTS];
+
 
-  prop       = (SmProp *) malloc (sizeof (*prop));
-  prop->name = strdup (name);
-  prop->type = strdup (SmLISTofARRAY8);
+/* a property is allocated along with its value: the string, or the
+ * pointers and then the strings of a string vector, follow the struct */
+#define XFSM_PROPERTY_DATA(prop)  ((gchar *) ((prop) + 1))
+
+
+static XfsmProperty *
+xfsm_property_new (GQuark        name,
+                   const GValue *value)
+{
+  XfsmProperty *prop;
+  const gchar  *str = NULL;
+  gchar       **strv = NULL;
+  gchar       **copy;
+  gchar        *data;
+  gsize         size = 0;
+  gsize         length;
+  guint         n, n_strv = 0;
+
+  if (G_VALUE_HOLDS (value, G_TYPE_STRV))
+    {
+      strv = g_value_get_boxed (value);
+      if (strv != NULL)
+        {
+          n_strv = g_strv_length (strv);
+          size = (n_strv + 1) * sizeof (gchar *);
+          for (n = 0; n < n_strv; ++n)
+            size += strlen (strv[n]) + 1;
+        }
+    }
+  else if (G_VALUE_HOLDS_STRING (value))
+    {
+      str = g_value_get_string (value);
+      if (str != NULL)
+        size = strlen (str) + 1;
+    }
 
-  for (argc = 0; argv[argc] != NULL; ++argc)
-    ;
+  prop = g_malloc0 (sizeof (XfsmProperty) + size);
+  prop->name = name;
+  g_value_init (&prop->value, G_VALUE_TYPE (value));
 
-  prop->num_vals = argc;
-  prop->vals     = (SmPropValue *) malloc (argc * sizeof (SmPropValue));
+  data = XFSM_PROPERTY_DATA (prop);
+  if (strv != NULL)
+    {
+      copy = (gchar **) data;
+      data += (n_strv + 1) * sizeof (gchar *);
+      for (n = 0; n < n_strv; ++n)
+        {
+          length = strlen (strv[n]) + 1;
+          memcpy (data, strv[n], length);
+          copy[n] = data;
+          data += length;
+        }
+      copy[n] = NULL;
 
-  while (argc-- > 0)
+      g_value_set_static_boxed (&prop->value, copy);
+    }
+  else if (str != NULL)
+    {
+      memcpy (data, str, size);
+      g_value_set_static_string (&prop->value, data);
+    }
+  else if (!G_VALUE_HOLDS (value, G_TYPE_STRV)
+           && !G_VALUE_HOLDS_STRING (value))
     {
-      prop->vals[argc].length = strlen (argv[argc]) + 1;
-      prop->vals[argc].value  = strdup (argv[argc]);
+      g_value_copy (value, &prop->value);
     }
 
   return prop;
 }
 
 
-static SmProp*
-str_to_property (const gchar *name,
-                 const gchar *value)
+static void
+xfsm_property_free (XfsmProperty *prop)
 {
-  SmProp *prop;
+  g_value_unset (&prop->value);
+  g_free (prop);
+}
 
-  prop                 = (SmProp *) malloc (sizeof (*prop));
-  prop->name           = strdup (name);
-  prop->type           = strdup (SmARRAY8);
-  prop->num_vals       = 1;
-  prop->vals           = (SmPropValue *) malloc (sizeof (SmPropValue));
-  prop->vals[0].length = strlen (value) + 1;
-  prop->vals[0].value  = strdup (value);
 
-  return prop;
+/* where property @name lives: its slot (which may be empty) or its
+ * entry in the sorted array. returns NULL if it is not in the array,
+ * @index is where it would have to be inserted then */
+static XfsmProperty **
+xfsm_properties_locate (const XfsmProperties *properties,
+                        GQuark                name,
+                        guint                *index)
+{
+  guint lower, upper, n;
+
+  for (n = 0; n < XFSM_PROPERTIES_N_SLOTS; ++n)
+    if (slot_quarks[n] == name)
+      return (XfsmProperty **) &properties->slots[n];
+
+  lower = 0;
+  upper = properties->n_props;
+  while (lower < upper)
+    {
+      n = (lower + upper) / 2;
+
+      if (properties->props[n]->name < name)
+        lower = n + 1;
+      else if (properties->props[n]->name > name)
+        upper = n;
+      else
+        return properties->props + n;
+    }
+
+  if (index != NULL)
+    *index = lower;
+
+  return NULL;
 }
 
 
-static SmProp*
-int_to_property (const gchar *name,
-                 gint         value)
+static XfsmProperty *
+xfsm_properties_lookup (const XfsmProperties *properties,
+                        const gchar          *property_name)
 {
-  SmProp *prop;
-  gint8  *p;
+  XfsmProperty **location;
+  GQuark         name;
 
-  p    = (gint8 *) malloc (1);
-  p[0] = (gint8) value;
+  /* a name that was never interned is not set on any client */
+  name = g_quark_try_string (property_name);
+  if (name == 0)
+    return NULL;
 
-  prop                 = (SmProp *) malloc (sizeof (*prop));
-  prop->name           = strdup (name);
-  prop->type           = strdup (SmCARD8);
-  prop->num_vals       = 1;
-  prop->vals           = (SmPropValue *) malloc (sizeof (SmPropValue));
-  prop->vals[0].length = 1;
-  prop->vals[0].value  = p;
+  location = xfsm_properties_locate (properties, name, NULL);
 
-  return prop;
+  return location != NULL ? *location : NULL;
+}
+
+
+/* the SmProps of a client in one block, ready to be sent:
+ *
+ *   SmProp *[n_props] | SmProp [n_props] | SmPropValue [n_vals] | CARD8s
+ *
+ * names point at the interned names and ARRAY8 values into the
+ * properties, so the block has to be dropped whenever one changes */
+typedef struct
+{
+  SmProp     **pp;
+  SmProp      *prop;
+  SmPropValue *val;
+  guchar      *card8;
+  gint         n_props;
+  gint         n_vals;
+} XfsmPropertiesWire;
+
+
+static gboolean
+xfsm_properties_wire_count (gpointer key,
+                            gpointer value,
+                            gpointer data)
+{
+  const GValue       *prop_value = value;
+  XfsmPropertiesWire *wire = data;
+
+  if (G_VALUE_HOLDS (prop_value, G_TYPE_STRV))
+    {
+      wire->n_vals += g_strv_length (g_value_get_boxed (prop_value));
+    }
+  else if (G_VALUE_HOLDS_STRING (prop_value)
+           || G_VALUE_HOLDS_UCHAR (prop_value))
+    {
+      wire->n_vals += 1;
+    }
+  else
+    {
+      g_warning ("Unhandled property \"%s\" with type \"%s\"", (const gchar *) key,
+                 g_type_name (G_VALUE_TYPE (prop_value)));
+      return FALSE;
+    }
+
+  wire->n_props++;
+
+  return FALSE;
+}
+
+
+static gboolean
+xfsm_properties_wire_fill (gpointer key,
+                           gpointer value,
+                           gpointer data)
+{
+  const GValue       *prop_value = value;
+  XfsmPropertiesWire *wire = data;
+  SmProp             *prop = wire->prop;
+  gchar             **strv;
+
+  prop->name = key;
+  prop->vals = wire->val;
+
+  if (G_VALUE_HOLDS (prop_value, G_TYPE_STRV))
+    {
+      prop->type = (gchar *) SmLISTofARRAY8;
+      for (strv = g_value_get_boxed (prop_value); *strv != NULL; ++strv, ++wire->val)
+        {
+          wire->val->length = strlen (*strv) + 1;
+          wire->val->value = *strv;
+        }
+    }
+  else if (G_VALUE_HOLDS_STRING (prop_value))
+    {
+      prop->type = (gchar *) SmARRAY8;
+      wire->val->length = strlen (g_value_get_string (prop_value)) + 1;
+      wire->val->value = (SmPointer) g_value_get_string (prop_value);
+      wire->val++;
+    }
+  else if (G_VALUE_HOLDS_UCHAR (prop_value))
+    {
+      prop->type = (gchar *) SmCARD8;
+      *wire->card8 = g_value_get_uchar (prop_value);
+      wire->val->length = 1;
+      wire->val->value = wire->card8++;
+      wire->val++;
+    }
+  else
+    {
+      return FALSE;
+    }
+
+  prop->num_vals = wire->val - prop->vals;
+  *wire->pp++ = wire->prop++;
+
+  return FALSE;
+}
+
+
+static void
+xfsm_properties_changed (XfsmProperties *properties,
+                         GQuark          name)
+{
+  properties->dirty = TRUE;
+
+  g_free (properties->sm_props);
+  properties->sm_props = NULL;
+  properties->n_sm_props = 0;
+
+  /* drop what the startup scheduler derived from @name */
+  if (name == slot_quarks[XFSM_PROPERTIES_SLOT_PROGRAM])
+    properties->startup_program = NULL;
+  else if (name == g_quark_try_string (GsmDesktopFile))
+    {
+      properties->startup_desktop = NULL;
+      g_strfreev (properties->startup_after);
+      properties->startup_after = NULL;
+    }
+}
+
+
+/* sets @property_name to a copy of @value. only the entry of
+ * @property_name is replaced, the other properties stay where they are */
+static void
+xfsm_properties_set_value (XfsmProperties *properties,
+                           const gchar    *property_name,
+                           const GValue   *value)
+{
+  XfsmProperty **location;
+  XfsmProperty  *prop;
+  XfsmProperty  *old_prop = NULL;
+  guint          index;
+
+  /* @value may point into the old entry, it is freed last */
+  prop = xfsm_property_new (g_quark_from_string (property_name), value);
+
+  location = xfsm_properties_locate (properties, prop->name, &index);
+  if (location != NULL)
+    {
+      old_prop = *location;
+      *location = prop;
+    }
+  else
+    {
+      if (properties->n_props == properties->props_size)
+        {
+          properties->props_size = MAX (8, properties->props_size * 2);
+          properties->props = g_renew (XfsmProperty *, properties->props,
+                                       properties->props_size);
+        }
+
+      memmove (properties->props + index + 1, properties->props + index,
+               (properties->n_props - index) * sizeof (XfsmProperty *));
+      properties->props[index] = prop;
+      properties->n_props++;
+    }
+
+  xfsm_properties_changed (properties, prop->name);
+
+  if (old_prop != NULL)
+    xfsm_property_free (old_prop);
 }
 
 
@@ -186,62 +418,96 @@ XfsmProperties*
 xfsm_properties_new (const gchar *client_id,
                      const gchar *hostname)
 {
+  static gsize    slots_initialized = 0;
   XfsmProperties *properties;
+  guint           n;
+
+  if (g_once_init_enter (&slots_initialized))
+    {
+      for (n = 0; n < XFSM_PROPERTIES_N_SLOTS; ++n)
+        slot_quarks[n] = g_quark_from_static_string (slot_names[n]);
+      g_once_init_leave (&slots_initialized, 1);
+    }
 
   properties = g_slice_new0 (XfsmProperties);
   properties->client_id = g_strdup (client_id);
   properties->hostname  = g_strdup (hostname);
   properties->pid       = -1;
-
-  properties->sm_properties = g_tree_new_full ((GCompareDataFunc) strcmp,
-                                               NULL,
-                                               (GDestroyNotify) g_free,
-                                               (GDestroyNotify) xfsm_g_value_free);
+  properties->dirty     = TRUE;
 
   return properties;
 }
 
 
-static gboolean
-xfsm_properties_extract_foreach (gpointer key,
-                                 gpointer value,
-                                 gpointer data)
+/* calls @func with the name and the GValue of every property, until
+ * it returns TRUE */
+void
+xfsm_properties_foreach (XfsmProperties *properties,
+                         GTraverseFunc   func,
+                         gpointer        user_data)
 {
-  const gchar  *prop_name = key;
-  const GValue *prop_value = value;
-  SmProp     ***pp = data;
+  XfsmProperty *prop;
+  guint         n;
 
-  if (G_VALUE_HOLDS (prop_value, G_TYPE_STRV))
-    **pp++ = strv_to_property (prop_name, g_value_get_boxed (prop_value));
-  else if (G_VALUE_HOLDS_STRING (prop_value))
-    **pp++ = str_to_property (prop_name, g_value_get_string (prop_value));
-  else if (G_VALUE_HOLDS_UCHAR (prop_value))
-    **pp++ = int_to_property (prop_name, g_value_get_uchar (prop_value));
-  else {
-    g_warning ("Unhandled property \"%s\" with type \"%s\"", prop_name,
-               g_type_name (G_VALUE_TYPE (prop_value)));
-  }
+  g_return_if_fail (properties != NULL);
+  g_return_if_fail (func != NULL);
 
-  return FALSE;
+  for (n = 0; n < XFSM_PROPERTIES_N_SLOTS; ++n)
+    {
+      prop = properties->slots[n];
+      if (prop != NULL
+          && func ((gpointer) g_quark_to_string (prop->name), &prop->value, user_data))
+        return;
+    }
+
+  for (n = 0; n < properties->n_props; ++n)
+    {
+      prop = properties->props[n];
+      if (func ((gpointer) g_quark_to_string (prop->name), &prop->value, user_data))
+        return;
+    }
 }
 
-void
-xfsm_properties_extract (XfsmProperties *properties,
-                         gint           *num_props,
-                         SmProp       ***props)
+
+/* the properties in the form SmsReturnProperties() wants them, owned
+ * by @properties and valid until the next change. only rebuilt after a
+ * change, so polling GetProperties does not allocate. */
+SmProp **
+xfsm_properties_get_sm_props (XfsmProperties *properties,
+                              gint           *num_props)
 {
-  SmProp **pp;
+  XfsmPropertiesWire wire = { NULL, };
+  gchar             *block;
+
+  g_return_val_if_fail (properties != NULL, NULL);
+  g_return_val_if_fail (num_props != NULL, NULL);
+
+  if (properties->sm_props == NULL)
+    {
+      xfsm_properties_foreach (properties,
+                               xfsm_properties_wire_count,
+                               &wire);
+
+      /* every value might be a CARD8 */
+      block = g_malloc (wire.n_props * (sizeof (SmProp *) + sizeof (SmProp))
+                        + wire.n_vals * (sizeof (SmPropValue) + 1));
+
+      properties->sm_props = (SmProp **) block;
+      properties->n_sm_props = wire.n_props;
 
-  g_return_if_fail (num_props != NULL);
-  g_return_if_fail (props != NULL);
+      wire.pp = properties->sm_props;
+      wire.prop = (SmProp *) (wire.pp + wire.n_props);
+      wire.val = (SmPropValue *) (wire.prop + wire.n_props);
+      wire.card8 = (guchar *) (wire.val + wire.n_vals);
 
-  *props = pp = (SmProp **) malloc (sizeof (SmProp *) * g_tree_nnodes (properties->sm_properties));
+      xfsm_properties_foreach (properties,
+                               xfsm_properties_wire_fill,
+                               &wire);
+    }
 
-  g_tree_foreach (properties->sm_properties,
-                  xfsm_properties_extract_foreach,
-                  &pp);
+  *num_props = properties->n_sm_props;
 
-  *num_props = pp - *props;
+  return properties->sm_props;
 }
 
 
@@ -254,7 +520,6 @@ xfsm_properties_load (XfceRc      *rc,
   XfsmProperties *properties;
   const gchar    *client_id;
   const gchar    *hostname;
-  GValue         *value;
   const gchar    *value_str;
   gchar         **value_strv;
   gint            value_int;
@@ -286,13 +551,8 @@ xfsm_properties_load (XfceRc      *rc,
       value_strv = xfce_rc_read_list_entry (rc, ENTRY (strv_properties[i].name), NULL);
       if (value_strv)
         {
-          xfsm_verbose ("-> Set strv (%s)\n", strv_properties[i].xsmp_name);
-          /* don't use _set_strv() to avoid a realloc of the whole strv */
-          value = xfsm_g_value_new (G_TYPE_STRV);
-          g_value_take_boxed (value, value_strv);
-          g_tree_replace (properties->sm_properties,
-                          g_strdup (strv_properties[i].xsmp_name),
-                          value);
+          xfsm_properties_set_strv (properties, strv_properties[i].xsmp_name, value_strv);
+          g_strfreev (value_strv);
         }
     }
 
@@ -324,45 +584,49 @@ xfsm_properties_load (XfceRc      *rc,
 
 void
 xfsm_properties_store (XfsmProperties *properties,
-                       XfceRc         *rc,
+                       GKeyFile       *file,
+                       const gchar    *group,
                        const gchar    *prefix)
 {
 #define ENTRY(name) (compose(buffer, 256, prefix, (name)))
 
-  GValue *value;
-  gint    i;
-  gchar   buffer[256];
+  XfsmProperty *prop;
+  gchar        *value;
+  gint          i;
+  gchar         buffer[256];
 
-  xfce_rc_write_entry (rc, ENTRY ("ClientId"), properties->client_id);
-  xfce_rc_write_entry (rc, ENTRY ("Hostname"), properties->hostname);
+  g_key_file_set_string (file, group, ENTRY ("ClientId"), properties->client_id);
+  g_key_file_set_string (file, group, ENTRY ("Hostname"), properties->hostname);
 
   for (i = 0; strv_properties[i].name; ++i)
     {
-      value = g_tree_lookup (properties->sm_properties, strv_properties[i].xsmp_name);
-      if (value)
+      prop = xfsm_properties_lookup (properties, strv_properties[i].xsmp_name);
+      if (prop && G_VALUE_HOLDS (&prop->value, G_TYPE_STRV))
         {
-          xfce_rc_write_list_entry (rc, ENTRY (strv_properties[i].name),
-                                    g_value_get_boxed (value), NULL);
+          /* same list format as xfce_rc_read_list_entry() reads */
+          value = g_strjoinv (",", g_value_get_boxed (&prop->value));
+          g_key_file_set_string (file, group, ENTRY (strv_properties[i].name), value);
+          g_free (value);
         }
     }
 
   for (i = 0; str_properties[i].name; ++i)
     {
-      value = g_tree_lookup (properties->sm_properties, str_properties[i].xsmp_name);
-      if (value)
+      prop = xfsm_properties_lookup (properties, str_properties[i].xsmp_name);
+      if (prop && G_VALUE_HOLDS_STRING (&prop->value))
         {
-          xfce_rc_write_entry (rc, ENTRY (str_properties[i].name),
-                               g_value_get_string (value));
+          g_key_file_set_string (file, group, ENTRY (str_properties[i].name),
+                                 g_value_get_string (&prop->value));
         }
     }
 
   for (i = 0; uchar_properties[i].name; ++i)
     {
-      value = g_tree_lookup (properties->sm_properties, uchar_properties[i].xsmp_name);
-      if (value)
+      prop = xfsm_properties_lookup (properties, uchar_properties[i].xsmp_name);
+      if (prop && G_VALUE_HOLDS_UCHAR (&prop->value))
         {
-          xfce_rc_write_int_entry (rc, ENTRY (uchar_properties[i].name),
-                                   g_value_get_uchar (value));
+          g_key_file_set_integer (file, group, ENTRY (uchar_properties[i].name),
+                                  g_value_get_uchar (&prop->value));
         }
     }
 
@@ -370,22 +634,21 @@ xfsm_properties_store (XfsmProperties *properties,
 }
 
 
-gint
-xfsm_properties_compare (const XfsmProperties *a,
-                         const XfsmProperties *b)
+static inline guchar
+xfsm_properties_get_priority (const XfsmProperties *properties)
 {
-  GValue *va, *vb;
-  gint ia = 50, ib = 50;
+  const XfsmProperty *prop = properties->slots[XFSM_PROPERTIES_SLOT_PRIORITY];
 
-  va = g_tree_lookup (a->sm_properties, GsmPriority);
-  if (va)
-    ia = g_value_get_uchar (va);
+  return prop != NULL && G_VALUE_HOLDS_UCHAR (&prop->value)
+    ? g_value_get_uchar (&prop->value) : 50;
+}
 
-  vb = g_tree_lookup (b->sm_properties, GsmPriority);
-  if (vb)
-    ib = g_value_get_uchar (vb);
 
-  return ia - ib;
+gint
+xfsm_properties_compare (const XfsmProperties *a,
+                         const XfsmProperties *b)
+{
+  return (gint) xfsm_properties_get_priority (a) - (gint) xfsm_properties_get_priority (b);
 }
 
 
@@ -404,8 +667,8 @@ xfsm_properties_check (const XfsmProperties *properties)
 
   return properties->client_id != NULL
     && properties->hostname != NULL
-    && g_tree_lookup (properties->sm_properties, SmProgram) != NULL
-    && g_tree_lookup (properties->sm_properties, SmRestartCommand) != NULL;
+    && properties->slots[XFSM_PROPERTIES_SLOT_PROGRAM] != NULL
+    && xfsm_properties_lookup (properties, SmRestartCommand) != NULL;
 }
 
 
@@ -413,15 +676,15 @@ const gchar *
 xfsm_properties_get_string (XfsmProperties *properties,
                             const gchar *property_name)
 {
-  GValue *value;
+  XfsmProperty *prop;
 
   g_return_val_if_fail (properties != NULL, NULL);
   g_return_val_if_fail (property_name != NULL, NULL);
 
-  value = g_tree_lookup (properties->sm_properties, property_name);
+  prop = xfsm_properties_lookup (properties, property_name);
 
-  if (G_LIKELY (value && G_VALUE_HOLDS_STRING (value)))
-    return g_value_get_string (value);
+  if (G_LIKELY (prop && G_VALUE_HOLDS_STRING (&prop->value)))
+    return g_value_get_string (&prop->value);
 
   return NULL;
 }
@@ -431,15 +694,15 @@ gchar **
 xfsm_properties_get_strv (XfsmProperties *properties,
                           const gchar *property_name)
 {
-  GValue *value;
+  XfsmProperty *prop;
 
   g_return_val_if_fail (properties != NULL, NULL);
   g_return_val_if_fail (property_name != NULL, NULL);
 
-  value = g_tree_lookup (properties->sm_properties, property_name);
+  prop = xfsm_properties_lookup (properties, property_name);
 
-  if (G_LIKELY (value && G_VALUE_HOLDS (value, G_TYPE_STRV)))
-    return g_value_get_boxed (value);
+  if (G_LIKELY (prop && G_VALUE_HOLDS (&prop->value, G_TYPE_STRV)))
+    return g_value_get_boxed (&prop->value);
 
   return NULL;
 }
@@ -450,169 +713,184 @@ xfsm_properties_get_uchar (XfsmProperties *properties,
                            const gchar *property_name,
                            guchar default_value)
 {
-  GValue *value;
+  XfsmProperty *prop;
 
   g_return_val_if_fail (properties != NULL, default_value);
   g_return_val_if_fail (property_name != NULL, default_value);
 
-  value = g_tree_lookup (properties->sm_properties, property_name);
+  prop = xfsm_properties_lookup (properties, property_name);
 
-  if (G_LIKELY (value && G_VALUE_HOLDS_UCHAR (value)))
-    return g_value_get_uchar (value);
+  if (G_LIKELY (prop && G_VALUE_HOLDS_UCHAR (&prop->value)))
+    return g_value_get_uchar (&prop->value);
 
   return default_value;
 }
 
 
+/* the value is owned by @properties and only valid until
+ * @property_name is set again or removed */
 const GValue *
 xfsm_properties_get (XfsmProperties *properties,
                      const gchar *property_name)
 {
+  XfsmProperty *prop;
+
   g_return_val_if_fail (properties != NULL, NULL);
   g_return_val_if_fail (property_name != NULL, NULL);
 
-  return g_tree_lookup (properties->sm_properties, property_name);
+  prop = xfsm_properties_lookup (properties, property_name);
+
+  return prop != NULL ? &prop->value : NULL;
 }
 
 
-void
+gboolean
 xfsm_properties_set_string (XfsmProperties *properties,
                             const gchar *property_name,
                             const gchar *property_value)
 {
-  GValue *value;
+  XfsmProperty *prop;
+  GValue        value = { 0, };
 
-  g_return_if_fail (properties != NULL);
-  g_return_if_fail (property_name != NULL);
-  g_return_if_fail (property_value != NULL);
+  g_return_val_if_fail (properties != NULL, FALSE);
+  g_return_val_if_fail (property_name != NULL, FALSE);
+  g_return_val_if_fail (property_value != NULL, FALSE);
+
+  prop = xfsm_properties_lookup (properties, property_name);
+  if (prop
+      && G_VALUE_HOLDS_STRING (&prop->value)
+      && g_strcmp0 (g_value_get_string (&prop->value), property_value) == 0)
+    return FALSE;
 
   xfsm_verbose ("-> Set string (%s, %s)\n", property_name, property_value);
 
-  value = g_tree_lookup (properties->sm_properties, property_name);
-  if (value)
-    {
-      if (!G_VALUE_HOLDS_STRING (value))
-        {
-          g_value_unset (value);
-          g_value_init (value, G_TYPE_STRING);
-        }
-      g_value_set_string (value, property_value);
-    }
-  else
-    {
-      value = xfsm_g_value_new (G_TYPE_STRING);
-      g_value_set_string (value, property_value);
-      g_tree_replace (properties->sm_properties,
-                      g_strdup (property_name),
-                      value);
-    }
+  g_value_init (&value, G_TYPE_STRING);
+  g_value_set_static_string (&value, property_value);
+  xfsm_properties_set_value (properties, property_name, &value);
+  g_value_unset (&value);
+
+  return TRUE;
 }
 
 
-void
+gboolean
 xfsm_properties_set_strv (XfsmProperties *properties,
                           const gchar *property_name,
                           gchar **property_value)
 {
-  GValue *value;
+  XfsmProperty *prop;
+  GValue        value = { 0, };
 
-  g_return_if_fail (properties != NULL);
-  g_return_if_fail (property_name != NULL);
-  g_return_if_fail (property_value != NULL);
+  g_return_val_if_fail (properties != NULL, FALSE);
+  g_return_val_if_fail (property_name != NULL, FALSE);
+  g_return_val_if_fail (property_value != NULL, FALSE);
+
+  prop = xfsm_properties_lookup (properties, property_name);
+  if (prop
+      && G_VALUE_HOLDS (&prop->value, G_TYPE_STRV)
+      && strv_equal (g_value_get_boxed (&prop->value), property_value))
+    return FALSE;
 
   xfsm_verbose ("-> Set strv (%s)\n", property_name);
 
-  value = g_tree_lookup (properties->sm_properties, property_name);
-  if (value)
-    {
-      if (!G_VALUE_HOLDS (value, G_TYPE_STRV))
-        {
-          g_value_unset (value);
-          g_value_init (value, G_TYPE_STRV);
-        }
-      g_value_set_boxed (value, property_value);
-    }
-  else
-    {
-      value = xfsm_g_value_new (G_TYPE_STRV);
-      g_value_set_boxed (value, property_value);
-      g_tree_replace (properties->sm_properties,
-                      g_strdup (property_name),
-                      value);
-    }
+  g_value_init (&value, G_TYPE_STRV);
+  g_value_set_static_boxed (&value, property_value);
+  xfsm_properties_set_value (properties, property_name, &value);
+  g_value_unset (&value);
+
+  return TRUE;
 }
 
-void
+
+gboolean
 xfsm_properties_set_uchar (XfsmProperties *properties,
                            const gchar *property_name,
                            guchar property_value)
 {
-  GValue *value;
+  XfsmProperty *prop;
+  GValue        value = { 0, };
 
-  g_return_if_fail (properties != NULL);
-  g_return_if_fail (property_name != NULL);
+  g_return_val_if_fail (properties != NULL, FALSE);
+  g_return_val_if_fail (property_name != NULL, FALSE);
+
+  prop = xfsm_properties_lookup (properties, property_name);
+  if (prop
+      && G_VALUE_HOLDS_UCHAR (&prop->value)
+      && g_value_get_uchar (&prop->value) == property_value)
+    return FALSE;
 
   xfsm_verbose ("-> Set uchar (%s, %d)\n", property_name, property_value);
 
-  value = g_tree_lookup (properties->sm_properties, property_name);
-  if (value)
-    {
-      if (!G_VALUE_HOLDS_UCHAR (value))
-        {
-          g_value_unset (value);
-          g_value_init (value, G_TYPE_UCHAR);
-        }
-      g_value_set_uchar (value, property_value);
-    }
-  else
-    {
-      value = xfsm_g_value_new (G_TYPE_UCHAR);
-      g_value_set_uchar (value, property_value);
-      g_tree_replace (properties->sm_properties,
-                      g_strdup (property_name),
-                      value);
-    }
+  g_value_init (&value, G_TYPE_UCHAR);
+  g_value_set_uchar (&value, property_value);
+  xfsm_properties_set_value (properties, property_name, &value);
+
+  return TRUE;
 }
 
 
+/* returns TRUE if the property was changed, FALSE if it already had
+ * that value or the value can't be stored */
 gboolean
 xfsm_properties_set (XfsmProperties *properties,
                      const gchar *property_name,
                      const GValue *property_value)
 {
-  GValue *new_value;
+  XfsmProperty *prop;
 
   g_return_val_if_fail (properties != NULL, FALSE);
   g_return_val_if_fail (property_name != NULL, FALSE);
   g_return_val_if_fail (property_value != NULL, FALSE);
 
-  if (!G_VALUE_HOLDS (property_value, G_TYPE_STRV)
-      && !G_VALUE_HOLDS_STRING (property_value)
-      && !G_VALUE_HOLDS_UCHAR (property_value))
+  if (G_VALUE_HOLDS (property_value, G_TYPE_STRV)
+      && g_value_get_boxed (property_value) != NULL)
+    {
+      return xfsm_properties_set_strv (properties, property_name,
+                                       g_value_get_boxed (property_value));
+    }
+  else if (G_VALUE_HOLDS_STRING (property_value)
+           && g_value_get_string (property_value) != NULL)
+    {
+      return xfsm_properties_set_string (properties, property_name,
+                                         g_value_get_string (property_value));
+    }
+  else if (G_VALUE_HOLDS_UCHAR (property_value))
+    {
+      return xfsm_properties_set_uchar (properties, property_name,
+                                        g_value_get_uchar (property_value));
+    }
+  else if (!G_VALUE_HOLDS (property_value, G_TYPE_STRV)
+           && !G_VALUE_HOLDS_STRING (property_value))
     {
       g_warning ("Unhandled property \"%s\" of type \"%s\"", property_name,
                  g_type_name (G_VALUE_TYPE (property_value)));
       return FALSE;
     }
 
-  xfsm_verbose ("-> Set (%s)\n", property_name);
+  /* a NULL string or string vector */
+  prop = xfsm_properties_lookup (properties, property_name);
+  if (prop
+      && G_VALUE_TYPE (&prop->value) == G_VALUE_TYPE (property_value)
+      && g_value_peek_pointer (&prop->value) == NULL)
+    return FALSE;
 
-  new_value = xfsm_g_value_new (G_VALUE_TYPE (property_value));
-  g_value_copy (property_value, new_value);
+  xfsm_verbose ("-> Set (%s)\n", property_name);
 
-  g_tree_replace (properties->sm_properties, g_strdup (property_name), new_value);
+  xfsm_properties_set_value (properties, property_name, property_value);
 
   return TRUE;
 }
 
+
+/* same as xfsm_properties_set() */
 gboolean
 xfsm_properties_set_from_smprop (XfsmProperties *properties,
                                  const SmProp *sm_prop)
 {
-  GValue *value;
-  gchar **value_strv;
-  guchar  value_uchar;
-  gint    n;
+  gchar  **value_strv;
+  guchar   value_uchar;
+  gboolean changed;
+  gint     n;
 
   g_return_val_if_fail (properties != NULL, FALSE);
   g_return_val_if_fail (sm_prop != NULL, FALSE);
@@ -622,43 +900,27 @@ xfsm_properties_set_from_smprop (XfsmProperties *properties,
       if (G_UNLIKELY (!sm_prop->num_vals || !sm_prop->vals))
         return FALSE;
 
-      value_strv = g_new0 (gchar *, sm_prop->num_vals + 1);
+      /* only the pointers, the strings are copied along with the property */
+      value_strv = g_new (gchar *, sm_prop->num_vals + 1);
       for (n = 0; n < sm_prop->num_vals; ++n)
-        value_strv[n] = g_strdup ((const gchar *) sm_prop->vals[n].value);
+        value_strv[n] = (gchar *) sm_prop->vals[n].value;
+      value_strv[n] = NULL;
 
-      xfsm_verbose ("-> Set strv (%s)\n", sm_prop->name);
+      changed = xfsm_properties_set_strv (properties, sm_prop->name, value_strv);
 
-      /* don't use _set_strv() to avoid a realloc of the whole strv */
-      value = g_tree_lookup (properties->sm_properties, sm_prop->name);
-      if (value)
-        {
-          if (!G_VALUE_HOLDS (value, G_TYPE_STRV))
-            {
-              g_value_unset (value);
-              g_value_init (value, G_TYPE_STRV);
-            }
-          g_value_take_boxed (value, value_strv);
-        }
-      else
-        {
-          value = xfsm_g_value_new (G_TYPE_STRV);
-          g_value_take_boxed (value, value_strv);
-          g_tree_replace (properties->sm_properties,
-                          g_strdup (sm_prop->name),
-                          value);
-        }
+      g_free (value_strv);
     }
   else if (!strcmp (sm_prop->type, SmARRAY8))
     {
       if (G_UNLIKELY (!sm_prop->vals[0].value))
         return FALSE;
 
-      xfsm_properties_set_string (properties, sm_prop->name, sm_prop->vals[0].value);
+      changed = xfsm_properties_set_string (properties, sm_prop->name, sm_prop->vals[0].value);
     }
   else if (!strcmp (sm_prop->type, SmCARD8))
     {
       value_uchar = *(guchar *)(sm_prop->vals[0].value);
-      xfsm_properties_set_uchar (properties, sm_prop->name, value_uchar);
+      changed = xfsm_properties_set_uchar (properties, sm_prop->name, value_uchar);
     }
   else
     {
@@ -666,7 +928,7 @@ xfsm_properties_set_from_smprop (XfsmProperties *properties,
       return FALSE;
     }
 
-  return TRUE;
+  return changed;
 }
 
 
@@ -674,12 +936,42 @@ gboolean
 xfsm_properties_remove (XfsmProperties *properties,
                         const gchar *property_name)
 {
+  XfsmProperty **location;
+  XfsmProperty  *prop;
+  GQuark         name;
+  guint          n;
+
   g_return_val_if_fail (properties != NULL, FALSE);
   g_return_val_if_fail (property_name != NULL, FALSE);
 
   xfsm_verbose ("-> Removing (%s)\n", property_name);
 
-  return g_tree_remove (properties->sm_properties, property_name);
+  name = g_quark_try_string (property_name);
+  if (name == 0)
+    return FALSE;
+
+  location = xfsm_properties_locate (properties, name, NULL);
+  if (location == NULL || *location == NULL)
+    return FALSE;
+
+  prop = *location;
+
+  if (location >= properties->props && location < properties->props + properties->n_props)
+    {
+      /* slots stay, just empty */
+      n = location - properties->props;
+      memmove (location, location + 1, (properties->n_props - n - 1) * sizeof (XfsmProperty *));
+      properties->n_props--;
+    }
+  else
+    {
+      *location = NULL;
+    }
+
+  xfsm_properties_changed (properties, name);
+  xfsm_property_free (prop);
+
+  return TRUE;
 }
 
 
@@ -706,6 +998,8 @@ xfsm_properties_set_default_child_watch (XfsmProperties *properties)
 void
 xfsm_properties_free (XfsmProperties *properties)
 {
+  guint n;
+
   g_return_if_fail (properties != NULL);
 
   xfsm_properties_set_default_child_watch (properties);
@@ -720,7 +1014,17 @@ xfsm_properties_free (XfsmProperties *properties)
   if (properties->hostname != NULL)
     g_free (properties->hostname);
 
-  g_tree_destroy (properties->sm_properties);
+  g_strfreev (properties->startup_after);
+  g_free (properties->journal_key);
+
+  for (n = 0; n < XFSM_PROPERTIES_N_SLOTS; ++n)
+    if (properties->slots[n] != NULL)
+      xfsm_property_free (properties->slots[n]);
+  for (n = 0; n < properties->n_props; ++n)
+    xfsm_property_free (properties->props[n]);
+  g_free (properties->props);
+
+  g_free (properties->sm_props);
 
   g_slice_free (XfsmProperties, properties);
 }
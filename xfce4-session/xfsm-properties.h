@@ -22,6 +22,8 @@
 #ifndef __XFSM_PROPERTIES_H__
 #define __XFSM_PROPERTIES_H__
 
+#include <glib-object.h>
+
 #include <X11/SM/SMlib.h>
 
 #include <libxfce4util/libxfce4util.h>
@@ -30,10 +32,29 @@
 #define GsmPriority     "_GSM_Priority"
 #define GsmDesktopFile  "_GSM_DesktopFile"
 
+/* startup ordering: list of client ids or program names that have to
+ * register before this client is started */
+#define XfsmAfter       "_XFSM_After"
+
 #define MAX_RESTART_ATTEMPTS 5
 
+/* properties with a fixed slot in XfsmProperties */
+enum
+{
+  XFSM_PROPERTIES_SLOT_PROGRAM,
+  XFSM_PROPERTIES_SLOT_RESTART_STYLE_HINT,
+  XFSM_PROPERTIES_SLOT_PRIORITY,
+  XFSM_PROPERTIES_N_SLOTS
+};
+
 typedef struct _XfsmProperties XfsmProperties;
 
+typedef struct
+{
+  GQuark name;   /* interned property name */
+  GValue value;  /* strings are allocated along with the property */
+} XfsmProperty;
+
 struct _XfsmProperties
 {
   guint   restart_attempts;
@@ -41,13 +62,48 @@ struct _XfsmProperties
 
   guint   startup_timeout_id;
 
+  /* what the startup scheduler derived from SmProgram and
+   * _GSM_DesktopFile, see xfsm-startup.c. dropped whenever one of
+   * those properties changes. the names are interned strings. */
+  const gchar  *startup_program;  /* basename of SmProgram */
+  const gchar  *startup_desktop;  /* desktop file id */
+  gchar       **startup_after;    /* X-XFCE-After of the desktop file */
+
   GPid    pid;
   guint   child_watch_id;
 
+  /* monotonic time the client was launched, see xfsm-latency.c */
+  gint64  spawn_time;
+
+  /* a legacy application restarted from its WM_COMMAND. it never
+   * registers, its window is waited for instead, see xfsm-legacy.c */
+  gboolean legacy;
+
+  /* an XDG autostart item started by the scheduler along with the
+   * session clients. it is never stored in the session. */
+  const struct _XfsmAutostartItem *autostart;
+
   gchar  *client_id;
   gchar  *hostname;
 
-  GTree  *sm_properties;
+  /* the XSMP properties. the names are shared by all clients, every
+   * property is one allocation with its value and is replaced as a
+   * whole when it changes, the others are not moved. */
+  XfsmProperty  *slots[XFSM_PROPERTIES_N_SLOTS]; /* NULL if unset */
+  XfsmProperty **props; /* sorted by name quark */
+  guint          n_props;
+  guint          props_size;
+
+  /* the properties ready for GetProperties, see
+   * xfsm_properties_get_sm_props(). one block that points into the
+   * properties, dropped whenever any of them changes. */
+  SmProp **sm_props;
+  gint     n_sm_props;
+
+  /* set whenever a property changes, cleared once the client was
+   * written to the session file or journal (see xfsm-journal.c) */
+  gboolean dirty;
+  gchar   *journal_key;
 };
 
 
@@ -58,17 +114,25 @@ XfsmProperties *xfsm_properties_new (const gchar *client_id,
                                      const gchar *hostname) G_GNUC_PURE;
 void            xfsm_properties_free    (XfsmProperties *properties);
 
-void            xfsm_properties_extract (XfsmProperties *properties,
-                                         gint           *num_props,
-                                         SmProp       ***props);
+void            xfsm_properties_foreach (XfsmProperties *properties,
+                                         GTraverseFunc   func,
+                                         gpointer        user_data);
+
+/* the block is owned by @properties and valid until any property of
+ * the client is set or removed, don't keep it across a change */
+SmProp        **xfsm_properties_get_sm_props (XfsmProperties *properties,
+                                              gint           *num_props);
 void            xfsm_properties_store   (XfsmProperties *properties,
-                                         XfceRc         *rc,
+                                         GKeyFile       *file,
+                                         const gchar    *group,
                                          const gchar    *prefix);
 
 XfsmProperties* xfsm_properties_load (XfceRc *rc, const gchar *prefix);
 
 gboolean xfsm_properties_check (const XfsmProperties *properties) G_GNUC_CONST;
 
+/* the values are owned by @properties and valid until the same
+ * property is set again or removed */
 const gchar *xfsm_properties_get_string (XfsmProperties *properties,
                                                   const gchar *property_name);
 gchar **xfsm_properties_get_strv (XfsmProperties *properties,
@@ -80,15 +144,16 @@ guchar xfsm_properties_get_uchar (XfsmProperties *properties,
 const GValue *xfsm_properties_get (XfsmProperties *properties,
                                    const gchar *property_name);
 
-void xfsm_properties_set_string (XfsmProperties *properties,
-                                 const gchar *property_name,
-                                 const gchar *property_value);
-void xfsm_properties_set_strv (XfsmProperties *properties,
-                               const gchar *property_name,
-                               gchar **property_value);
-void xfsm_properties_set_uchar (XfsmProperties *properties,
-                                const gchar *property_name,
-                                guchar property_value);
+/* the setters return TRUE only if the value actually changed */
+gboolean xfsm_properties_set_string (XfsmProperties *properties,
+                                     const gchar *property_name,
+                                     const gchar *property_value);
+gboolean xfsm_properties_set_strv (XfsmProperties *properties,
+                                   const gchar *property_name,
+                                   gchar **property_value);
+gboolean xfsm_properties_set_uchar (XfsmProperties *properties,
+                                    const gchar *property_name,
+                                    guchar property_value);
 
 gboolean xfsm_properties_set (XfsmProperties *properties,
                               const gchar *property_name,
@@ -0,0 +1,410 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Keeps track of the clients taking part in a SaveYourself. The
+ * coordinator follows the state changes of every registered client, so
+ * the manager can tell whether clients are still saving or waiting for
+ * phase 2 without walking the client list on every reply.
+ *
+ * It also records how long each program takes to save, as a histogram
+ * keyed by SmProgram. Time spent waiting for phase 2 or for the user to
+ * interact is not counted.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <dbus/dbus-glib.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-latency.h>
+#include <xfce4-session/xfsm-save-coordinator.h>
+
+
+/* upper bounds of the histogram buckets in milliseconds, the last
+ * bucket takes everything above */
+static const guint bucket_bounds[] =
+{
+  10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000, 60000,
+};
+
+#define N_BUCKETS (G_N_ELEMENTS (bucket_bounds) + 1)
+
+
+typedef struct
+{
+  guint  count;
+  guint  buckets[N_BUCKETS];
+  gint64 total;
+  gint64 max;
+} XfsmSaveHistogram;
+
+typedef struct
+{
+  gint64 started;
+  gint64 elapsed;
+} XfsmSaveTiming;
+
+struct _XfsmSaveCoordinator
+{
+  /* clients in SAVING, WAITFORINTERACT or INTERACTING state */
+  guint       n_saving;
+
+  /* clients in WAITFORPHASE2 state, in the order they asked for it */
+  GQueue     *phase2_clients;
+
+  /* XfsmClient -> XfsmSaveTiming of the current save */
+  GHashTable *timings;
+
+  /* SmProgram -> XfsmSaveHistogram */
+  GHashTable *histograms;
+};
+
+
+static inline gboolean
+xfsm_save_coordinator_state_is_saving (XfsmClientState state)
+{
+  return state == XFSM_CLIENT_SAVING
+      || state == XFSM_CLIENT_WAITFORINTERACT
+      || state == XFSM_CLIENT_INTERACTING;
+}
+
+
+static inline gboolean
+xfsm_save_coordinator_state_is_running (XfsmClientState state)
+{
+  return state == XFSM_CLIENT_SAVING
+      || state == XFSM_CLIENT_SAVINGLOCAL;
+}
+
+
+static void
+xfsm_save_coordinator_record (XfsmSaveCoordinator *coordinator,
+                              XfsmClient          *client,
+                              gint64               latency)
+{
+  XfsmSaveHistogram *histogram;
+  XfsmProperties    *properties;
+  const gchar       *program;
+  gint64             msec = latency / 1000;
+  guint              n;
+
+  properties = xfsm_client_get_properties (client);
+  if (properties == NULL)
+    return;
+
+  program = xfsm_properties_get_string (properties, SmProgram);
+  if (program == NULL)
+    return;
+
+  histogram = g_hash_table_lookup (coordinator->histograms, program);
+  if (histogram == NULL)
+    {
+      histogram = g_new0 (XfsmSaveHistogram, 1);
+      g_hash_table_insert (coordinator->histograms, g_strdup (program), histogram);
+    }
+
+  for (n = 0; n < G_N_ELEMENTS (bucket_bounds); ++n)
+    if (msec <= bucket_bounds[n])
+      break;
+
+  histogram->buckets[n]++;
+  histogram->count++;
+  histogram->total += latency;
+  histogram->max = MAX (histogram->max, latency);
+
+  xfsm_latency_record (program, XFSM_LATENCY_SAVE, latency);
+
+  xfsm_verbose ("Client Id = %s (%s) saved in %" G_GINT64_FORMAT " ms\n",
+                xfsm_client_get_id (client), program, msec);
+}
+
+
+static void
+xfsm_save_coordinator_state_changed (XfsmClient          *client,
+                                     XfsmClientState      old_state,
+                                     XfsmClientState      new_state,
+                                     XfsmSaveCoordinator *coordinator)
+{
+  XfsmSaveTiming *timing;
+  gint64          now;
+
+  if (xfsm_save_coordinator_state_is_saving (old_state))
+    coordinator->n_saving--;
+  if (xfsm_save_coordinator_state_is_saving (new_state))
+    coordinator->n_saving++;
+
+  if (old_state == XFSM_CLIENT_WAITFORPHASE2)
+    g_queue_remove (coordinator->phase2_clients, client);
+  if (new_state == XFSM_CLIENT_WAITFORPHASE2)
+    g_queue_push_tail (coordinator->phase2_clients, client);
+
+  /* save latency */
+  now = g_get_monotonic_time ();
+  timing = g_hash_table_lookup (coordinator->timings, client);
+
+  if (timing != NULL && timing->started != 0)
+    {
+      timing->elapsed += now - timing->started;
+      timing->started = 0;
+    }
+
+  if (xfsm_save_coordinator_state_is_running (new_state))
+    {
+      if (timing == NULL)
+        {
+          timing = g_slice_new0 (XfsmSaveTiming);
+          g_hash_table_insert (coordinator->timings, client, timing);
+        }
+      timing->started = now;
+    }
+  else if (timing != NULL
+           && (new_state == XFSM_CLIENT_SAVEDONE
+               || new_state == XFSM_CLIENT_IDLE
+               || new_state == XFSM_CLIENT_DISCONNECTED))
+    {
+      if (new_state != XFSM_CLIENT_DISCONNECTED)
+        xfsm_save_coordinator_record (coordinator, client, timing->elapsed);
+      g_hash_table_remove (coordinator->timings, client);
+    }
+}
+
+
+static void
+xfsm_save_coordinator_timing_free (gpointer data)
+{
+  g_slice_free (XfsmSaveTiming, data);
+}
+
+
+XfsmSaveCoordinator *
+xfsm_save_coordinator_new (void)
+{
+  XfsmSaveCoordinator *coordinator;
+
+  coordinator = g_new0 (XfsmSaveCoordinator, 1);
+  coordinator->phase2_clients = g_queue_new ();
+  coordinator->timings = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+                                                NULL, xfsm_save_coordinator_timing_free);
+  coordinator->histograms = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                   g_free, g_free);
+
+  return coordinator;
+}
+
+
+/* all clients have to be removed before */
+void
+xfsm_save_coordinator_free (XfsmSaveCoordinator *coordinator)
+{
+  g_queue_free (coordinator->phase2_clients);
+  g_hash_table_destroy (coordinator->timings);
+  g_hash_table_destroy (coordinator->histograms);
+  g_free (coordinator);
+}
+
+
+/* starts following the state of @client, which must not be saving yet */
+void
+xfsm_save_coordinator_add_client (XfsmSaveCoordinator *coordinator,
+                                  XfsmClient          *client)
+{
+  g_signal_connect (client, "state-changed",
+                    G_CALLBACK (xfsm_save_coordinator_state_changed),
+                    coordinator);
+}
+
+
+void
+xfsm_save_coordinator_remove_client (XfsmSaveCoordinator *coordinator,
+                                     XfsmClient          *client)
+{
+  XfsmClientState state = xfsm_client_get_state (client);
+
+  g_signal_handlers_disconnect_by_func (client,
+                                        xfsm_save_coordinator_state_changed,
+                                        coordinator);
+
+  if (xfsm_save_coordinator_state_is_saving (state))
+    coordinator->n_saving--;
+  else if (state == XFSM_CLIENT_WAITFORPHASE2)
+    g_queue_remove (coordinator->phase2_clients, client);
+
+  g_hash_table_remove (coordinator->timings, client);
+}
+
+
+gboolean
+xfsm_save_coordinator_is_saving (XfsmSaveCoordinator *coordinator)
+{
+  return coordinator->n_saving > 0;
+}
+
+
+/* the returned list has to be freed with g_list_free(), the clients
+ * leave it when their state changes */
+GList *
+xfsm_save_coordinator_get_phase2_clients (XfsmSaveCoordinator *coordinator)
+{
+  return g_list_copy (g_queue_peek_head_link (coordinator->phase2_clients));
+}
+
+
+/* mean time in microseconds @program took to save, -1 if unknown */
+gint64
+xfsm_save_coordinator_get_mean_latency (XfsmSaveCoordinator *coordinator,
+                                        const gchar         *program)
+{
+  XfsmSaveHistogram *histogram;
+
+  if (program == NULL)
+    return -1;
+
+  histogram = g_hash_table_lookup (coordinator->histograms, program);
+  if (histogram == NULL || histogram->count == 0)
+    return -1;
+
+  return histogram->total / histogram->count;
+}
+
+
+static gint
+xfsm_save_coordinator_compare (gconstpointer a,
+                               gconstpointer b,
+                               gpointer      user_data)
+{
+  XfsmSaveCoordinator *coordinator = user_data;
+  XfsmProperties      *properties;
+  gint64               latency_a;
+  gint64               latency_b;
+
+  properties = xfsm_client_get_properties (XFSM_CLIENT (a));
+  latency_a = properties != NULL
+              ? xfsm_save_coordinator_get_mean_latency (coordinator,
+                                                        xfsm_properties_get_string (properties, SmProgram))
+              : -1;
+
+  properties = xfsm_client_get_properties (XFSM_CLIENT (b));
+  latency_b = properties != NULL
+              ? xfsm_save_coordinator_get_mean_latency (coordinator,
+                                                        xfsm_properties_get_string (properties, SmProgram))
+              : -1;
+
+  if (latency_a > latency_b)
+    return -1;
+  else if (latency_a < latency_b)
+    return 1;
+
+  return 0;
+}
+
+
+/* sorts @clients so the ones that took longest to save before come
+ * first and get the most time to complete */
+GList *
+xfsm_save_coordinator_sort_clients (XfsmSaveCoordinator *coordinator,
+                                    GList               *clients)
+{
+  if (g_hash_table_size (coordinator->histograms) == 0)
+    return clients;
+
+  return g_list_sort_with_data (clients, xfsm_save_coordinator_compare,
+                                coordinator);
+}
+
+
+GArray *
+xfsm_save_coordinator_get_bounds (void)
+{
+  GArray *bounds;
+
+  bounds = g_array_sized_new (FALSE, FALSE, sizeof (guint), G_N_ELEMENTS (bucket_bounds));
+  g_array_append_vals (bounds, bucket_bounds, G_N_ELEMENTS (bucket_bounds));
+
+  return bounds;
+}
+
+
+static GValue *
+xfsm_save_coordinator_value_new (GType type)
+{
+  GValue *value = g_new0 (GValue, 1);
+  g_value_init (value, type);
+  return value;
+}
+
+
+static void
+xfsm_save_coordinator_value_free (gpointer data)
+{
+  g_value_unset (data);
+  g_free (data);
+}
+
+
+/* one a{sv} per program, see GetSaveLatencies in xfsm-manager-dbus.xml */
+GPtrArray *
+xfsm_save_coordinator_get_histograms (XfsmSaveCoordinator *coordinator)
+{
+  XfsmSaveHistogram *histogram;
+  GHashTableIter     iter;
+  GHashTable        *dict;
+  GPtrArray         *histograms;
+  GArray            *buckets;
+  GValue            *value;
+  gpointer           program;
+
+  histograms = g_ptr_array_sized_new (g_hash_table_size (coordinator->histograms));
+
+  g_hash_table_iter_init (&iter, coordinator->histograms);
+  while (g_hash_table_iter_next (&iter, &program, (gpointer) &histogram))
+    {
+      dict = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+                                    xfsm_save_coordinator_value_free);
+
+      value = xfsm_save_coordinator_value_new (G_TYPE_STRING);
+      g_value_set_string (value, program);
+      g_hash_table_insert (dict, "program", value);
+
+      value = xfsm_save_coordinator_value_new (G_TYPE_UINT);
+      g_value_set_uint (value, histogram->count);
+      g_hash_table_insert (dict, "count", value);
+
+      value = xfsm_save_coordinator_value_new (G_TYPE_UINT64);
+      g_value_set_uint64 (value, histogram->total / MAX (histogram->count, 1));
+      g_hash_table_insert (dict, "mean", value);
+
+      value = xfsm_save_coordinator_value_new (G_TYPE_UINT64);
+      g_value_set_uint64 (value, histogram->max);
+      g_hash_table_insert (dict, "max", value);
+
+      buckets = g_array_sized_new (FALSE, FALSE, sizeof (guint), N_BUCKETS);
+      g_array_append_vals (buckets, histogram->buckets, N_BUCKETS);
+      value = xfsm_save_coordinator_value_new (DBUS_TYPE_G_UINT_ARRAY);
+      g_value_take_boxed (value, buckets);
+      g_hash_table_insert (dict, "buckets", value);
+
+      g_ptr_array_add (histograms, dict);
+    }
+
+  return histograms;
+}
@@ -0,0 +1,54 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_SAVE_COORDINATOR_H__
+#define __XFSM_SAVE_COORDINATOR_H__
+
+#include <glib.h>
+
+#include <xfce4-session/xfsm-client.h>
+
+G_BEGIN_DECLS;
+
+typedef struct _XfsmSaveCoordinator XfsmSaveCoordinator;
+
+XfsmSaveCoordinator *xfsm_save_coordinator_new               (void);
+void                 xfsm_save_coordinator_free              (XfsmSaveCoordinator *coordinator);
+
+void                 xfsm_save_coordinator_add_client        (XfsmSaveCoordinator *coordinator,
+                                                              XfsmClient          *client);
+void                 xfsm_save_coordinator_remove_client     (XfsmSaveCoordinator *coordinator,
+                                                              XfsmClient          *client);
+
+gboolean             xfsm_save_coordinator_is_saving         (XfsmSaveCoordinator *coordinator);
+GList               *xfsm_save_coordinator_get_phase2_clients (XfsmSaveCoordinator *coordinator);
+
+GList               *xfsm_save_coordinator_sort_clients      (XfsmSaveCoordinator *coordinator,
+                                                              GList               *clients);
+
+gint64               xfsm_save_coordinator_get_mean_latency  (XfsmSaveCoordinator *coordinator,
+                                                              const gchar         *program);
+
+GArray              *xfsm_save_coordinator_get_bounds        (void);
+GPtrArray           *xfsm_save_coordinator_get_histograms    (XfsmSaveCoordinator *coordinator);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_SAVE_COORDINATOR_H__ */
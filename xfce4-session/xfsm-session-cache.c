@@ -0,0 +1,766 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Compiled form of the session file. Whenever the session is stored, the
+ * XfceRc file is compiled into a flat binary image next to it
+ * (<session file>.cache), which is mapped read-only on the next login
+ * instead of parsing the INI file again.
+ *
+ * Layout (native byte order, all offsets are absolute file offsets):
+ *
+ *   CacheHeader
+ *   per session: strv value tables, property tables, client tables,
+ *                legacy tables and the active workspace table
+ *   CacheSession table
+ *   string table (NUL terminated, deduplicated)
+ *
+ * The header records mtime (with nanoseconds, where the system has them)
+ * and size of the session file it was compiled from, the cache is ignored
+ * as soon as the session file changed. The session file is stored several
+ * times per second during a checkpoint, so seconds are not enough.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <glib/gstdio.h>
+
+#include <libxfce4util/libxfce4util.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-legacy.h>
+#include <xfce4-session/xfsm-properties.h>
+#include <xfce4-session/xfsm-session-cache.h>
+
+#define CACHE_MAGIC    0x43534658 /* "XFSC" */
+#define CACHE_VERSION  2
+#define CACHE_NONE     G_MAXUINT32
+
+
+typedef struct
+{
+  guint32 magic;
+  guint32 version;
+  guint32 file_size;
+  guint32 rc_size;
+  guint64 rc_mtime;
+  guint32 rc_mtime_nsec;
+  guint32 n_sessions;
+  guint32 sessions;
+  guint32 strings;
+  guint32 strings_size;
+} CacheHeader;
+
+typedef struct
+{
+  guint32 name;
+  guint32 n_clients;
+  guint32 clients;
+  guint32 n_legacy;
+  guint32 legacy;
+  guint32 n_workspaces;
+  guint32 workspaces;
+} CacheSession;
+
+typedef struct
+{
+  guint32 client_id;
+  guint32 hostname;
+  guint32 n_props;
+  guint32 props;
+} CacheClient;
+
+typedef enum
+{
+  CACHE_PROP_STRING,
+  CACHE_PROP_STRV,
+  CACHE_PROP_UCHAR,
+} CachePropType;
+
+typedef struct
+{
+  guint32 name;
+  guint32 type;
+  guint32 n_values;
+  guint32 value;    /* string, offset of the strv table or the uchar */
+} CacheProp;
+
+typedef struct
+{
+  guint32 screen_num;
+  guint32 n_args;
+  guint32 args;
+} CacheLegacy;
+
+
+struct _XfsmSessionCache
+{
+  GMappedFile        *file;
+  const gchar        *data;
+  gsize               size;
+  const CacheHeader  *header;
+  const CacheSession *sessions;
+  const gchar        *strings;
+};
+
+
+typedef struct
+{
+  GByteArray *data;
+  GString    *strings;
+  GHashTable *string_offsets;
+} CacheWriter;
+
+
+
+static guint32
+xfsm_session_cache_write_string (CacheWriter *writer,
+                                 const gchar *str)
+{
+  gpointer offset;
+
+  if (str == NULL)
+    return CACHE_NONE;
+
+  if (!g_hash_table_lookup_extended (writer->string_offsets, str, NULL, &offset))
+    {
+      offset = GUINT_TO_POINTER (writer->strings->len);
+      g_string_append_len (writer->strings, str, strlen (str) + 1);
+      g_hash_table_insert (writer->string_offsets, g_strdup (str), offset);
+    }
+
+  return GPOINTER_TO_UINT (offset);
+}
+
+
+static guint32
+xfsm_session_cache_write_data (CacheWriter  *writer,
+                               gconstpointer data,
+                               gsize         size)
+{
+  guint32 offset = writer->data->len;
+
+  g_byte_array_append (writer->data, data, size);
+
+  return offset;
+}
+
+
+static guint32
+xfsm_session_cache_write_strv (CacheWriter  *writer,
+                               gchar       **strv,
+                               guint32      *n_values)
+{
+  GArray *refs;
+  guint32 ref;
+  guint32 offset;
+
+  refs = g_array_new (FALSE, FALSE, sizeof (guint32));
+  for (; strv != NULL && *strv != NULL; ++strv)
+    {
+      ref = xfsm_session_cache_write_string (writer, *strv);
+      g_array_append_val (refs, ref);
+    }
+
+  *n_values = refs->len;
+  offset = xfsm_session_cache_write_data (writer, refs->data,
+                                          refs->len * sizeof (guint32));
+  g_array_free (refs, TRUE);
+
+  return offset;
+}
+
+
+typedef struct
+{
+  CacheWriter *writer;
+  GArray      *props;
+} CompileClientData;
+
+
+static gboolean
+xfsm_session_cache_compile_property (gpointer key,
+                                     gpointer value,
+                                     gpointer user_data)
+{
+  CompileClientData *data = user_data;
+  const GValue      *prop_value = value;
+  CacheProp          prop;
+
+  prop.name = xfsm_session_cache_write_string (data->writer, key);
+  prop.n_values = 1;
+
+  if (G_VALUE_HOLDS (prop_value, G_TYPE_STRV))
+    {
+      prop.type = CACHE_PROP_STRV;
+      prop.value = xfsm_session_cache_write_strv (data->writer,
+                                                  g_value_get_boxed (prop_value),
+                                                  &prop.n_values);
+    }
+  else if (G_VALUE_HOLDS_STRING (prop_value))
+    {
+      prop.type = CACHE_PROP_STRING;
+      prop.value = xfsm_session_cache_write_string (data->writer,
+                                                    g_value_get_string (prop_value));
+    }
+  else if (G_VALUE_HOLDS_UCHAR (prop_value))
+    {
+      prop.type = CACHE_PROP_UCHAR;
+      prop.value = g_value_get_uchar (prop_value);
+    }
+  else
+    return FALSE;
+
+  g_array_append_val (data->props, prop);
+
+  return FALSE;
+}
+
+
+static void
+xfsm_session_cache_compile_session (CacheWriter  *writer,
+                                    XfceRc       *rc,
+                                    const gchar  *name,
+                                    CacheSession *session)
+{
+  CompileClientData data;
+  XfsmProperties   *properties;
+  CacheClient       client;
+  CacheLegacy       legacy;
+  GArray           *clients;
+  GArray           *legacies;
+  GArray           *workspaces;
+  gchar           **command;
+  gchar             buffer[256];
+  gint32            workspace;
+  gint              count;
+  gint              n;
+
+  session->name = xfsm_session_cache_write_string (writer, name);
+
+  /* same order as xfsm_manager_load_session() reads them */
+  clients = g_array_new (FALSE, FALSE, sizeof (CacheClient));
+  count = xfce_rc_read_int_entry (rc, "Count", 0);
+  while (count-- > 0)
+    {
+      g_snprintf (buffer, sizeof (buffer), "Client%d_", count);
+      properties = xfsm_properties_load (rc, buffer);
+      if (G_UNLIKELY (properties == NULL))
+        continue;
+
+      data.writer = writer;
+      data.props = g_array_new (FALSE, FALSE, sizeof (CacheProp));
+      xfsm_properties_foreach (properties,
+                               xfsm_session_cache_compile_property,
+                               &data);
+
+      client.client_id = xfsm_session_cache_write_string (writer, properties->client_id);
+      client.hostname = xfsm_session_cache_write_string (writer, properties->hostname);
+      client.n_props = data.props->len;
+      client.props = xfsm_session_cache_write_data (writer, data.props->data,
+                                                    data.props->len * sizeof (CacheProp));
+      g_array_append_val (clients, client);
+
+      g_array_free (data.props, TRUE);
+      xfsm_properties_free (properties);
+    }
+
+  legacies = g_array_new (FALSE, FALSE, sizeof (CacheLegacy));
+  count = xfce_rc_read_int_entry (rc, "LegacyCount", 0);
+  for (n = 0; n < count; ++n)
+    {
+      g_snprintf (buffer, sizeof (buffer), "Legacy%d_Command", n);
+      command = xfce_rc_read_list_entry (rc, buffer, NULL);
+      if (command == NULL)
+        continue;
+
+      g_snprintf (buffer, sizeof (buffer), "Legacy%d_Screen", n);
+      legacy.screen_num = xfce_rc_read_int_entry (rc, buffer, 0);
+      legacy.args = xfsm_session_cache_write_strv (writer, command, &legacy.n_args);
+      g_array_append_val (legacies, legacy);
+
+      g_strfreev (command);
+    }
+
+  workspaces = g_array_new (FALSE, FALSE, sizeof (gint32));
+  for (n = 0;; ++n)
+    {
+      g_snprintf (buffer, sizeof (buffer), "Screen%d_ActiveWorkspace", n);
+      if (!xfce_rc_has_entry (rc, buffer))
+        break;
+
+      workspace = xfce_rc_read_int_entry (rc, buffer, 0);
+      g_array_append_val (workspaces, workspace);
+    }
+
+  session->n_clients = clients->len;
+  session->clients = xfsm_session_cache_write_data (writer, clients->data,
+                                                    clients->len * sizeof (CacheClient));
+  session->n_legacy = legacies->len;
+  session->legacy = xfsm_session_cache_write_data (writer, legacies->data,
+                                                   legacies->len * sizeof (CacheLegacy));
+  session->n_workspaces = workspaces->len;
+  session->workspaces = xfsm_session_cache_write_data (writer, workspaces->data,
+                                                       workspaces->len * sizeof (gint32));
+
+  g_array_free (clients, TRUE);
+  g_array_free (legacies, TRUE);
+  g_array_free (workspaces, TRUE);
+}
+
+
+static guint32
+xfsm_session_cache_mtime_nsec (const GStatBuf *sb)
+{
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+  return sb->st_mtim.tv_nsec;
+#else
+  return 0;
+#endif
+}
+
+
+static gchar *
+xfsm_session_cache_filename (const gchar *session_file)
+{
+  return g_strconcat (session_file, ".cache", NULL);
+}
+
+
+void
+xfsm_session_cache_compile (const gchar *session_file)
+{
+  CacheWriter  writer;
+  CacheHeader  header;
+  CacheSession session;
+  GStatBuf     sb;
+  GArray      *sessions;
+  GError      *error = NULL;
+  XfceRc      *rc;
+  gchar      **groups;
+  gchar       *cache_file;
+  gint         n;
+
+  g_return_if_fail (session_file != NULL);
+
+  if (g_stat (session_file, &sb) != 0)
+    return;
+
+  rc = xfce_rc_simple_open (session_file, TRUE);
+  if (G_UNLIKELY (rc == NULL))
+    return;
+
+  writer.data = g_byte_array_new ();
+  writer.strings = g_string_new (NULL);
+  writer.string_offsets = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+  /* reserve room for the header, filled in at the end */
+  memset (&header, 0, sizeof (header));
+  xfsm_session_cache_write_data (&writer, &header, sizeof (header));
+
+  sessions = g_array_new (FALSE, FALSE, sizeof (CacheSession));
+  groups = xfce_rc_get_groups (rc);
+  for (n = 0; groups[n] != NULL; ++n)
+    {
+      if (strncmp (groups[n], "Session: ", 9) != 0)
+        continue;
+
+      xfce_rc_set_group (rc, groups[n]);
+      xfsm_session_cache_compile_session (&writer, rc, groups[n] + 9, &session);
+      g_array_append_val (sessions, session);
+    }
+  g_strfreev (groups);
+  xfce_rc_close (rc);
+
+  header.magic = CACHE_MAGIC;
+  header.version = CACHE_VERSION;
+  header.rc_size = sb.st_size;
+  header.rc_mtime = sb.st_mtime;
+  header.rc_mtime_nsec = xfsm_session_cache_mtime_nsec (&sb);
+  header.n_sessions = sessions->len;
+  header.sessions = xfsm_session_cache_write_data (&writer, sessions->data,
+                                                   sessions->len * sizeof (CacheSession));
+  header.strings = writer.data->len;
+  header.strings_size = writer.strings->len;
+  xfsm_session_cache_write_data (&writer, writer.strings->str, writer.strings->len);
+  header.file_size = writer.data->len;
+  memcpy (writer.data->data, &header, sizeof (header));
+
+  cache_file = xfsm_session_cache_filename (session_file);
+  if (!g_file_set_contents (cache_file, (const gchar *) writer.data->data,
+                            writer.data->len, &error))
+    {
+      g_warning ("Unable to write session cache %s: %s", cache_file, error->message);
+      g_error_free (error);
+    }
+  else
+    {
+      xfsm_verbose ("Compiled %u session(s) into %s (%u bytes)\n",
+                    header.n_sessions, cache_file, header.file_size);
+    }
+  g_free (cache_file);
+
+  g_array_free (sessions, TRUE);
+  g_hash_table_destroy (writer.string_offsets);
+  g_string_free (writer.strings, TRUE);
+  g_byte_array_free (writer.data, TRUE);
+}
+
+
+
+static gboolean
+xfsm_session_cache_range_valid (XfsmSessionCache *cache,
+                                guint32           offset,
+                                guint32           n_elements,
+                                gsize             element_size)
+{
+  return offset % sizeof (guint32) == 0
+    && offset <= cache->size
+    && n_elements <= (cache->size - offset) / element_size;
+}
+
+
+static const gchar *
+xfsm_session_cache_string (XfsmSessionCache *cache,
+                           guint32           ref)
+{
+  /* the string table is NUL terminated, see xfsm_session_cache_open() */
+  if (ref == CACHE_NONE || ref >= cache->header->strings_size)
+    return NULL;
+
+  return cache->strings + ref;
+}
+
+
+static gboolean
+xfsm_session_cache_strv_valid (XfsmSessionCache *cache,
+                               guint32           offset,
+                               guint32           n_values)
+{
+  const guint32 *refs;
+  guint32        n;
+
+  if (!xfsm_session_cache_range_valid (cache, offset, n_values, sizeof (guint32)))
+    return FALSE;
+
+  refs = (const guint32 *) (cache->data + offset);
+  for (n = 0; n < n_values; ++n)
+    if (xfsm_session_cache_string (cache, refs[n]) == NULL)
+      return FALSE;
+
+  return TRUE;
+}
+
+
+static gchar **
+xfsm_session_cache_strv (XfsmSessionCache *cache,
+                         guint32           offset,
+                         guint32           n_values)
+{
+  const guint32 *refs = (const guint32 *) (cache->data + offset);
+  gchar        **strv;
+  guint32        n;
+
+  strv = g_new (gchar *, n_values + 1);
+  for (n = 0; n < n_values; ++n)
+    strv[n] = g_strdup (cache->strings + refs[n]);
+  strv[n] = NULL;
+
+  return strv;
+}
+
+
+static gboolean
+xfsm_session_cache_session_valid (XfsmSessionCache   *cache,
+                                  const CacheSession *session)
+{
+  const CacheClient *clients;
+  const CacheLegacy *legacy;
+  const CacheProp   *props;
+  guint32            n, m;
+
+  if (!xfsm_session_cache_range_valid (cache, session->clients, session->n_clients, sizeof (CacheClient))
+      || !xfsm_session_cache_range_valid (cache, session->legacy, session->n_legacy, sizeof (CacheLegacy))
+      || !xfsm_session_cache_range_valid (cache, session->workspaces, session->n_workspaces, sizeof (gint32)))
+    return FALSE;
+
+  clients = (const CacheClient *) (cache->data + session->clients);
+  for (n = 0; n < session->n_clients; ++n)
+    {
+      if (xfsm_session_cache_string (cache, clients[n].client_id) == NULL
+          || xfsm_session_cache_string (cache, clients[n].hostname) == NULL
+          || !xfsm_session_cache_range_valid (cache, clients[n].props, clients[n].n_props, sizeof (CacheProp)))
+        return FALSE;
+
+      props = (const CacheProp *) (cache->data + clients[n].props);
+      for (m = 0; m < clients[n].n_props; ++m)
+        {
+          if (xfsm_session_cache_string (cache, props[m].name) == NULL)
+            return FALSE;
+
+          switch (props[m].type)
+            {
+            case CACHE_PROP_STRING:
+              if (xfsm_session_cache_string (cache, props[m].value) == NULL)
+                return FALSE;
+              break;
+
+            case CACHE_PROP_STRV:
+              if (!xfsm_session_cache_strv_valid (cache, props[m].value, props[m].n_values))
+                return FALSE;
+              break;
+
+            case CACHE_PROP_UCHAR:
+              break;
+
+            default:
+              return FALSE;
+            }
+        }
+    }
+
+  legacy = (const CacheLegacy *) (cache->data + session->legacy);
+  for (n = 0; n < session->n_legacy; ++n)
+    if (!xfsm_session_cache_strv_valid (cache, legacy[n].args, legacy[n].n_args))
+      return FALSE;
+
+  return TRUE;
+}
+
+
+XfsmSessionCache *
+xfsm_session_cache_open (const gchar *session_file)
+{
+  XfsmSessionCache  *cache;
+  const CacheHeader *header;
+  GMappedFile       *file;
+  GStatBuf           sb;
+  gchar             *cache_file;
+  gsize              size;
+
+  g_return_val_if_fail (session_file != NULL, NULL);
+
+  if (g_stat (session_file, &sb) != 0)
+    return NULL;
+
+  cache_file = xfsm_session_cache_filename (session_file);
+  file = g_mapped_file_new (cache_file, FALSE, NULL);
+  if (file == NULL)
+    {
+      xfsm_verbose ("No session cache %s\n", cache_file);
+      g_free (cache_file);
+      return NULL;
+    }
+
+  size = g_mapped_file_get_length (file);
+  header = (const CacheHeader *) g_mapped_file_get_contents (file);
+
+  if (size < sizeof (CacheHeader)
+      || header->magic != CACHE_MAGIC
+      || header->version != CACHE_VERSION
+      || header->file_size != size)
+    {
+      xfsm_verbose ("Ignoring invalid session cache %s\n", cache_file);
+      goto invalid;
+    }
+
+  /* the session file was modified after the cache was compiled */
+  if (header->rc_mtime != (guint64) sb.st_mtime
+      || header->rc_mtime_nsec != xfsm_session_cache_mtime_nsec (&sb)
+      || header->rc_size != (guint32) sb.st_size)
+    {
+      xfsm_verbose ("Ignoring stale session cache %s\n", cache_file);
+      goto invalid;
+    }
+
+  if (header->strings_size == 0
+      || header->strings > size
+      || header->strings_size > size - header->strings
+      || ((const gchar *) header)[header->strings + header->strings_size - 1] != '\0')
+    {
+      xfsm_verbose ("Ignoring invalid session cache %s\n", cache_file);
+      goto invalid;
+    }
+
+  cache = g_slice_new0 (XfsmSessionCache);
+  cache->file = file;
+  cache->data = (const gchar *) header;
+  cache->size = size;
+  cache->header = header;
+  cache->strings = cache->data + header->strings;
+
+  if (!xfsm_session_cache_range_valid (cache, header->sessions, header->n_sessions, sizeof (CacheSession)))
+    {
+      xfsm_verbose ("Ignoring invalid session cache %s\n", cache_file);
+      g_slice_free (XfsmSessionCache, cache);
+      goto invalid;
+    }
+
+  cache->sessions = (const CacheSession *) (cache->data + header->sessions);
+
+  g_free (cache_file);
+
+  return cache;
+
+invalid:
+  g_mapped_file_unref (file);
+  g_free (cache_file);
+  return NULL;
+}
+
+
+void
+xfsm_session_cache_close (XfsmSessionCache *cache)
+{
+  if (cache == NULL)
+    return;
+
+  g_mapped_file_unref (cache->file);
+  g_slice_free (XfsmSessionCache, cache);
+}
+
+
+static const CacheSession *
+xfsm_session_cache_lookup (XfsmSessionCache *cache,
+                           const gchar      *session_name)
+{
+  const gchar *name;
+  guint32      n;
+
+  for (n = 0; n < cache->header->n_sessions; ++n)
+    {
+      name = xfsm_session_cache_string (cache, cache->sessions[n].name);
+      if (name != NULL && strcmp (name, session_name) == 0)
+        return cache->sessions + n;
+    }
+
+  return NULL;
+}
+
+
+/* appends the clients of @session_name to @properties and queues its
+ * legacy applications. returns FALSE if the session isn't in the cache,
+ * the caller has to load it from the session file then. */
+gboolean
+xfsm_session_cache_load (XfsmSessionCache *cache,
+                         const gchar      *session_name,
+                         GQueue           *properties)
+{
+  const CacheSession *session;
+  const CacheClient  *clients;
+  const CacheLegacy  *legacy;
+  const CacheProp    *props;
+  XfsmProperties     *client;
+  const gchar        *name;
+  gchar             **strv;
+  guint32             n, m;
+
+  g_return_val_if_fail (cache != NULL, FALSE);
+  g_return_val_if_fail (session_name != NULL, FALSE);
+  g_return_val_if_fail (properties != NULL, FALSE);
+
+  session = xfsm_session_cache_lookup (cache, session_name);
+  if (session == NULL || !xfsm_session_cache_session_valid (cache, session))
+    return FALSE;
+
+  /* nothing else is restored for an empty session either */
+  if (session->n_clients == 0)
+    return TRUE;
+
+  clients = (const CacheClient *) (cache->data + session->clients);
+  for (n = 0; n < session->n_clients; ++n)
+    {
+      client = xfsm_properties_new (cache->strings + clients[n].client_id,
+                                    cache->strings + clients[n].hostname);
+
+      xfsm_verbose ("Loading cached properties for client %s\n", client->client_id);
+
+      props = (const CacheProp *) (cache->data + clients[n].props);
+      for (m = 0; m < clients[n].n_props; ++m)
+        {
+          name = cache->strings + props[m].name;
+
+          switch (props[m].type)
+            {
+            case CACHE_PROP_STRING:
+              xfsm_properties_set_string (client, name, cache->strings + props[m].value);
+              break;
+
+            case CACHE_PROP_STRV:
+              strv = xfsm_session_cache_strv (cache, props[m].value, props[m].n_values);
+              xfsm_properties_set_strv (client, name, strv);
+              g_strfreev (strv);
+              break;
+
+            case CACHE_PROP_UCHAR:
+              xfsm_properties_set_uchar (client, name, props[m].value);
+              break;
+            }
+        }
+
+      if (xfsm_properties_check (client))
+        g_queue_push_tail (properties, client);
+      else
+        xfsm_properties_free (client);
+    }
+
+  legacy = (const CacheLegacy *) (cache->data + session->legacy);
+  for (n = 0; n < session->n_legacy; ++n)
+    {
+      xfsm_legacy_add_restart_app (legacy[n].screen_num,
+                                   xfsm_session_cache_strv (cache, legacy[n].args,
+                                                            legacy[n].n_args),
+                                   NULL, properties);
+    }
+
+  return TRUE;
+}
+
+
+/* returns -1 if nothing was stored for @screen_num */
+gint
+xfsm_session_cache_get_active_workspace (XfsmSessionCache *cache,
+                                         const gchar      *session_name,
+                                         gint              screen_num)
+{
+  const CacheSession *session;
+  const gint32       *workspaces;
+
+  g_return_val_if_fail (cache != NULL, -1);
+  g_return_val_if_fail (session_name != NULL, -1);
+
+  session = xfsm_session_cache_lookup (cache, session_name);
+  if (session == NULL
+      || screen_num < 0
+      || (guint32) screen_num >= session->n_workspaces
+      || !xfsm_session_cache_range_valid (cache, session->workspaces,
+                                          session->n_workspaces, sizeof (gint32)))
+    return -1;
+
+  workspaces = (const gint32 *) (cache->data + session->workspaces);
+
+  return workspaces[screen_num];
+}
@@ -0,0 +1,45 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_SESSION_CACHE_H__
+#define __XFSM_SESSION_CACHE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+typedef struct _XfsmSessionCache XfsmSessionCache;
+
+XfsmSessionCache *xfsm_session_cache_open     (const gchar      *session_file);
+void              xfsm_session_cache_close    (XfsmSessionCache *cache);
+
+gboolean          xfsm_session_cache_load     (XfsmSessionCache *cache,
+                                               const gchar      *session_name,
+                                               GQueue           *properties);
+
+gint              xfsm_session_cache_get_active_workspace (XfsmSessionCache *cache,
+                                                           const gchar      *session_name,
+                                                           gint              screen_num);
+
+void              xfsm_session_cache_compile  (const gchar      *session_file);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_SESSION_CACHE_H__ */
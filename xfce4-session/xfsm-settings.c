@@ -0,0 +1,255 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * The xfce4-session settings as read by the manager. Normally these
+ * come from the xfce4-session xfconf channel; in headless mode they
+ * come from a GKeyFile instead so the manager runs without xfconfd.
+ *
+ * A property "/a/b/c" maps to key "c" in group "[/a/b]" of the key
+ * file, e.g.:
+ *
+ *   [/general]
+ *   FailsafeSessionName=Failsafe
+ *
+ *   [/sessions/Failsafe]
+ *   IsFailsafe=true
+ *   Count=1
+ *   Client0_Command=sleep;3600;
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <xfconf/xfconf.h>
+
+#include <libxfsm/xfsm-util.h>
+
+#include <xfce4-session/xfsm-settings.h>
+
+
+struct _XfsmSettings
+{
+  XfconfChannel *channel;
+  GKeyFile      *keyfile;
+};
+
+
+static XfsmSettings *default_settings = NULL;
+
+
+XfsmSettings *
+xfsm_settings_get (void)
+{
+  if (G_UNLIKELY (default_settings == NULL))
+    {
+      default_settings = g_new0 (XfsmSettings, 1);
+      default_settings->channel = xfsm_open_config ();
+    }
+
+  return default_settings;
+}
+
+
+/*
+ * Makes the settings returned by xfsm_settings_get() come from
+ * @filename, or an empty in-memory store if @filename is %NULL.
+ * Must be called before the first xfsm_settings_get().
+ */
+gboolean
+xfsm_settings_use_keyfile (const gchar  *filename,
+                           GError      **error)
+{
+  GKeyFile *keyfile;
+
+  g_return_val_if_fail (default_settings == NULL, FALSE);
+
+  keyfile = g_key_file_new ();
+  if (filename != NULL
+      && !g_key_file_load_from_file (keyfile, filename, G_KEY_FILE_NONE, error))
+    {
+      g_key_file_free (keyfile);
+      return FALSE;
+    }
+
+  default_settings = g_new0 (XfsmSettings, 1);
+  default_settings->keyfile = keyfile;
+
+  return TRUE;
+}
+
+
+/* splits @property into the key file group and key, returns the
+ * key and stores the newly allocated group in @group */
+static const gchar *
+xfsm_settings_split (const gchar  *property,
+                     gchar       **group)
+{
+  const gchar *key;
+
+  key = strrchr (property, '/');
+  if (G_UNLIKELY (key == NULL || key == property))
+    {
+      *group = g_strdup ("/");
+      return key != NULL ? key + 1 : property;
+    }
+
+  *group = g_strndup (property, key - property);
+  return key + 1;
+}
+
+
+gchar *
+xfsm_settings_get_string (XfsmSettings *settings,
+                          const gchar  *property,
+                          const gchar  *default_value)
+{
+  const gchar *key;
+  gchar       *group;
+  gchar       *value;
+
+  if (settings->channel != NULL)
+    return xfconf_channel_get_string (settings->channel, property, default_value);
+
+  key = xfsm_settings_split (property, &group);
+  value = g_key_file_get_string (settings->keyfile, group, key, NULL);
+  g_free (group);
+
+  return value != NULL ? value : g_strdup (default_value);
+}
+
+
+gint
+xfsm_settings_get_int (XfsmSettings *settings,
+                       const gchar  *property,
+                       gint          default_value)
+{
+  const gchar *key;
+  gchar       *group;
+  GError      *error = NULL;
+  gint         value;
+
+  if (settings->channel != NULL)
+    return xfconf_channel_get_int (settings->channel, property, default_value);
+
+  key = xfsm_settings_split (property, &group);
+  value = g_key_file_get_integer (settings->keyfile, group, key, &error);
+  g_free (group);
+
+  if (error != NULL)
+    {
+      g_error_free (error);
+      return default_value;
+    }
+
+  return value;
+}
+
+
+gboolean
+xfsm_settings_get_bool (XfsmSettings *settings,
+                        const gchar  *property,
+                        gboolean      default_value)
+{
+  const gchar *key;
+  gchar       *group;
+  GError      *error = NULL;
+  gboolean     value;
+
+  if (settings->channel != NULL)
+    return xfconf_channel_get_bool (settings->channel, property, default_value);
+
+  key = xfsm_settings_split (property, &group);
+  value = g_key_file_get_boolean (settings->keyfile, group, key, &error);
+  g_free (group);
+
+  if (error != NULL)
+    {
+      g_error_free (error);
+      return default_value;
+    }
+
+  return value;
+}
+
+
+gchar **
+xfsm_settings_get_string_list (XfsmSettings *settings,
+                               const gchar  *property)
+{
+  const gchar *key;
+  gchar       *group;
+  gchar      **value;
+
+  if (settings->channel != NULL)
+    return xfconf_channel_get_string_list (settings->channel, property);
+
+  key = xfsm_settings_split (property, &group);
+  value = g_key_file_get_string_list (settings->keyfile, group, key, NULL, NULL);
+  g_free (group);
+
+  return value;
+}
+
+
+void
+xfsm_settings_set_string (XfsmSettings *settings,
+                          const gchar  *property,
+                          const gchar  *value)
+{
+  const gchar *key;
+  gchar       *group;
+
+  if (settings->channel != NULL)
+    {
+      xfconf_channel_set_string (settings->channel, property, value);
+      return;
+    }
+
+  /* changes to the key file only live as long as the process */
+  key = xfsm_settings_split (property, &group);
+  g_key_file_set_string (settings->keyfile, group, key, value);
+  g_free (group);
+}
+
+
+void
+xfsm_settings_set_bool (XfsmSettings *settings,
+                        const gchar  *property,
+                        gboolean      value)
+{
+  const gchar *key;
+  gchar       *group;
+
+  if (settings->channel != NULL)
+    {
+      xfconf_channel_set_bool (settings->channel, property, value);
+      return;
+    }
+
+  key = xfsm_settings_split (property, &group);
+  g_key_file_set_boolean (settings->keyfile, group, key, value);
+  g_free (group);
+}
@@ -0,0 +1,56 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_SETTINGS_H__
+#define __XFSM_SETTINGS_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+typedef struct _XfsmSettings XfsmSettings;
+
+XfsmSettings *xfsm_settings_get             (void);
+
+gboolean      xfsm_settings_use_keyfile     (const gchar   *filename,
+                                             GError       **error);
+
+gchar        *xfsm_settings_get_string      (XfsmSettings  *settings,
+                                             const gchar   *property,
+                                             const gchar   *default_value);
+gint          xfsm_settings_get_int         (XfsmSettings  *settings,
+                                             const gchar   *property,
+                                             gint           default_value);
+gboolean      xfsm_settings_get_bool        (XfsmSettings  *settings,
+                                             const gchar   *property,
+                                             gboolean       default_value);
+gchar       **xfsm_settings_get_string_list (XfsmSettings  *settings,
+                                             const gchar   *property);
+
+void          xfsm_settings_set_string      (XfsmSettings  *settings,
+                                             const gchar   *property,
+                                             const gchar   *value);
+void          xfsm_settings_set_bool        (XfsmSettings  *settings,
+                                             const gchar   *property,
+                                             gboolean       value);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_SETTINGS_H__ */
@@ -68,6 +68,7 @@
 #endif
 
 #include <libxfsm/xfsm-util.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <xfce4-session/xfsm-shutdown-fallback.h>
 
 
@@ -206,11 +207,11 @@ xfsm_shutdown_fallback_check_auth (const gchar *action_id)
 static gboolean
 lock_screen (GError **error)
 {
-  XfconfChannel *channel;
+  XfsmSettings  *settings;
   gboolean       ret = TRUE;
 
-  channel = xfsm_open_config ();
-  if (xfconf_channel_get_bool (channel, "/shutdown/LockScreen", FALSE))
+  settings = xfsm_settings_get ();
+  if (xfsm_settings_get_bool (settings, "/shutdown/LockScreen", FALSE))
       ret = g_spawn_command_line_async ("xflock4", error);
 
   if (ret)
@@ -0,0 +1,437 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Spawning for the session startup. g_spawn_async() forks a full copy
+ * of the session manager (plus an intermediate child unless the caller
+ * reaps), which gets slow once the process is big and stalls the main
+ * loop while clients are already talking ICE to us. Here the child is
+ * created with vfork() and reports a failing chdir() or exec() through
+ * a close-on-exec pipe, so the parent only waits until the exec() is
+ * done. Children that are not reaped by the caller get a child watch.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include <libxfce4util/libxfce4util.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-spawn.h>
+
+
+extern gchar **environ;
+
+
+enum
+{
+  XFSM_SPAWN_STAGE_CHDIR,
+  XFSM_SPAWN_STAGE_DUP2,
+  XFSM_SPAWN_STAGE_EXEC,
+};
+
+/* written to the failure pipe by the child */
+typedef struct
+{
+  gint stage;
+  gint error;
+} XfsmSpawnFailure;
+
+
+
+static gboolean
+xfsm_spawn_pipe (gint     fds[2],
+                 GError **error)
+{
+  if (pipe (fds) < 0)
+    {
+      g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
+                   _("Failed to create pipe for communicating with child process (%s)"),
+                   g_strerror (errno));
+      return FALSE;
+    }
+
+  fcntl (fds[0], F_SETFD, FD_CLOEXEC);
+  fcntl (fds[1], F_SETFD, FD_CLOEXEC);
+
+  return TRUE;
+}
+
+
+
+static void
+xfsm_spawn_close_pipe (gint fds[2])
+{
+  if (fds[0] >= 0)
+    close (fds[0]);
+  if (fds[1] >= 0)
+    close (fds[1]);
+}
+
+
+
+static gint
+xfsm_spawn_exec_error (gint error)
+{
+  switch (error)
+    {
+    case EACCES:       return G_SPAWN_ERROR_ACCES;
+    case EPERM:        return G_SPAWN_ERROR_PERM;
+    case E2BIG:        return G_SPAWN_ERROR_2BIG;
+    case ENOEXEC:      return G_SPAWN_ERROR_NOEXEC;
+    case ENAMETOOLONG: return G_SPAWN_ERROR_NAMETOOLONG;
+    case ENOENT:       return G_SPAWN_ERROR_NOENT;
+    case ENOMEM:       return G_SPAWN_ERROR_NOMEM;
+    case ENOTDIR:      return G_SPAWN_ERROR_NOTDIR;
+    case ELOOP:        return G_SPAWN_ERROR_LOOP;
+    case ETXTBSY:      return G_SPAWN_ERROR_TXTBUSY;
+    case EIO:          return G_SPAWN_ERROR_IO;
+    case ENFILE:       return G_SPAWN_ERROR_NFILE;
+    case EMFILE:       return G_SPAWN_ERROR_MFILE;
+    case EINVAL:       return G_SPAWN_ERROR_INVAL;
+    case EISDIR:       return G_SPAWN_ERROR_ISDIR;
+    default:           return G_SPAWN_ERROR_FAILED;
+    }
+}
+
+
+
+/* everything below runs in the vfork()ed child and shares the memory
+ * of the session manager, so only async-signal-safe calls, no malloc
+ * and no return */
+static void
+xfsm_spawn_child_fail (gint failure_fd,
+                       gint stage)
+{
+  XfsmSpawnFailure failure;
+
+  failure.stage = stage;
+  failure.error = errno;
+
+  while (write (failure_fd, &failure, sizeof (failure)) < 0 && errno == EINTR)
+    ;
+
+  _exit (127);
+}
+
+
+
+static void
+xfsm_spawn_child_close_range (gint lower,
+                              gint upper)
+{
+  gint fd;
+
+  if (lower > upper)
+    return;
+
+#if defined (__linux__) && defined (SYS_close_range)
+  if (syscall (SYS_close_range, lower, upper, 0) == 0)
+    return;
+#endif
+
+  for (fd = lower; fd <= upper; ++fd)
+    close (fd);
+}
+
+
+
+static void
+xfsm_spawn_child (const gchar    *working_directory,
+                  const gchar    *program,
+                  gchar         **argv,
+                  gchar         **envp,
+                  gint            stdout_fd,
+                  gint            failure_fd,
+                  gint            max_fd,
+                  const sigset_t *old_mask)
+{
+  struct sigaction sa;
+  gint             sig;
+
+  /* our handlers must not run in here, reset them before unblocking */
+  for (sig = 1; sig < NSIG; ++sig)
+    {
+      if (sigaction (sig, NULL, &sa) == 0
+          && sa.sa_handler != SIG_IGN
+          && sa.sa_handler != SIG_DFL)
+        {
+          sa.sa_handler = SIG_DFL;
+          sa.sa_flags = 0;
+          sigemptyset (&sa.sa_mask);
+          sigaction (sig, &sa, NULL);
+        }
+    }
+  sigprocmask (SIG_SETMASK, old_mask, NULL);
+
+  if (working_directory != NULL && chdir (working_directory) < 0)
+    xfsm_spawn_child_fail (failure_fd, XFSM_SPAWN_STAGE_CHDIR);
+
+  if (stdout_fd >= 0)
+    {
+      if (stdout_fd == STDOUT_FILENO)
+        fcntl (stdout_fd, F_SETFD, 0);
+      else if (dup2 (stdout_fd, STDOUT_FILENO) < 0)
+        xfsm_spawn_child_fail (failure_fd, XFSM_SPAWN_STAGE_DUP2);
+    }
+
+  /* close everything but stdio and the failure pipe */
+  if (max_fd > 0)
+    {
+      xfsm_spawn_child_close_range (STDERR_FILENO + 1, failure_fd - 1);
+      xfsm_spawn_child_close_range (failure_fd + 1, max_fd);
+    }
+
+  execve (program, argv, envp);
+
+  xfsm_spawn_child_fail (failure_fd, XFSM_SPAWN_STAGE_EXEC);
+}
+
+
+
+gboolean
+xfsm_spawn_async (const gchar  *working_directory,
+                  gchar       **argv,
+                  gchar       **envp,
+                  GSpawnFlags   flags,
+                  GPid         *child_pid,
+                  gint         *standard_output,
+                  GError      **error)
+{
+  XfsmSpawnFailure failure;
+  sigset_t         all_signals;
+  sigset_t         old_mask;
+  gint             failure_pipe[2] = { -1, -1 };
+  gint             stdout_pipe[2] = { -1, -1 };
+  gint64           start_time;
+  gchar           *program;
+  gssize           n;
+  gint             max_fd = 0;
+  gint             saved_errno;
+  pid_t            pid;
+
+  g_return_val_if_fail (argv != NULL && argv[0] != NULL, FALSE);
+  g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+  start_time = g_get_monotonic_time ();
+
+  /* resolve the program here, the child cannot allocate */
+  if ((flags & G_SPAWN_SEARCH_PATH) != 0 && strchr (argv[0], '/') == NULL)
+    {
+      program = g_find_program_in_path (argv[0]);
+      if (G_UNLIKELY (program == NULL))
+        {
+          g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_NOENT,
+                       _("Failed to execute child process \"%s\" (%s)"),
+                       argv[0], g_strerror (ENOENT));
+          return FALSE;
+        }
+    }
+  else
+    {
+      program = g_strdup (argv[0]);
+    }
+
+  if (!xfsm_spawn_pipe (failure_pipe, error)
+      || (standard_output != NULL && !xfsm_spawn_pipe (stdout_pipe, error)))
+    {
+      xfsm_spawn_close_pipe (failure_pipe);
+      g_free (program);
+      return FALSE;
+    }
+
+  if ((flags & G_SPAWN_LEAVE_DESCRIPTORS_OPEN) == 0)
+    {
+      max_fd = sysconf (_SC_OPEN_MAX);
+      if (max_fd <= 0)
+        max_fd = 1024;
+    }
+
+  if (envp == NULL)
+    envp = environ;
+
+  /* no signal handler may run in the child while it shares our memory */
+  sigfillset (&all_signals);
+  sigprocmask (SIG_BLOCK, &all_signals, &old_mask);
+
+#ifdef HAVE_VFORK
+  pid = vfork ();
+#else
+  pid = fork ();
+#endif
+
+  if (pid == 0)
+    {
+      xfsm_spawn_child (working_directory, program, argv, envp,
+                        stdout_pipe[1], failure_pipe[1], max_fd,
+                        &old_mask);
+    }
+
+  saved_errno = errno;
+  sigprocmask (SIG_SETMASK, &old_mask, NULL);
+
+  g_free (program);
+
+  close (failure_pipe[1]);
+  if (stdout_pipe[1] >= 0)
+    close (stdout_pipe[1]);
+
+  if (G_UNLIKELY (pid < 0))
+    {
+      g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_FORK,
+                   _("Failed to fork (%s)"), g_strerror (saved_errno));
+      close (failure_pipe[0]);
+      if (stdout_pipe[0] >= 0)
+        close (stdout_pipe[0]);
+      return FALSE;
+    }
+
+  /* EOF as soon as the exec() succeeded and closed the write end */
+  do
+    n = read (failure_pipe[0], &failure, sizeof (failure));
+  while (n < 0 && errno == EINTR);
+  close (failure_pipe[0]);
+
+  if (G_UNLIKELY (n == sizeof (failure)))
+    {
+      /* the child already called _exit() */
+      while (waitpid (pid, NULL, 0) < 0 && errno == EINTR)
+        ;
+
+      if (stdout_pipe[0] >= 0)
+        close (stdout_pipe[0]);
+
+      switch (failure.stage)
+        {
+        case XFSM_SPAWN_STAGE_CHDIR:
+          g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_CHDIR,
+                       _("Failed to change to directory \"%s\" (%s)"),
+                       working_directory, g_strerror (failure.error));
+          break;
+
+        case XFSM_SPAWN_STAGE_DUP2:
+          g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
+                       _("Failed to redirect output or input of child process (%s)"),
+                       g_strerror (failure.error));
+          break;
+
+        default:
+          g_set_error (error, G_SPAWN_ERROR, xfsm_spawn_exec_error (failure.error),
+                       _("Failed to execute child process \"%s\" (%s)"),
+                       argv[0], g_strerror (failure.error));
+          break;
+        }
+
+      return FALSE;
+    }
+
+  if ((flags & G_SPAWN_DO_NOT_REAP_CHILD) == 0)
+    g_child_watch_add (pid, (GChildWatchFunc) g_spawn_close_pid, NULL);
+
+  if (child_pid != NULL)
+    *child_pid = pid;
+  if (standard_output != NULL)
+    *standard_output = stdout_pipe[0];
+
+  xfsm_verbose ("Spawned \"%s\" with PID %d, main loop blocked for %" G_GINT64_FORMAT " us\n",
+                argv[0], (gint) pid, g_get_monotonic_time () - start_time);
+
+  return TRUE;
+}
+
+
+
+gboolean
+xfsm_spawn_command_line_on_screen (GdkScreen    *screen,
+                                   const gchar  *command_line,
+                                   GError      **error)
+{
+  gchar   **argv;
+  gchar   **envp;
+  gchar    *display_name;
+  gchar    *display_env = NULL;
+  gboolean  result;
+  guint     n, m;
+
+  g_return_val_if_fail (command_line != NULL, FALSE);
+
+  if (!g_shell_parse_argv (command_line, NULL, &argv, error))
+    return FALSE;
+
+  if (screen == NULL)
+    screen = gdk_screen_get_default ();
+
+  /* our environment with DISPLAY pointing at @screen, the strings
+   * are shared with environ. without a display (headless mode) the
+   * inherited DISPLAY, if any, is passed on */
+  if (screen != NULL)
+    {
+      display_name = gdk_screen_make_display_name (screen);
+      display_env = g_strconcat ("DISPLAY=", display_name, NULL);
+      g_free (display_name);
+    }
+
+  envp = g_new (gchar *, g_strv_length (environ) + 2);
+  for (n = m = 0; environ[n] != NULL; ++n)
+    {
+      if ((display_env == NULL || !g_str_has_prefix (environ[n], "DISPLAY="))
+          && !g_str_has_prefix (environ[n], "DESKTOP_STARTUP_ID="))
+        envp[m++] = environ[n];
+    }
+
+  if (display_env != NULL)
+    envp[m++] = display_env;
+  envp[m] = NULL;
+
+  result = xfsm_spawn_async (NULL, argv, envp, G_SPAWN_SEARCH_PATH,
+                             NULL, NULL, error);
+
+  g_free (display_env);
+  g_free (envp);
+  g_strfreev (argv);
+
+  return result;
+}
@@ -0,0 +1,44 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_SPAWN_H__
+#define __XFSM_SPAWN_H__
+
+#include <gdk/gdk.h>
+
+G_BEGIN_DECLS;
+
+/* supported flags are G_SPAWN_DO_NOT_REAP_CHILD, G_SPAWN_SEARCH_PATH
+ * and G_SPAWN_LEAVE_DESCRIPTORS_OPEN */
+gboolean xfsm_spawn_async                  (const gchar  *working_directory,
+                                            gchar       **argv,
+                                            gchar       **envp,
+                                            GSpawnFlags   flags,
+                                            GPid         *child_pid,
+                                            gint         *standard_output,
+                                            GError      **error);
+
+gboolean xfsm_spawn_command_line_on_screen (GdkScreen    *screen,
+                                            const gchar  *command_line,
+                                            GError      **error);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_SPAWN_H__ */
@@ -27,6 +27,9 @@
 #ifdef HAVE_ERRNO_H
 #include <errno.h>
 #endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
 #ifdef HAVE_MEMORY_H
 #include <memory.h>
 #endif
@@ -58,24 +61,66 @@
 
 #include <libxfsm/xfsm-util.h>
 
+#include <xfce4-session/xfsm-autostart.h>
 #include <xfce4-session/xfsm-compat-gnome.h>
 #include <xfce4-session/xfsm-compat-kde.h>
 #include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-latency.h>
+#include <xfce4-session/xfsm-lazy-agent.h>
+#include <xfce4-session/xfsm-legacy.h>
 #include <xfce4-session/xfsm-manager.h>
+#include <xfce4-session/xfsm-spawn.h>
 #include <xfce4-session/xfsm-splash-screen.h>
+#include <xfce4-session/xfsm-trace.h>
+#include <xfce4-session/xfsm-wnck.h>
 
 #include <xfce4-session/xfsm-startup.h>
 
 
+/* seconds an agent may take to print its environment */
+#define AGENT_TIMEOUT 10
+
+
 typedef struct
 {
   XfsmManager    *manager;
   XfsmProperties *properties;
 } XfsmStartupData;
 
-static void     xfsm_startup_failsafe                (XfsmManager *manager);
+typedef void (*XfsmStartupAgentFunc) (gpointer user_data);
 
-static gboolean xfsm_startup_session_next_prio_group (XfsmManager *manager);
+typedef struct
+{
+  const gchar         *agent;
+  pid_t               *pid_return;
+  gint                 fd;
+  GString             *output;
+  guint                watch_id;
+  guint                timeout_id;
+  gint64               start_time;
+
+  /* called once the environment is set, NULL if the session waits
+   * for the agent */
+  XfsmStartupAgentFunc ready;
+  gpointer             ready_data;
+} XfsmStartupAgent;
+
+/* what the pending clients may wait for. updated by the manager as
+ * clients enter and leave the starting and pending queues, so neither
+ * checking a client nor a registration scans the queues. the names are
+ * interned strings */
+typedef struct
+{
+  GHashTable *names;           /* name -> number of clients known by it */
+  GHashTable *wanted;          /* name -> number of pending clients waiting for it */
+  guint       n_session;       /* session clients, i.e. no autostart items */
+  guint       priorities[256]; /* session clients per priority */
+  gint        min_priority;    /* lowest priority of those */
+} XfsmStartupIndex;
+
+static void     xfsm_startup_begin_session           (XfsmManager *manager);
+static void     xfsm_startup_failsafe                (XfsmManager *manager);
+static void     xfsm_startup_autostart_migrate       (void);
 
 static void     xfsm_startup_data_free               (XfsmStartupData *sdata);
 static void     xfsm_startup_child_watch             (GPid         pid,
@@ -85,12 +130,32 @@ static gboolean xfsm_startup_timeout                 (gpointer     data);
 
 static void     xfsm_startup_handle_failed_startup   (XfsmProperties *properties,
                                                       XfsmManager    *manager);
+static void     xfsm_startup_transient_window_opened (const XfsmWnckWindowInfo *info,
+                                                      gpointer                  user_data);
 
 
 static pid_t running_sshagent = -1;
 static pid_t running_gpgagent = -1;
 static gboolean gpgagent_ssh_enabled = FALSE;
 
+/* agents that did not report their environment yet */
+static guint        agents_pending = 0;
+static XfsmManager *agents_waiting_manager = NULL;
+
+/* ssh-agent started on the first connection to SSH_AUTH_SOCK */
+static gchar *lazy_sshagent_path = NULL;
+
+/* the manager waiting for the windows of restarted legacy applications
+ * and of the autostart items other clients wait for */
+static XfsmManager *transient_manager = NULL;
+
+/* whether the autostart items joined the pending clients yet */
+static gboolean autostart_queued = FALSE;
+static guint    autostart_started = 0;
+
+/* the starting and pending clients, see xfsm_startup_index_add() */
+static XfsmStartupIndex startup_index;
+
 
 
 static pid_t
@@ -127,75 +192,223 @@ xfsm_ssh_agent_pid (const gchar *ssh_agent_pid)
 
 
 static pid_t
-xfsm_startup_init_agent (const gchar *cmd,
-                         const gchar *agent)
+xfsm_startup_agent_parse (const gchar *output,
+                          const gchar *agent)
 {
-  gchar     *cmdoutput = NULL;
-  GError    *error = NULL;
   gchar    **lines;
   guint      i;
   gchar     *p, *t;
   gchar     *variable, *value;
   pid_t      pid = -1;
 
-  if (g_spawn_command_line_sync (cmd, &cmdoutput, NULL, NULL, &error))
+  lines = g_strsplit (output, "\n", -1);
+  g_assert (lines != NULL);
+  for (i = 0; lines[i] != NULL; i++)
     {
-      if (G_UNLIKELY (cmdoutput == NULL))
+      p = strchr (lines[i], '=');
+      if (G_UNLIKELY (p == NULL))
+        continue;
+      t = strchr (p + 1, ';');
+      if (G_UNLIKELY (t == NULL))
+        continue;
+
+      variable = g_strndup (lines[i], p - lines[i]);
+      value = g_strndup (p + 1, t - p - 1);
+
+      /* try to get agent pid from the variable */
+      if (pid <= 0)
         {
-          g_message ("%s returned no variables to stdout", agent);
-          return -1;
+          if (g_strcmp0 (variable, "SSH_AGENT_PID") == 0)
+            pid = xfsm_ssh_agent_pid (value);
+          else if (g_strcmp0 (variable, "GPG_AGENT_INFO") == 0)
+            pid = xfsm_gpg_agent_pid (value);
         }
 
-      lines = g_strsplit (cmdoutput, "\n", -1);
-      g_assert (lines != NULL);
-      for (i = 0; lines[i] != NULL; i++)
-        {
-          p = strchr (lines[i], '=');
-          if (G_UNLIKELY (p == NULL))
-            continue;
-          t = strchr (p + 1, ';');
-          if (G_UNLIKELY (t == NULL))
-            continue;
+      g_setenv (variable, value, TRUE);
 
-          variable = g_strndup (lines[i], p - lines[i]);
-          value = g_strndup (p + 1, t - p - 1);
+      g_free (variable);
+      g_free (value);
+    }
+  g_strfreev (lines);
 
-          /* try to get agent pid from the variable */
-          if (pid <= 0)
-            {
-              if (g_strcmp0 (variable, "SSH_AGENT_PID") == 0)
-                pid = xfsm_ssh_agent_pid (value);
-              else if (g_strcmp0 (variable, "GPG_AGENT_INFO") == 0)
-                pid = xfsm_gpg_agent_pid (value);
-            }
+  if (pid <= 0)
+    g_warning ("%s returned no PID in the variables", agent);
+
+  return pid;
+}
 
-          g_setenv (variable, value, TRUE);
 
-          g_free (variable);
-          g_free (value);
-        }
-      g_strfreev (lines);
-    }
+
+static void
+xfsm_startup_agent_finish (XfsmStartupAgent *sagent)
+{
+  if (sagent->watch_id != 0)
+    g_source_remove (sagent->watch_id);
+  if (sagent->timeout_id != 0)
+    g_source_remove (sagent->timeout_id);
+
+  close (sagent->fd);
+
+  if (G_UNLIKELY (sagent->output->len == 0))
+    g_message ("%s returned no variables to stdout", sagent->agent);
   else
+    *sagent->pid_return = xfsm_startup_agent_parse (sagent->output->str, sagent->agent);
+
+  xfsm_verbose ("%s environment set after %" G_GINT64_FORMAT " ms\n", sagent->agent,
+                (g_get_monotonic_time () - sagent->start_time) / 1000);
+
+  if (sagent->ready != NULL)
+    {
+      sagent->ready (sagent->ready_data);
+    }
+  else if (--agents_pending == 0 && agents_waiting_manager != NULL)
+    {
+      /* start the session if it was waiting for the agents */
+      XfsmManager *manager = agents_waiting_manager;
+
+      agents_waiting_manager = NULL;
+      xfsm_startup_begin_session (manager);
+      g_object_unref (manager);
+    }
+
+  g_string_free (sagent->output, TRUE);
+  g_slice_free (XfsmStartupAgent, sagent);
+}
+
+
+
+static gboolean
+xfsm_startup_agent_read (GIOChannel   *channel,
+                         GIOCondition  condition,
+                         gpointer      user_data)
+{
+  XfsmStartupAgent *sagent = user_data;
+  gchar             buffer[1024];
+  gssize            n;
+
+  n = read (sagent->fd, buffer, sizeof (buffer));
+  if (n > 0)
+    {
+      g_string_append_len (sagent->output, buffer, n);
+      return TRUE;
+    }
+  else if (n < 0 && (errno == EINTR || errno == EAGAIN))
+    {
+      return TRUE;
+    }
+
+  /* eof, the agent forked into the background */
+  sagent->watch_id = 0;
+  xfsm_startup_agent_finish (sagent);
+
+  return FALSE;
+}
+
+
+
+static gboolean
+xfsm_startup_agent_timeout (gpointer user_data)
+{
+  XfsmStartupAgent *sagent = user_data;
+
+  g_warning ("%s did not report its environment within %d seconds",
+             sagent->agent, AGENT_TIMEOUT);
+
+  sagent->timeout_id = 0;
+  xfsm_startup_agent_finish (sagent);
+
+  return FALSE;
+}
+
+
+
+/* spawns the agent and reads its environment from the main loop. if
+ * @ready is NULL the session is not started before the agent reported
+ * its variables, else @ready is called afterwards. the pid of the
+ * agent is stored in @pid_return. */
+static gboolean
+xfsm_startup_init_agent (const gchar          *cmd,
+                         const gchar          *agent,
+                         pid_t                *pid_return,
+                         XfsmStartupAgentFunc  ready,
+                         gpointer              ready_data)
+{
+  XfsmStartupAgent *sagent;
+  GIOChannel       *channel;
+  GError           *error = NULL;
+  gchar           **argv;
+  gint              fd;
+
+  if (!g_shell_parse_argv (cmd, NULL, &argv, &error))
     {
       g_warning ("Failed to spawn %s: %s", agent, error->message);
       g_error_free (error);
+      return FALSE;
+    }
 
-      return -1;
+  if (!xfsm_spawn_async (NULL, argv, NULL, 0, NULL, &fd, &error))
+    {
+      g_warning ("Failed to spawn %s: %s", agent, error->message);
+      g_error_free (error);
+      g_strfreev (argv);
+      return FALSE;
     }
 
-  g_free (cmdoutput);
+  g_strfreev (argv);
 
-  if (pid <= 0)
-    g_warning ("%s returned no PID in the variables", agent);
+  fcntl (fd, F_SETFL, fcntl (fd, F_GETFL) | O_NONBLOCK);
 
-  return pid;
+  sagent = g_slice_new0 (XfsmStartupAgent);
+  sagent->agent = agent;
+  sagent->pid_return = pid_return;
+  sagent->fd = fd;
+  sagent->output = g_string_new (NULL);
+  sagent->start_time = g_get_monotonic_time ();
+  sagent->ready = ready;
+  sagent->ready_data = ready_data;
+
+  channel = g_io_channel_unix_new (fd);
+  sagent->watch_id = g_io_add_watch (channel, G_IO_IN | G_IO_HUP | G_IO_ERR,
+                                     xfsm_startup_agent_read, sagent);
+  g_io_channel_unref (channel);
+
+  sagent->timeout_id = g_timeout_add_seconds (AGENT_TIMEOUT,
+                                              xfsm_startup_agent_timeout,
+                                              sagent);
+
+  if (ready == NULL)
+    agents_pending++;
+
+  return TRUE;
+}
+
+
+
+static void
+xfsm_startup_lazy_agent_started (gpointer user_data)
+{
+  xfsm_lazy_agent_ready (TRUE);
+}
+
+
+
+static void
+xfsm_startup_lazy_agent_start (const gchar *agent_socket,
+                               gpointer     user_data)
+{
+  gchar *cmd;
+
+  cmd = g_strdup_printf ("%s -s -a '%s'", lazy_sshagent_path, agent_socket);
+  if (!xfsm_startup_init_agent (cmd, "ssh-agent", &running_sshagent,
+                                xfsm_startup_lazy_agent_started, NULL))
+    xfsm_lazy_agent_ready (FALSE);
+  g_free (cmd);
 }
 
 
 
 void
-xfsm_startup_init (XfconfChannel *channel)
+xfsm_startup_init (XfsmSettings *settings)
 {
   gchar       *ssh_agent;
   gchar       *ssh_agent_path = NULL;
@@ -204,10 +417,15 @@ xfsm_startup_init (XfconfChannel *channel)
   pid_t        agentpid;
   gboolean     gnome_keyring_found;
 
+  /* migrate the old autostart location (if still present) and start
+   * validating the autostart index while the session is restored */
+  xfsm_startup_autostart_migrate ();
+  xfsm_autostart_scan ();
+
       /* if GNOME compatibility is enabled and gnome-keyring-daemon
        * is found, skip the gpg/ssh agent startup and wait for
        * gnome-keyring, which is probably what the user wants */
-  if (xfconf_channel_get_bool (channel, "/compat/LaunchGNOME", FALSE))
+  if (xfsm_settings_get_bool (settings, "/compat/LaunchGNOME", FALSE))
     {
       cmd = g_find_program_in_path ("gnome-keyring-daemon");
       gnome_keyring_found = (cmd != NULL);
@@ -222,7 +440,7 @@ xfsm_startup_init (XfconfChannel *channel)
         }
     }
 
-  if (xfconf_channel_get_bool (channel, "/startup/gpg-agent/enabled", TRUE))
+  if (xfsm_settings_get_bool (settings, "/startup/gpg-agent/enabled", TRUE))
     {
       gpg_agent_path = g_find_program_in_path ("gpg-agent");
       if (gpg_agent_path == NULL)
@@ -230,9 +448,9 @@ xfsm_startup_init (XfconfChannel *channel)
                     "No GPG agent found");
     }
 
-  if (xfconf_channel_get_bool (channel, "/startup/ssh-agent/enabled", TRUE))
+  if (xfsm_settings_get_bool (settings, "/startup/ssh-agent/enabled", TRUE))
     {
-      ssh_agent = xfconf_channel_get_string (channel, "/startup/ssh-agent/type", NULL);
+      ssh_agent = xfsm_settings_get_string (settings, "/startup/ssh-agent/type", NULL);
 
       if (ssh_agent == NULL
           || g_strcmp0 (ssh_agent, "ssh-agent") == 0)
@@ -278,11 +496,19 @@ xfsm_startup_init (XfconfChannel *channel)
 
       if (ssh_agent_path != NULL)
         {
-          cmd = g_strdup_printf ("%s -s", ssh_agent_path);
-          /* keep this around for shutdown */
-          running_sshagent = xfsm_startup_init_agent (cmd, "ssh-agent");
-          g_free (cmd);
-          g_free (ssh_agent_path);
+          if (xfsm_settings_get_bool (settings, "/startup/ssh-agent/lazy", FALSE)
+              && xfsm_lazy_agent_init (xfsm_startup_lazy_agent_start, NULL))
+            {
+              lazy_sshagent_path = ssh_agent_path;
+            }
+          else
+            {
+              cmd = g_strdup_printf ("%s -s", ssh_agent_path);
+              /* keep this around for shutdown */
+              xfsm_startup_init_agent (cmd, "ssh-agent", &running_sshagent, NULL, NULL);
+              g_free (cmd);
+              g_free (ssh_agent_path);
+            }
         }
     }
 
@@ -314,7 +540,7 @@ xfsm_startup_init (XfconfChannel *channel)
             }
 
           /* keep this around for shutdown */
-          running_gpgagent = xfsm_startup_init_agent (cmd, "gpg-agent");
+          xfsm_startup_init_agent (cmd, "gpg-agent", &running_gpgagent, NULL, NULL);
 
           g_free (cmd);
           g_free (envfile);
@@ -343,6 +569,16 @@ xfsm_startup_shutdown (void)
         }
     }
 
+  if (xfsm_lazy_agent_get_socket () != NULL)
+    {
+      if (running_sshagent <= 0)
+        g_unsetenv ("SSH_AUTH_SOCK");
+
+      xfsm_lazy_agent_shutdown ();
+      g_free (lazy_sshagent_path);
+      lazy_sshagent_path = NULL;
+    }
+
   if (running_gpgagent > 0)
     {
       gchar *envfile;
@@ -445,43 +681,6 @@ figure_app_name (const gchar *program_path)
 
 
 
-static gboolean
-xfsm_check_valid_exec (const gchar *exec)
-{
-  gboolean result = TRUE;
-  gchar   *tmp;
-  gchar   *p;
-
-  if (*exec == '/')
-    {
-      result = (access (exec, X_OK) == 0);
-    }
-  else
-    {
-      tmp = g_strdup (exec);
-      p = strchr (tmp, ' ');
-      if (G_UNLIKELY (p != NULL))
-        *p = '\0';
-
-      p = g_find_program_in_path (tmp);
-      g_free (tmp);
-
-      if (G_UNLIKELY (p == NULL))
-        {
-          result = FALSE;
-        }
-      else
-        {
-          result = (access (p, X_OK) == 0);
-          g_free (p);
-        }
-    }
-
-  return result;
-}
-
-
-
 static void
 xfsm_startup_autostart_migrate (void)
 {
@@ -584,153 +783,105 @@ xfsm_startup_autostart_migrate (void)
 
 
 
-static gint
-xfsm_startup_autostart_xdg (XfsmManager *manager,
-                            gboolean     start_at_spi)
+/* whether the autostart item @item should be started */
+static gboolean
+xfsm_startup_autostart_eligible (const XfsmAutostartItem *item,
+                                 gboolean                 start_at_spi)
 {
-  const gchar *try_exec;
-  const gchar *type;
-  const gchar *exec;
-  gboolean     startup_notify;
-  gboolean     terminal;
-  gboolean     skip;
-  GError      *error = NULL;
-  XfceRc      *rc;
-  gchar      **files;
-  gchar      **only_show_in;
-  gchar      **not_show_in;
-  gint         started = 0;
-  gint         n, m;
-  gchar       *filename;
-  const gchar *pattern;
-
-  /* migrate the old autostart location (if still present) */
-  xfsm_startup_autostart_migrate ();
+  gboolean skip;
 
-  /* pattern for only at-spi desktop files or everything */
-  if (start_at_spi)
-    pattern = "autostart/at-spi-*.desktop";
-  else
-    pattern = "autostart/*.desktop";
+  /* only at-spi desktop files in at-spi mode */
+  if (start_at_spi && !g_str_has_prefix (item->name, "at-spi-"))
+    return FALSE;
 
-  files = xfce_resource_match (XFCE_RESOURCE_CONFIG, pattern, TRUE);
-  for (n = 0; files[n] != NULL; ++n)
+  /* check the Hidden key */
+  skip = item->hidden;
+  if (G_LIKELY (!skip))
     {
-      rc = xfce_rc_config_open (XFCE_RESOURCE_CONFIG, files[n], TRUE);
-      if (G_UNLIKELY (rc == NULL))
-        continue;
+      /* check the OnlyShowIn and NotShowIn settings */
+      skip = !item->show_in_xfce;
+      if (skip)
+        xfsm_verbose ("%s not shown in XFCE, skipping\n", item->name);
+
+      /* skip at-spi launchers if not in at-spi mode or don't skip
+       * them no matter what the OnlyShowIn key says if only
+       * launching at-spi */
+      if (g_str_has_prefix (item->name, "at-spi-"))
+        {
+          skip = !start_at_spi;
+          xfsm_verbose ("start_at_spi (a11y support), %s\n", skip ? "skipping" : "showing");
+        }
+    }
 
-      xfce_rc_set_group (rc, "Desktop Entry");
+  /* check the "Type" key */
+  if (G_UNLIKELY (!skip && !item->application))
+    {
+      skip = TRUE;
+      xfsm_verbose ("Type != Application, skipping\n");
+    }
 
-      /* check the Hidden key */
-      skip = xfce_rc_read_bool_entry (rc, "Hidden", FALSE);
-      if (G_LIKELY (!skip))
-        {
-          xfsm_verbose("hidden set\n");
+  /* check the "TryExec" key */
+  if (G_UNLIKELY (!skip && !item->try_exec_valid))
+    {
+      skip = TRUE;
+      xfsm_verbose ("TryExec set and not found, skipping\n");
+    }
 
-          if (xfce_rc_read_bool_entry (rc, "X-XFCE-Autostart-Override", FALSE))
-            {
-              /* override the OnlyShowIn check */
-              skip = FALSE;
-              xfsm_verbose ("X-XFCE-Autostart-Override set, launching\n");
-            }
-          else
-            {
-              /* check the OnlyShowIn setting */
-              only_show_in = xfce_rc_read_list_entry (rc, "OnlyShowIn", ";");
-              if (G_UNLIKELY (only_show_in != NULL))
-                {
-                  /* check if "XFCE" is specified */
-                  for (m = 0, skip = TRUE; only_show_in[m] != NULL; ++m)
-                    {
-                      if (g_ascii_strcasecmp (only_show_in[m], "XFCE") == 0)
-                        {
-                          skip = FALSE;
-                          xfsm_verbose ("only show in XFCE set, launching\n");
-                          break;
-                        }
-                    }
+  return !skip && item->exec != NULL;
+}
 
-                  g_strfreev (only_show_in);
-                }
-            }
 
-          /* check the NotShowIn setting */
-          not_show_in = xfce_rc_read_list_entry (rc, "NotShowIn", ";");
-          if (G_UNLIKELY (not_show_in != NULL))
-            {
-              /* check if "Xfce" is not specified */
-              for (m = 0; not_show_in[m] != NULL; ++m)
-                if (g_ascii_strcasecmp (not_show_in[m], "XFCE") == 0)
-                  {
-                    skip = TRUE;
-                    xfsm_verbose ("NotShowIn Xfce set, skipping\n");
-                    break;
-                  }
-
-              g_strfreev (not_show_in);
-            }
 
-          /* skip at-spi launchers if not in at-spi mode or don't skip
-           * them no matter what the OnlyShowIn key says if only
-           * launching at-spi */
-          filename = g_path_get_basename (files[n]);
-          if (g_str_has_prefix (filename, "at-spi-"))
-            {
-              skip = !start_at_spi;
-              xfsm_verbose ("start_at_spi (a11y support), %s\n", skip ? "skipping" : "showing");
-            }
-          g_free (filename);
-        }
+static gboolean
+xfsm_startup_autostart_launch (const XfsmAutostartItem *item)
+{
+  gboolean launched;
+  GError  *error = NULL;
+
+  /* try to launch the command, libxfce4ui is only needed for
+   * the terminal wrapper and startup notification, which both
+   * need a display */
+  xfsm_verbose ("Autostart: running command \"%s\"\n", item->exec);
+  if ((item->terminal || item->startup_notify) && !xfsm_headless)
+    {
+      launched = xfce_spawn_command_line_on_screen (gdk_screen_get_default (),
+                                                    item->exec,
+                                                    item->terminal,
+                                                    item->startup_notify,
+                                                    &error);
+    }
+  else
+    {
+      launched = xfsm_spawn_command_line_on_screen (gdk_screen_get_default (),
+                                                    item->exec,
+                                                    &error);
+    }
 
-      /* check the "Type" key */
-      type = xfce_rc_read_entry (rc, "Type", NULL);
-      if (G_UNLIKELY (!skip && type != NULL && g_ascii_strcasecmp (type, "Application") != 0))
-        {
-          skip = TRUE;
-          xfsm_verbose ("Type == Application, skipping\n");
-        }
+  if (!launched)
+    {
+      g_warning ("Unable to launch \"%s\" (specified by %s): %s", item->exec, item->path, error->message);
+      xfsm_verbose ("Unable to launch \"%s\" (specified by %s): %s\n", item->exec, item->path, error->message);
+      g_error_free (error);
+    }
+
+  return launched;
+}
 
-      /* check the "TryExec" key */
-      try_exec = xfce_rc_read_entry (rc, "TryExec", NULL);
-      if (G_UNLIKELY (!skip && try_exec != NULL))
-        {
-          skip = !xfsm_check_valid_exec (try_exec);
-          if (skip)
-            xfsm_verbose ("TryExec set and xfsm_check_valid_exec failed, skipping\n");
-        }
 
-      /* execute the item */
-      exec = xfce_rc_read_entry (rc, "Exec", NULL);
-      if (G_LIKELY (!skip && exec != NULL))
-        {
-          /* query launch parameters */
-          startup_notify = xfce_rc_read_bool_entry (rc, "StartupNotify", FALSE);
-          terminal = xfce_rc_read_bool_entry (rc, "Terminal", FALSE);
-
-          /* try to launch the command */
-          xfsm_verbose ("Autostart: running command \"%s\"\n", exec);
-          if (!xfce_spawn_command_line_on_screen (gdk_screen_get_default (),
-                                                  exec,
-                                                  terminal,
-                                                  startup_notify,
-                                                  &error))
-            {
-              g_warning ("Unable to launch \"%s\" (specified by %s): %s", exec, files[n], error->message);
-              xfsm_verbose ("Unable to launch \"%s\" (specified by %s): %s\n", exec, files[n], error->message);
-              g_error_free (error);
-              error = NULL;
-            }
-          else
-            {
-              ++started;
-            }
-        }
 
-      /* cleanup */
-      xfce_rc_close (rc);
+static gint
+xfsm_startup_autostart_xdg (GPtrArray *items,
+                            gboolean   start_at_spi)
+{
+  gint  started = 0;
+  guint n;
+
+  for (n = 0; n < items->len; ++n)
+    {
+      if (xfsm_startup_autostart_eligible (g_ptr_array_index (items, n), start_at_spi)
+          && xfsm_startup_autostart_launch (g_ptr_array_index (items, n)))
+        ++started;
     }
-  g_strfreev (files);
 
   return started;
 }
@@ -738,11 +889,12 @@ xfsm_startup_autostart_xdg (XfsmManager *manager,
 
 
 static void
-xfsm_startup_autostart (XfsmManager *manager)
+xfsm_startup_autostart_ready (GPtrArray *items,
+                              gpointer   user_data)
 {
   gint n;
 
-  n = xfsm_startup_autostart_xdg (manager, FALSE);
+  n = xfsm_startup_autostart_xdg (items, FALSE);
 
   if (n > 0)
     {
@@ -759,6 +911,66 @@ xfsm_startup_autostart (XfsmManager *manager)
 
 
 
+static void
+xfsm_startup_autostart (XfsmManager *manager)
+{
+  /* launched as soon as the autostart index is up to date */
+  xfsm_autostart_load (xfsm_startup_autostart_ready, NULL);
+}
+
+
+
+/* adds the autostart items to the pending clients, so that they are
+ * started by xfsm_startup_session_continue() along with the session
+ * and can take part in the X-XFCE-After ordering */
+static void
+xfsm_startup_autostart_queue (GPtrArray *items,
+                              gpointer   user_data)
+{
+  XfsmManager       *manager = XFSM_MANAGER (user_data);
+  XfsmAutostartItem *item;
+  XfsmProperties    *properties;
+  gchar            **argv;
+  gchar             *client_id;
+  GError            *error = NULL;
+  guint              n;
+
+  for (n = 0; n < items->len; ++n)
+    {
+      item = g_ptr_array_index (items, n);
+      if (!xfsm_startup_autostart_eligible (item, FALSE))
+        continue;
+
+      if (!g_shell_parse_argv (item->exec, NULL, &argv, &error))
+        {
+          g_warning ("Unable to launch \"%s\" (specified by %s): %s", item->exec, item->path, error->message);
+          g_error_free (error);
+          error = NULL;
+          continue;
+        }
+
+      client_id = g_strconcat ("xfsm-autostart-", item->name, NULL);
+      properties = xfsm_properties_new (client_id, NULL);
+      properties->autostart = item;
+      xfsm_properties_set_string (properties, SmProgram, argv[0]);
+      xfsm_properties_set_strv (properties, SmRestartCommand, argv);
+      xfsm_properties_set_string (properties, GsmDesktopFile, item->path);
+      g_free (client_id);
+      g_strfreev (argv);
+
+      xfsm_manager_add_pending_properties (manager, properties);
+    }
+
+  autostart_queued = TRUE;
+
+  if (xfsm_manager_get_state (manager) == XFSM_MANAGER_STARTUP)
+    xfsm_startup_session_continue (manager);
+
+  g_object_unref (manager);
+}
+
+
+
 void
 xfsm_startup_foreign (XfsmManager *manager)
 {
@@ -848,7 +1060,7 @@ xfsm_startup_at (XfsmManager *manager)
   gint n, i;
 
   /* start at-spi-dbus-bus and/or at-spi-registryd */
-  n = xfsm_startup_autostart_xdg (manager, TRUE);
+  n = xfsm_startup_autostart_xdg (xfsm_autostart_load_sync (), TRUE);
 
   if (n > 0)
     {
@@ -874,8 +1086,107 @@ xfsm_startup_at (XfsmManager *manager)
 }
 
 
-void
-xfsm_startup_begin (XfsmManager *manager)
+static gboolean
+xfsm_startup_has_legacy (GQueue *queue)
+{
+  GList *lp;
+
+  for (lp = g_queue_peek_head_link (queue); lp != NULL; lp = lp->next)
+    if (XFSM_PROPERTIES (lp->data)->legacy)
+      return TRUE;
+
+  return FALSE;
+}
+
+
+static void
+xfsm_startup_transient_watch (XfsmManager *manager)
+{
+  if (transient_manager != NULL)
+    return;
+
+  transient_manager = g_object_ref (manager);
+  xfsm_wnck_watch_windows (xfsm_startup_transient_window_opened, transient_manager);
+}
+
+
+static void
+xfsm_startup_transient_unwatch (void)
+{
+  if (transient_manager == NULL)
+    return;
+
+  xfsm_wnck_unwatch_windows (xfsm_startup_transient_window_opened, transient_manager);
+  g_object_unref (transient_manager);
+  transient_manager = NULL;
+}
+
+
+/* the counterpart of xfsm_manager_register_client() for the clients
+ * that never register */
+static void
+xfsm_startup_transient_started (XfsmManager    *manager,
+                                XfsmProperties *properties)
+{
+  xfsm_verbose ("Client %s mapped a window\n", properties->client_id);
+
+  if (properties->startup_timeout_id > 0)
+    {
+      g_source_remove (properties->startup_timeout_id);
+      properties->startup_timeout_id = 0;
+    }
+
+  /* remember how long the client took to come up */
+  if (properties->spawn_time > 0)
+    {
+      xfsm_latency_record (xfsm_properties_get_string (properties, SmProgram),
+                           XFSM_LATENCY_STARTUP,
+                           g_get_monotonic_time () - properties->spawn_time);
+      properties->spawn_time = 0;
+    }
+
+  xfsm_trace_mark (properties->client_id, XFSM_TRACE_WINDOW_MAPPED);
+
+  /* there is no client to hand the properties to, the child is
+   * reaped in the background */
+  xfsm_manager_remove_starting_properties (manager, properties);
+  xfsm_properties_free (properties);
+
+  if (xfsm_manager_get_state (manager) == XFSM_MANAGER_STARTUP)
+    {
+      /* clients waiting for this one may be started now */
+      xfsm_startup_session_continue (manager);
+    }
+}
+
+
+static void
+xfsm_startup_transient_window_opened (const XfsmWnckWindowInfo *info,
+                                      gpointer                  user_data)
+{
+  XfsmManager    *manager = XFSM_MANAGER (user_data);
+  XfsmProperties *properties;
+  GList          *lp;
+
+  lp = g_queue_peek_head_link (xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_STARTING_PROPS));
+  for (; lp != NULL; lp = lp->next)
+    {
+      properties = XFSM_PROPERTIES (lp->data);
+
+      /* autostart items are only known by the pid we spawned */
+      if (properties->autostart != NULL
+          ? info->pid > 0 && info->pid == properties->pid
+          : xfsm_legacy_window_matches (properties, info))
+        {
+          xfsm_startup_transient_started (manager, properties);
+          return;
+        }
+    }
+}
+
+
+static void
+xfsm_startup_begin_session (XfsmManager *manager)
 {
   /* start assistive technology before anything else */
   if (xfsm_manager_get_start_at (manager))
@@ -889,8 +1200,34 @@ xfsm_startup_begin (XfsmManager *manager)
     }
   else
     {
+      /* restarted legacy applications are started along with the
+       * XSMP clients and are done once one of their windows shows up */
+      if (xfsm_startup_has_legacy (xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_PENDING_PROPS)))
+        xfsm_startup_transient_watch (manager);
+
       xfsm_startup_session_continue (manager);
+
+      /* the autostart items join as soon as the index is ready, the
+       * session is not done before */
+      xfsm_autostart_load (xfsm_startup_autostart_queue, g_object_ref (manager));
+    }
+}
+
+
+void
+xfsm_startup_begin (XfsmManager *manager)
+{
+  /* the clients inherit SSH_AUTH_SOCK and friends, so wait until
+   * the agents printed them */
+  if (agents_pending > 0)
+    {
+      xfsm_verbose ("Waiting for %u agent(s) before starting the session\n",
+                    agents_pending);
+      agents_waiting_manager = g_object_ref (manager);
+      return;
     }
+
+  xfsm_startup_begin_session (manager);
 }
 
 
@@ -930,6 +1267,7 @@ xfsm_startup_start_properties (XfsmProperties *properties,
   gint             n;
   const gchar     *current_directory;
   GPid             pid;
+  guint            timeout;
   GError          *error = NULL;
 
   /* release any possible old resources related to a previous startup */
@@ -945,11 +1283,10 @@ xfsm_startup_start_properties (XfsmProperties *properties,
 
   current_directory = xfsm_properties_get_string (properties, SmCurrentDirectory);
 
-  if (!g_spawn_async (current_directory,
-                      argv, NULL,
-                      G_SPAWN_DO_NOT_REAP_CHILD | G_SPAWN_SEARCH_PATH,
-                      NULL, NULL,
-                      &pid, &error))
+  if (!xfsm_spawn_async (current_directory,
+                         argv, NULL,
+                         G_SPAWN_DO_NOT_REAP_CHILD | G_SPAWN_SEARCH_PATH,
+                         &pid, NULL, &error))
     {
       g_warning ("Unable to launch \"%s\": %s",
                  *argv, error->message);
@@ -971,6 +1308,11 @@ xfsm_startup_start_properties (XfsmProperties *properties,
   g_strfreev (argv);
 
   properties->pid = pid;
+  properties->spawn_time = g_get_monotonic_time ();
+
+  xfsm_trace_mark_full (properties->client_id,
+                        xfsm_properties_get_string (properties, SmProgram),
+                        pid, XFSM_TRACE_SPAWN, 0);
 
   /* set a watch to make sure the child doesn't quit before registering */
   child_watch_data = g_new0 (XfsmStartupData, 1);
@@ -982,12 +1324,15 @@ xfsm_startup_start_properties (XfsmProperties *properties,
                               (GDestroyNotify) xfsm_startup_data_free);
 
   /* set a timeout -- client must register in a a certain amount of time
-   * or it's assumed to be broken/have issues. */
+   * or it's assumed to be broken/have issues. how long depends on how
+   * long the program took in previous sessions. */
+  timeout = xfsm_latency_get_timeout (xfsm_properties_get_string (properties, SmProgram),
+                                      XFSM_LATENCY_STARTUP, STARTUP_TIMEOUT);
   startup_timeout_data = g_new (XfsmStartupData, 1);
   startup_timeout_data->manager = g_object_ref (manager);
   startup_timeout_data->properties = properties;
   properties->startup_timeout_id = g_timeout_add_full (G_PRIORITY_DEFAULT,
-                                                       STARTUP_TIMEOUT,
+                                                       timeout,
                                                        xfsm_startup_timeout,
                                                        startup_timeout_data,
                                                        (GDestroyNotify) xfsm_startup_data_free);
@@ -996,107 +1341,432 @@ xfsm_startup_start_properties (XfsmProperties *properties,
 }
 
 
+/* resolves the names other clients can refer to @properties by in their
+ * startup dependencies, besides its client id */
+static void
+xfsm_startup_properties_resolve (XfsmProperties *properties)
+{
+  const gchar *program;
+  const gchar *desktop_file;
+  gchar       *basename;
+
+  if (properties->startup_program == NULL)
+    {
+      program = xfsm_properties_get_string (properties, SmProgram);
+      if (program != NULL)
+        {
+          basename = g_path_get_basename (program);
+          properties->startup_program = g_intern_string (basename);
+          g_free (basename);
+        }
+      else
+        {
+          properties->startup_program = g_intern_static_string ("");
+        }
+    }
+
+  if (properties->startup_desktop == NULL)
+    {
+      desktop_file = xfsm_properties_get_string (properties, GsmDesktopFile);
+      if (desktop_file != NULL)
+        {
+          basename = g_path_get_basename (desktop_file);
+          if (g_str_has_suffix (basename, ".desktop"))
+            basename[strlen (basename) - strlen (".desktop")] = '\0';
+          properties->startup_desktop = g_intern_string (basename);
+          g_free (basename);
+        }
+      else
+        {
+          properties->startup_desktop = g_intern_static_string ("");
+        }
+    }
+}
+
+
+/* returns how many of the names of @properties are @name */
+static guint
+xfsm_startup_properties_is_named (XfsmProperties *properties,
+                                  const gchar    *name)
+{
+  return (g_intern_string (properties->client_id) == name)
+         + (properties->startup_program == name)
+         + (properties->startup_desktop == name);
+}
+
+
+/* returns the explicit startup dependencies of @properties: the _XFSM_After
+ * property if set, otherwise the X-XFCE-After key of its desktop file */
+static gchar **
+xfsm_startup_properties_get_after (XfsmProperties *properties)
+{
+  static gchar *no_after[] = { NULL };
+  const gchar  *desktop_file;
+  gchar       **after;
+  XfceRc       *rc;
+
+  /* clients may change it at any time, so it is not cached */
+  after = xfsm_properties_get_strv (properties, XfsmAfter);
+  if (after != NULL)
+    return after;
+
+  /* the autostart index parsed it already */
+  if (properties->autostart != NULL)
+    return properties->autostart->after != NULL ? properties->autostart->after : no_after;
+
+  /* dropped by xfsm-properties.c when _GSM_DesktopFile changes */
+  if (G_LIKELY (properties->startup_after != NULL))
+    return properties->startup_after;
+
+  desktop_file = xfsm_properties_get_string (properties, GsmDesktopFile);
+  if (desktop_file != NULL)
+    {
+      rc = xfce_rc_simple_open (desktop_file, TRUE);
+      if (rc != NULL)
+        {
+          xfce_rc_set_group (rc, "Desktop Entry");
+          properties->startup_after = xfce_rc_read_list_entry (rc, "X-XFCE-After", ";");
+          xfce_rc_close (rc);
+        }
+    }
+
+  if (properties->startup_after == NULL)
+    properties->startup_after = g_new0 (gchar *, 1);
+
+  return properties->startup_after;
+}
+
+
+static void
+xfsm_startup_index_count (GHashTable  *table,
+                          const gchar *name)
+{
+  if (*name != '\0')
+    g_hash_table_insert (table, (gpointer) name,
+                         GUINT_TO_POINTER (GPOINTER_TO_UINT (g_hash_table_lookup (table, name)) + 1));
+}
+
+
+static void
+xfsm_startup_index_uncount (GHashTable  *table,
+                            const gchar *name)
+{
+  guint count;
+
+  if (*name == '\0')
+    return;
+
+  count = GPOINTER_TO_UINT (g_hash_table_lookup (table, name));
+  if (count > 1)
+    g_hash_table_insert (table, (gpointer) name, GUINT_TO_POINTER (count - 1));
+  else
+    g_hash_table_remove (table, name);
+}
+
+
+static XfsmStartupIndex *
+xfsm_startup_index_get (void)
+{
+  if (G_UNLIKELY (startup_index.names == NULL))
+    {
+      startup_index.names = g_hash_table_new (g_direct_hash, g_direct_equal);
+      startup_index.wanted = g_hash_table_new (g_direct_hash, g_direct_equal);
+    }
+
+  return &startup_index;
+}
+
+
+/* called by the manager whenever @properties joins the starting or
+ * (if @pending) the pending queue. the names and the priority of a
+ * client don't change while it is in one of them */
 void
-xfsm_startup_session_continue (XfsmManager *manager)
+xfsm_startup_index_add (XfsmProperties *properties,
+                        gboolean        pending)
 {
-  GQueue  *pending_properties = xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_PENDING_PROPS);
-  gboolean client_started = FALSE;
+  XfsmStartupIndex *index = xfsm_startup_index_get ();
+  gchar           **after;
+  gint              priority;
+  guint             n;
+
+  xfsm_startup_properties_resolve (properties);
 
-  /* try to start some clients.  if we fail to start anything in the current
-   * priority group, move right to the next one.  if we *did* start something,
-   * the failed/registered handlers will take care of moving us on to the
-   * next priority group */
-  while (client_started == FALSE && g_queue_peek_head (pending_properties) != NULL)
-    client_started = xfsm_startup_session_next_prio_group (manager);
+  xfsm_startup_index_count (index->names, g_intern_string (properties->client_id));
+  xfsm_startup_index_count (index->names, properties->startup_program);
+  xfsm_startup_index_count (index->names, properties->startup_desktop);
 
-  if (G_UNLIKELY (client_started == FALSE && g_queue_peek_head (pending_properties) == NULL))
+  if (properties->autostart == NULL)
     {
-      /* we failed to start anything, and we don't have anything else,
-       * to start, so just move on to the autostart items and signal
-       * the manager that we're finished */
-      xfsm_verbose ("Nothing started and nothing to start, moving to autostart items\n");
-      xfsm_startup_autostart (manager);
-      xfsm_manager_signal_startup_done (manager);
+      priority = xfsm_properties_get_uchar (properties, GsmPriority, 50);
+      index->priorities[priority]++;
+      if (index->n_session++ == 0 || priority < index->min_priority)
+        index->min_priority = priority;
+    }
+
+  if (pending)
+    {
+      after = xfsm_startup_properties_get_after (properties);
+      for (n = 0; after[n] != NULL; ++n)
+        xfsm_startup_index_count (index->wanted, g_intern_string (after[n]));
     }
 }
 
 
-/* returns TRUE if we started anything, FALSE if we didn't */
-static gboolean
-xfsm_startup_session_next_prio_group (XfsmManager *manager)
+/* called by the manager whenever @properties leaves the starting or
+ * (if @pending) the pending queue */
+void
+xfsm_startup_index_remove (XfsmProperties *properties,
+                           gboolean        pending)
 {
-  GQueue         *pending_properties = xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_PENDING_PROPS);
-  GQueue         *starting_properties = xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_STARTING_PROPS);
-  XfsmProperties *properties;
-  gint            cur_prio_group;
-  gboolean        client_started = FALSE;
+  XfsmStartupIndex *index = xfsm_startup_index_get ();
+  gchar           **after;
+  gint              priority;
+  guint             n;
 
-  properties = (XfsmProperties *) g_queue_peek_head (pending_properties);
-  if (properties == NULL)
-    return FALSE;
+  xfsm_startup_index_uncount (index->names, g_intern_string (properties->client_id));
+  xfsm_startup_index_uncount (index->names, properties->startup_program);
+  xfsm_startup_index_uncount (index->names, properties->startup_desktop);
 
-  cur_prio_group = xfsm_properties_get_uchar (properties, GsmPriority, 50);
+  if (properties->autostart == NULL)
+    {
+      priority = xfsm_properties_get_uchar (properties, GsmPriority, 50);
+      index->priorities[priority]--;
+      if (--index->n_session == 0)
+        index->min_priority = 0;
+      else if (priority == index->min_priority)
+        while (index->priorities[index->min_priority] == 0)
+          index->min_priority++;
+    }
 
-  xfsm_verbose ("Starting apps in prio group %d\n", cur_prio_group);
+  if (pending)
+    {
+      after = xfsm_startup_properties_get_after (properties);
+      for (n = 0; after[n] != NULL; ++n)
+        xfsm_startup_index_uncount (index->wanted, g_intern_string (after[n]));
+    }
+}
+
+
+/* returns TRUE if a pending client waits for @properties */
+static gboolean
+xfsm_startup_index_wanted (XfsmStartupIndex *index,
+                           XfsmProperties   *properties)
+{
+  return g_hash_table_lookup (index->wanted, g_intern_string (properties->client_id)) != NULL
+         || g_hash_table_lookup (index->wanted, properties->startup_program) != NULL
+         || g_hash_table_lookup (index->wanted, properties->startup_desktop) != NULL;
+}
 
-  while ((properties = g_queue_pop_head (pending_properties)))
+
+/* returns TRUE if @properties still waits for a starting or pending client.
+ * @properties has to be in @index itself */
+static gboolean
+xfsm_startup_properties_waits_for (XfsmProperties   *properties,
+                                   XfsmStartupIndex *index)
+{
+  const gchar *name;
+  gchar      **after;
+  guint        count;
+  guint        n;
+
+  after = xfsm_startup_properties_get_after (properties);
+  if (after[0] != NULL)
     {
-      /* quit if we've hit all the clients in the current prio group */
-      if (xfsm_properties_get_uchar (properties, GsmPriority, 50) != cur_prio_group)
+      /* explicit edges replace the priority groups */
+      for (n = 0; after[n] != NULL; ++n)
         {
-          /* we're not starting this one yet; put it back */
-          g_queue_push_head (pending_properties, properties);
-          break;
+          name = g_intern_string (after[n]);
+          count = GPOINTER_TO_UINT (g_hash_table_lookup (index->names, name));
+          if (count > xfsm_startup_properties_is_named (properties, name))
+            return TRUE;
         }
 
-      /* FIXME: splash */
-      if (G_LIKELY (splash_screen != NULL))
+      return FALSE;
+    }
+
+  /* autostart items used to be started after the whole session, which
+   * is still the implicit edge */
+  if (properties->autostart != NULL)
+    return index->n_session > 0;
+
+  /* implicit edge to every client in a lower priority group */
+  return index->min_priority < xfsm_properties_get_uchar (properties, GsmPriority, 50);
+}
+
+
+static void
+xfsm_startup_splash_next (XfsmProperties *properties)
+{
+  const gchar *app_name = NULL;
+  const gchar *desktop_file;
+  XfceRc      *rcfile = NULL;
+
+  /* FIXME: splash */
+  if (G_UNLIKELY (splash_screen == NULL))
+    return;
+
+  desktop_file = xfsm_properties_get_string (properties, GsmDesktopFile);
+
+  if (desktop_file)
+    {
+      rcfile = xfce_rc_simple_open (desktop_file, TRUE);
+      if (rcfile)
         {
-          const gchar *app_name = NULL;
-          const gchar *desktop_file;
-          XfceRc      *rcfile = NULL;
+          xfce_rc_set_group (rcfile, "Desktop Entry");
+          app_name = xfce_rc_read_entry (rcfile, "Name", NULL);
+        }
+    }
 
-          desktop_file = xfsm_properties_get_string (properties, GsmDesktopFile);
+  if (!app_name)
+    app_name = figure_app_name (xfsm_properties_get_string (properties,
+                                                            SmProgram));
 
-          if (desktop_file)
-            {
-              rcfile = xfce_rc_simple_open (desktop_file, TRUE);
-              if (rcfile)
-                {
-                  xfce_rc_set_group (rcfile, "Desktop Entry");
-                  app_name = xfce_rc_read_entry (rcfile, "Name", NULL);
-                }
-            }
+  xfsm_splash_screen_next (splash_screen, app_name);
+
+  if (rcfile)
+    {
+      /* delay closing because app_name belongs to the rcfile
+       * if we found it in the file */
+      xfce_rc_close (rcfile);
+    }
+}
 
-          if (!app_name)
-            app_name = figure_app_name (xfsm_properties_get_string (properties,
-                                                                    SmProgram));
 
-          xfsm_splash_screen_next (splash_screen, app_name);
+/* returns TRUE unless the autostart item failed to start and another
+ * client waits for it */
+static gboolean
+xfsm_startup_autostart_start_one (XfsmManager      *manager,
+                                  XfsmProperties   *properties,
+                                  XfsmStartupIndex *index)
+{
+  const XfsmAutostartItem *item = properties->autostart;
 
-          if (rcfile)
-            {
-              /* delay closing because app_name belongs to the rcfile
-               * if we found it in the file */
-              xfce_rc_close (rcfile);
-            }
+  if (xfsm_startup_index_wanted (index, properties)
+      && !((item->terminal || item->startup_notify) && !xfsm_headless))
+    {
+      /* done once one of its windows shows up, like a legacy client,
+       * or once it exits or times out */
+      xfsm_verbose ("Autostart: running command \"%s\"\n", item->exec);
+      if (!xfsm_startup_start_properties (properties, manager))
+        {
+          xfsm_properties_free (properties);
+          return FALSE;
         }
 
-      if (G_LIKELY (xfsm_startup_start_properties (properties, manager)))
+      ++autostart_started;
+      xfsm_startup_transient_watch (manager);
+      xfsm_manager_add_starting_properties (manager, properties);
+      return TRUE;
+    }
+
+  /* nobody waits for it, or there is no pid to wait for */
+  if (xfsm_startup_autostart_launch (item))
+    ++autostart_started;
+  xfsm_properties_free (properties);
+
+  return TRUE;
+}
+
+
+/* returns TRUE if the client was started, FALSE if it failed */
+static gboolean
+xfsm_startup_session_start_one (XfsmManager      *manager,
+                                XfsmProperties   *properties,
+                                XfsmStartupIndex *index)
+{
+  xfsm_startup_splash_next (properties);
+
+  if (properties->autostart != NULL)
+    return xfsm_startup_autostart_start_one (manager, properties, index);
+
+  if (G_LIKELY (xfsm_startup_start_properties (properties, manager)))
+    {
+      xfsm_manager_add_starting_properties (manager, properties);
+      xfsm_verbose ("client id %s started\n", properties->client_id);
+      return TRUE;
+    }
+
+  /* if starting the app failed, let the manager handle it */
+  if (xfsm_manager_handle_failed_properties (manager, properties) == FALSE)
+    xfsm_properties_free (properties);
+
+  return FALSE;
+}
+
+
+void
+xfsm_startup_session_continue (XfsmManager *manager)
+{
+  GQueue           *pending_properties = xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_PENDING_PROPS);
+  GQueue           *starting_properties = xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_STARTING_PROPS);
+  XfsmStartupIndex *index = xfsm_startup_index_get ();
+  XfsmProperties   *properties;
+  GList            *lp, *next;
+  gboolean          progress;
+
+  /* start every pending client whose dependencies already registered or
+   * failed.  called again by the registered/failed handlers, so clients
+   * are launched as soon as whatever they wait for is done, instead of
+   * waiting for a whole priority group to finish */
+  do
+    {
+      progress = FALSE;
+
+      /* a started client moves from the pending to the starting queue
+       * and is still counted, so nothing that waits for it is started
+       * before it registered */
+      for (lp = g_queue_peek_head_link (pending_properties); lp != NULL; lp = next)
         {
-          g_queue_push_tail (starting_properties, properties);
-          client_started = TRUE;
-          xfsm_verbose ("client id %s started\n", properties->client_id);
+          next = lp->next;
+          properties = XFSM_PROPERTIES (lp->data);
+
+          if (xfsm_startup_properties_waits_for (properties, index))
+            continue;
+
+          xfsm_manager_take_pending_properties (manager, lp);
+          progress = TRUE;
+
+          /* a failed start may unblock clients we already passed, hence
+           * the extra pass; the list may have changed as well */
+          if (!xfsm_startup_session_start_one (manager, properties, index))
+            break;
         }
-      else
+
+      if (!progress
+          && g_queue_peek_head (starting_properties) == NULL
+          && g_queue_peek_head (pending_properties) != NULL)
         {
-          /* if starting the app failed, let the manager handle it */
-          if (xfsm_manager_handle_failed_properties (manager, properties) == FALSE)
-            xfsm_properties_free (properties);
+          /* nothing is starting but every pending client waits for
+           * another pending client: break the dependency cycle by
+           * starting the client with the lowest priority. the queue
+           * isn't sorted anymore once autostart items were added */
+          next = g_queue_peek_head_link (pending_properties);
+          for (lp = next->next; lp != NULL; lp = lp->next)
+            if (xfsm_properties_compare (lp->data, next->data) < 0)
+              next = lp;
+
+          properties = xfsm_manager_take_pending_properties (manager, next);
+          g_warning ("Dependency cycle detected, starting \"%s\" anyway",
+                     properties->client_id);
+          xfsm_startup_session_start_one (manager, properties, index);
+          progress = TRUE;
         }
     }
+  while (progress);
+
+  if (G_UNLIKELY (autostart_queued
+                  && g_queue_peek_head (starting_properties) == NULL
+                  && g_queue_peek_head (pending_properties) == NULL))
+    {
+      /* everything has been started or failed, including the autostart
+       * items, so signal the manager that we're finished */
+      xfsm_verbose ("Nothing starting and nothing to start\n");
+      xfsm_startup_transient_unwatch ();
 
-  return client_started;
+      g_timeout_add (autostart_started > 0 ? 2000 : 1000, destroy_splash, NULL);
+
+      xfsm_manager_signal_startup_done (manager);
+    }
 }
 
 
@@ -1114,7 +1784,6 @@ xfsm_startup_child_watch (GPid     pid,
                           gpointer user_data)
 {
   XfsmStartupData *cwdata = user_data;
-  GQueue          *starting_properties;
 
   xfsm_verbose ("Client Id = %s, PID %d exited with status %d\n",
                 cwdata->properties->client_id, (gint)pid, status);
@@ -1122,8 +1791,7 @@ xfsm_startup_child_watch (GPid     pid,
   cwdata->properties->child_watch_id = 0;
   cwdata->properties->pid = -1;
 
-  starting_properties = xfsm_manager_get_queue (cwdata->manager, XFSM_MANAGER_QUEUE_STARTING_PROPS);
-  if (g_queue_find (starting_properties, cwdata->properties) != NULL)
+  if (xfsm_manager_has_starting_properties (cwdata->manager, cwdata->properties))
     {
       xfsm_verbose ("Client Id = %s died while starting up\n",
                     cwdata->properties->client_id);
@@ -1146,6 +1814,12 @@ xfsm_startup_timeout (gpointer data)
   xfsm_verbose ("Client Id = %s failed to register in time\n",
                 stdata->properties->client_id);
 
+  /* give it more time next session */
+  xfsm_latency_record (xfsm_properties_get_string (stdata->properties, SmProgram),
+                       XFSM_LATENCY_STARTUP,
+                       g_get_monotonic_time () - stdata->properties->spawn_time);
+  stdata->properties->spawn_time = 0;
+
   stdata->properties->startup_timeout_id = 0;
   xfsm_startup_handle_failed_startup (stdata->properties, stdata->manager);
 
@@ -1157,8 +1831,6 @@ static void
 xfsm_startup_handle_failed_startup (XfsmProperties *properties,
                                     XfsmManager    *manager)
 {
-  GQueue *starting_properties = xfsm_manager_get_queue (manager, XFSM_MANAGER_QUEUE_STARTING_PROPS);
-
   xfsm_verbose ("Client Id = %s failed to start\n", properties->client_id);
 
   /* if our timer hasn't run out yet, kill it */
@@ -1172,14 +1844,14 @@ xfsm_startup_handle_failed_startup (XfsmProperties *properties,
 
   /* not starting anymore, so remove it from the list.  tell the manager
    * it failed, and let it do its thing. */
-  g_queue_remove (starting_properties, properties);
-  if (xfsm_manager_handle_failed_properties (manager, properties) == FALSE)
+  xfsm_manager_remove_starting_properties (manager, properties);
+  if (properties->autostart != NULL
+      || xfsm_manager_handle_failed_properties (manager, properties) == FALSE)
       xfsm_properties_free (properties);
 
-  if (g_queue_peek_head (starting_properties) == NULL
-      && xfsm_manager_get_state (manager) == XFSM_MANAGER_STARTUP)
+  if (xfsm_manager_get_state (manager) == XFSM_MANAGER_STARTUP)
     {
-      /* everything has finished starting or failed; continue startup */
+      /* clients waiting for this one may be started now */
       xfsm_startup_session_continue (manager);
     }
 }
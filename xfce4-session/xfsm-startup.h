@@ -23,10 +23,11 @@
 #ifndef __XFSM_STARTUP_H__
 #define __XFSM_STARTUP_H__
 
-#include <xfconf/xfconf.h>
 #include <libxfce4util/libxfce4util.h>
 
-void xfsm_startup_init (XfconfChannel *channel);
+#include <xfce4-session/xfsm-settings.h>
+
+void xfsm_startup_init (XfsmSettings *settings);
 void xfsm_startup_shutdown (void);
 void xfsm_startup_foreign (XfsmManager *manager);
 void xfsm_startup_begin (XfsmManager *manager);
@@ -34,5 +35,12 @@ void xfsm_startup_session_continue (XfsmManager *manager);
 gboolean xfsm_startup_start_properties (XfsmProperties *properties,
                                         XfsmManager    *manager);
 
+/* the manager reports every client that joins or leaves the starting
+ * or the pending queue, see xfsm_manager_add_starting_properties() */
+void xfsm_startup_index_add (XfsmProperties *properties,
+                             gboolean        pending);
+void xfsm_startup_index_remove (XfsmProperties *properties,
+                                gboolean        pending);
+
 #endif /* !__XFSM_STARTUP_H__ */
 
@@ -0,0 +1,244 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Keeps the most recent durations of the core XSMP paths (client
+ * registration, checkpoint and logout) so a load generator driving
+ * the manager over the protocol can read latency percentiles and the
+ * manager's own CPU and memory use through GetProtocolStats().
+ *
+ * During startup a probe timer also records how late the main loop
+ * dispatches it, separately for the time the splash screen is shown, so
+ * the cost of the splash animation for ICE clients can be compared.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <glib-object.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-stats.h>
+
+/* number of samples remembered per kind */
+#define STATS_SAMPLES 512
+
+/* interval of the main loop probe in milliseconds */
+#define PROBE_INTERVAL 20
+
+
+typedef struct
+{
+  gint64 samples[STATS_SAMPLES];
+  guint  n_samples;  /* total number recorded */
+} XfsmStatsRing;
+
+
+static const gchar *kind_names[XFSM_STATS_N_KINDS] =
+{
+  "register",
+  "checkpoint",
+  "shutdown",
+  "loop",
+  "loop-splash",
+};
+
+static XfsmStatsRing stats[XFSM_STATS_N_KINDS];
+
+static guint  probe_id = 0;
+static gint64 probe_due;
+
+
+void
+xfsm_stats_record (XfsmStatsKind kind,
+                   gint64        duration)
+{
+  XfsmStatsRing *ring;
+
+  g_return_if_fail (kind < XFSM_STATS_N_KINDS);
+
+  ring = &stats[kind];
+  ring->samples[ring->n_samples % STATS_SAMPLES] = MAX (duration, 0);
+  ring->n_samples++;
+}
+
+
+static gboolean
+xfsm_stats_probe (gpointer user_data)
+{
+  gint64 now = g_get_monotonic_time ();
+
+  xfsm_stats_record (splash_screen != NULL ? XFSM_STATS_LOOP_SPLASH : XFSM_STATS_LOOP,
+                     now - probe_due);
+  probe_due = now + PROBE_INTERVAL * 1000;
+
+  return TRUE;
+}
+
+
+/* samples the main loop latency until xfsm_stats_probe_stop() */
+void
+xfsm_stats_probe_start (void)
+{
+  if (probe_id != 0)
+    return;
+
+  probe_due = g_get_monotonic_time () + PROBE_INTERVAL * 1000;
+  probe_id = g_timeout_add (PROBE_INTERVAL, xfsm_stats_probe, NULL);
+}
+
+
+void
+xfsm_stats_probe_stop (void)
+{
+  XfsmStatsRing *ring;
+  guint          kind;
+  guint          n;
+  gint64         max;
+
+  if (probe_id == 0)
+    return;
+
+  g_source_remove (probe_id);
+  probe_id = 0;
+
+  for (kind = XFSM_STATS_LOOP; kind <= XFSM_STATS_LOOP_SPLASH; ++kind)
+    {
+      ring = &stats[kind];
+      for (n = 0, max = 0; n < MIN (ring->n_samples, STATS_SAMPLES); ++n)
+        max = MAX (max, ring->samples[n]);
+
+      if (ring->n_samples > 0)
+        {
+          xfsm_verbose ("Main loop latency (%s): %u samples, max %" G_GINT64_FORMAT " us\n",
+                        kind_names[kind], ring->n_samples, max);
+        }
+    }
+}
+
+
+static gint
+xfsm_stats_compare (gconstpointer a,
+                    gconstpointer b)
+{
+  gint64 da = *(const gint64 *) a;
+  gint64 db = *(const gint64 *) b;
+
+  return da < db ? -1 : (da > db ? 1 : 0);
+}
+
+
+static void
+xfsm_stats_value_free (gpointer data)
+{
+  GValue *value = data;
+
+  g_value_unset (value);
+  g_free (value);
+}
+
+
+static void
+xfsm_stats_insert_uint64 (GHashTable  *dict,
+                          const gchar *prefix,
+                          const gchar *name,
+                          guint64      number)
+{
+  GValue *value;
+
+  value = g_new0 (GValue, 1);
+  g_value_init (value, G_TYPE_UINT64);
+  g_value_set_uint64 (value, number);
+
+  if (prefix != NULL)
+    g_hash_table_insert (dict, g_strconcat (prefix, "-", name, NULL), value);
+  else
+    g_hash_table_insert (dict, g_strdup (name), value);
+}
+
+
+GHashTable *
+xfsm_stats_to_dbus (void)
+{
+  static const guint percentiles[] = { 50, 90, 99 };
+  XfsmStatsRing     *ring;
+  GHashTable        *dict;
+  gint64             sorted[STATS_SAMPLES];
+  gchar              name[8];
+  guint              kind;
+  guint              n;
+  guint              i;
+#ifdef HAVE_SYS_RESOURCE_H
+  struct rusage      usage;
+#endif
+
+  dict = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+                                xfsm_stats_value_free);
+
+  for (kind = 0; kind < XFSM_STATS_N_KINDS; ++kind)
+    {
+      ring = &stats[kind];
+      n = MIN (ring->n_samples, STATS_SAMPLES);
+
+      xfsm_stats_insert_uint64 (dict, kind_names[kind], "count", ring->n_samples);
+      if (n == 0)
+        continue;
+
+      memcpy (sorted, ring->samples, n * sizeof (gint64));
+      qsort (sorted, n, sizeof (gint64), xfsm_stats_compare);
+
+      for (i = 0; i < G_N_ELEMENTS (percentiles); ++i)
+        {
+          g_snprintf (name, sizeof (name), "p%u", percentiles[i]);
+          xfsm_stats_insert_uint64 (dict, kind_names[kind], name,
+                                    sorted[(n - 1) * percentiles[i] / 100]);
+        }
+      xfsm_stats_insert_uint64 (dict, kind_names[kind], "max", sorted[n - 1]);
+    }
+
+#ifdef HAVE_SYS_RESOURCE_H
+  if (getrusage (RUSAGE_SELF, &usage) == 0)
+    {
+      xfsm_stats_insert_uint64 (dict, NULL, "cpu-time",
+                                (guint64) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * G_USEC_PER_SEC
+                                + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+      xfsm_stats_insert_uint64 (dict, NULL, "max-rss", usage.ru_maxrss);
+    }
+#endif
+
+  return dict;
+}
@@ -0,0 +1,49 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_STATS_H__
+#define __XFSM_STATS_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+/* protocol paths whose duration is recorded */
+typedef enum
+{
+  XFSM_STATS_REGISTER = 0,  /* ICE connect until RegisterClientReply */
+  XFSM_STATS_CHECKPOINT,    /* SaveYourself until all clients are done */
+  XFSM_STATS_SHUTDOWN,      /* logout until Die is sent to the clients */
+  XFSM_STATS_LOOP,          /* main loop dispatch delay during startup */
+  XFSM_STATS_LOOP_SPLASH,   /* the same while the splash screen is up */
+  XFSM_STATS_N_KINDS,
+} XfsmStatsKind;
+
+void        xfsm_stats_record      (XfsmStatsKind kind,
+                                    gint64        duration);
+
+void        xfsm_stats_probe_start (void);
+void        xfsm_stats_probe_stop  (void);
+
+GHashTable *xfsm_stats_to_dbus     (void);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_STATS_H__ */
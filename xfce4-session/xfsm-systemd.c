@@ -27,6 +27,7 @@
 #endif
 
 #include <libxfsm/xfsm-util.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <xfce4-session/xfsm-systemd.h>
 
 
@@ -109,11 +110,11 @@ xfsm_systemd_finalize (GObject *object)
 static gboolean
 xfsm_systemd_lock_screen (GError **error)
 {
-  XfconfChannel *channel;
+  XfsmSettings  *settings;
   gboolean       ret = TRUE;
 
-  channel = xfsm_open_config ();
-  if (xfconf_channel_get_bool (channel, "/shutdown/LockScreen", FALSE))
+  settings = xfsm_settings_get ();
+  if (xfsm_settings_get_bool (settings, "/shutdown/LockScreen", FALSE))
       ret = g_spawn_command_line_async ("xflock4", error);
 
   return ret;
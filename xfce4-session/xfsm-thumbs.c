@@ -0,0 +1,482 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Session thumbnails of one display, kept in a single atlas file
+ * (sessions/thumbs-<display>.atlas) instead of one PNG per session.
+ *
+ * Layout (native byte order):
+ *
+ *   ThumbsHeader
+ *   ThumbsEntry[THUMBS_SLOTS]    the index, an empty name marks a free slot
+ *   guint32[SIZE * SIZE] per slot, premultiplied ARGB, SIZE pixels per row
+ *
+ * Every slot has a fixed offset, so the logout path rewrites the pixels
+ * and the index entry of one session in place and the chooser maps the
+ * file once and looks each session up through a hash table.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <glib/gstdio.h>
+
+#include <libxfce4util/libxfce4util.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-thumbs.h>
+
+#define THUMBS_MAGIC      0x42544658 /* "XFTB" */
+#define THUMBS_VERSION    1
+#define THUMBS_SLOTS      64
+#define THUMBS_NAME_SIZE  120
+#define THUMBS_SLOT_SIZE  (XFSM_THUMBS_SIZE * XFSM_THUMBS_SIZE * sizeof (guint32))
+#define THUMBS_PIXELS     (sizeof (ThumbsHeader) + THUMBS_SLOTS * sizeof (ThumbsEntry))
+
+
+typedef struct
+{
+  guint32 magic;
+  guint32 version;
+  guint32 size;
+  guint32 n_slots;
+} ThumbsHeader;
+
+typedef struct
+{
+  gchar   name[THUMBS_NAME_SIZE];
+  guint16 width;
+  guint16 height;
+  guint32 stamp;       /* time of the store, the oldest slot is reused */
+} ThumbsEntry;
+
+
+struct _XfsmThumbs
+{
+  GMappedFile       *file;
+  const gchar       *data;
+  gsize              size;
+  const ThumbsEntry *entries;
+  GHashTable        *index;    /* session name -> ThumbsEntry */
+};
+
+
+gchar *
+xfsm_thumbs_get_filename (const gchar *display_name)
+{
+  gchar *resource;
+  gchar *filename;
+
+  resource = g_strconcat ("sessions/thumbs-", display_name, ".atlas", NULL);
+  filename = xfce_resource_save_location (XFCE_RESOURCE_CACHE, resource, TRUE);
+  g_free (resource);
+
+  return filename;
+}
+
+
+static gboolean
+xfsm_thumbs_header_valid (const ThumbsHeader *header)
+{
+  return header->magic == THUMBS_MAGIC
+    && header->version == THUMBS_VERSION
+    && header->size == XFSM_THUMBS_SIZE
+    && header->n_slots == THUMBS_SLOTS;
+}
+
+
+static gboolean
+xfsm_thumbs_entry_valid (const ThumbsEntry *entry)
+{
+  return entry->name[0] != '\0'
+    && entry->name[THUMBS_NAME_SIZE - 1] == '\0'
+    && entry->width > 0 && entry->width <= XFSM_THUMBS_SIZE
+    && entry->height > 0 && entry->height <= XFSM_THUMBS_SIZE;
+}
+
+
+XfsmThumbs *
+xfsm_thumbs_open (const gchar *filename)
+{
+  XfsmThumbs        *thumbs;
+  const ThumbsEntry *entry;
+  GMappedFile       *file;
+  gsize              size;
+  guint              n;
+
+  g_return_val_if_fail (filename != NULL, NULL);
+
+  file = g_mapped_file_new (filename, FALSE, NULL);
+  if (file == NULL)
+    {
+      xfsm_verbose ("No thumbnail atlas %s\n", filename);
+      return NULL;
+    }
+
+  size = g_mapped_file_get_length (file);
+  if (size < THUMBS_PIXELS
+      || !xfsm_thumbs_header_valid ((const ThumbsHeader *) g_mapped_file_get_contents (file)))
+    {
+      xfsm_verbose ("Ignoring invalid thumbnail atlas %s\n", filename);
+      g_mapped_file_unref (file);
+      return NULL;
+    }
+
+  thumbs = g_slice_new0 (XfsmThumbs);
+  thumbs->file = file;
+  thumbs->data = g_mapped_file_get_contents (file);
+  thumbs->size = size;
+  thumbs->entries = (const ThumbsEntry *) (thumbs->data + sizeof (ThumbsHeader));
+  thumbs->index = g_hash_table_new (g_str_hash, g_str_equal);
+
+  /* the names point into the mapped file */
+  for (n = 0; n < THUMBS_SLOTS; ++n)
+    {
+      entry = thumbs->entries + n;
+      if (xfsm_thumbs_entry_valid (entry)
+          && THUMBS_PIXELS + (n + 1) * THUMBS_SLOT_SIZE <= size)
+        g_hash_table_insert (thumbs->index, (gpointer) entry->name, (gpointer) entry);
+    }
+
+  return thumbs;
+}
+
+
+void
+xfsm_thumbs_close (XfsmThumbs *thumbs)
+{
+  if (thumbs == NULL)
+    return;
+
+  g_hash_table_destroy (thumbs->index);
+  g_mapped_file_unref (thumbs->file);
+  g_slice_free (XfsmThumbs, thumbs);
+}
+
+
+GdkPixbuf *
+xfsm_thumbs_lookup (XfsmThumbs  *thumbs,
+                    const gchar *session_name)
+{
+  const ThumbsEntry *entry;
+  const guint32     *src;
+  GdkPixbuf         *pixbuf;
+  guchar            *dst;
+  guint32            pixel;
+  guint              alpha;
+  gint               rowstride;
+  gint               x, y;
+
+  g_return_val_if_fail (thumbs != NULL, NULL);
+  g_return_val_if_fail (session_name != NULL, NULL);
+
+  entry = g_hash_table_lookup (thumbs->index, session_name);
+  if (entry == NULL)
+    return NULL;
+
+  pixbuf = gdk_pixbuf_new (GDK_COLORSPACE_RGB, TRUE, 8, entry->width, entry->height);
+  if (G_UNLIKELY (pixbuf == NULL))
+    return NULL;
+
+  src = (const guint32 *) (thumbs->data + THUMBS_PIXELS
+                           + (entry - thumbs->entries) * THUMBS_SLOT_SIZE);
+  rowstride = gdk_pixbuf_get_rowstride (pixbuf);
+
+  for (y = 0; y < entry->height; y++)
+    {
+      dst = gdk_pixbuf_get_pixels (pixbuf) + y * rowstride;
+      for (x = 0; x < entry->width; x++, dst += 4)
+        {
+          pixel = src[y * XFSM_THUMBS_SIZE + x];
+          alpha = pixel >> 24;
+
+          if (alpha == 0)
+            {
+              dst[0] = dst[1] = dst[2] = dst[3] = 0;
+              continue;
+            }
+
+          dst[0] = (((pixel >> 16) & 0xff) * 255 + alpha / 2) / alpha;
+          dst[1] = (((pixel >> 8) & 0xff) * 255 + alpha / 2) / alpha;
+          dst[2] = ((pixel & 0xff) * 255 + alpha / 2) / alpha;
+          dst[3] = alpha;
+        }
+    }
+
+  return pixbuf;
+}
+
+
+static gboolean
+xfsm_thumbs_pwrite (gint           fd,
+                    gconstpointer  data,
+                    gsize          length,
+                    goffset        offset,
+                    GError       **error)
+{
+  const gchar *p = data;
+  gssize       n;
+
+  while (length > 0)
+    {
+      n = pwrite (fd, p, length, offset);
+      if (n < 0)
+        {
+          if (errno == EINTR)
+            continue;
+
+          g_set_error (error, G_FILE_ERROR, g_file_error_from_errno (errno),
+                       "%s", g_strerror (errno));
+          return FALSE;
+        }
+
+      p += n;
+      length -= n;
+      offset += n;
+    }
+
+  return TRUE;
+}
+
+
+/* reads header and index, FALSE if the file is new or unusable */
+static gboolean
+xfsm_thumbs_read_index (gint         fd,
+                        ThumbsEntry *entries)
+{
+  ThumbsHeader header;
+
+  if (pread (fd, &header, sizeof (header), 0) != sizeof (header)
+      || !xfsm_thumbs_header_valid (&header))
+    return FALSE;
+
+  return pread (fd, entries, THUMBS_SLOTS * sizeof (ThumbsEntry), sizeof (header))
+    == THUMBS_SLOTS * sizeof (ThumbsEntry);
+}
+
+
+/* stores @thumb as the thumbnail of @session_name, only the pixels and
+ * the index entry of its slot are written. safe to call from a thread. */
+gboolean
+xfsm_thumbs_store (const gchar  *filename,
+                   const gchar  *session_name,
+                   GdkPixbuf    *thumb,
+                   GError      **error)
+{
+  ThumbsHeader  header;
+  ThumbsEntry  *entries;
+  ThumbsEntry  *entry;
+  const guchar *src;
+  guint32      *pixels;
+  gboolean      succeed = FALSE;
+  gint          width, height, n_channels, rowstride;
+  guint         r, g, b, a;
+  gint          x, y;
+  gint          fd;
+  guint         n, slot;
+
+  g_return_val_if_fail (filename != NULL, FALSE);
+  g_return_val_if_fail (session_name != NULL, FALSE);
+  g_return_val_if_fail (GDK_IS_PIXBUF (thumb), FALSE);
+
+  width = gdk_pixbuf_get_width (thumb);
+  height = gdk_pixbuf_get_height (thumb);
+  g_return_val_if_fail (width <= XFSM_THUMBS_SIZE && height <= XFSM_THUMBS_SIZE, FALSE);
+
+  if (strlen (session_name) >= THUMBS_NAME_SIZE)
+    {
+      g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_NAMETOOLONG,
+                   "Session name \"%s\" is too long for the thumbnail atlas",
+                   session_name);
+      return FALSE;
+    }
+
+  fd = g_open (filename, O_RDWR | O_CREAT, 0600);
+  if (fd < 0)
+    {
+      g_set_error (error, G_FILE_ERROR, g_file_error_from_errno (errno),
+                   "Failed to open %s: %s", filename, g_strerror (errno));
+      return FALSE;
+    }
+
+  entries = g_new0 (ThumbsEntry, THUMBS_SLOTS);
+  pixels = g_new0 (guint32, XFSM_THUMBS_SIZE * XFSM_THUMBS_SIZE);
+
+  if (!xfsm_thumbs_read_index (fd, entries))
+    {
+      /* start a new atlas */
+      memset (entries, 0, THUMBS_SLOTS * sizeof (ThumbsEntry));
+      header.magic = THUMBS_MAGIC;
+      header.version = THUMBS_VERSION;
+      header.size = XFSM_THUMBS_SIZE;
+      header.n_slots = THUMBS_SLOTS;
+
+      if (ftruncate (fd, 0) != 0
+          || !xfsm_thumbs_pwrite (fd, &header, sizeof (header), 0, error)
+          || !xfsm_thumbs_pwrite (fd, entries, THUMBS_SLOTS * sizeof (ThumbsEntry),
+                                  sizeof (header), error))
+        goto out;
+    }
+
+  /* the slot of the session, else a free one, else the oldest */
+  slot = THUMBS_SLOTS;
+  for (n = 0; n < THUMBS_SLOTS; ++n)
+    {
+      if (strncmp (entries[n].name, session_name, THUMBS_NAME_SIZE) == 0)
+        {
+          slot = n;
+          break;
+        }
+
+      if (slot == THUMBS_SLOTS
+          || (entries[slot].name[0] != '\0'
+              && (entries[n].name[0] == '\0' || entries[n].stamp < entries[slot].stamp)))
+        slot = n;
+    }
+
+  entry = entries + slot;
+
+  /* drop the slot from the index while its pixels are rewritten */
+  if (entry->name[0] != '\0')
+    {
+      memset (entry, 0, sizeof (ThumbsEntry));
+      if (!xfsm_thumbs_pwrite (fd, entry, sizeof (ThumbsEntry),
+                               sizeof (ThumbsHeader) + slot * sizeof (ThumbsEntry), error))
+        goto out;
+    }
+
+  n_channels = gdk_pixbuf_get_n_channels (thumb);
+  rowstride = gdk_pixbuf_get_rowstride (thumb);
+
+  for (y = 0; y < height; y++)
+    {
+      src = gdk_pixbuf_get_pixels (thumb) + y * rowstride;
+      for (x = 0; x < width; x++, src += n_channels)
+        {
+          a = gdk_pixbuf_get_has_alpha (thumb) ? src[3] : 0xff;
+          r = (src[0] * a + 127) / 255;
+          g = (src[1] * a + 127) / 255;
+          b = (src[2] * a + 127) / 255;
+          pixels[y * XFSM_THUMBS_SIZE + x] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+
+  if (!xfsm_thumbs_pwrite (fd, pixels, THUMBS_SLOT_SIZE,
+                           THUMBS_PIXELS + slot * THUMBS_SLOT_SIZE, error))
+    goto out;
+
+  g_strlcpy (entry->name, session_name, THUMBS_NAME_SIZE);
+  entry->width = width;
+  entry->height = height;
+  entry->stamp = time (NULL);
+
+  succeed = xfsm_thumbs_pwrite (fd, entry, sizeof (ThumbsEntry),
+                                sizeof (ThumbsHeader) + slot * sizeof (ThumbsEntry), error);
+
+out:
+  if (!succeed && error != NULL && *error == NULL)
+    g_set_error (error, G_FILE_ERROR, g_file_error_from_errno (errno),
+                 "Failed to write %s: %s", filename, g_strerror (errno));
+
+  close (fd);
+  g_free (pixels);
+  g_free (entries);
+
+  return succeed;
+}
+
+
+static gboolean
+xfsm_thumbs_has_name (gchar       **session_names,
+                      const gchar  *name)
+{
+  guint n;
+
+  for (n = 0; session_names[n] != NULL; ++n)
+    if (strcmp (session_names[n], name) == 0)
+      return TRUE;
+
+  return FALSE;
+}
+
+
+/* frees the slots of all sessions not in @session_names */
+void
+xfsm_thumbs_prune (const gchar  *filename,
+                   gchar       **session_names)
+{
+  ThumbsEntry *entries;
+  GError      *error = NULL;
+  guint        n;
+  gint         fd;
+
+  g_return_if_fail (filename != NULL);
+  g_return_if_fail (session_names != NULL);
+
+  fd = g_open (filename, O_RDWR, 0);
+  if (fd < 0)
+    return;
+
+  entries = g_new0 (ThumbsEntry, THUMBS_SLOTS);
+
+  if (xfsm_thumbs_read_index (fd, entries))
+    {
+      for (n = 0; n < THUMBS_SLOTS && error == NULL; ++n)
+        {
+          if (entries[n].name[0] == '\0'
+              || (entries[n].name[THUMBS_NAME_SIZE - 1] == '\0'
+                  && xfsm_thumbs_has_name (session_names, entries[n].name)))
+            continue;
+
+          xfsm_verbose ("Pruning the thumbnail of session \"%.*s\"\n",
+                        THUMBS_NAME_SIZE, entries[n].name);
+
+          memset (entries + n, 0, sizeof (ThumbsEntry));
+          xfsm_thumbs_pwrite (fd, entries + n, sizeof (ThumbsEntry),
+                              sizeof (ThumbsHeader) + n * sizeof (ThumbsEntry), &error);
+        }
+    }
+
+  if (G_UNLIKELY (error != NULL))
+    {
+      g_warning ("Failed to prune the thumbnail atlas %s: %s", filename, error->message);
+      g_error_free (error);
+    }
+
+  close (fd);
+  g_free (entries);
+}
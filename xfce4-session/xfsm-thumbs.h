@@ -0,0 +1,51 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_THUMBS_H__
+#define __XFSM_THUMBS_H__
+
+#include <gdk-pixbuf/gdk-pixbuf.h>
+
+G_BEGIN_DECLS;
+
+/* maximum width and height of a session thumbnail */
+#define XFSM_THUMBS_SIZE 64
+
+typedef struct _XfsmThumbs XfsmThumbs;
+
+gchar      *xfsm_thumbs_get_filename (const gchar  *display_name);
+
+XfsmThumbs *xfsm_thumbs_open         (const gchar  *filename);
+void        xfsm_thumbs_close        (XfsmThumbs   *thumbs);
+
+GdkPixbuf  *xfsm_thumbs_lookup       (XfsmThumbs   *thumbs,
+                                      const gchar  *session_name);
+
+gboolean    xfsm_thumbs_store        (const gchar  *filename,
+                                      const gchar  *session_name,
+                                      GdkPixbuf    *thumb,
+                                      GError      **error);
+
+void        xfsm_thumbs_prune        (const gchar  *filename,
+                                      gchar       **session_names);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_THUMBS_H__ */
@@ -0,0 +1,347 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+/*
+ * Records when each session client was spawned, connected, registered,
+ * finished its initial local save and mapped its first window, and
+ * exports the result as Chrome trace-event JSON (chrome://tracing).
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include <libxfce4util/libxfce4util.h>
+
+#include <xfce4-session/xfsm-global.h>
+#include <xfce4-session/xfsm-trace.h>
+#include <xfce4-session/xfsm-wnck.h>
+
+/* keep watching for windows for a while after startup finished,
+ * clients usually map their windows after registering */
+#define TRACE_WINDOW_TIMEOUT  (10 * 1000)
+
+
+typedef struct
+{
+  gchar  *client_id;
+  gchar  *program;
+  GPid    pid;
+  gint64  marks[XFSM_TRACE_N_MARKS];
+} XfsmTraceEntry;
+
+
+static const gchar *mark_names[XFSM_TRACE_N_MARKS] =
+{
+  "spawn",
+  "connect",
+  "register",
+  "save-local",
+  "window-mapped",
+};
+
+static gboolean    trace_active = FALSE;
+static gint64      trace_origin = 0;
+static gint64      trace_startup_done = 0;
+static GHashTable *trace_entries = NULL;
+static GPtrArray  *trace_order = NULL;
+static guint       trace_finish_id = 0;
+
+
+static void xfsm_trace_window_opened (const XfsmWnckWindowInfo *info,
+                                      gpointer                  user_data);
+
+
+static void
+xfsm_trace_entry_free (XfsmTraceEntry *entry)
+{
+  g_free (entry->client_id);
+  g_free (entry->program);
+  g_slice_free (XfsmTraceEntry, entry);
+}
+
+
+void
+xfsm_trace_init (void)
+{
+  g_return_if_fail (trace_entries == NULL);
+
+  trace_origin = g_get_monotonic_time ();
+  trace_entries = g_hash_table_new (g_str_hash, g_str_equal);
+  trace_order = g_ptr_array_new_with_free_func ((GDestroyNotify) xfsm_trace_entry_free);
+  trace_active = TRUE;
+
+  xfsm_wnck_watch_windows (xfsm_trace_window_opened, NULL);
+}
+
+
+static XfsmTraceEntry *
+xfsm_trace_lookup (const gchar *client_id)
+{
+  XfsmTraceEntry *entry;
+
+  entry = g_hash_table_lookup (trace_entries, client_id);
+  if (entry == NULL)
+    {
+      entry = g_slice_new0 (XfsmTraceEntry);
+      entry->client_id = g_strdup (client_id);
+      entry->pid = -1;
+      g_hash_table_insert (trace_entries, entry->client_id, entry);
+      g_ptr_array_add (trace_order, entry);
+    }
+
+  return entry;
+}
+
+
+void
+xfsm_trace_mark (const gchar  *client_id,
+                 XfsmTraceMark mark)
+{
+  xfsm_trace_mark_full (client_id, NULL, -1, mark, 0);
+}
+
+
+void
+xfsm_trace_mark_full (const gchar  *client_id,
+                      const gchar  *program,
+                      GPid          pid,
+                      XfsmTraceMark mark,
+                      gint64        timestamp)
+{
+  XfsmTraceEntry *entry;
+
+  g_return_if_fail (mark < XFSM_TRACE_N_MARKS);
+
+  if (!trace_active || client_id == NULL)
+    return;
+
+  entry = xfsm_trace_lookup (client_id);
+
+  if (program != NULL && entry->program == NULL)
+    entry->program = g_path_get_basename (program);
+  if (pid > 0 && entry->pid <= 0)
+    entry->pid = pid;
+
+  /* only the first occurrence of every mark is interesting */
+  if (entry->marks[mark] == 0)
+    {
+      entry->marks[mark] = timestamp > 0 ? timestamp : g_get_monotonic_time ();
+
+      xfsm_verbose ("Trace: client %s %s at %" G_GINT64_FORMAT " us\n",
+                    client_id, mark_names[mark],
+                    entry->marks[mark] - trace_origin);
+    }
+}
+
+
+static void
+xfsm_trace_window_opened (const XfsmWnckWindowInfo *info,
+                          gpointer                  user_data)
+{
+  XfsmTraceEntry *entry = NULL;
+  guint           n;
+
+  /* the client leader carries the SM client id, fall back to the pid
+   * for clients that don't set it */
+  if (info->session_id != NULL)
+    entry = g_hash_table_lookup (trace_entries, info->session_id);
+
+  if (entry == NULL)
+    {
+      for (n = 0; info->pid > 0 && n < trace_order->len; ++n)
+        if (((XfsmTraceEntry *) g_ptr_array_index (trace_order, n))->pid == info->pid)
+          {
+            entry = g_ptr_array_index (trace_order, n);
+            break;
+          }
+    }
+
+  if (entry != NULL)
+    xfsm_trace_mark (entry->client_id, XFSM_TRACE_WINDOW_MAPPED);
+}
+
+
+static void
+xfsm_trace_write (void)
+{
+  GError     *error = NULL;
+  gchar      *display_name;
+  gchar      *resource;
+  gchar      *filename;
+  gchar      *json;
+
+  display_name = xfsm_get_display_name ();
+  resource = g_strconcat ("sessions/startup-trace-", display_name, ".json", NULL);
+  filename = xfce_resource_save_location (XFCE_RESOURCE_CACHE, resource, TRUE);
+  g_free (display_name);
+  g_free (resource);
+
+  if (G_LIKELY (filename != NULL))
+    {
+      json = xfsm_trace_to_json ();
+      if (!g_file_set_contents (filename, json, -1, &error))
+        {
+          g_warning ("Unable to write startup trace %s: %s", filename, error->message);
+          g_error_free (error);
+        }
+      g_free (json);
+    }
+
+  g_free (filename);
+}
+
+
+static gboolean
+xfsm_trace_finish (gpointer user_data)
+{
+  trace_finish_id = 0;
+  trace_active = FALSE;
+
+  xfsm_wnck_unwatch_windows (xfsm_trace_window_opened, NULL);
+
+  xfsm_trace_write ();
+
+  return FALSE;
+}
+
+
+void
+xfsm_trace_startup_done (void)
+{
+  if (!trace_active || trace_startup_done != 0)
+    return;
+
+  trace_startup_done = g_get_monotonic_time ();
+
+  trace_finish_id = g_timeout_add (TRACE_WINDOW_TIMEOUT, xfsm_trace_finish, NULL);
+}
+
+
+static void
+xfsm_trace_append_string (GString     *json,
+                          const gchar *str)
+{
+  const gchar *p;
+
+  g_string_append_c (json, '"');
+  for (p = str; p != NULL && *p != '\0'; ++p)
+    {
+      if (*p == '"' || *p == '\\')
+        g_string_append_printf (json, "\\%c", *p);
+      else if ((guchar) *p < 0x20)
+        g_string_append_printf (json, "\\u%04x", (guint) *p);
+      else
+        g_string_append_c (json, *p);
+    }
+  g_string_append_c (json, '"');
+}
+
+
+static void
+xfsm_trace_append_event (GString     *json,
+                         const gchar *name,
+                         const gchar *phase,
+                         gint64       timestamp,
+                         gint64       duration,
+                         guint        tid)
+{
+  if (json->str[json->len - 1] != '[')
+    g_string_append (json, ",\n");
+
+  g_string_append (json, "{\"name\":");
+  xfsm_trace_append_string (json, name);
+  g_string_append_printf (json, ",\"cat\":\"startup\",\"ph\":\"%s\","
+                          "\"ts\":%" G_GINT64_FORMAT ",\"pid\":1,\"tid\":%u",
+                          phase, timestamp - trace_origin, tid);
+  if (*phase == 'X')
+    g_string_append_printf (json, ",\"dur\":%" G_GINT64_FORMAT, duration);
+  else if (*phase == 'i')
+    g_string_append (json, tid == 0 ? ",\"s\":\"g\"" : ",\"s\":\"t\"");
+}
+
+
+gchar *
+xfsm_trace_to_json (void)
+{
+  XfsmTraceEntry *entry;
+  GString        *json;
+  gint64          first, last;
+  guint           n;
+  gint            m;
+
+  json = g_string_new ("{\"traceEvents\":[");
+
+  if (G_UNLIKELY (trace_order == NULL))
+    {
+      g_string_append (json, "]}\n");
+      return g_string_free (json, FALSE);
+    }
+
+  xfsm_trace_append_event (json, "session-start", "i", trace_origin, 0, 0);
+  g_string_append (json, "}");
+
+  for (n = 0; n < trace_order->len; ++n)
+    {
+      entry = g_ptr_array_index (trace_order, n);
+
+      /* one complete event spanning the client's whole startup ... */
+      first = last = 0;
+      for (m = 0; m < XFSM_TRACE_N_MARKS; ++m)
+        {
+          if (entry->marks[m] == 0)
+            continue;
+          if (first == 0 || entry->marks[m] < first)
+            first = entry->marks[m];
+          if (entry->marks[m] > last)
+            last = entry->marks[m];
+        }
+
+      xfsm_trace_append_event (json,
+                               entry->program != NULL ? entry->program : entry->client_id,
+                               "X", first, last - first, n + 1);
+      g_string_append (json, ",\"args\":{\"client_id\":");
+      xfsm_trace_append_string (json, entry->client_id);
+      g_string_append_printf (json, ",\"pid\":%d}}", (gint) entry->pid);
+
+      /* ... and an instant event for every mark */
+      for (m = 0; m < XFSM_TRACE_N_MARKS; ++m)
+        {
+          if (entry->marks[m] == 0)
+            continue;
+          xfsm_trace_append_event (json, mark_names[m], "i", entry->marks[m], 0, n + 1);
+          g_string_append (json, "}");
+        }
+    }
+
+  if (trace_startup_done != 0)
+    {
+      xfsm_trace_append_event (json, "startup-done", "i", trace_startup_done, 0, 0);
+      g_string_append (json, "}");
+    }
+
+  g_string_append (json, "]}\n");
+
+  return g_string_free (json, FALSE);
+}
@@ -0,0 +1,55 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_TRACE_H__
+#define __XFSM_TRACE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+/* points in the life of a session client recorded during startup */
+typedef enum
+{
+  XFSM_TRACE_SPAWN = 0,
+  XFSM_TRACE_CONNECT,
+  XFSM_TRACE_REGISTER,
+  XFSM_TRACE_SAVE_LOCAL,
+  XFSM_TRACE_WINDOW_MAPPED,
+  XFSM_TRACE_N_MARKS,
+} XfsmTraceMark;
+
+void   xfsm_trace_init         (void);
+
+void   xfsm_trace_mark         (const gchar  *client_id,
+                                XfsmTraceMark mark);
+void   xfsm_trace_mark_full    (const gchar  *client_id,
+                                const gchar  *program,
+                                GPid          pid,
+                                XfsmTraceMark mark,
+                                gint64        timestamp);
+
+void   xfsm_trace_startup_done (void);
+
+gchar *xfsm_trace_to_json      (void);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_TRACE_H__ */
@@ -26,6 +26,7 @@
 #endif /* HAVE_UPOWER */
 
 #include <libxfsm/xfsm-util.h>
+#include <xfce4-session/xfsm-settings.h>
 #include <xfce4-session/xfsm-upower.h>
 
 
@@ -291,13 +292,13 @@ xfsm_upower_lock_screen (XfsmUPower   *upower,
                          const gchar  *sleep_kind,
                          GError      **error)
 {
-  XfconfChannel *channel;
+  XfsmSettings  *settings;
   gboolean       ret = TRUE;
 
   g_return_val_if_fail (sleep_kind != NULL, FALSE);
 
-  channel = xfsm_open_config ();
-  if (xfconf_channel_get_bool (channel, "/shutdown/LockScreen", FALSE))
+  settings = xfsm_settings_get ();
+  if (xfsm_settings_get_bool (settings, "/shutdown/LockScreen", FALSE))
     {
       if (xfsm_upower_proxy_ensure (upower, error))
         {
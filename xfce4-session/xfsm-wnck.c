@@ -0,0 +1,331 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+
+#include <gdk/gdk.h>
+#include <gdk/gdkx.h>
+
+#include <libwnck/libwnck.h>
+
+#include <xfce4-session/xfsm-wnck.h>
+
+/* the stub backend pretends to manage a single screen */
+#define STUB_WORKSPACE_COUNT 4
+
+
+typedef struct
+{
+  XfsmWnckWindowFunc func;
+  gpointer           user_data;
+} XfsmWnckWatch;
+
+
+static gint real_get_n_screens        (void);
+static gint real_get_workspace_count  (gint               screen_num);
+static gint real_get_active_workspace (gint               screen_num);
+static void real_activate_workspace   (gint               screen_num,
+                                       gint               workspace);
+static void real_watch_windows        (XfsmWnckWindowFunc func,
+                                       gpointer           user_data);
+static void real_unwatch_windows      (XfsmWnckWindowFunc func,
+                                       gpointer           user_data);
+
+static gint stub_get_n_screens        (void);
+static gint stub_get_workspace_count  (gint               screen_num);
+static gint stub_get_active_workspace (gint               screen_num);
+static void stub_activate_workspace   (gint               screen_num,
+                                       gint               workspace);
+static void stub_watch_windows        (XfsmWnckWindowFunc func,
+                                       gpointer           user_data);
+
+
+static const XfsmWnckBackend real_backend =
+{
+  real_get_n_screens,
+  real_get_workspace_count,
+  real_get_active_workspace,
+  real_activate_workspace,
+  real_watch_windows,
+  real_unwatch_windows,
+};
+
+static const XfsmWnckBackend stub_backend =
+{
+  stub_get_n_screens,
+  stub_get_workspace_count,
+  stub_get_active_workspace,
+  stub_activate_workspace,
+  stub_watch_windows,
+  stub_watch_windows,
+};
+
+static const XfsmWnckBackend *backend = &real_backend;
+static GSList                *real_watches = NULL;
+static gint                   stub_active_workspace = 0;
+
+
+void
+xfsm_wnck_set_backend (const XfsmWnckBackend *new_backend)
+{
+  g_return_if_fail (new_backend != NULL);
+  backend = new_backend;
+}
+
+
+const XfsmWnckBackend *
+xfsm_wnck_get_stub_backend (void)
+{
+  return &stub_backend;
+}
+
+
+gint
+xfsm_wnck_get_n_screens (void)
+{
+  return backend->get_n_screens ();
+}
+
+
+gint
+xfsm_wnck_get_workspace_count (gint screen_num)
+{
+  return backend->get_workspace_count (screen_num);
+}
+
+
+gint
+xfsm_wnck_get_active_workspace (gint screen_num)
+{
+  return backend->get_active_workspace (screen_num);
+}
+
+
+void
+xfsm_wnck_activate_workspace (gint screen_num,
+                              gint workspace)
+{
+  backend->activate_workspace (screen_num, workspace);
+}
+
+
+void
+xfsm_wnck_watch_windows (XfsmWnckWindowFunc func,
+                         gpointer           user_data)
+{
+  backend->watch_windows (func, user_data);
+}
+
+
+void
+xfsm_wnck_unwatch_windows (XfsmWnckWindowFunc func,
+                           gpointer           user_data)
+{
+  backend->unwatch_windows (func, user_data);
+}
+
+
+static WnckScreen *
+real_get_screen (gint screen_num)
+{
+  WnckScreen *screen;
+
+  screen = wnck_screen_get (screen_num);
+  wnck_screen_force_update (screen);
+
+  return screen;
+}
+
+
+static gint
+real_get_n_screens (void)
+{
+  return gdk_display_get_n_screens (gdk_display_get_default ());
+}
+
+
+static gint
+real_get_workspace_count (gint screen_num)
+{
+  return wnck_screen_get_workspace_count (real_get_screen (screen_num));
+}
+
+
+static gint
+real_get_active_workspace (gint screen_num)
+{
+  WnckWorkspace *workspace;
+
+  workspace = wnck_screen_get_active_workspace (real_get_screen (screen_num));
+  return workspace != NULL ? wnck_workspace_get_number (workspace) : -1;
+}
+
+
+static void
+real_activate_workspace (gint screen_num,
+                         gint workspace)
+{
+  WnckWorkspace *ws;
+
+  ws = wnck_screen_get_workspace (real_get_screen (screen_num), workspace);
+  if (G_LIKELY (ws != NULL))
+    wnck_workspace_activate (ws, GDK_CURRENT_TIME);
+}
+
+
+static void
+real_window_opened (WnckScreen    *screen,
+                    WnckWindow    *window,
+                    XfsmWnckWatch *watch)
+{
+  XfsmWnckWindowInfo info;
+  XClassHint         class_hint = { NULL, NULL };
+  Window             leader;
+  char             **argv;
+  int                argc;
+  int                n;
+
+  info.session_id = wnck_window_get_session_id (window);
+  info.pid = wnck_window_get_pid (window);
+  info.res_name = NULL;
+  info.res_class = NULL;
+  info.command = NULL;
+
+  /* libwnck doesn't tell WM_COMMAND, and WM_CLASS only in parts */
+  gdk_error_trap_push ();
+
+  if (XGetClassHint (gdk_display, wnck_window_get_xid (window), &class_hint))
+    {
+      info.res_name = class_hint.res_name;
+      info.res_class = class_hint.res_class;
+    }
+
+  leader = wnck_window_get_group_leader (window);
+  if (XGetCommand (gdk_display, leader != None ? leader : wnck_window_get_xid (window),
+                   &argv, &argc))
+    {
+      if (argc > 0)
+        {
+          info.command = g_new0 (gchar *, argc + 1);
+          for (n = 0; n < argc; ++n)
+            info.command[n] = g_strdup (argv[n]);
+        }
+      XFreeStringList (argv);
+    }
+
+  gdk_error_trap_pop ();
+
+  watch->func (&info, watch->user_data);
+
+  if (class_hint.res_name != NULL)
+    XFree (class_hint.res_name);
+  if (class_hint.res_class != NULL)
+    XFree (class_hint.res_class);
+  g_strfreev (info.command);
+}
+
+
+static void
+real_watch_windows (XfsmWnckWindowFunc func,
+                    gpointer           user_data)
+{
+  XfsmWnckWatch *watch;
+  gint           n;
+
+  watch = g_slice_new (XfsmWnckWatch);
+  watch->func = func;
+  watch->user_data = user_data;
+  real_watches = g_slist_prepend (real_watches, watch);
+
+  for (n = 0; n < real_get_n_screens (); ++n)
+    {
+      g_signal_connect (G_OBJECT (wnck_screen_get (n)), "window-opened",
+                        G_CALLBACK (real_window_opened), watch);
+    }
+}
+
+
+static void
+real_unwatch_windows (XfsmWnckWindowFunc func,
+                      gpointer           user_data)
+{
+  XfsmWnckWatch *watch;
+  GSList        *lp;
+  gint           n;
+
+  for (lp = real_watches; lp != NULL; lp = lp->next)
+    {
+      watch = lp->data;
+      if (watch->func != func || watch->user_data != user_data)
+        continue;
+
+      for (n = 0; n < real_get_n_screens (); ++n)
+        {
+          g_signal_handlers_disconnect_by_func (G_OBJECT (wnck_screen_get (n)),
+                                                real_window_opened, watch);
+        }
+
+      real_watches = g_slist_delete_link (real_watches, lp);
+      g_slice_free (XfsmWnckWatch, watch);
+      break;
+    }
+}
+
+
+static gint
+stub_get_n_screens (void)
+{
+  return 1;
+}
+
+
+static gint
+stub_get_workspace_count (gint screen_num)
+{
+  return STUB_WORKSPACE_COUNT;
+}
+
+
+static gint
+stub_get_active_workspace (gint screen_num)
+{
+  return stub_active_workspace;
+}
+
+
+static void
+stub_activate_workspace (gint screen_num,
+                         gint workspace)
+{
+  stub_active_workspace = workspace;
+}
+
+
+static void
+stub_watch_windows (XfsmWnckWindowFunc func,
+                    gpointer           user_data)
+{
+  /* no windows are ever opened */
+}
@@ -0,0 +1,72 @@
+/*-
+ * Copyright (c) 2026 The Xfce development team
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301 USA.
+ */
+
+#ifndef __XFSM_WNCK_H__
+#define __XFSM_WNCK_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS;
+
+/* a window that was opened */
+typedef struct
+{
+  const gchar  *session_id; /* SM_CLIENT_ID of its client leader */
+  gint          pid;        /* _NET_WM_PID */
+  const gchar  *res_name;   /* WM_CLASS */
+  const gchar  *res_class;
+  gchar       **command;    /* WM_COMMAND of its client leader */
+} XfsmWnckWindowInfo;
+
+typedef void (*XfsmWnckWindowFunc) (const XfsmWnckWindowInfo *info,
+                                    gpointer                  user_data);
+
+/* the window manager queries of the session manager, libwnck based
+ * by default, see xfsm_wnck_get_stub_backend() for headless mode */
+typedef struct
+{
+  gint (*get_n_screens)        (void);
+  gint (*get_workspace_count)  (gint               screen_num);
+  gint (*get_active_workspace) (gint               screen_num);
+  void (*activate_workspace)   (gint               screen_num,
+                                gint               workspace);
+  void (*watch_windows)        (XfsmWnckWindowFunc func,
+                                gpointer           user_data);
+  void (*unwatch_windows)      (XfsmWnckWindowFunc func,
+                                gpointer           user_data);
+} XfsmWnckBackend;
+
+void                   xfsm_wnck_set_backend          (const XfsmWnckBackend *backend);
+const XfsmWnckBackend *xfsm_wnck_get_stub_backend     (void);
+
+gint                   xfsm_wnck_get_n_screens        (void);
+gint                   xfsm_wnck_get_workspace_count  (gint                   screen_num);
+gint                   xfsm_wnck_get_active_workspace (gint                   screen_num);
+void                   xfsm_wnck_activate_workspace   (gint                   screen_num,
+                                                       gint                   workspace);
+
+void                   xfsm_wnck_watch_windows        (XfsmWnckWindowFunc     func,
+                                                       gpointer               user_data);
+void                   xfsm_wnck_unwatch_windows      (XfsmWnckWindowFunc     func,
+                                                       gpointer               user_data);
+
+G_END_DECLS;
+
+#endif /* !__XFSM_WNCK_H__ */